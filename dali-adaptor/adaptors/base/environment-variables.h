@@ -28,6 +28,26 @@ namespace Adaptor
 
 #define DALI_ENV_LOG_PERFORMANCE "DALI_LOG_PERFORMANCE"
 
+// The file the performance markers are written to in the trace-event format, when bit 3 of DALI_LOG_PERFORMANCE is set
+#define DALI_ENV_PERFORMANCE_TRACE_FILE "DALI_PERFORMANCE_TRACE_FILE"
+
+// The number of worker threads used to parallelize the update; zero (the default) disables them
+#define DALI_ENV_UPDATE_WORKER_THREADS "DALI_UPDATE_WORKER_THREADS"
+
+// Non-zero to triple-buffer the scene-graph, so the update-thread can run a frame further ahead of the render-thread;
+// needs dali-core built with --enable-triple-buffering
+#define DALI_ENV_TRIPLE_BUFFERING "DALI_TRIPLE_BUFFERING"
+
+// How the pan gesture properties are worked out: 0 uses the latest gesture, 1 averages it with the previous one,
+// 2 (the default) extrapolates it to the next render time
+#define DALI_ENV_PAN_PREDICTION_MODE "DALI_PAN_PREDICTION_MODE"
+
+// The milliseconds added to the next render time when extrapolating pan gestures
+#define DALI_ENV_PAN_PREDICTION_AMOUNT "DALI_PAN_PREDICTION_AMOUNT"
+
+// How much the pan gesture velocity is smoothed when extrapolating, as a percentage
+#define DALI_ENV_PAN_SMOOTHING_AMOUNT "DALI_PAN_SMOOTHING_AMOUNT"
+
 } // namespace Adaptor
 
 } // namespace Internal
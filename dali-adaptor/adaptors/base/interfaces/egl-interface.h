@@ -17,6 +17,9 @@
 // limitations under the License.
 //
 
+// EXTERNAL INCLUDES
+#include <dali/public-api/math/rect.h>
+
 namespace Dali
 {
 namespace Internal
@@ -65,6 +68,18 @@ public:
    */
   virtual void SwapBuffers() = 0;
 
+  /**
+   * Queries how many frames ago the contents of the back buffer were posted.
+   * @return The age of the back buffer, or zero if its contents are undefined
+   */
+  virtual unsigned int GetBufferAge() = 0;
+
+  /**
+   * Sets the area of the back buffer which was redrawn, to be posted by the next SwapBuffers().
+   * @param[in] area The redrawn area in window coordinates; an empty area means the whole buffer was redrawn
+   */
+  virtual void SetDamagedArea( const Rect<int>& area ) = 0;
+
   /**
    * Performs an OpenGL copy buffers command
    */
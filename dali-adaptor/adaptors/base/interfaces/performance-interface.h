@@ -48,6 +48,7 @@ public:
     LOG_UPDATE_RENDER    = 1 << 0, ///< Bit 0, log update and render times
     LOG_EVENT_PROCESS    = 1 << 1, ///< Bit 1, log event process times
     LOG_EVENTS_TO_KERNEL = 1 << 2, ///< Bit 2, log all events to kernel trace
+    LOG_TRACE_EVENTS     = 1 << 3, ///< Bit 3, write all markers to a trace-event file, see DALI_PERFORMANCE_TRACE_FILE
   };
 
   /**
@@ -67,6 +68,14 @@ public:
    */
   virtual void AddMarker( PerformanceMarker::MarkerType markerType) = 0;
 
+  /**
+   * Add a marker for the start or end of a named section, e.g. traced by Dali Core or Toolkit
+   * This function can be called from ANY THREAD.
+   * @param name the name of the section; a string literal
+   * @param start true for the start of the section, false for the end
+   */
+  virtual void AddCustomMarker( const char* name, bool start ) = 0;
+
   /**
    * Set the logging level and frequency
    * @param level 0 = disabled, 1 = enabled
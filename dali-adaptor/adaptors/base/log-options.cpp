@@ -28,6 +28,7 @@ LogOptions::LogOptions()
 : mFpsFrequency(0),
   mUpdateStatusFrequency(0),
   mPerformanceLoggingLevel(0),
+  mPerformanceTraceFile(),
   mLogFunction( NULL )
 {
 }
@@ -40,12 +41,14 @@ LogOptions::~LogOptions()
 void LogOptions::SetOptions( const Dali::Integration::Log::LogFunction& logFunction,
                              unsigned int logFrameRateFrequency,
                              unsigned int logupdateStatusFrequency,
-                             unsigned int logPerformanceLevel )
+                             unsigned int logPerformanceLevel,
+                             const std::string& performanceTraceFile )
 {
   mLogFunction = logFunction;
   mFpsFrequency = logFrameRateFrequency;
   mUpdateStatusFrequency = logupdateStatusFrequency;
   mPerformanceLoggingLevel = logPerformanceLevel;
+  mPerformanceTraceFile = performanceTraceFile;
 }
 
 void LogOptions::InstallLogFunction() const
@@ -73,6 +76,11 @@ unsigned int LogOptions::GetPerformanceLoggingLevel() const
   return mPerformanceLoggingLevel;
 }
 
+const std::string& LogOptions::GetPerformanceTraceFile() const
+{
+  return mPerformanceTraceFile;
+}
+
 
 } // Adaptor
 } // Internal
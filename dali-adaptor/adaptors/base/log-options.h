@@ -17,6 +17,8 @@
 // limitations under the License.
 //
 
+// EXTERNAL INCLUDES
+#include <string>
 #include <dali/integration-api/debug.h>
 
 namespace Dali
@@ -50,11 +52,13 @@ public:
    * @param logFrameRateFrequency frequency of how often FPS is logged out (e.g. 0 = off, 2 = every 2 seconds).
    * @param logupdateStatusFrequency frequency of how often the update status is logged in number of frames
    * @param logPerformanceLevel performance logging, 0 = disabled,  1+ =  enabled
+   * @param performanceTraceFile the file the performance markers are written to, if enabled by logPerformanceLevel
    */
   void SetOptions( const Dali::Integration::Log::LogFunction& logFunction,
                    unsigned int logFrameRateFrequency,
                    unsigned int logupdateStatusFrequency,
-                   unsigned int logPerformanceLevel );
+                   unsigned int logPerformanceLevel,
+                   const std::string& performanceTraceFile );
 
   /**
    * Install the log function for the current thread.
@@ -81,11 +85,17 @@ public:
    */
   unsigned int GetPerformanceLoggingLevel() const;
 
+  /**
+   * @return the file the performance markers are written to, in the trace-event format
+   */
+  const std::string& GetPerformanceTraceFile() const;
+
 private:
 
   unsigned int mFpsFrequency;                     ///< how often fps is logged out in seconds
   unsigned int mUpdateStatusFrequency;            ///< how often update status is logged out in frames
   unsigned int mPerformanceLoggingLevel;          ///< performance log level
+  std::string mPerformanceTraceFile;              ///< performance trace-event file
 
   Dali::Integration::Log::LogFunction mLogFunction;
 
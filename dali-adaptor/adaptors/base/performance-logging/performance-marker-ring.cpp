@@ -0,0 +1,97 @@
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// CLASS HEADER
+#include "performance-marker-ring.h"
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+PerformanceMarkerRing::PerformanceMarkerRing( unsigned int capacity )
+: mMask( 0 ),
+  mWriteCount( 0 ),
+  mReadCount( 0 ),
+  mDroppedCount( 0 ),
+  mThreadName( NULL )
+{
+  unsigned int size = 1;
+  while( size < capacity )
+  {
+    size <<= 1;
+  }
+  mMarkers.Resize( size, PerformanceMarker( PerformanceMarker::V_SYNC ) );
+  mMask = size - 1;
+}
+
+PerformanceMarkerRing::~PerformanceMarkerRing()
+{
+}
+
+bool PerformanceMarkerRing::Push( const PerformanceMarker& marker )
+{
+  const unsigned int writeCount = mWriteCount;
+  const unsigned int readCount = __sync_fetch_and_add( &mReadCount, 0 ); // acquires the markers the reader has finished with
+
+  if( writeCount - readCount > mMask )
+  {
+    __sync_fetch_and_add( &mDroppedCount, 1 );
+    return false;
+  }
+
+  mMarkers[ writeCount & mMask ] = marker;
+
+  // the marker must be written before the reader can see it
+  __sync_synchronize();
+  mWriteCount = writeCount + 1;
+
+  return true;
+}
+
+bool PerformanceMarkerRing::Pop( PerformanceMarker& marker )
+{
+  const unsigned int readCount = mReadCount;
+  const unsigned int writeCount = __sync_fetch_and_add( &mWriteCount, 0 ); // acquires the markers the writer has added
+
+  if( readCount == writeCount )
+  {
+    return false;
+  }
+
+  marker = mMarkers[ readCount & mMask ];
+
+  // the marker must be read before the writer can overwrite it
+  __sync_synchronize();
+  mReadCount = readCount + 1;
+
+  return true;
+}
+
+unsigned int PerformanceMarkerRing::TakeDroppedCount()
+{
+  return __sync_fetch_and_and( &mDroppedCount, 0 );
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
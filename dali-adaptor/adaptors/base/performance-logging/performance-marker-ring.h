@@ -0,0 +1,115 @@
+#ifndef __DALI_INTERNAL_ADAPTOR_PERFORMANCE_MARKER_RING_H__
+#define __DALI_INTERNAL_ADAPTOR_PERFORMANCE_MARKER_RING_H__
+
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
+#include <base/performance-logging/performance-marker.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * Fixed size ring buffer of the performance markers added by one thread.
+ * Lock-free, as long as only one thread adds markers and only one other thread reads them.
+ * When the ring is full, new markers are dropped and counted.
+ */
+class PerformanceMarkerRing
+{
+public:
+
+  /**
+   * Constructor
+   * @param capacity The number of markers the ring can hold; rounded up to a power of two
+   */
+  PerformanceMarkerRing( unsigned int capacity );
+
+  /**
+   * Non-virtual destructor, not intended as a base class
+   */
+  ~PerformanceMarkerRing();
+
+  /**
+   * Adds a marker; called only by the thread which owns the ring.
+   * @param marker The marker
+   * @return false if the ring is full, and the marker was dropped
+   */
+  bool Push( const PerformanceMarker& marker );
+
+  /**
+   * Removes the oldest marker; called only by the thread reading the markers.
+   * @param[out] marker The marker
+   * @return false if the ring is empty
+   */
+  bool Pop( PerformanceMarker& marker );
+
+  /**
+   * Gets the number of markers dropped since the previous call, because the ring was full.
+   * Called only by the thread reading the markers.
+   * @return The number of dropped markers
+   */
+  unsigned int TakeDroppedCount();
+
+  /**
+   * Sets the name of the thread which owns the ring; called only by the thread reading the markers.
+   * @param name The name; a string literal
+   */
+  void SetThreadName( const char* name )
+  {
+    mThreadName = name;
+  }
+
+  /**
+   * @return the name of the thread which owns the ring, or NULL if it isn't known yet
+   */
+  const char* GetThreadName() const
+  {
+    return mThreadName;
+  }
+
+private:
+
+  // Undefined copy constructor.
+  PerformanceMarkerRing( const PerformanceMarkerRing& );
+
+  // Undefined assignment operator.
+  PerformanceMarkerRing& operator=( const PerformanceMarkerRing& );
+
+private:
+
+  Dali::Vector< PerformanceMarker > mMarkers; ///< Storage for the markers
+  unsigned int mMask;                         ///< Capacity - 1; the capacity is a power of two
+  volatile unsigned int mWriteCount;          ///< Total markers pushed, only written by the owning thread
+  volatile unsigned int mReadCount;           ///< Total markers popped, only written by the reading thread
+  volatile unsigned int mDroppedCount;        ///< Markers dropped since the reading thread last took the count
+  const char* mThreadName;                    ///< Name of the owning thread, used when exporting the markers
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_ADAPTOR_PERFORMANCE_MARKER_RING_H__
@@ -17,6 +17,9 @@
 // CLASS HEADER
 #include "performance-marker.h"
 
+// EXTERNAL INCLUDES
+#include <cstddef>
+
 namespace Dali
 {
 
@@ -46,24 +49,39 @@ const NamePair MarkerLookup[] =
     { PerformanceMarker::SWAP_END     ,        "SWAP_END"              },
     { PerformanceMarker::PROCESS_EVENTS_START, "PROCESS_EVENT_START"   },
     { PerformanceMarker::PROCESS_EVENTS_END,   "PROCESS_EVENT_END"     },
+    { PerformanceMarker::UPDATE_WAIT_START,    "UPDATE_WAIT_START"     },
+    { PerformanceMarker::UPDATE_WAIT_END,      "UPDATE_WAIT_END"       },
+    { PerformanceMarker::RENDER_WAIT_START,    "RENDER_WAIT_START"     },
+    { PerformanceMarker::RENDER_WAIT_END,      "RENDER_WAIT_END"       },
     { PerformanceMarker::PAUSED       ,        "PAUSED"                },
-    { PerformanceMarker::RESUME       ,        "RESUMED"               }
+    { PerformanceMarker::RESUME       ,        "RESUMED"               },
+    { PerformanceMarker::CUSTOM_START ,        "CUSTOM_START"          },
+    { PerformanceMarker::CUSTOM_END   ,        "CUSTOM_END"            }
 };
 }
 PerformanceMarker::PerformanceMarker( MarkerType type )
-:mType(type)
+:mType(type),
+ mName(NULL)
 {
 }
 
 PerformanceMarker::PerformanceMarker( MarkerType type, FrameTimeStamp frameInfo )
 :mType(type),
- mTimeStamp(frameInfo)
+ mTimeStamp(frameInfo),
+ mName(NULL)
+{
+}
+
+PerformanceMarker::PerformanceMarker( MarkerType type, FrameTimeStamp frameInfo, const char* name )
+:mType(type),
+ mTimeStamp(frameInfo),
+ mName(name)
 {
 }
 
 const char* PerformanceMarker::GetName( ) const
 {
-  return MarkerLookup[ mType ].name;
+  return mName ? mName : MarkerLookup[ mType ].name;
 }
 
 unsigned int PerformanceMarker::MicrosecondDiff( const PerformanceMarker& start,const PerformanceMarker& end )
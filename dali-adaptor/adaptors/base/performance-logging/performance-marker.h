@@ -52,8 +52,14 @@ public:
       SWAP_END     ,        ///< SwapBuffers End
       PROCESS_EVENTS_START, ///< Process events start (e.g. touch event)
       PROCESS_EVENTS_END,   ///< Process events end
+      UPDATE_WAIT_START,    ///< Update starts waiting for render to finish a frame
+      UPDATE_WAIT_END,      ///< Update stops waiting for render
+      RENDER_WAIT_START,    ///< Render starts waiting for update to finish a frame
+      RENDER_WAIT_END,      ///< Render stops waiting for update
       PAUSED       ,        ///< Pause start
-      RESUME                ///< Resume start
+      RESUME       ,        ///< Resume start
+      CUSTOM_START ,        ///< Start of a named section, e.g. traced by Dali Core or Toolkit
+      CUSTOM_END            ///< End of a named section
   };
 
   /**
@@ -69,6 +75,14 @@ public:
    */
   PerformanceMarker(MarkerType type,  FrameTimeStamp time);
 
+  /**
+   * Constructor for custom markers
+   * @param type marker type, CUSTOM_START or CUSTOM_END
+   * @param time time stamp
+   * @param name name of the section; a string literal, which outlives the marker
+   */
+  PerformanceMarker( MarkerType type, FrameTimeStamp time, const char* name );
+
   /**
    * @return the time stamp
    */
@@ -101,6 +115,7 @@ private:
 
   MarkerType           mType;         ///< marker type
   FrameTimeStamp       mTimeStamp;    ///< frame time stamp
+  const char*          mName;         ///< name of a custom marker, NULL otherwise
 
 };
 
@@ -18,7 +18,9 @@
 #include "performance-server.h"
 
 // INTERNAL INCLUDES
+#include <dali/integration-api/trace.h>
 #include <base/log-options.h>
+#include <base/performance-logging/trace-event-writer.h>
 
 namespace Dali
 {
@@ -38,33 +40,117 @@ namespace
 const unsigned int DEFAULT_LOG_FREQUENCEY = 2;        ///< default log frequency = 2
 const unsigned int MILLISECONDS_PER_SECOND = 1000;    ///< 1000 milliseconds per second
 const unsigned int MICROSECONDS_PER_SECOND = 1000000; ///< 1000000 microseconds per second
+
+PerformanceServer* gPerformanceServer = NULL;         ///< receives the sections traced by Dali Core
+
+/**
+ * Works out which thread added a marker, from the type of the marker.
+ * @param marker the marker
+ * @return the name of the thread, or NULL for custom markers which could be added by any thread
+ */
+const char* GetThreadName( const PerformanceMarker& marker )
+{
+  switch( marker.GetType() )
+  {
+    case PerformanceMarker::V_SYNC:
+    {
+      return "VSync";
+    }
+    case PerformanceMarker::UPDATE_START:
+    case PerformanceMarker::UPDATE_END:
+    case PerformanceMarker::UPDATE_WAIT_START:
+    case PerformanceMarker::UPDATE_WAIT_END:
+    {
+      return "Update";
+    }
+    case PerformanceMarker::RENDER_START:
+    case PerformanceMarker::RENDER_END:
+    case PerformanceMarker::RENDER_WAIT_START:
+    case PerformanceMarker::RENDER_WAIT_END:
+    case PerformanceMarker::SWAP_START:
+    case PerformanceMarker::SWAP_END:
+    {
+      return "Render";
+    }
+    case PerformanceMarker::PROCESS_EVENTS_START:
+    case PerformanceMarker::PROCESS_EVENTS_END:
+    case PerformanceMarker::PAUSED:
+    case PerformanceMarker::RESUME:
+    {
+      return "Event";
+    }
+    default:
+    {
+      return NULL;
+    }
+  }
 }
 
+} // unnamed namespace
+
 
 PerformanceServer::PerformanceServer( AdaptorInternalServices& adaptorServices,
                                       const LogOptions& logOptions)
 :mLoggingEnabled( false),
  mLogFunctionInstalled( false ),
+ mLogLevel( 0 ),
  mLogFrequencyMicroseconds( 0),
  mPlatformAbstraction( adaptorServices.GetPlatformAbstractionInterface() ),
+ mRingCount( 0 ),
+ mThreadRing( &PerformanceServer::KeepThreadRing ),
+ mLogStartTime(),
+ mLogStarted( false ),
+ mDroppedCount( 0 ),
+ mTraceEventWriter( NULL ),
  mLogOptions(logOptions),
  mKernelTrace( adaptorServices.GetKernelTraceInterface() )
 {
+  for( unsigned int i = 0; i < MAX_THREADS; ++i )
+  {
+    mRings[i] = NULL;
+  }
+
+  gPerformanceServer = this;
+
   SetLogging( mLogOptions.GetPerformanceLoggingLevel(), mLogOptions.GetFrameRateLoggingFrequency());
 }
 
 PerformanceServer::~PerformanceServer()
 {
+  Integration::Trace::InstallTraceFunction( NULL );
+  gPerformanceServer = NULL;
+
   if( mLogFunctionInstalled )
   {
     mLogOptions.UnInstallLogFunction();
   }
+
+  // the threads adding markers have stopped, so write out any markers left in the rings
+  if( mTraceEventWriter )
+  {
+    PerformanceMarker marker( PerformanceMarker::V_SYNC );
+    for( unsigned int i = 0; i < mRingCount; ++i )
+    {
+      while( mRings[i]->Pop( marker ) )
+      {
+        mTraceEventWriter->WriteMarker( i + 1, marker );
+      }
+    }
+    delete mTraceEventWriter;
+  }
+
+  for( unsigned int i = 0; i < mRingCount; ++i )
+  {
+    delete mRings[i];
+  }
 }
+
 void PerformanceServer::SetLogging( unsigned int level, unsigned int interval)
 {
   if( level == 0)
   {
     mLoggingEnabled = false;
+    Integration::Trace::InstallTraceFunction( NULL );
     return;
   }
   mLogLevel = level;
@@ -75,8 +161,22 @@ void PerformanceServer::SetLogging( unsigned int level, unsigned int interval)
   {
     mLogFrequencyMicroseconds = DEFAULT_LOG_FREQUENCEY * MICROSECONDS_PER_SECOND;
   }
+
+  if( ( mLogLevel & LOG_TRACE_EVENTS ) && !mTraceEventWriter )
+  {
+    mTraceEventWriter = new TraceEventWriter( mLogOptions.GetPerformanceTraceFile() );
+    if( !mTraceEventWriter->IsOpen() )
+    {
+      DALI_LOG_ERROR( "Failed to open performance trace file %s\n", mLogOptions.GetPerformanceTraceFile().c_str() );
+      delete mTraceEventWriter;
+      mTraceEventWriter = NULL;
+    }
+  }
+
   mLoggingEnabled = true;
 
+  // trace the sections marked in Dali Core as well
+  Integration::Trace::InstallTraceFunction( &PerformanceServer::TraceSection );
 }
 
 void PerformanceServer::AddMarker( PerformanceMarker::MarkerType markerType )
@@ -98,38 +198,209 @@ void PerformanceServer::AddMarker( PerformanceMarker::MarkerType markerType )
   AddMarkerToLog( marker );
 }
 
-void PerformanceServer::AddMarkerToLog( PerformanceMarker marker )
+void PerformanceServer::AddCustomMarker( const char* name, bool start )
 {
-  // Add Marker can be called from any thread
-  boost::mutex::scoped_lock sharedDatalock( mDataMutex );
+  if( !mLoggingEnabled )
+  {
+    return;
+  }
+
+  unsigned int seconds(0);
+  unsigned int microseconds(0);
 
-  // store the marker
-  mMarkers.PushBack( marker );
+  // get the time
+  mPlatformAbstraction.GetTimeMicroseconds( seconds, microseconds );
+
+  // create a marker
+  PerformanceMarker marker( start ? PerformanceMarker::CUSTOM_START : PerformanceMarker::CUSTOM_END,
+                            FrameTimeStamp( 0, seconds, microseconds ),
+                            name );
+
+  AddMarkerToLog( marker );
+}
+
+void PerformanceServer::AddMarkerToLog( const PerformanceMarker& marker )
+{
+  // Add Marker can be called from any thread, each thread has its own ring so no lock is required
+  PerformanceMarkerRing* ring = GetThreadRing();
+  if( ring )
+  {
+    ring->Push( marker );
+  }
 
   if( mLogLevel & LOG_EVENTS_TO_KERNEL )
   {
+    // the kernel trace is not thread safe
+    boost::mutex::scoped_lock kernelTraceLock( mKernelTraceMutex );
     mKernelTrace.Trace(marker.GetName());
   }
 
-  // only log on the v-sync thread, so we have less impact on update/render
-  if( marker.GetType() != PerformanceMarker::V_SYNC )
+  // only process the markers on the v-sync thread, so we have less impact on update/render
+  if( marker.GetType() == PerformanceMarker::V_SYNC )
+  {
+    ProcessMarkers( marker );
+  }
+}
+
+PerformanceMarkerRing* PerformanceServer::GetThreadRing()
+{
+  PerformanceMarkerRing* ring = mThreadRing.get();
+  if( !ring )
+  {
+    // first marker of this thread
+    boost::mutex::scoped_lock ringLock( mRingMutex );
+
+    if( mRingCount == MAX_THREADS )
+    {
+      return NULL;
+    }
+
+    ring = new PerformanceMarkerRing( MARKERS_PER_THREAD );
+    mRings[ mRingCount ] = ring;
+
+    // make sure the ring is visible to the v-sync thread before it is counted
+    __sync_synchronize();
+    ++mRingCount;
+
+    mThreadRing.reset( ring );
+  }
+  return ring;
+}
+
+void PerformanceServer::ProcessMarkers( const PerformanceMarker& vSyncMarker )
+{
+  const unsigned int ringCount = __sync_fetch_and_add( &mRingCount, 0 );
+
+  PerformanceMarker marker( PerformanceMarker::V_SYNC );
+  for( unsigned int i = 0; i < ringCount; ++i )
+  {
+    PerformanceMarkerRing& ring = *mRings[i];
+    const unsigned int threadId = i + 1;
+
+    while( ring.Pop( marker ) )
+    {
+      if( !ring.GetThreadName() )
+      {
+        const char* threadName = GetThreadName( marker );
+        if( threadName )
+        {
+          ring.SetThreadName( threadName );
+          if( mTraceEventWriter )
+          {
+            mTraceEventWriter->WriteThreadName( threadId, threadName );
+          }
+        }
+      }
+
+      AddMarkerToStats( marker );
+
+      if( mTraceEventWriter )
+      {
+        mTraceEventWriter->WriteMarker( threadId, marker );
+      }
+    }
+
+    const unsigned int droppedCount = ring.TakeDroppedCount();
+    if( droppedCount > 0 )
+    {
+      mDroppedCount += droppedCount;
+      if( mTraceEventWriter )
+      {
+        mTraceEventWriter->WriteDroppedCount( threadId, vSyncMarker, droppedCount );
+      }
+    }
+  }
+
+  if( mTraceEventWriter )
   {
+    mTraceEventWriter->Flush();
+  }
+
+  if( !mLogStarted )
+  {
+    mLogStartTime = vSyncMarker.GetTimeStamp();
+    mLogStarted = true;
     return;
   }
 
   // log out every mLogFrequency.
-  // check difference between first and last frame
-  unsigned int microseconds = PerformanceMarker::MicrosecondDiff( mMarkers[0], marker );
+  unsigned int microseconds = FrameTimeStamp::MicrosecondDiff( mLogStartTime, vSyncMarker.GetTimeStamp() );
 
   if( microseconds  >=  mLogFrequencyMicroseconds )
   {
     LogMarkers( );
-    mMarkers.Clear();
 
     // reset data for update / render statistics
     mUpdateStats.Reset();
     mRenderStats.Reset();
     mEventStats.Reset();
+    mUpdateWaitStats.Reset();
+    mRenderWaitStats.Reset();
+    mDroppedCount = 0;
+
+    mLogStartTime = vSyncMarker.GetTimeStamp();
+  }
+}
+
+void PerformanceServer::AddMarkerToStats( const PerformanceMarker& marker )
+{
+  // insert time stamps into a frame-time-stats object, based on type
+  switch( marker.GetType() )
+  {
+    case PerformanceMarker::UPDATE_START:
+    {
+      mUpdateStats.StartTime( marker.GetTimeStamp() );
+      break;
+    }
+    case PerformanceMarker::UPDATE_END:
+    {
+      mUpdateStats.EndTime( marker.GetTimeStamp() );
+      break;
+    }
+    case PerformanceMarker::RENDER_START:
+    {
+      mRenderStats.StartTime( marker.GetTimeStamp() );
+      break;
+    }
+    case PerformanceMarker::RENDER_END:
+    {
+      mRenderStats.EndTime( marker.GetTimeStamp() );
+      break;
+    }
+    case PerformanceMarker::PROCESS_EVENTS_START:
+    {
+      mEventStats.StartTime( marker.GetTimeStamp() );
+      break;
+    }
+    case PerformanceMarker::PROCESS_EVENTS_END:
+    {
+      mEventStats.EndTime( marker.GetTimeStamp() );
+      break;
+    }
+    case PerformanceMarker::UPDATE_WAIT_START:
+    {
+      mUpdateWaitStats.StartTime( marker.GetTimeStamp() );
+      break;
+    }
+    case PerformanceMarker::UPDATE_WAIT_END:
+    {
+      mUpdateWaitStats.EndTime( marker.GetTimeStamp() );
+      break;
+    }
+    case PerformanceMarker::RENDER_WAIT_START:
+    {
+      mRenderWaitStats.StartTime( marker.GetTimeStamp() );
+      break;
+    }
+    case PerformanceMarker::RENDER_WAIT_END:
+    {
+      mRenderWaitStats.EndTime( marker.GetTimeStamp() );
+      break;
+    }
+    default:
+    {
+      break;
+    }
   }
 }
 
@@ -155,62 +426,42 @@ void PerformanceServer::LogMarker(const char* name, const FrameTimeStats& frameS
 
 void PerformanceServer::LogMarkers()
 {
-  // insert time stamps into a frame-time-stats object, based on type
-  for( MarkerVector::SizeType i = 0; i < mMarkers.Size(); ++i)
-  {
-    const PerformanceMarker& marker = mMarkers[i];
-    switch( marker.GetType() )
-    {
-      case PerformanceMarker::UPDATE_START:
-      {
-        mUpdateStats.StartTime( marker.GetTimeStamp() );
-        break;
-      }
-      case PerformanceMarker::UPDATE_END:
-      {
-        mUpdateStats.EndTime( marker.GetTimeStamp() );
-        break;
-      }
-      case PerformanceMarker::RENDER_START:
-      {
-        mRenderStats.StartTime( marker.GetTimeStamp() );
-        break;
-      }
-      case PerformanceMarker::RENDER_END:
-      {
-        mRenderStats.EndTime( marker.GetTimeStamp() );
-        break;
-      }
-      case PerformanceMarker::PROCESS_EVENTS_START:
-      {
-        mEventStats.StartTime( marker.GetTimeStamp() );
-        break;
-      }
-      case PerformanceMarker::PROCESS_EVENTS_END:
-      {
-        mEventStats.EndTime( marker.GetTimeStamp() );
-        break;
-      }
-      default:
-      {
-        break;
-      }
-    }
-  }
   if( mLogLevel & LOG_UPDATE_RENDER )
   {
     LogMarker("Update",mUpdateStats);
     LogMarker("Render",mRenderStats);
+    LogMarker("Update waiting for Render",mUpdateWaitStats);
+    LogMarker("Render waiting for Update",mRenderWaitStats);
   }
   if( mLogLevel & LOG_EVENT_PROCESS )
   {
     LogMarker("Event",mEventStats);
   }
+  if( mDroppedCount > 0 )
+  {
+    Integration::Log::LogMessage( Dali::Integration::Log::DebugInfo,
+                                  "%u performance markers dropped, the ring buffers were full\n", mDroppedCount );
+  }
 
 }
 
+void PerformanceServer::TraceSection( const char* name, bool start )
+{
+  PerformanceServer* server = gPerformanceServer;
+  if( server )
+  {
+    server->AddCustomMarker( name, start );
+  }
+}
+
+void PerformanceServer::KeepThreadRing( PerformanceMarkerRing* /* ring */ )
+{
+  // the ring is deleted with the server
+}
+
 } // namespace Internal
 
 } // namespace Adaptor
 
 } // namespace Dali
+
@@ -19,11 +19,12 @@
 
 // INTERNAL INCLUDES
 #include <base/performance-logging/frame-time-stats.h>
-#include <dali/public-api/common/dali-vector.h>
+#include <base/performance-logging/performance-marker-ring.h>
 #include <base/interfaces/adaptor-internal-services.h>
 
 // EXTERNAL INCLUDES
 #include <boost/thread/mutex.hpp>
+#include <boost/thread/tss.hpp>
 
 namespace Dali
 {
@@ -35,10 +36,16 @@ namespace Adaptor
 {
 
 class LogOptions;
+class TraceEventWriter;
+
 /**
  * Concrete implementation of performance interface.
  * Adaptor classes should never include this file, they
  * just need to include the abstract class performance-interface.h
+ *
+ * Every thread adds its markers to its own ring buffer, without locking.
+ * The v-sync thread reads the markers of all the threads once a frame, to work out
+ * the statistics which are logged, and to write them to the trace-event file.
  */
 class PerformanceServer : public PerformanceInterface
 {
@@ -63,6 +70,11 @@ public:
    */
   virtual void AddMarker( PerformanceMarker::MarkerType markerType);
 
+  /**
+   * @copydoc PerformanceInterface::AddCustomMarker()
+   */
+  virtual void AddCustomMarker( const char* name, bool start );
+
   /**
    * @copydoc PerformanceInterface::SetLogging()
    */
@@ -74,7 +86,25 @@ private:
   /**
    * Helper
    */
-  void AddMarkerToLog( PerformanceMarker marker );
+  void AddMarkerToLog( const PerformanceMarker& marker );
+
+  /**
+   * Gets the ring buffer of the current thread, creating it for the first marker of the thread.
+   * @return the ring buffer, or NULL if too many threads have added markers
+   */
+  PerformanceMarkerRing* GetThreadRing();
+
+  /**
+   * Reads the markers of every thread; only called from the v-sync thread.
+   * @param vSyncMarker the v-sync marker which triggered the processing
+   */
+  void ProcessMarkers( const PerformanceMarker& vSyncMarker );
+
+  /**
+   * Adds a marker to the statistics, based on its type
+   * @param marker the marker
+   */
+  void AddMarkerToStats( const PerformanceMarker& marker );
 
   /**
    * Helper
@@ -86,8 +116,22 @@ private:
    */
   void LogMarkers();
 
+  /**
+   * Installed into Dali Core, to add the markers of the sections it traces.
+   * @see Integration::Trace::TraceFunction
+   */
+  static void TraceSection( const char* name, bool start );
+
+  /**
+   * Cleanup function of mThreadRing; the rings are owned by the server, so outlive their threads.
+   */
+  static void KeepThreadRing( PerformanceMarkerRing* ring );
+
 private:
 
+  static const unsigned int MAX_THREADS = 16;         ///< maximum number of threads which can add markers
+  static const unsigned int MARKERS_PER_THREAD = 1024; ///< capacity of the ring buffer of each thread
+
   bool mLoggingEnabled:1;         ///< whether logging update / render to a log is enabled
   bool mLogFunctionInstalled:1;   ///< whether the log function is installed
   unsigned int mLogLevel;         ///< log level
@@ -97,12 +141,22 @@ private:
   FrameTimeStats mUpdateStats;    ///< update time statistics
   FrameTimeStats mRenderStats;    ///< render time statistics
   FrameTimeStats mEventStats;     ///< event time statistics
+  FrameTimeStats mUpdateWaitStats; ///< statistics of the time update waits for render
+  FrameTimeStats mRenderWaitStats; ///< statistics of the time render waits for update
 
   Integration::PlatformAbstraction& mPlatformAbstraction; ///< platform abstraction
 
-  typedef Dali::Vector<PerformanceMarker > MarkerVector;
-  MarkerVector mMarkers;              ///< vector of markers
-  boost::mutex mDataMutex;            ///< mutex
+  PerformanceMarkerRing* mRings[ MAX_THREADS ];                ///< ring buffers of the threads which added markers
+  volatile unsigned int mRingCount;                             ///< number of ring buffers
+  boost::thread_specific_ptr< PerformanceMarkerRing > mThreadRing; ///< ring buffer of the current thread
+  boost::mutex mRingMutex;            ///< only locked when a thread adds its first marker
+  boost::mutex mKernelTraceMutex;     ///< only locked when logging to the kernel trace
+
+  FrameTimeStamp mLogStartTime;       ///< time the statistics were last logged
+  bool mLogStarted;                   ///< whether mLogStartTime is set
+  unsigned int mDroppedCount;         ///< markers dropped since the statistics were last logged
+
+  TraceEventWriter* mTraceEventWriter; ///< writes the trace-event file, NULL if not enabled
   const LogOptions& mLogOptions;      ///< log options
   KernelTraceInterface& mKernelTrace; ///< kernel trace interface
 
@@ -0,0 +1,209 @@
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// CLASS HEADER
+#include "trace-event-writer.h"
+
+// EXTERNAL INCLUDES
+#include <unistd.h>
+#include <dali/integration-api/debug.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+namespace
+{
+
+const unsigned long long MICROSECONDS_PER_SECOND = 1000000ull; ///< 1000000 microseconds per second
+
+/**
+ * How a marker is shown in the trace
+ */
+struct TraceEventInfo
+{
+  const char* name;  ///< The name of the slice or instant event
+  char phase;        ///< 'B' starts a slice, 'E' ends it, 'i' is an instant event
+};
+
+/**
+ * @param marker The marker
+ * @return how the marker is shown in the trace
+ */
+TraceEventInfo GetTraceEventInfo( const PerformanceMarker& marker )
+{
+  TraceEventInfo info = { marker.GetName(), 'i' };
+
+  switch( marker.GetType() )
+  {
+    case PerformanceMarker::V_SYNC:               info.name = "VSync";          break;
+    case PerformanceMarker::PAUSED:               info.name = "Paused";         break;
+    case PerformanceMarker::RESUME:               info.name = "Resumed";        break;
+    case PerformanceMarker::UPDATE_START:         info.name = "Update";         info.phase = 'B'; break;
+    case PerformanceMarker::UPDATE_END:           info.name = "Update";         info.phase = 'E'; break;
+    case PerformanceMarker::RENDER_START:         info.name = "Render";         info.phase = 'B'; break;
+    case PerformanceMarker::RENDER_END:           info.name = "Render";         info.phase = 'E'; break;
+    case PerformanceMarker::SWAP_START:           info.name = "SwapBuffers";    info.phase = 'B'; break;
+    case PerformanceMarker::SWAP_END:             info.name = "SwapBuffers";    info.phase = 'E'; break;
+    case PerformanceMarker::PROCESS_EVENTS_START: info.name = "ProcessEvents";  info.phase = 'B'; break;
+    case PerformanceMarker::PROCESS_EVENTS_END:   info.name = "ProcessEvents";  info.phase = 'E'; break;
+    case PerformanceMarker::UPDATE_WAIT_START:    info.name = "WaitForRender";  info.phase = 'B'; break;
+    case PerformanceMarker::UPDATE_WAIT_END:      info.name = "WaitForRender";  info.phase = 'E'; break;
+    case PerformanceMarker::RENDER_WAIT_START:    info.name = "WaitForUpdate";  info.phase = 'B'; break;
+    case PerformanceMarker::RENDER_WAIT_END:      info.name = "WaitForUpdate";  info.phase = 'E'; break;
+    case PerformanceMarker::CUSTOM_START:         info.phase = 'B'; break;
+    case PerformanceMarker::CUSTOM_END:           info.phase = 'E'; break;
+  }
+
+  return info;
+}
+
+/**
+ * @param marker The marker
+ * @return the time stamp of the marker in microseconds
+ */
+unsigned long long GetMicroseconds( const PerformanceMarker& marker )
+{
+  const FrameTimeStamp& timeStamp = marker.GetTimeStamp();
+  return static_cast< unsigned long long >( timeStamp.seconds ) * MICROSECONDS_PER_SECOND + timeStamp.microseconds;
+}
+
+/**
+ * Writes a JSON string, escaping quotes, backslashes and control characters
+ * @param file The file
+ * @param text The text of the string
+ */
+void WriteString( FILE* file, const char* text )
+{
+  fputc( '"', file );
+  for( ; *text; ++text )
+  {
+    const unsigned char character = static_cast< unsigned char >( *text );
+    if( character == '"' || character == '\\' )
+    {
+      fputc( '\\', file );
+      fputc( character, file );
+    }
+    else if( character < 0x20 )
+    {
+      fprintf( file, "\\u%04x", character );
+    }
+    else
+    {
+      fputc( character, file );
+    }
+  }
+  fputc( '"', file );
+}
+
+} // unnamed namespace
+
+TraceEventWriter::TraceEventWriter( const std::string& fileName )
+: mFile( fopen( fileName.c_str(), "w" ) ),
+  mProcessId( static_cast< unsigned int >( getpid() ) ),
+  mFirstEvent( true )
+{
+  if( mFile )
+  {
+    // The JSON array format; the closing bracket is optional, so a trace cut short by a crash can still be loaded
+    fputs( "[\n", mFile );
+  }
+  else
+  {
+    DALI_LOG_ERROR( "Unable to open trace file %s\n", fileName.c_str() );
+  }
+}
+
+TraceEventWriter::~TraceEventWriter()
+{
+  if( mFile )
+  {
+    fputs( "\n]\n", mFile );
+    fclose( mFile );
+  }
+}
+
+bool TraceEventWriter::IsOpen() const
+{
+  return mFile != NULL;
+}
+
+void TraceEventWriter::WriteThreadName( unsigned int threadId, const char* name )
+{
+  if( mFile )
+  {
+    StartEvent();
+    fprintf( mFile, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%u,\"tid\":%u,\"args\":{\"name\":", mProcessId, threadId );
+    WriteString( mFile, name );
+    fputs( "}}", mFile );
+  }
+}
+
+void TraceEventWriter::WriteMarker( unsigned int threadId, const PerformanceMarker& marker )
+{
+  if( mFile )
+  {
+    const TraceEventInfo info = GetTraceEventInfo( marker );
+
+    StartEvent();
+    fputs( "{\"name\":", mFile );
+    WriteString( mFile, info.name );
+    fprintf( mFile, ",\"ph\":\"%c\",\"ts\":%llu,\"pid\":%u,\"tid\":%u", info.phase, GetMicroseconds( marker ), mProcessId, threadId );
+    if( info.phase == 'i' )
+    {
+      fputs( ",\"s\":\"t\"", mFile );
+    }
+    fputc( '}', mFile );
+  }
+}
+
+void TraceEventWriter::WriteDroppedCount( unsigned int threadId, const PerformanceMarker& marker, unsigned int droppedCount )
+{
+  if( mFile )
+  {
+    StartEvent();
+    fprintf( mFile, "{\"name\":\"DroppedMarkers\",\"ph\":\"C\",\"ts\":%llu,\"pid\":%u,\"tid\":%u,\"args\":{\"count\":%u}}",
+             GetMicroseconds( marker ), mProcessId, threadId, droppedCount );
+  }
+}
+
+void TraceEventWriter::Flush()
+{
+  if( mFile )
+  {
+    fflush( mFile );
+  }
+}
+
+void TraceEventWriter::StartEvent()
+{
+  if( !mFirstEvent )
+  {
+    fputs( ",\n", mFile );
+  }
+  mFirstEvent = false;
+}
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,116 @@
+#ifndef __DALI_INTERNAL_ADAPTOR_TRACE_EVENT_WRITER_H__
+#define __DALI_INTERNAL_ADAPTOR_TRACE_EVENT_WRITER_H__
+
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// EXTERNAL INCLUDES
+#include <cstdio>
+#include <string>
+
+// INTERNAL INCLUDES
+#include <base/performance-logging/performance-marker.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace Adaptor
+{
+
+/**
+ * Writes performance markers to a file in the trace-event JSON format,
+ * which can be loaded by chrome://tracing or the Perfetto UI.
+ * The start and end markers of each thread become its slices, e.g. Update or Render;
+ * v-sync, pause and resume markers become instant events.
+ * Not thread-safe; used only by the thread reading the markers.
+ */
+class TraceEventWriter
+{
+public:
+
+  /**
+   * Constructor; opens the file.
+   * @param fileName The name of the file to write
+   */
+  TraceEventWriter( const std::string& fileName );
+
+  /**
+   * Non-virtual destructor, not intended as a base class; completes and closes the file.
+   */
+  ~TraceEventWriter();
+
+  /**
+   * @return true if the file could be opened
+   */
+  bool IsOpen() const;
+
+  /**
+   * Names a thread in the trace.
+   * @param threadId Identifies the thread in the trace
+   * @param name The name of the thread
+   */
+  void WriteThreadName( unsigned int threadId, const char* name );
+
+  /**
+   * Writes a marker to the trace.
+   * @param threadId Identifies the thread which added the marker
+   * @param marker The marker
+   */
+  void WriteMarker( unsigned int threadId, const PerformanceMarker& marker );
+
+  /**
+   * Writes the number of markers a thread dropped, as a counter.
+   * @param threadId Identifies the thread which dropped the markers
+   * @param marker The marker after which the markers were dropped
+   * @param droppedCount The number of dropped markers
+   */
+  void WriteDroppedCount( unsigned int threadId, const PerformanceMarker& marker, unsigned int droppedCount );
+
+  /**
+   * Writes any buffered events to the file.
+   */
+  void Flush();
+
+private:
+
+  /**
+   * Writes the separator before an event.
+   */
+  void StartEvent();
+
+  // Undefined copy constructor.
+  TraceEventWriter( const TraceEventWriter& );
+
+  // Undefined assignment operator.
+  TraceEventWriter& operator=( const TraceEventWriter& );
+
+private:
+
+  FILE* mFile;              ///< The trace file
+  unsigned int mProcessId;  ///< The process id written with every event
+  bool mFirstEvent;         ///< Whether no event has been written yet
+};
+
+} // namespace Adaptor
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_ADAPTOR_TRACE_EVENT_WRITER_H__
@@ -49,6 +49,7 @@ RenderThread::RenderThread( UpdateRenderSynchronization& sync,
   mGLES( adaptorInterfaces.GetGlesInterface() ),
   mEglFactory( &adaptorInterfaces.GetEGLFactoryInterface()),
   mEGL( NULL ),
+  mPerformanceInterface( adaptorInterfaces.GetPerformanceInterface() ),
   mThread( NULL ),
   mSurfaceReplacing( false ),
   mNewDataAvailable( false ),
@@ -180,6 +181,9 @@ bool RenderThread::Run()
     // perform any pre-render operations
     if(PreRender() == true)
     {
+      // Only the damaged part of the back buffer is redrawn, if the rest of it is known
+      mCore.SetBackBufferAge( mEGL->GetBufferAge() );
+
        // Render
       mCore.Render( renderStatus );
 
@@ -191,7 +195,10 @@ bool RenderThread::Run()
       // perform any post-render operations
       if ( renderStatus.HasRendered() )
       {
+        mEGL->SetDamagedArea( renderStatus.GetDamagedArea() );
+        AddPerformanceMarker( PerformanceMarker::SWAP_START );
         PostRender( static_cast< unsigned int >(newTime - currentTime) );
+        AddPerformanceMarker( PerformanceMarker::SWAP_END );
       }
 
       if(mSurfaceReplacing)
@@ -345,6 +352,14 @@ void RenderThread::PostRender( unsigned int timeDelta )
                                 mSurfaceReplacing ? RenderSurface::SYNC_MODE_NONE : RenderSurface::SYNC_MODE_WAIT );
 }
 
+void RenderThread::AddPerformanceMarker( PerformanceMarker::MarkerType type )
+{
+  if( mPerformanceInterface )
+  {
+    mPerformanceInterface->AddMarker( type );
+  }
+}
+
 } // namespace Adaptor
 
 } // namespace Internal
@@ -22,6 +22,7 @@
 
 // INTERNAL INCLUDES
 #include <base/interfaces/egl-interface.h>
+#include <base/performance-logging/performance-marker.h>
 #include <internal/common/render-surface-impl.h> // needed for Dali::Internal::Adaptor::RenderSurface
 
 
@@ -40,6 +41,7 @@ namespace Adaptor
 {
 
 class AdaptorInternalServices;
+class PerformanceInterface;
 class RenderSurface;
 class UpdateRenderSynchronization;
 class EglFactoryInterface;
@@ -163,6 +165,12 @@ private: // Render thread side helpers
    */
   void PostRender( unsigned int timeDelta );
 
+  /**
+   * Helper to add a performance marker to the performance server (if its active)
+   * @param type performance marker type
+   */
+  void AddPerformanceMarker( PerformanceMarker::MarkerType type );
+
 private: // Data
 
   UpdateRenderSynchronization&        mUpdateRenderSync; ///< Used to synchronize the update & render threads
@@ -170,6 +178,7 @@ private: // Data
   Integration::GlAbstraction&         mGLES;             ///< GL abstraction rerefence
   EglFactoryInterface*                mEglFactory;       ///< Factory class to create EGL implementation
   EglInterface*                       mEGL;              ///< Interface to EGL implementation
+  PerformanceInterface*               mPerformanceInterface; ///< The performance logging interface
 
   boost::thread*                      mThread;           ///< render thread
   bool                                mUsingPixmap;      ///< whether we're using a pixmap or a window
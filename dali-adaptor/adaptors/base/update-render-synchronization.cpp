@@ -171,11 +171,19 @@ bool UpdateRenderSynchronization::UpdateSyncWithRender( bool& renderNeedsUpdate
   mUpdateFinishedCondition.notify_one();
 
   // The update-thread must wait until a frame has been rendered, when mMaximumUpdateCount is reached
-  while( mRunning && ( mMaximumUpdateCount == mUpdateReadyCount ) )
+  if( mRunning && ( mMaximumUpdateCount == mUpdateReadyCount ) )
   {
-    // Wait will atomically add the thread to the set of threads waiting on
-    // the condition variable mRenderFinishedCondition and unlock the mutex.
-    mRenderFinishedCondition.wait( lock );
+    // Only the time spent blocked is measured
+    AddPerformanceMarker( PerformanceMarker::UPDATE_WAIT_START );
+
+    while( mRunning && ( mMaximumUpdateCount == mUpdateReadyCount ) )
+    {
+      // Wait will atomically add the thread to the set of threads waiting on
+      // the condition variable mRenderFinishedCondition and unlock the mutex.
+      mRenderFinishedCondition.wait( lock );
+    }
+
+    AddPerformanceMarker( PerformanceMarker::UPDATE_WAIT_END );
   }
 
   renderNeedsUpdate = mUpdateRequired;
@@ -267,11 +275,19 @@ bool UpdateRenderSynchronization::RenderSyncWithUpdate()
   boost::unique_lock< boost::mutex > lock( mMutex );
 
   // Wait for update to produce a buffer, or for the mRunning state to change
-  while ( mRunning && ( 0u == mUpdateReadyCount ) )
+  if( mRunning && ( 0u == mUpdateReadyCount ) )
   {
-    // Wait will atomically add the thread to the set of threads waiting on
-    // the condition variable mUpdateFinishedCondition and unlock the mutex.
-    mUpdateFinishedCondition.wait( lock );
+    // Only the time spent blocked is measured
+    AddPerformanceMarker( PerformanceMarker::RENDER_WAIT_START );
+
+    while ( mRunning && ( 0u == mUpdateReadyCount ) )
+    {
+      // Wait will atomically add the thread to the set of threads waiting on
+      // the condition variable mUpdateFinishedCondition and unlock the mutex.
+      mUpdateFinishedCondition.wait( lock );
+    }
+
+    AddPerformanceMarker( PerformanceMarker::RENDER_WAIT_END );
   }
 
   if( mRunning )
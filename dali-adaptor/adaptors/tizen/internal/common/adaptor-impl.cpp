@@ -65,6 +65,10 @@ namespace
 {
 boost::thread_specific_ptr<Adaptor> gThreadLocalAdaptor;
 
+const unsigned int DEFAULT_PAN_PREDICTION_MODE( 2u );       ///< Linear prediction
+const unsigned int DEFAULT_PAN_SMOOTHING_PERCENTAGE( 25u );
+const char* const DEFAULT_PERFORMANCE_TRACE_FILE( "/tmp/dali-trace.json" );
+
 unsigned int GetIntegerEnvironmentVariable( const char* variable, unsigned int defaultValue )
 {
   const char* variableParameter = std::getenv(variable);
@@ -96,10 +100,12 @@ void Adaptor::ParseLogOptions()
   unsigned int logFrameRateFrequency = GetIntegerEnvironmentVariable( DALI_ENV_FPS_TRACKING, 0 );
   unsigned int logupdateStatusFrequency = GetIntegerEnvironmentVariable( DALI_ENV_UPDATE_STATUS_INTERVAL, 0 );
   unsigned int logPerformanceLevel = GetIntegerEnvironmentVariable( DALI_ENV_LOG_PERFORMANCE, 0 );
+  const char* performanceTraceFile = std::getenv( DALI_ENV_PERFORMANCE_TRACE_FILE );
 
   Dali::Integration::Log::LogFunction  logFunction(Dali::SlpPlatform::LogMessage);
 
-  mLogOptions.SetOptions( logFunction, logFrameRateFrequency, logupdateStatusFrequency, logPerformanceLevel );
+  mLogOptions.SetOptions( logFunction, logFrameRateFrequency, logupdateStatusFrequency, logPerformanceLevel,
+                          performanceTraceFile ? performanceTraceFile : DEFAULT_PERFORMANCE_TRACE_FILE );
 
   // all threads here (event, update, and render) will send their logs to SLP Platform's LogMessage handler.
   // Dali::Integration::Log::LogFunction logFunction(Dali::SlpPlatform::LogMessage);
@@ -131,7 +137,15 @@ void Adaptor::Initialize()
 
   EglSyncImplementation* eglSyncImpl = mEglFactory->GetSyncImplementation();
 
-  mCore = Integration::Core::New( *this, *mPlatformAbstraction, *mGLES, *eglSyncImpl, *mGestureManager );
+  unsigned int updateWorkerCount = GetIntegerEnvironmentVariable( DALI_ENV_UPDATE_WORKER_THREADS, 0 );
+  bool tripleBuffered = ( 0u != GetIntegerEnvironmentVariable( DALI_ENV_TRIPLE_BUFFERING, 0 ) );
+
+  mCore = Integration::Core::New( *this, *mPlatformAbstraction, *mGLES, *eglSyncImpl, *mGestureManager, updateWorkerCount, tripleBuffered );
+
+  // Extrapolate pan gestures to the next render, so that scrolling keeps up with the touch
+  mCore->SetPanGesturePredictionMode( GetIntegerEnvironmentVariable( DALI_ENV_PAN_PREDICTION_MODE, DEFAULT_PAN_PREDICTION_MODE ) );
+  mCore->SetPanGesturePredictionAmount( GetIntegerEnvironmentVariable( DALI_ENV_PAN_PREDICTION_AMOUNT, 0 ) );
+  mCore->SetPanGestureSmoothingAmount( GetIntegerEnvironmentVariable( DALI_ENV_PAN_SMOOTHING_AMOUNT, DEFAULT_PAN_SMOOTHING_PERCENTAGE ) * 0.01f );
 
   mNotificationTrigger = new TriggerEvent( boost::bind(&Adaptor::ProcessCoreEvents, this) );
 
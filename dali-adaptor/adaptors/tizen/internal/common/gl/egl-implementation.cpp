@@ -19,6 +19,7 @@
 #include "egl-implementation.h"
 
 // EXTERNAL INCLUDES
+#include <cstring>
 #include <dali/integration-api/debug.h>
 #include <dali/public-api/common/dali-common.h>
 #include <dali/public-api/common/dali-vector.h>
@@ -45,6 +46,38 @@ namespace Adaptor
   } \
 }
 
+namespace
+{
+
+#ifndef EGL_BUFFER_AGE_EXT
+#define EGL_BUFFER_AGE_EXT 0x313D
+#endif
+
+/**
+ * Checks whether an extension is in a space separated list of extensions
+ * @param[in] extensions The list of extensions, may be NULL
+ * @param[in] name The name of the extension
+ * @return true if the extension is in the list
+ */
+bool HasExtension( const char* extensions, const char* name )
+{
+  if( extensions )
+  {
+    const size_t length = strlen( name );
+    for( const char* found = strstr( extensions, name ); found; found = strstr( found + length, name ) )
+    {
+      if( ( found == extensions || found[-1] == ' ' ) &&
+          ( found[length] == ' ' || found[length] == '\0' ) )
+      {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+} // unnamed namespace
+
 EglImplementation::EglImplementation()
   : mEglNativeDisplay(0),
     mEglNativeWindow(0),
@@ -58,7 +91,10 @@ EglImplementation::EglImplementation()
     mSyncMode(FULL_SYNC),
     mContextCurrent(false),
     mIsWindow(true),
-    mColorDepth(COLOR_DEPTH_24)
+    mColorDepth(COLOR_DEPTH_24),
+    mSwapBuffersWithDamage(NULL),
+    mDamagedArea(),
+    mBufferAgeSupported(false)
 {
 }
 
@@ -104,6 +140,8 @@ bool EglImplementation::InitializeGles( EGLNativeDisplayType display, bool isOwn
 
     mContextAttribs.PushBack( EGL_NONE );
 
+    InitializeDamageExtensions();
+
     mGlesInitialized = true;
     mIsOwnSurface = isOwnSurface;
   }
@@ -303,7 +341,35 @@ bool EglImplementation::SetRefreshSync( SyncMode mode )
 
 void EglImplementation::SwapBuffers()
 {
-  eglSwapBuffers( mEglDisplay, mEglSurface );
+  if( mSwapBuffersWithDamage && !mDamagedArea.IsEmpty() )
+  {
+    // Lets the compositor update only the part of the window which changed
+    EGLint rect[4] = { mDamagedArea.x, mDamagedArea.y, mDamagedArea.width, mDamagedArea.height };
+    mSwapBuffersWithDamage( mEglDisplay, mEglSurface, rect, 1 );
+  }
+  else
+  {
+    eglSwapBuffers( mEglDisplay, mEglSurface );
+  }
+  mDamagedArea = Rect<int>();
+}
+
+unsigned int EglImplementation::GetBufferAge()
+{
+  EGLint age = 0;
+  if( mBufferAgeSupported && mIsWindow && mEglSurface )
+  {
+    if( eglQuerySurface( mEglDisplay, mEglSurface, EGL_BUFFER_AGE_EXT, &age ) != EGL_TRUE || age < 0 )
+    {
+      age = 0;
+    }
+  }
+  return static_cast< unsigned int >( age );
+}
+
+void EglImplementation::SetDamagedArea( const Rect<int>& area )
+{
+  mDamagedArea = area;
 }
 
 void EglImplementation::CopyBuffers()
@@ -316,6 +382,27 @@ void EglImplementation::WaitGL()
   eglWaitGL();
 }
 
+void EglImplementation::InitializeDamageExtensions()
+{
+  const char* extensions = eglQueryString( mEglDisplay, EGL_EXTENSIONS );
+
+  mBufferAgeSupported = HasExtension( extensions, "EGL_EXT_buffer_age" );
+
+  mSwapBuffersWithDamage = NULL;
+  if( HasExtension( extensions, "EGL_KHR_swap_buffers_with_damage" ) )
+  {
+    mSwapBuffersWithDamage = (SwapBuffersWithDamageFunction) eglGetProcAddress( "eglSwapBuffersWithDamageKHR" );
+  }
+  else if( HasExtension( extensions, "EGL_EXT_swap_buffers_with_damage" ) )
+  {
+    mSwapBuffersWithDamage = (SwapBuffersWithDamageFunction) eglGetProcAddress( "eglSwapBuffersWithDamageEXT" );
+  }
+
+  DALI_LOG_INFO( Debug::Filter::gShader, Debug::General, "EGL buffer age %s, swap buffers with damage %s\n",
+                 mBufferAgeSupported ? "supported" : "not supported",
+                 mSwapBuffersWithDamage ? "supported" : "not supported" );
+}
+
 void EglImplementation::ChooseConfig( bool isWindowType, ColorDepth depth )
 {
   if(mEglConfig && isWindowType == mIsWindow && mColorDepth == depth)
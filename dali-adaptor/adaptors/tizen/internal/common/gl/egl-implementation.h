@@ -114,6 +114,16 @@ public:
    */
   virtual void SwapBuffers();
 
+  /**
+   * @copydoc EglInterface::GetBufferAge
+   */
+  virtual unsigned int GetBufferAge();
+
+  /**
+   * @copydoc EglInterface::SetDamagedArea
+   */
+  virtual void SetDamagedArea( const Rect<int>& area );
+
   /**
    * Performs an OpenGL copy buffers command
    */
@@ -177,6 +187,15 @@ public:
    */
   EGLContext GetContext() const;
 
+private:
+
+  /**
+   * Checks which of the extensions used for partial screen updates are supported by the display.
+   */
+  void InitializeDamageExtensions();
+
+  typedef EGLBoolean (*SwapBuffersWithDamageFunction)( EGLDisplay display, EGLSurface surface, EGLint* rects, EGLint count );
+
 private:
 
   Vector<EGLint>       mContextAttribs;
@@ -196,6 +215,10 @@ private:
   bool                 mContextCurrent;
   bool                 mIsWindow;
   ColorDepth           mColorDepth;
+
+  SwapBuffersWithDamageFunction mSwapBuffersWithDamage; ///< eglSwapBuffersWithDamageKHR or EXT, NULL if not supported
+  Rect<int>            mDamagedArea;                    ///< The area redrawn since the last swap, empty if everything was
+  bool                 mBufferAgeSupported;             ///< Whether EGL_EXT_buffer_age is supported
 };
 
 } // namespace Adaptor
@@ -0,0 +1,448 @@
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+
+#include <stdlib.h>
+#include <unistd.h>
+#include <boost/thread.hpp>
+
+#include <dali-test-suite-utils.h>
+
+#include "platform-abstractions/slp/data-cache/data-cache-io.h"
+
+using namespace Dali;
+using namespace Dali::SlpPlatform;
+
+typedef Platform::DataCache::DataKey DataKey;
+typedef Platform::DataCache::KeyVector KeyVector;
+typedef Platform::DataCache::Data Data;
+typedef Platform::DataCache::DataVector DataVector;
+
+static void Startup();
+static void Cleanup();
+
+extern "C" {
+  void (*tet_startup)() = Startup;
+  void (*tet_cleanup)() = Cleanup;
+}
+
+enum {
+  POSITIVE_TC_IDX = 0x01,
+  NEGATIVE_TC_IDX,
+};
+
+#define MAX_NUMBER_OF_TESTS 10000
+extern "C" {
+  struct tet_testlist tet_testlist[MAX_NUMBER_OF_TESTS];
+}
+
+TEST_FUNCTION( UtcDaliDataCacheFind,               POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliDataCacheFindCompressed,     POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliDataCacheFindFromOtherCache, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliDataCacheReCreate,           POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliDataCacheConcurrentAccess,   POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliDataCacheFindMissingFiles,   NEGATIVE_TC_IDX );
+
+// Called only once before first test is run.
+static void Startup()
+{
+}
+
+// Called only once after last test is run
+static void Cleanup()
+{
+}
+
+namespace
+{
+
+const unsigned int MAX_DATA_SIZE( 64u );          ///< maximum data size
+const unsigned int MAX_NUMBER_ENTRIES( 100000u );  ///< maximum number of entries
+
+/**
+ * Each test uses its own files, so the corruption check runs for each of them.
+ */
+std::string GetTestFileName( const char* testName )
+{
+  std::ostringstream fileName;
+  fileName << "/tmp/dali-data-cache-" << testName << "-" << getpid();
+  return fileName.str();
+}
+
+void RemoveTestFiles( const std::string& fileName )
+{
+  unlink( ( fileName + ".index" ).c_str() );
+  unlink( ( fileName + ".data" ).c_str() );
+}
+
+/**
+ * The data for a key is generated from the key, so any reader can check it.
+ * Runs of repeated values are included, so run length encoding has something to compress.
+ */
+unsigned int GetDataLength( DataKey key )
+{
+  return 1u + key % MAX_DATA_SIZE;
+}
+
+unsigned char GetDataValue( DataKey key, unsigned int index )
+{
+  return static_cast< unsigned char >( ( index < 8u ) ? key : key + index );
+}
+
+void CreateData( const KeyVector& keys, DataVector& dataVector )
+{
+  dataVector.resize( keys.size() );
+  for( unsigned int i = 0; i < keys.size(); ++i )
+  {
+    const unsigned int length = GetDataLength( keys[i] );
+    unsigned char* data = new unsigned char[ length ];
+    for( unsigned int j = 0; j < length; ++j )
+    {
+      data[j] = GetDataValue( keys[i], j );
+    }
+    dataVector[i].SetData( data, length );
+  }
+}
+
+void DeleteData( DataVector& dataVector )
+{
+  for( unsigned int i = 0; i < dataVector.size(); ++i )
+  {
+    delete [] dataVector[i].data;
+  }
+  dataVector.clear();
+}
+
+bool IsDataValid( DataKey key, const Data& data )
+{
+  if( data.length != GetDataLength( key ) )
+  {
+    return false;
+  }
+  for( unsigned int j = 0; j < data.length; ++j )
+  {
+    if( data.data[j] != GetDataValue( key, j ) )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+void CreateKeys( DataKey first, unsigned int count, KeyVector& keys )
+{
+  keys.clear();
+  for( unsigned int i = 0; i < count; ++i )
+  {
+    keys.push_back( first + i );
+  }
+}
+
+/**
+ * Adds the keys in batches, so the lookup has to grow between the calls.
+ */
+void AddKeys( Platform::DataCache& cache, const KeyVector& keys, unsigned int batchSize )
+{
+  for( unsigned int first = 0; first < keys.size(); first += batchSize )
+  {
+    KeyVector batch( keys.begin() + first, keys.begin() + std::min( first + batchSize, static_cast< unsigned int >( keys.size() ) ) );
+    DataVector dataVector;
+    CreateData( batch, dataVector );
+    cache.Add( batch, dataVector );
+    DeleteData( dataVector );
+  }
+}
+
+/**
+ * @return the number of keys found with the correct data. Keys found with incorrect data are not counted.
+ */
+unsigned int FindKeys( Platform::DataCache& cache, const KeyVector& keys, unsigned int& invalidCount )
+{
+  DataVector dataVector;
+  cache.Find( keys, dataVector );
+
+  unsigned int foundCount( 0 );
+  for( unsigned int i = 0; i < keys.size(); ++i )
+  {
+    if( dataVector[i].exists )
+    {
+      if( IsDataValid( keys[i], dataVector[i] ) )
+      {
+        ++foundCount;
+      }
+      else
+      {
+        ++invalidCount;
+      }
+    }
+  }
+  DeleteData( dataVector );
+
+  return foundCount;
+}
+
+/**
+ * Re-creates the cache files empty, as is done when corruption is detected.
+ */
+void ReCreateTestFiles( const std::string& fileName, Platform::DataCache::CompressionMode compressionMode )
+{
+  FILE* dataFile = DataCacheIo::OpenFile( fileName + ".data", DataCacheIo::DATA_FILE, DataCacheIo::LOCK_FILE, DataCacheIo::READ_WRITE, DataCacheIo::CREATE_IF_MISSING );
+  DALI_TEST_CHECK( dataFile );
+  if( dataFile )
+  {
+    DataCacheIo::ReCreateFiles( fileName + ".index", fileName + ".data", compressionMode );
+    fclose( dataFile );
+  }
+}
+
+void TestFind( const char* testName, Platform::DataCache::CompressionMode compressionMode )
+{
+  const std::string fileName( GetTestFileName( testName ) );
+  RemoveTestFiles( fileName );
+
+  Platform::DataCache* cache = Platform::DataCache::New( Platform::DataCache::READ_WRITE, compressionMode, fileName, MAX_DATA_SIZE, MAX_NUMBER_ENTRIES );
+
+  // enough keys for the lookup to grow several times
+  KeyVector keys;
+  CreateKeys( 1000u, 500u, keys );
+  AddKeys( *cache, keys, 7u );
+
+  unsigned int invalidCount( 0 );
+  DALI_TEST_EQUALS( FindKeys( *cache, keys, invalidCount ), 500u, TEST_LOCATION );
+  DALI_TEST_EQUALS( invalidCount, 0u, TEST_LOCATION );
+
+  // keys that were never added, including keys that share hash buckets with added keys
+  KeyVector missingKeys;
+  CreateKeys( 0u, 1000u, missingKeys );
+  DALI_TEST_EQUALS( FindKeys( *cache, missingKeys, invalidCount ), 0u, TEST_LOCATION );
+
+  // adding existing keys again does not add duplicate entries
+  AddKeys( *cache, keys, 100u );
+  DALI_TEST_EQUALS( FindKeys( *cache, keys, invalidCount ), 500u, TEST_LOCATION );
+  DALI_TEST_EQUALS( invalidCount, 0u, TEST_LOCATION );
+
+  delete cache;
+  RemoveTestFiles( fileName );
+}
+
+/**
+ * Each thread adds its own keys and finds the keys of all the threads.
+ * One thread re-creates the files part way through, while the others are reading.
+ */
+struct ConcurrentAccessThread
+{
+  ConcurrentAccessThread( const std::string& fileName, unsigned int threadIndex, unsigned int threadCount, unsigned int& invalidCount, boost::mutex& mutex )
+  : mFileName( fileName ),
+    mThreadIndex( threadIndex ),
+    mThreadCount( threadCount ),
+    mInvalidCount( invalidCount ),
+    mMutex( mutex )
+  {
+  }
+
+  void operator()()
+  {
+    const unsigned int KEYS_PER_ITERATION( 20u );
+    const unsigned int ITERATIONS( 50u );
+
+    Platform::DataCache* cache = Platform::DataCache::New( Platform::DataCache::READ_WRITE, Platform::DataCache::RUN_LENGTH_ENCODING, mFileName, MAX_DATA_SIZE, MAX_NUMBER_ENTRIES );
+
+    unsigned int invalidCount( 0 );
+    for( unsigned int iteration = 0; iteration < ITERATIONS; ++iteration )
+    {
+      KeyVector keys;
+      CreateKeys( ( iteration * mThreadCount + mThreadIndex ) * KEYS_PER_ITERATION, KEYS_PER_ITERATION, keys );
+      AddKeys( *cache, keys, KEYS_PER_ITERATION );
+
+      if( ( 0u == mThreadIndex ) && ( ITERATIONS / 2u == iteration ) )
+      {
+        ReCreateTestFiles( mFileName, Platform::DataCache::RUN_LENGTH_ENCODING );
+      }
+
+      // find the keys added by all the threads so far; some may have been removed by the re-creation
+      KeyVector allKeys;
+      CreateKeys( 0u, ( iteration + 1u ) * mThreadCount * KEYS_PER_ITERATION, allKeys );
+      FindKeys( *cache, allKeys, invalidCount );
+    }
+
+    delete cache;
+
+    boost::mutex::scoped_lock lock( mMutex );
+    mInvalidCount += invalidCount;
+  }
+
+  std::string   mFileName;
+  unsigned int  mThreadIndex;
+  unsigned int  mThreadCount;
+  unsigned int& mInvalidCount;
+  boost::mutex& mMutex;
+};
+
+} // unnamed namespace
+
+static void UtcDaliDataCacheFind()
+{
+  tet_infoline("Test data added to the cache is found, and missing keys are not");
+
+  TestFind( "find", Platform::DataCache::COMPRESSION_OFF );
+}
+
+static void UtcDaliDataCacheFindCompressed()
+{
+  tet_infoline("Test run length encoded data added to the cache is found");
+
+  TestFind( "find-compressed", Platform::DataCache::RUN_LENGTH_ENCODING );
+}
+
+static void UtcDaliDataCacheFindFromOtherCache()
+{
+  tet_infoline("Test data added by one cache is found by another cache using the same files");
+
+  const std::string fileName( GetTestFileName( "other-cache" ) );
+  RemoveTestFiles( fileName );
+
+  Platform::DataCache* writer = Platform::DataCache::New( Platform::DataCache::READ_WRITE, Platform::DataCache::RUN_LENGTH_ENCODING, fileName, MAX_DATA_SIZE, MAX_NUMBER_ENTRIES );
+  Platform::DataCache* reader = Platform::DataCache::New( Platform::DataCache::READ_ONLY, Platform::DataCache::RUN_LENGTH_ENCODING, fileName, MAX_DATA_SIZE, MAX_NUMBER_ENTRIES );
+
+  KeyVector keys;
+  CreateKeys( 0u, 100u, keys );
+  AddKeys( *writer, keys, 10u );
+
+  unsigned int invalidCount( 0 );
+  DALI_TEST_EQUALS( FindKeys( *reader, keys, invalidCount ), 100u, TEST_LOCATION );
+
+  // data added after the reader mapped the data file is beyond its mapping
+  KeyVector moreKeys;
+  CreateKeys( 100u, 100u, moreKeys );
+  AddKeys( *writer, moreKeys, 10u );
+
+  DALI_TEST_EQUALS( FindKeys( *reader, moreKeys, invalidCount ), 100u, TEST_LOCATION );
+  DALI_TEST_EQUALS( invalidCount, 0u, TEST_LOCATION );
+
+  delete reader;
+  delete writer;
+  RemoveTestFiles( fileName );
+}
+
+static void UtcDaliDataCacheReCreate()
+{
+  tet_infoline("Test re-creating the files does not truncate a mapped data file, and the cache uses the new files");
+
+  const std::string fileName( GetTestFileName( "recreate" ) );
+  RemoveTestFiles( fileName );
+
+  Platform::DataCache* cache = Platform::DataCache::New( Platform::DataCache::READ_WRITE, Platform::DataCache::COMPRESSION_OFF, fileName, MAX_DATA_SIZE, MAX_NUMBER_ENTRIES );
+
+  KeyVector keys;
+  CreateKeys( 0u, 200u, keys );
+  AddKeys( *cache, keys, 50u );
+
+  unsigned int invalidCount( 0 );
+  DALI_TEST_EQUALS( FindKeys( *cache, keys, invalidCount ), 200u, TEST_LOCATION );
+
+  std::size_t mappingSize( 0 );
+  DataCacheIo::FileIdentity oldIdentity;
+  const unsigned char* mapping = DataCacheIo::MapFile( fileName + ".data", mappingSize, oldIdentity );
+  DALI_TEST_CHECK( mapping );
+
+  ReCreateTestFiles( fileName, Platform::DataCache::COMPRESSION_OFF );
+
+  // the old file is replaced rather than truncated, so all of the old mapping can still be read
+  unsigned int checksum( 0 );
+  for( std::size_t i = 0; i < mappingSize; ++i )
+  {
+    checksum += mapping[i];
+  }
+  DALI_TEST_CHECK( checksum > 0u );
+  DataCacheIo::UnmapFile( mapping, mappingSize );
+
+  DataCacheIo::FileIdentity newIdentity;
+  DALI_TEST_CHECK( DataCacheIo::GetFileIdentity( fileName + ".data", newIdentity ) );
+  DALI_TEST_CHECK( !( newIdentity == oldIdentity ) );
+
+  // the cache discards the entries of the old files
+  DALI_TEST_EQUALS( FindKeys( *cache, keys, invalidCount ), 0u, TEST_LOCATION );
+
+  // and adds to the new files
+  KeyVector newKeys;
+  CreateKeys( 1000u, 50u, newKeys );
+  AddKeys( *cache, newKeys, 50u );
+  DALI_TEST_EQUALS( FindKeys( *cache, newKeys, invalidCount ), 50u, TEST_LOCATION );
+
+  Platform::DataCache* otherCache = Platform::DataCache::New( Platform::DataCache::READ_ONLY, Platform::DataCache::COMPRESSION_OFF, fileName, MAX_DATA_SIZE, MAX_NUMBER_ENTRIES );
+  DALI_TEST_EQUALS( FindKeys( *otherCache, newKeys, invalidCount ), 50u, TEST_LOCATION );
+  DALI_TEST_EQUALS( FindKeys( *otherCache, keys, invalidCount ), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( invalidCount, 0u, TEST_LOCATION );
+
+  delete otherCache;
+  delete cache;
+  RemoveTestFiles( fileName );
+}
+
+static void UtcDaliDataCacheConcurrentAccess()
+{
+  tet_infoline("Test threads adding and finding data in the same files, while the files are re-created");
+
+  const std::string fileName( GetTestFileName( "concurrent" ) );
+  RemoveTestFiles( fileName );
+
+  const unsigned int THREAD_COUNT( 4u );
+
+  unsigned int invalidCount( 0 );
+  boost::mutex mutex;
+
+  boost::thread_group threads;
+  for( unsigned int i = 0; i < THREAD_COUNT; ++i )
+  {
+    threads.create_thread( ConcurrentAccessThread( fileName, i, THREAD_COUNT, invalidCount, mutex ) );
+  }
+  threads.join_all();
+
+  // no thread found data which did not belong to its key
+  DALI_TEST_EQUALS( invalidCount, 0u, TEST_LOCATION );
+
+  // the files are still valid; the keys the first thread added after it re-created the files are found
+  Platform::DataCache* cache = Platform::DataCache::New( Platform::DataCache::READ_ONLY, Platform::DataCache::RUN_LENGTH_ENCODING, fileName, MAX_DATA_SIZE, MAX_NUMBER_ENTRIES );
+  KeyVector lastKeys;
+  CreateKeys( 49u * THREAD_COUNT * 20u, 20u, lastKeys );
+  DALI_TEST_EQUALS( FindKeys( *cache, lastKeys, invalidCount ), 20u, TEST_LOCATION );
+  DALI_TEST_EQUALS( invalidCount, 0u, TEST_LOCATION );
+
+  delete cache;
+  RemoveTestFiles( fileName );
+}
+
+static void UtcDaliDataCacheFindMissingFiles()
+{
+  tet_infoline("Test finding data when the cache files have been removed");
+
+  const std::string fileName( GetTestFileName( "missing" ) );
+  RemoveTestFiles( fileName );
+
+  Platform::DataCache* cache = Platform::DataCache::New( Platform::DataCache::READ_ONLY, Platform::DataCache::COMPRESSION_OFF, fileName, MAX_DATA_SIZE, MAX_NUMBER_ENTRIES );
+  RemoveTestFiles( fileName );
+
+  KeyVector keys;
+  CreateKeys( 0u, 10u, keys );
+
+  unsigned int invalidCount( 0 );
+  DALI_TEST_EQUALS( FindKeys( *cache, keys, invalidCount ), 0u, TEST_LOCATION );
+
+  delete cache;
+}
@@ -0,0 +1,228 @@
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <iostream>
+
+#include <stdlib.h>
+#include <boost/thread.hpp>
+
+#include <dali-test-suite-utils.h>
+
+#include "platform-abstractions/slp/font-platform/font-controller-impl.h"
+
+using namespace Dali;
+
+static void Startup();
+static void Cleanup();
+
+extern "C" {
+  void (*tet_startup)() = Startup;
+  void (*tet_cleanup)() = Cleanup;
+}
+
+enum {
+  POSITIVE_TC_IDX = 0x01,
+  NEGATIVE_TC_IDX,
+};
+
+#define MAX_NUMBER_OF_TESTS 10000
+extern "C" {
+  struct tet_testlist tet_testlist[MAX_NUMBER_OF_TESTS];
+}
+
+TEST_FUNCTION( UtcDaliFontControllerGetFontFamilyForChars,              POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliFontControllerGetFontFamilyForUnsupportedChars,   NEGATIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliFontControllerKnownFontsDoNotInvalidate,          POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliFontControllerSetDefaultFontFamilyRebuildsIndex,  POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliFontControllerRebuildWhileReading,                POSITIVE_TC_IDX );
+
+namespace
+{
+
+typedef Platform::FontController::StyledFontFamily StyledFontFamily;
+
+const uint32_t LATIN_CAPITAL_A = 0x41;
+const uint32_t LATIN_SMALL_Z = 0x7a;
+const uint32_t LAST_PRIVATE_USE_CHARACTER = 0x10fffd; ///< not supported by any font
+
+TextArray CreateText( uint32_t first, uint32_t last )
+{
+  TextArray text;
+  for( uint32_t character = first; character <= last; ++character )
+  {
+    text.push_back( character );
+  }
+  return text;
+}
+
+/**
+ * Looks up the font for some text, until it is told to stop.
+ */
+struct FontLookup
+{
+  FontLookup( SlpPlatform::FontController& controller, const TextArray& text, volatile bool& stop )
+  : mController( controller ),
+    mText( text ),
+    mStop( stop ),
+    mNumberOfLookups( 0u ),
+    mNumberOfFailures( 0u )
+  {
+  }
+
+  void operator()()
+  {
+    while( !mStop )
+    {
+      const StyledFontFamily font = mController.GetFontFamilyForChars( mText );
+      if( font.first.empty() )
+      {
+        ++mNumberOfFailures;
+      }
+      ++mNumberOfLookups;
+    }
+  }
+
+  SlpPlatform::FontController& mController;
+  const TextArray& mText;
+  volatile bool& mStop;
+  unsigned int mNumberOfLookups;
+  unsigned int mNumberOfFailures;
+};
+
+} // unnamed namespace
+
+// Called only once before first test is run.
+static void Startup()
+{
+}
+
+// Called only once after last test is run
+static void Cleanup()
+{
+}
+
+static void UtcDaliFontControllerGetFontFamilyForChars()
+{
+  tet_infoline("Testing that the font found for some text supports every character");
+
+  SlpPlatform::FontController controller;
+  const TextArray text = CreateText( LATIN_CAPITAL_A, LATIN_SMALL_Z );
+
+  const StyledFontFamily font = controller.GetFontFamilyForChars( text );
+  DALI_TEST_CHECK( !font.first.empty() );
+  DALI_TEST_CHECK( controller.AllGlyphsSupported( font, text ) );
+
+  // A second lookup reads the same index
+  const unsigned int generation = controller.GetFontConfigGeneration();
+  DALI_TEST_CHECK( font == controller.GetFontFamilyForChars( text ) );
+  DALI_TEST_EQUALS( controller.GetFontConfigGeneration(), generation, TEST_LOCATION );
+}
+
+static void UtcDaliFontControllerGetFontFamilyForUnsupportedChars()
+{
+  tet_infoline("Testing that no font is found for text which no font supports");
+
+  SlpPlatform::FontController controller;
+
+  TextArray text = CreateText( LATIN_CAPITAL_A, LATIN_SMALL_Z );
+  text.push_back( LAST_PRIVATE_USE_CHARACTER );
+
+  const StyledFontFamily font = controller.GetFontFamilyForChars( text );
+  DALI_TEST_CHECK( font.first.empty() );
+}
+
+static void UtcDaliFontControllerKnownFontsDoNotInvalidate()
+{
+  tet_infoline("Testing that caching fonts which the coverage index knows does not invalidate it");
+
+  SlpPlatform::FontController controller;
+  const TextArray text = CreateText( LATIN_CAPITAL_A, LATIN_SMALL_Z );
+
+  const StyledFontFamily font = controller.GetFontFamilyForChars( text );
+  const unsigned int generation = controller.GetFontConfigGeneration();
+
+  // Caches every font
+  const Platform::FontController::FontList fontList = controller.GetFontList( Platform::FontController::LIST_ALL_FONTS );
+  for( Platform::FontController::FontList::const_iterator iter = fontList.begin(), endIter = fontList.end(); iter != endIter; ++iter )
+  {
+    bool isDefault( false );
+    StyledFontFamily closestMatch;
+    controller.ValidateFontFamilyName( *iter, isDefault, closestMatch );
+  }
+
+  DALI_TEST_EQUALS( controller.GetFontConfigGeneration(), generation, TEST_LOCATION );
+  DALI_TEST_CHECK( font == controller.GetFontFamilyForChars( text ) );
+  DALI_TEST_EQUALS( controller.GetFontConfigGeneration(), generation, TEST_LOCATION );
+}
+
+static void UtcDaliFontControllerSetDefaultFontFamilyRebuildsIndex()
+{
+  tet_infoline("Testing that setting the default font family invalidates the coverage index, and the previous index is freed once it is rebuilt");
+
+  SlpPlatform::FontController controller;
+  const TextArray text = CreateText( LATIN_CAPITAL_A, LATIN_SMALL_Z );
+
+  const StyledFontFamily font = controller.GetFontFamilyForChars( text );
+
+  for( unsigned int i = 1u; i <= 3u; ++i )
+  {
+    const unsigned int generation = controller.GetFontConfigGeneration();
+    controller.SetDefaultFontFamily( font );
+    DALI_TEST_EQUALS( controller.GetFontConfigGeneration(), generation + 1u, TEST_LOCATION );
+
+    // The index is rebuilt for the new generation
+    DALI_TEST_CHECK( font == controller.GetFontFamilyForChars( text ) );
+    DALI_TEST_EQUALS( controller.GetFontConfigGeneration(), generation + 1u, TEST_LOCATION );
+
+    // No other thread reads the index, so the previous one has been freed
+    DALI_TEST_EQUALS( controller.GetNumberOfRetiredFontCoverageIndices(), 0u, TEST_LOCATION );
+  }
+}
+
+static void UtcDaliFontControllerRebuildWhileReading()
+{
+  tet_infoline("Testing that the coverage index can be rebuilt while other threads look up fonts");
+
+  SlpPlatform::FontController controller;
+  const TextArray text = CreateText( LATIN_CAPITAL_A, LATIN_SMALL_Z );
+
+  const StyledFontFamily font = controller.GetFontFamilyForChars( text );
+  DALI_TEST_CHECK( !font.first.empty() );
+
+  volatile bool stop( false );
+  FontLookup lookup1( controller, text, stop );
+  FontLookup lookup2( controller, text, stop );
+  boost::thread thread1( boost::ref( lookup1 ) );
+  boost::thread thread2( boost::ref( lookup2 ) );
+
+  const unsigned int numberOfRebuilds = 20u;
+  for( unsigned int i = 0u; i < numberOfRebuilds; ++i )
+  {
+    controller.SetDefaultFontFamily( font );
+    DALI_TEST_CHECK( font == controller.GetFontFamilyForChars( text ) );
+  }
+
+  stop = true;
+  thread1.join();
+  thread2.join();
+
+  tet_printf( "%u rebuilds during %u lookups\n", numberOfRebuilds, lookup1.mNumberOfLookups + lookup2.mNumberOfLookups );
+  DALI_TEST_EQUALS( lookup1.mNumberOfFailures + lookup2.mNumberOfFailures, 0u, TEST_LOCATION );
+
+  // The last reader has freed the indices of the previous generations
+  DALI_TEST_CHECK( font == controller.GetFontFamilyForChars( text ) );
+  DALI_TEST_EQUALS( controller.GetNumberOfRetiredFontCoverageIndices(), 0u, TEST_LOCATION );
+}
@@ -0,0 +1,237 @@
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <iostream>
+
+#include <stdlib.h>
+
+#include <dali-test-suite-utils.h>
+
+#include "platform-abstractions/slp/resource-loader/image-resampler.h"
+
+using namespace Dali;
+using namespace Dali::Integration;
+
+static void Startup();
+static void Cleanup();
+
+extern "C" {
+  void (*tet_startup)() = Startup;
+  void (*tet_cleanup)() = Cleanup;
+}
+
+enum {
+  POSITIVE_TC_IDX = 0x01,
+  NEGATIVE_TC_IDX,
+};
+
+#define MAX_NUMBER_OF_TESTS 10000
+extern "C" {
+  struct tet_testlist tet_testlist[MAX_NUMBER_OF_TESTS];
+}
+
+TEST_FUNCTION( UtcDaliImageResamplerScaledDimensions, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliImageResamplerShrinkToFit,      POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliImageResamplerScaleToFill,      POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliImageResamplerFullSize,         POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliImageResamplerCrop,             POSITIVE_TC_IDX );
+
+// Called only once before first test is run.
+static void Startup()
+{
+}
+
+// Called only once after last test is run
+static void Cleanup()
+{
+}
+
+namespace
+{
+
+/**
+ * Creates a bitmap filled with a pattern, or with a single value.
+ */
+BitmapPtr CreateBitmap( unsigned int width, unsigned int height, Pixel::Format pixelFormat, int value = -1 )
+{
+  BitmapPtr bitmap = Bitmap::New( Bitmap::BITMAP_2D_PACKED_PIXELS, true );
+  const unsigned int size = width * height * Pixel::GetBytesPerPixel( pixelFormat );
+  PixelBuffer* pixels = bitmap->GetPackedPixelsProfile()->ReserveBuffer( pixelFormat, width, height, width, height );
+
+  for( unsigned int i = 0; i < size; ++i )
+  {
+    pixels[i] = ( value < 0 ) ? static_cast<PixelBuffer>( ( i * 7u ) ^ ( i >> 5u ) ) : static_cast<PixelBuffer>( value );
+  }
+
+  return bitmap;
+}
+
+} // unnamed namespace
+
+static void UtcDaliImageResamplerScaledDimensions()
+{
+  unsigned int scaledWidth, scaledHeight, desiredWidth, desiredHeight;
+
+  ImageAttributes attributes;
+  attributes.SetSize( 128, 128 );
+
+  // Shrinks to fit inside the requested size.
+  DALI_TEST_CHECK( SlpPlatform::CalculateScaledDimensions( attributes, 2048u, 1024u, scaledWidth, scaledHeight, desiredWidth, desiredHeight ) );
+  DALI_TEST_EQUALS( desiredWidth, 128u, TEST_LOCATION );
+  DALI_TEST_EQUALS( desiredHeight, 64u, TEST_LOCATION );
+
+  // Never scales up.
+  DALI_TEST_CHECK( !SlpPlatform::CalculateScaledDimensions( attributes, 100u, 50u, scaledWidth, scaledHeight, desiredWidth, desiredHeight ) );
+  DALI_TEST_EQUALS( desiredWidth, 100u, TEST_LOCATION );
+  DALI_TEST_EQUALS( desiredHeight, 50u, TEST_LOCATION );
+
+  // Covers the requested size and crops the rest.
+  attributes.SetScalingMode( ImageAttributes::ScaleToFill );
+  DALI_TEST_CHECK( SlpPlatform::CalculateScaledDimensions( attributes, 2048u, 1024u, scaledWidth, scaledHeight, desiredWidth, desiredHeight ) );
+  DALI_TEST_EQUALS( scaledWidth, 256u, TEST_LOCATION );
+  DALI_TEST_EQUALS( scaledHeight, 128u, TEST_LOCATION );
+  DALI_TEST_EQUALS( desiredWidth, 128u, TEST_LOCATION );
+  DALI_TEST_EQUALS( desiredHeight, 128u, TEST_LOCATION );
+
+  attributes.SetScalingMode( ImageAttributes::FitHeight );
+  attributes.SetSize( 0, 100 );
+  DALI_TEST_CHECK( SlpPlatform::CalculateScaledDimensions( attributes, 400u, 200u, scaledWidth, scaledHeight, desiredWidth, desiredHeight ) );
+  DALI_TEST_EQUALS( desiredWidth, 200u, TEST_LOCATION );
+  DALI_TEST_EQUALS( desiredHeight, 100u, TEST_LOCATION );
+
+  DALI_TEST_EQUALS( SlpPlatform::CalculateBoxFilterFactor( 2048u, 1024u, 256u, 128u ), 8u, TEST_LOCATION );
+  DALI_TEST_EQUALS( SlpPlatform::CalculateBoxFilterFactor( 2048u, 1024u, 300u, 150u ), 4u, TEST_LOCATION );
+}
+
+static void UtcDaliImageResamplerShrinkToFit()
+{
+  BitmapPtr bitmap = CreateBitmap( 1023u, 517u, Pixel::RGBA8888, 77 );
+
+  ImageAttributes attributes;
+  attributes.SetSize( 61, 61 );
+
+  BitmapPtr scaled = SlpPlatform::ApplyAttributesToBitmap( bitmap, attributes );
+  DALI_TEST_CHECK( scaled != bitmap );
+  DALI_TEST_EQUALS( scaled->GetImageWidth(), 61u, TEST_LOCATION );
+  DALI_TEST_EQUALS( scaled->GetImageHeight(), 31u, TEST_LOCATION );
+  DALI_TEST_EQUALS( scaled->GetPixelFormat(), Pixel::RGBA8888, TEST_LOCATION );
+
+  // Filtering a plain image leaves it plain.
+  const PixelBuffer* pixels = scaled->GetBuffer();
+  bool plain = true;
+  for( unsigned int i = 0; i < 61u * 31u * 4u; ++i )
+  {
+    plain = plain && ( pixels[i] == 77 );
+  }
+  DALI_TEST_CHECK( plain );
+}
+
+static void UtcDaliImageResamplerScaleToFill()
+{
+  // A 2x box filter followed by a centred crop.
+  BitmapPtr bitmap = CreateBitmap( 300u, 200u, Pixel::RGB888 );
+
+  ImageAttributes attributes;
+  attributes.SetSize( 100, 100 );
+  attributes.SetScalingMode( ImageAttributes::ScaleToFill );
+
+  BitmapPtr scaled = SlpPlatform::ApplyAttributesToBitmap( bitmap, attributes );
+  DALI_TEST_EQUALS( scaled->GetImageWidth(), 100u, TEST_LOCATION );
+  DALI_TEST_EQUALS( scaled->GetImageHeight(), 100u, TEST_LOCATION );
+
+  const PixelBuffer* input = bitmap->GetBuffer();
+  const PixelBuffer* output = scaled->GetBuffer();
+  unsigned int mismatches = 0u;
+  for( unsigned int y = 0; y < 100u; ++y )
+  {
+    for( unsigned int x = 0; x < 100u; ++x )
+    {
+      for( unsigned int channel = 0; channel < 3u; ++channel )
+      {
+        const unsigned int column = ( x + 25u ) * 2u;
+        const unsigned int sum = input[( ( y * 2u ) * 300u + column ) * 3u + channel] + input[( ( y * 2u ) * 300u + column + 1u ) * 3u + channel] +
+                                 input[( ( y * 2u + 1u ) * 300u + column ) * 3u + channel] + input[( ( y * 2u + 1u ) * 300u + column + 1u ) * 3u + channel];
+        if( ( sum + 2u ) / 4u != output[( y * 100u + x ) * 3u + channel] )
+        {
+          ++mismatches;
+        }
+      }
+    }
+  }
+  DALI_TEST_EQUALS( mismatches, 0u, TEST_LOCATION );
+}
+
+static void UtcDaliImageResamplerFullSize()
+{
+  BitmapPtr bitmap = CreateBitmap( 64u, 32u, Pixel::L8 );
+
+  // No size requested.
+  ImageAttributes attributes;
+  DALI_TEST_CHECK( SlpPlatform::ApplyAttributesToBitmap( bitmap, attributes ) == bitmap );
+
+  // Bigger than the image.
+  attributes.SetSize( 128, 64 );
+  DALI_TEST_CHECK( SlpPlatform::ApplyAttributesToBitmap( bitmap, attributes ) == bitmap );
+
+  // Packed formats aren't resampled.
+  BitmapPtr packed = CreateBitmap( 64u, 32u, Pixel::RGB565 );
+  attributes.SetSize( 16, 16 );
+  DALI_TEST_CHECK( SlpPlatform::ApplyAttributesToBitmap( packed, attributes ) == packed );
+}
+
+static void UtcDaliImageResamplerCrop()
+{
+  unsigned int x, y, width, height;
+
+  ImageAttributes attributes;
+  DALI_TEST_CHECK( !SlpPlatform::CalculateCropRegion( attributes, 400u, 200u, x, y, width, height ) );
+  DALI_TEST_EQUALS( width, 400u, TEST_LOCATION );
+  DALI_TEST_EQUALS( height, 200u, TEST_LOCATION );
+
+  attributes.SetCrop( Rect<float>( 0.25f, 0.5f, 0.5f, 0.25f ) );
+  DALI_TEST_CHECK( SlpPlatform::CalculateCropRegion( attributes, 400u, 200u, x, y, width, height ) );
+  DALI_TEST_EQUALS( x, 100u, TEST_LOCATION );
+  DALI_TEST_EQUALS( y, 100u, TEST_LOCATION );
+  DALI_TEST_EQUALS( width, 200u, TEST_LOCATION );
+  DALI_TEST_EQUALS( height, 50u, TEST_LOCATION );
+
+  // Cropping without scaling copies the region.
+  BitmapPtr bitmap = CreateBitmap( 400u, 200u, Pixel::L8 );
+  BitmapPtr cropped = SlpPlatform::ApplyAttributesToBitmap( bitmap, attributes );
+  DALI_TEST_EQUALS( cropped->GetImageWidth(), 200u, TEST_LOCATION );
+  DALI_TEST_EQUALS( cropped->GetImageHeight(), 50u, TEST_LOCATION );
+
+  const PixelBuffer* input = bitmap->GetBuffer();
+  const PixelBuffer* output = cropped->GetBuffer();
+  unsigned int mismatches = 0u;
+  for( unsigned int row = 0; row < 50u; ++row )
+  {
+    for( unsigned int column = 0; column < 200u; ++column )
+    {
+      if( input[( row + 100u ) * 400u + column + 100u] != output[row * 200u + column] )
+      {
+        ++mismatches;
+      }
+    }
+  }
+  DALI_TEST_EQUALS( mismatches, 0u, TEST_LOCATION );
+
+  // The requested size applies to the region.
+  attributes.SetSize( 100, 100 );
+  BitmapPtr scaled = SlpPlatform::ApplyAttributesToBitmap( bitmap, attributes );
+  DALI_TEST_EQUALS( scaled->GetImageWidth(), 100u, TEST_LOCATION );
+  DALI_TEST_EQUALS( scaled->GetImageHeight(), 25u, TEST_LOCATION );
+}
@@ -0,0 +1,288 @@
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <iostream>
+#include <vector>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/time.h>
+
+#include <dali-test-suite-utils.h>
+
+#include <dali/integration-api/resource-cache.h>
+#include "platform-abstractions/slp/resource-loader/resource-loader.h"
+
+using namespace Dali;
+using namespace Dali::Integration;
+
+static void Startup();
+static void Cleanup();
+
+extern "C" {
+  void (*tet_startup)() = Startup;
+  void (*tet_cleanup)() = Cleanup;
+}
+
+enum {
+  POSITIVE_TC_IDX = 0x01,
+  NEGATIVE_TC_IDX,
+};
+
+#define MAX_NUMBER_OF_TESTS 10000
+extern "C" {
+  struct tet_testlist tet_testlist[MAX_NUMBER_OF_TESTS];
+}
+
+TEST_FUNCTION( UtcDaliResourceLoaderCancelQueued,          POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliResourceLoaderTimeToFirstVisible,    POSITIVE_TC_IDX );
+
+namespace
+{
+
+const char* const IMAGE_PATH = "/tmp/utc-Dali-ResourceLoader.bmp";
+const unsigned int IMAGE_SIZE = 1024u;          ///< The images are decoded, then scaled down to thumbnails
+const unsigned int THUMBNAIL_SIZE = 128u;
+
+const unsigned int GRID_IMAGE_COUNT = 200u;     ///< The number of images in the grid
+const unsigned int VISIBLE_IMAGE_COUNT = 20u;   ///< The images on screen, which are loaded with LoadPriorityHigh
+const unsigned int PREFETCH_IMAGE_COUNT = 80u;  ///< The images just off screen, which are loaded with LoadPriorityNormal
+                                                ///  The remaining images are loaded in the background, with LoadPriorityLow
+
+const unsigned int TIMEOUT_MILLISECONDS = 60000u;
+
+float GetMilliseconds( const timeval& start, const timeval& end )
+{
+  return static_cast<float>( end.tv_sec - start.tv_sec ) * 1000.0f +
+         static_cast<float>( end.tv_usec - start.tv_usec ) / 1000.0f;
+}
+
+/**
+ * Write an uncompressed 24 bit BMP file, filled with a pattern.
+ */
+void WriteBmp( const char* path, unsigned int size )
+{
+  const unsigned int imageBytes = size * size * 3u; // rows of a multiple of 4 bytes need no padding
+  const unsigned int fileBytes = 54u + imageBytes;
+
+  unsigned char header[54] = { 'B', 'M' };
+  header[2] = fileBytes & 0xff; header[3] = ( fileBytes >> 8 ) & 0xff; header[4] = ( fileBytes >> 16 ) & 0xff; header[5] = fileBytes >> 24;
+  header[10] = 54u;
+  header[14] = 40u;
+  header[18] = size & 0xff; header[19] = size >> 8;
+  header[22] = size & 0xff; header[23] = size >> 8;
+  header[26] = 1u;
+  header[28] = 24u;
+
+  std::vector<unsigned char> pixels( imageBytes );
+  for( unsigned int i = 0; i < imageBytes; ++i )
+  {
+    pixels[i] = static_cast<unsigned char>( ( i * 7u ) ^ ( i >> 9u ) );
+  }
+
+  FILE* file = fopen( path, "wb" );
+  DALI_TEST_CHECK( file );
+  if( file )
+  {
+    fwrite( header, 1, sizeof( header ), file );
+    fwrite( &pixels[0], 1, imageBytes, file );
+    fclose( file );
+  }
+}
+
+/**
+ * Records the order in which the resources are received from the ResourceLoader, and when.
+ */
+class TestResourceCache : public ResourceCache
+{
+public:
+
+  TestResourceCache()
+  {
+    gettimeofday( &mStart, NULL );
+  }
+
+  virtual void LoadResponse( ResourceId id, ResourceTypeId type, ResourcePointer resource, LoadStatus status )
+  {
+    if( RESOURCE_COMPLETELY_LOADED == status )
+    {
+      timeval now;
+      gettimeofday( &now, NULL );
+
+      mLoaded.push_back( id );
+      mLoadedMilliseconds.push_back( GetMilliseconds( mStart, now ) );
+    }
+  }
+
+  virtual void SaveComplete( ResourceId id, ResourceTypeId type )
+  {
+  }
+
+  virtual void LoadFailed( ResourceId id, ResourceFailure failure )
+  {
+    mFailed.push_back( id );
+  }
+
+  virtual void SaveFailed( ResourceId id, ResourceFailure failure )
+  {
+  }
+
+  /**
+   * Fetch the resources from the loader until the expected number has arrived.
+   */
+  void WaitForResources( SlpPlatform::ResourceLoader& loader, unsigned int count )
+  {
+    for( unsigned int waited = 0u; mLoaded.size() + mFailed.size() < count && waited < TIMEOUT_MILLISECONDS; ++waited )
+    {
+      usleep( 1000 );
+      loader.GetResources( *this );
+    }
+  }
+
+  timeval mStart;
+  std::vector<ResourceId> mLoaded;
+  std::vector<float> mLoadedMilliseconds;
+  std::vector<ResourceId> mFailed;
+};
+
+/**
+ * Load the thumbnails of a grid of images, the way a scrolling grid requests them:
+ * the background and prefetched images are requested first, and the visible ones when they are put on stage.
+ * @param[in] prioritised Whether the requests have the priority of their class, rather than LoadPriorityNormal.
+ * @param[out] firstVisible The milliseconds until the first visible image was received.
+ * @param[out] allVisible The milliseconds until every visible image was received.
+ * @param[out] lastVisiblePosition The position of the last visible image, in the order the images were received.
+ */
+void LoadGrid( bool prioritised, float& firstVisible, float& allVisible, unsigned int& lastVisiblePosition )
+{
+  SlpPlatform::ResourceLoader loader;
+
+  ImageAttributes attributes;
+  attributes.SetSize( THUMBNAIL_SIZE, THUMBNAIL_SIZE );
+  BitmapResourceType type( attributes );
+
+  TestResourceCache cache;
+
+  for( unsigned int i = 0; i < GRID_IMAGE_COUNT; ++i )
+  {
+    // Resource IDs 1 to VISIBLE_IMAGE_COUNT are the visible images, which are requested last
+    const ResourceId id = GRID_IMAGE_COUNT - i;
+
+    LoadResourcePriority priority = LoadPriorityNormal;
+    if( prioritised )
+    {
+      if( id <= VISIBLE_IMAGE_COUNT )
+      {
+        priority = LoadPriorityHigh;
+      }
+      else if( id > VISIBLE_IMAGE_COUNT + PREFETCH_IMAGE_COUNT )
+      {
+        priority = LoadPriorityLow;
+      }
+    }
+
+    loader.LoadResource( ResourceRequest( id, type, IMAGE_PATH, priority ) );
+  }
+
+  cache.WaitForResources( loader, GRID_IMAGE_COUNT );
+  DALI_TEST_EQUALS( cache.mLoaded.size(), static_cast<size_t>( GRID_IMAGE_COUNT ), TEST_LOCATION );
+  DALI_TEST_EQUALS( cache.mFailed.size(), static_cast<size_t>( 0u ), TEST_LOCATION );
+
+  firstVisible = 0.0f;
+  allVisible = 0.0f;
+  lastVisiblePosition = 0u;
+  bool found = false;
+  for( unsigned int position = 0; position < cache.mLoaded.size(); ++position )
+  {
+    if( cache.mLoaded[position] <= VISIBLE_IMAGE_COUNT )
+    {
+      if( !found )
+      {
+        firstVisible = cache.mLoadedMilliseconds[position];
+        found = true;
+      }
+      allVisible = cache.mLoadedMilliseconds[position];
+      lastVisiblePosition = position;
+    }
+  }
+}
+
+} // unnamed namespace
+
+// Called only once before first test is run.
+static void Startup()
+{
+  WriteBmp( IMAGE_PATH, IMAGE_SIZE );
+}
+
+// Called only once after last test is run
+static void Cleanup()
+{
+  unlink( IMAGE_PATH );
+}
+
+static void UtcDaliResourceLoaderCancelQueued()
+{
+  tet_infoline("Testing that cancelled requests are removed from the queue, and never delivered");
+
+  SlpPlatform::ResourceLoader loader;
+  loader.Pause();
+
+  BitmapResourceType type( ( ImageAttributes() ) );
+  const unsigned int requestCount = 50u;
+  for( ResourceId id = 1u; id <= requestCount; ++id )
+  {
+    loader.LoadResource( ResourceRequest( id, type, IMAGE_PATH, ( id % 2u ) ? LoadPriorityLow : LoadPriorityHigh ) );
+  }
+
+  // Cancel the odd requests, while they are all queued
+  for( ResourceId id = 1u; id <= requestCount; id += 2u )
+  {
+    loader.CancelLoad( id, ResourceBitmap );
+  }
+  loader.Resume();
+
+  TestResourceCache cache;
+  cache.WaitForResources( loader, requestCount / 2u );
+
+  // Give any cancelled request time to arrive
+  usleep( 100000 );
+  loader.GetResources( cache );
+
+  DALI_TEST_EQUALS( cache.mLoaded.size(), static_cast<size_t>( requestCount / 2u ), TEST_LOCATION );
+  for( unsigned int i = 0; i < cache.mLoaded.size(); ++i )
+  {
+    DALI_TEST_EQUALS( cache.mLoaded[i] % 2u, 0u, TEST_LOCATION );
+  }
+}
+
+static void UtcDaliResourceLoaderTimeToFirstVisible()
+{
+  tet_infoline("Measure the time until the visible images of a grid of 200 thumbnails are loaded");
+
+  float firstVisible, allVisible;
+  unsigned int lastVisiblePosition;
+
+  LoadGrid( false, firstVisible, allVisible, lastVisiblePosition );
+  tet_printf( "Equal priorities: first visible image after %.1f ms, all %u visible images after %.1f ms\n", firstVisible, VISIBLE_IMAGE_COUNT, allVisible );
+
+  LoadGrid( true, firstVisible, allVisible, lastVisiblePosition );
+  tet_printf( "Visible, prefetch & background priorities: first visible image after %.1f ms, all %u visible images after %.1f ms\n", firstVisible, VISIBLE_IMAGE_COUNT, allVisible );
+
+  // The visible images overtake the prefetched & background images which are still queued
+  DALI_TEST_CHECK( lastVisiblePosition < VISIBLE_IMAGE_COUNT + PREFETCH_IMAGE_COUNT );
+}
@@ -24,6 +24,7 @@
 
 
 // EXTERNAL INCLUDES
+#include <algorithm>
 #include <boost/functional/hash.hpp>
 #include <boost/thread.hpp>
 
@@ -39,6 +40,20 @@ namespace
 boost::mutex mFileCheckMutex; ///< used to ensure only one thread at a time is allowed to check a file for corruption
 std::vector<  std::size_t /* hash value*/>  fileCheckList;  ///< List of files hashes that have been checked
 
+const unsigned int MINIMUM_LOOKUP_SIZE( 64u );          ///< initial number of entries in the memory lookup, a power of two
+const unsigned int KEY_HASH_MULTIPLIER( 2654435761u );  ///< Knuth's multiplicative hash constant
+
+/**
+ * Helper to find the first lookup entry to probe for a key.
+ * @param[in] key the key
+ * @param[in] lookupSize the number of entries in the lookup, a power of two
+ * @return the index of the entry
+ */
+inline unsigned int GetLookupIndex( Dali::Platform::DataCache::DataKey key, unsigned int lookupSize )
+{
+  return ( key * KEY_HASH_MULTIPLIER ) & ( lookupSize - 1u );
+}
+
 bool FileCheckedForCorruption( std::size_t hashValue )
 {
   return std::find( fileCheckList.begin(), fileCheckList.end(), hashValue ) != fileCheckList.end();
@@ -84,6 +99,8 @@ DataCache::DataCache( Dali::Platform::DataCache::ReadWriteMode mode,
  mEncodeBuffer( NULL ),
  mDecodeBuffer( NULL ),
  mEncodeBufferSize(0),
+ mDataFileMapping( NULL ),
+ mDataFileMappingSize( 0 ),
  mMode( mode ),
  mCompressionMode( compressionMode )
 {
@@ -102,6 +119,8 @@ DataCache::DataCache( Dali::Platform::DataCache::ReadWriteMode mode,
 
 DataCache::~DataCache()
 {
+  UnmapDataFile();
+
   delete []mDecodeBuffer;
   delete []mEncodeBuffer;
 }
@@ -112,31 +131,29 @@ void DataCache::Find( const KeyVector& keyVector, DataVector& dataVector )
   dataVector.resize( keyVector.size() );
   SetExistsFlag( dataVector, false );
 
+  // discard the mapping and the memory lookup if another process has re-created the files
+  CheckForReCreatedFiles();
+
   // the aim is to avoid loading the index file, unless the key is not found in our memory lookup
   bool indexFileLoaded( false );
 
   // if the memory lookup is empty, this will try and load the index file
   InitialiseLookup( indexFileLoaded );
 
-  if( mLookup.empty() )
+  if( 0 == mNumberEntries )
   {
     // the index file has not been created
     return;
   }
 
-  // open the data file for read binary
-  FILE* dataFile = DataCacheIo::OpenFile( mDataFile.c_str(), DataCacheIo::DATA_FILE, DataCacheIo::NO_LOCK, DataCacheIo::READ_ONLY );
-  if( NULL == dataFile )
+  if( !MapDataFile() )
   {
-    DALI_LOG_ERROR("Failed to open data file '%s' for reading\n", mDataFile.c_str() );
+    DALI_LOG_ERROR("Failed to map data file '%s' for reading\n", mDataFile.c_str() );
     return;
   }
 
   // read the data for each key, if it exists
-  ReadFromDataFile( dataFile, indexFileLoaded, keyVector, dataVector );
-
-  // close the data file
-  fclose( dataFile );
+  ReadFromDataFile( indexFileLoaded, keyVector, dataVector );
 }
 
 // Add()
@@ -148,6 +165,7 @@ void DataCache::Find( const KeyVector& keyVector, DataVector& dataVector )
 // Stage 2.
 // - Insert data to the end of the file
 // - insert the new key / data offset to index file
+// - Flush the data file
 // - Increase the number of entries
 //
 // Stage 3.
@@ -158,6 +176,8 @@ void DataCache::Find( const KeyVector& keyVector, DataVector& dataVector )
 // We never write duplicate data.
 // Every entry in the index file, always has valid data.
 // The last chunk of data written to disk is the number of entries in the index file.
+// The data is flushed before it, so a reader that sees an entry can always read its data
+// from the memory mapped data file.
 // The write operations are atomic. If many threads are reading from the index file
 // while the write is in progress, depending on timing they will either read
 // n number of entries, or n+1 number of entries. In both cases the data will be valid.
@@ -187,6 +207,9 @@ void DataCache::Add( const KeyVector& keyVector, const DataVector& dataVector )
 
   if( dataFile != NULL && indexFile != NULL )
   {
+    // the files cannot be re-created while the lock is held
+    CheckForReCreatedFiles();
+
     // update our lookup table with the one on disk
     if( ReLoadIndexFile( indexFile ) )
     {
@@ -236,7 +259,7 @@ void DataCache::InitialiseLookup( bool &indexFileLoaded )
   // ensure the index file has been loaded at least once.
   indexFileLoaded = false;
 
-  if( mLookup.empty() )
+  if( 0 == mNumberEntries )
   {
     // if the memory lookup is empty, try loading the index from file
     LoadIndexFile();
@@ -268,8 +291,7 @@ void DataCache::LoadIndexFile()
   }
 }
 
-bool DataCache::ReadFromDataFile( FILE* dataFile,
-                                  bool indexFileLoaded,
+bool DataCache::ReadFromDataFile( bool indexFileLoaded,
                                   const KeyVector& keyVector,
                                   DataVector& dataVector
                                   )
@@ -281,26 +303,26 @@ bool DataCache::ReadFromDataFile( FILE* dataFile,
   {
     DataKey key = keyVector[index];
 
-    KeyLookup::const_iterator keyIter =  mLookup.find( key);
+    // offset in the data file of the binary data
+    unsigned int offset( 0 );
+    bool found = FindInLookup( key, offset );
 
     // if a key isn't found in the lookup and we haven't tried loading the index file yet, do it now.
-    if( ( keyIter == mLookup.end() ) && ( !indexFileLoaded ) )
+    if( ( !found ) && ( !indexFileLoaded ) )
     {
       LoadIndexFile();
       indexFileLoaded = true;
-      keyIter = mLookup.find( key );
+      found = FindInLookup( key, offset );
     }
 
     // if we have found key, fill in the data
-    if( keyIter != mLookup.end() )
+    if( found )
     {
-      // key.second holds the offset in the data file of the binary data
-      unsigned int offset = (*keyIter).second;
       Data& data(  dataVector[ index]  );
 
       DALI_ASSERT_DEBUG( data.exists == false);
 
-      bool ok = ReadData( dataFile, offset , key, data);
+      bool ok = ReadData( offset , key, data);
       if( !ok)
       {
         return false;
@@ -313,7 +335,7 @@ bool DataCache::ReadFromDataFile( FILE* dataFile,
 
 void DataCache::FindExistingData( const KeyVector& keyVector, DataVector& dataVector) const
 {
-  if( mLookup.empty() )
+  if( 0 == mNumberEntries )
   {
     return;
   }
@@ -321,14 +343,8 @@ void DataCache::FindExistingData( const KeyVector& keyVector, DataVector& dataVe
   // at the same time check for duplicate keys in the key vector
   for( unsigned int index = 0, vectorSize = keyVector.size(); index < vectorSize; ++index )
   {
-    if( mLookup.find( keyVector[index] ) == mLookup.end() )
-    {
-      dataVector[index].exists = false;
-    }
-    else
-    {
-      dataVector[index].exists = true;
-    }
+    unsigned int offset( 0 );
+    dataVector[index].exists = FindInLookup( keyVector[index], offset );
   }
 }
 
@@ -383,32 +399,51 @@ void DataCache::WriteDataAndUpdateIndex( const KeyVector& keyVector,
       DataCacheIo::WriteKey( indexFile, key, offset );
 
       // write to our memory lookup
-      mLookup[ key ] = offset;
+      AddToLookup( key, offset );
 
     }
   }
   if( newEntries )
   {
-    mNumberEntries+= newEntries;
-
     // assert if max entries is exceeded, the cache files will be deleted on restart
     DALI_ASSERT_ALWAYS( mNumberEntries <= mMaxNumberEntries);
 
+    // the data must be in the file before other threads / processes can see the new entries
+    if( fflush( dataFile ) )
+    {
+      DALI_LOG_ERROR("Error flushing data file\n");
+    }
+
     // write the number of entries
     DataCacheIo::WriteNumberEntries( indexFile, mNumberEntries );
 
   }
 }
 
-bool DataCache::ReadData( FILE* dataFile,
-                unsigned int offset,
+bool DataCache::ReadData( unsigned int offset,
                 DataCache::DataKey key,
-                DataCache::Data& data) const
+                DataCache::Data& data)
 {
-  unsigned char *dataBuffer( mEncodeBuffer );
+  // point to the data in the mapping
+  const unsigned char *dataBuffer( NULL );
 
-  // load the data in to the encode buffer
-  bool ok = DataCacheIo::ReadData( dataFile, offset, key, data, mEncodeBuffer, mEncodeBufferSize );
+  bool ok = DataCacheIo::ReadData( mDataFileMapping, mDataFileMappingSize, offset, key, data, dataBuffer, mEncodeBufferSize );
+  if( !ok )
+  {
+    // the data may have been written by another thread / process after the file was mapped
+    UnmapDataFile();
+    if( !MapDataFile() )
+    {
+      return false;
+    }
+    if( !( mDataFileIdentity == mLookupIdentity ) )
+    {
+      // the file has been re-created, the offsets in the memory lookup refer to the old file
+      ClearLookup();
+      return false;
+    }
+    ok = DataCacheIo::ReadData( mDataFileMapping, mDataFileMappingSize, offset, key, data, dataBuffer, mEncodeBufferSize );
+  }
   if( !ok )
   {
     DALI_LOG_ERROR("data file corrupt \n");
@@ -418,7 +453,7 @@ bool DataCache::ReadData( FILE* dataFile,
   if( mCompressionMode == RUN_LENGTH_ENCODING )
   {
     std::size_t bytesDecoded(0);
-    ok = DataCompression::DecodeRle( mEncodeBuffer, data.length, mDecodeBuffer, mMaxDataSize, bytesDecoded);
+    ok = DataCompression::DecodeRle( dataBuffer, data.length, mDecodeBuffer, mMaxDataSize, bytesDecoded);
     if( !ok )
     {
       DALI_LOG_ERROR("data file corrupt \n");
@@ -438,6 +473,119 @@ bool DataCache::ReadData( FILE* dataFile,
   return true;
 }
 
+bool DataCache::MapDataFile()
+{
+  if( NULL == mDataFileMapping )
+  {
+    mDataFileMapping = DataCacheIo::MapFile( mDataFile, mDataFileMappingSize, mDataFileIdentity );
+  }
+
+  return NULL != mDataFileMapping;
+}
+
+void DataCache::UnmapDataFile()
+{
+  if( NULL != mDataFileMapping )
+  {
+    DataCacheIo::UnmapFile( mDataFileMapping, mDataFileMappingSize );
+    mDataFileMapping = NULL;
+    mDataFileMappingSize = 0;
+  }
+}
+
+void DataCache::CheckForReCreatedFiles()
+{
+  // The files only grow, unless they are re-created after corruption is detected.
+  // Re-created files replace the old ones under the same name, and the old file stays
+  // valid while it is mapped, so a stale mapping can always be read safely. It is only
+  // discarded here so that the data added to the new files can be found.
+  DataCacheIo::FileIdentity identity;
+  const bool exists = DataCacheIo::GetFileIdentity( mDataFile, identity );
+
+  if( ( 0 != mNumberEntries ) && ( ( !exists ) || ( !( identity == mLookupIdentity ) ) ) )
+  {
+    DALI_LOG_WARNING("data file '%s' has been re-created\n", mDataFile.c_str() );
+    ClearLookup();
+  }
+
+  if( ( NULL != mDataFileMapping ) && ( ( !exists ) || ( !( identity == mDataFileIdentity ) ) ) )
+  {
+    UnmapDataFile();
+  }
+
+  // the identity is read before the index file, so entries loaded into an empty lookup belong to these files or newer ones
+  if( 0 == mNumberEntries )
+  {
+    mLookupIdentity = identity;
+  }
+}
+
+bool DataCache::FindInLookup( DataKey key, unsigned int& offset ) const
+{
+  const unsigned int lookupSize = mLookup.size();
+  if( 0 == lookupSize )
+  {
+    return false;
+  }
+
+  // linear probing until the key or an empty entry is found
+  for( unsigned int index = GetLookupIndex( key, lookupSize ); ; index = ( index + 1u ) & ( lookupSize - 1u ) )
+  {
+    const KeyLookupEntry& entry( mLookup[ index ] );
+    if( 0 == entry.mOffset )
+    {
+      return false;
+    }
+    if( entry.mKey == key )
+    {
+      offset = entry.mOffset;
+      return true;
+    }
+  }
+}
+
+void DataCache::AddToLookup( DataKey key, unsigned int offset )
+{
+  DALI_ASSERT_DEBUG( 0 != offset );
+
+  // keep the lookup at most half full, so probe sequences stay short
+  if( ( mNumberEntries + 1u ) * 2u > mLookup.size() )
+  {
+    KeyLookup oldLookup;
+    oldLookup.swap( mLookup );
+
+    const KeyLookupEntry emptyEntry = { 0, 0 };
+    mLookup.resize( std::max( MINIMUM_LOOKUP_SIZE, static_cast<unsigned int>( oldLookup.size() * 2u ) ), emptyEntry );
+    mNumberEntries = 0;
+
+    for( KeyLookup::const_iterator iter = oldLookup.begin(), endIter = oldLookup.end(); iter != endIter; ++iter )
+    {
+      if( 0 != iter->mOffset )
+      {
+        AddToLookup( iter->mKey, iter->mOffset );
+      }
+    }
+  }
+
+  const unsigned int lookupSize = mLookup.size();
+  unsigned int index = GetLookupIndex( key, lookupSize );
+  while( 0 != mLookup[ index ].mOffset )
+  {
+    DALI_ASSERT_DEBUG( mLookup[ index ].mKey != key && "key added twice to the lookup" );
+    index = ( index + 1u ) & ( lookupSize - 1u );
+  }
+
+  mLookup[ index ].mKey = key;
+  mLookup[ index ].mOffset = offset;
+  mNumberEntries++;
+}
+
+void DataCache::ClearLookup()
+{
+  mLookup.clear();
+  mNumberEntries = 0;
+}
+
 unsigned int DataCache::WriteData( FILE *dataFile, DataKey key, const Data &data) const
 {
   unsigned int offset;
@@ -481,6 +629,15 @@ bool DataCache::ReLoadIndexFile( FILE *indexFile )
 
   if( numberEntries < mNumberEntries )
   {
+    // another thread / process may have re-created the files since they were checked
+    DataCacheIo::FileIdentity identity;
+    if( DataCacheIo::GetFileIdentity( mDataFile, identity ) && !( identity == mLookupIdentity ) )
+    {
+      ClearLookup();
+      mLookupIdentity = identity;
+      return ReadNewEntries( indexFile, numberEntries );
+    }
+
     // this should not happen, but if it does delete the cache files and assert
     DALI_LOG_ERROR("numberEntries too small \n");
     return false;
@@ -508,12 +665,8 @@ bool DataCache::ReadNewEntries( FILE* indexFile, unsigned int newEntries)
       DataKey key( keyMeta[i].mKey );
       unsigned int offset (keyMeta[i].mOffset );
 
-      // check the key hasn't been stored before
-      DALI_ASSERT_DEBUG( mLookup.end() == mLookup.find( key) );
-
       // create a new key with the offset
-      mLookup[ key ] = offset;
-      mNumberEntries++;
+      AddToLookup( key, offset );
     }
   }
   else
@@ -536,10 +689,14 @@ bool DataCache::ReadNewEntries( FILE* indexFile, unsigned int newEntries)
 //  - The other app then tries to use the corrupt files, and detects an error.
 //   When either app restarts the cache will be recreated.
 //
-void DataCache::CloseAndReinitializeFiles( FILE** indexFile, FILE** dataFile ) const
+void DataCache::CloseAndReinitializeFiles( FILE** indexFile, FILE** dataFile )
 {
   DALI_LOG_ERROR( "corrupt data file detected, re-created" );
 
+  // the mapping and the memory lookup refer to the old files
+  UnmapDataFile();
+  ClearLookup();
+
   // close existing files
   if( indexFile && *indexFile )
   {
@@ -553,18 +710,15 @@ void DataCache::CloseAndReinitializeFiles( FILE** indexFile, FILE** dataFile ) c
     *dataFile = NULL;
   }
 
-  // reopen files writable
-  FILE* newDataFile = DataCacheIo::OpenFile( mDataFile, DataCacheIo::DATA_FILE, DataCacheIo::LOCK_FILE, DataCacheIo::READ_WRITE );
-  if( newDataFile != NULL )
+  // lock the data file while the files are replaced
+  FILE* lockedDataFile = DataCacheIo::OpenFile( mDataFile, DataCacheIo::DATA_FILE, DataCacheIo::LOCK_FILE, DataCacheIo::READ_WRITE );
+  if( lockedDataFile != NULL )
   {
-    FILE* newIndexFile = DataCacheIo::OpenFile( mIndexFile, DataCacheIo::INDEX_FILE, DataCacheIo::NO_LOCK, DataCacheIo::READ_WRITE );
-    if( newIndexFile != NULL )
-    {
-      // re-create the files with zero entries
-      DataCacheIo::ReCreateFiles( newIndexFile, newDataFile, mCompressionMode );
-      fclose( newIndexFile );
-    }
-    fclose( newDataFile );
+    // re-create the files with zero entries
+    DataCacheIo::ReCreateFiles( mIndexFile, mDataFile, mCompressionMode );
+
+    // closing the data file will release the lock
+    fclose( lockedDataFile );
   }
 }
 
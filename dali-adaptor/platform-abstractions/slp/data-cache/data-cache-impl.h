@@ -18,10 +18,11 @@
 //
 
 // EXTERNAL INCLUDES
-#include <map>
+#include <vector>
 
 // INTERNAL INCLUDES
 #include "../../interfaces/data-cache.h"
+#include "data-cache-io.h"
 
 namespace Dali
 {
@@ -55,9 +56,16 @@ namespace SlpPlatform
  * The Key is stored in the data file as well, to ensure the information held in the index file
  * is correct.
  *
+ * Both files are append only. Data is flushed to the data file before the keys and the number of entries
+ * are written to the index file, so every entry a reader can see in the index file has all of its data.
+ *
+ * The keys and offsets read from the index file are held in memory in an open addressing hash table.
+ * The data file is memory mapped for reading, so the data is read from the page cache without any file
+ * reads. The file is mapped again when an entry added by another thread / process is beyond the mapping.
+ *
  * Multi-threading / multi-process notes
  *
- * - Any thread / process can read from the data-cache files without being blocked.
+ * - Any thread / process can read from the data-cache files without being blocked or taking a file lock.
  * - Only a single thread / process can write data at any time. This is achieved by
  * using a file lock.
  * - Reading from the data-cache while it is being written to is fine. See DataCache::Add()
@@ -75,7 +83,7 @@ namespace SlpPlatform
  * If corruption is found they are deleted and recreated empty.
  *
  * Performance notes:
- * DataCache::Find() use std::map which has complexity of O( log n)
+ * DataCache::Find() uses a hash table which has complexity of O( 1 )
  * Plus the addition of a fixed time reading/writing the data to file system.
  * In simple terms, the time taken to Add or Find data in a data cache
  * with 10,000 entries is almost identical to a data cache with 100 items.
@@ -131,13 +139,11 @@ private:
 
   /**
    * Read data for each key.
-   * @param[in] dataFile data file
    * @param[in] indexFileLoaded whether the index file has been loaded
    * @param[in] keyVector vector of keys
    * @param[out] dataVector vector of data objects
    */
-  bool ReadFromDataFile( FILE* dataFile,
-                         bool indexFileLoaded,
+  bool ReadFromDataFile( bool indexFileLoaded,
                          const KeyVector& keyVector,
                          DataVector& dataVector
                          );
@@ -171,17 +177,55 @@ private:
                                 FILE* dataFile,
                                 FILE* indexFile );
   /**
-   * Read the data from the data file.
-   * @param[in] dataFile data file
-   * @param[in[ offset the file offset where the data exists
+   * Read the data from the memory mapped data file.
+   * If the data is beyond the mapping, the data file is mapped again.
+   * @param[in] offset the file offset where the data exists
    * @param[in] key used to ensure the data is for the correct key
    * @param[out] data assigned the data from the file
    * @return true on success, false on failure (corruption)
    */
-  bool ReadData( FILE* dataFile,
-                  unsigned int offset,
-                  DataKey key,
-                  Data &data) const;
+  bool ReadData( unsigned int offset,
+                 DataKey key,
+                 Data &data);
+
+  /**
+   * Memory map the data file, if it isn't mapped already.
+   * @return true on success, false on failure
+   */
+  bool MapDataFile();
+
+  /**
+   * Unmap the data file, if it is mapped.
+   */
+  void UnmapDataFile();
+
+  /**
+   * Checks the files haven't been re-created by another thread / process since the memory lookup was loaded,
+   * or since the data file was mapped. If they have, the memory lookup and the mapping are discarded.
+   * The old data file is never truncated, so a stale mapping is still safe to read until then.
+   */
+  void CheckForReCreatedFiles();
+
+  /**
+   * Find the data offset of a key in the memory lookup.
+   * @param[in] key the key
+   * @param[out] offset the offset of the data in the data file
+   * @return true if the key was found
+   */
+  bool FindInLookup( DataKey key, unsigned int& offset ) const;
+
+  /**
+   * Add a key and the offset of its data to the memory lookup.
+   * Increases the number of entries.
+   * @param[in] key the key
+   * @param[in] offset the offset of the data in the data file
+   */
+  void AddToLookup( DataKey key, unsigned int offset );
+
+  /**
+   * Remove all the entries from the memory lookup.
+   */
+  void ClearLookup();
 
   /**
    * Write the data to the data file.
@@ -208,11 +252,11 @@ private:
   bool ReadNewEntries( FILE* indexFile, unsigned int newEntries);
 
   /**
-   * Close existing files, then calls DataCacheIo::RecreateFiles to truncate and reinitialize the files
+   * Close existing files, then calls DataCacheIo::ReCreateFiles to replace them with empty files
    * @param[in] indexFile index file
    * @param[in] dataFile data file
    */
-  void CloseAndReinitializeFiles(FILE** indexFile , FILE** dataFile) const;
+  void CloseAndReinitializeFiles(FILE** indexFile , FILE** dataFile);
 
   /**
    * Return the maximum buffer size of encoded data.
@@ -222,9 +266,19 @@ private:
    */
   unsigned int GetMaxEncodedDataSize() const;
 
-  typedef std::map< DataKey, unsigned int /* file offset */ > KeyLookup;
+  /**
+   * Memory lookup entry.
+   * Data is never at offset zero (the file header is), so a zero offset marks an empty entry.
+   */
+  struct KeyLookupEntry
+  {
+    DataKey      mKey;                ///< Key
+    unsigned int mOffset;             ///< Offset of the data in the data file
+  };
+
+  typedef std::vector< KeyLookupEntry > KeyLookup;
 
-  KeyLookup      mLookup;             ///< Lookup between key, and offset of the value in a table.
+  KeyLookup      mLookup;             ///< Lookup between key, and offset of the value in a table. Open addressing with linear probing.
   std::string    mIndexFile;          ///< index file name
   std::string    mDataFile;           ///< cache file name
   unsigned int   mNumberEntries;      ///< how many entries in our lookup (mLookup.size() can be O(n)
@@ -233,6 +287,10 @@ private:
   unsigned char* mEncodeBuffer;       ///< encode buffer for compressed data
   unsigned char* mDecodeBuffer;       ///< decode buffer for un-compressed data
   std::size_t    mEncodeBufferSize;   ///< Size of the encode buffer
+  const unsigned char* mDataFileMapping;     ///< memory mapped data file
+  std::size_t          mDataFileMappingSize; ///< size of the memory mapped data file
+  DataCacheIo::FileIdentity mDataFileIdentity; ///< identity of the memory mapped data file
+  DataCacheIo::FileIdentity mLookupIdentity;   ///< identity of the data file the memory lookup refers to
 
   Platform::DataCache::ReadWriteMode    mMode;             ///< read / write mode.
   Platform::DataCache::CompressionMode  mCompressionMode;  ///< Compression mode
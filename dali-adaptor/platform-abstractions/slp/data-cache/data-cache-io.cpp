@@ -22,10 +22,15 @@
 
 // EXTERNAL INCLUDES
 #include <stdio.h>
+#include <stdlib.h>     // mkstemp()
 #include <string.h>
 #include <sys/file.h>   // flock()
-#include <unistd.h>     // ftruncate()
+#include <sys/mman.h>   // mmap()
+#include <sys/stat.h>   // fstat()
+#include <fcntl.h>      // open()
+#include <unistd.h>     // fsync()
 #include <errno.h>
+#include <vector>
 
 
 namespace Dali
@@ -389,6 +394,89 @@ bool LockFile(FILE* file)
 
   return true;
 }
+
+/**
+ * Helper to fill in the identity of a file from its status.
+ */
+void SetIdentity( const struct stat& fileStatus, FileIdentity& identity )
+{
+  identity.mDevice = fileStatus.st_dev;
+  identity.mInode = fileStatus.st_ino;
+}
+
+/**
+ * Helper to check an open file is still the file held under its file name.
+ */
+bool IsCurrentFile( FILE* file, const std::string& fileName )
+{
+  struct stat openStatus;
+  struct stat nameStatus;
+  if( ( 0 != fstat( fileno( file ), &openStatus ) ) || ( 0 != stat( fileName.c_str(), &nameStatus ) ) )
+  {
+    // if the file has been removed, the caller can still use the open file
+    return true;
+  }
+
+  return ( openStatus.st_dev == nameStatus.st_dev ) && ( openStatus.st_ino == nameStatus.st_ino );
+}
+
+/**
+ * Helper to create a uniquely named temporary file, next to the file it will replace.
+ * @param[in] fileName the name of the file that will be replaced
+ * @param[out] tempFileName the name of the temporary file
+ * @param[out] file the temporary file, opened for writing
+ * @return true on success
+ */
+bool CreateTemporaryFile( const std::string& fileName, std::string& tempFileName, FILE** file )
+{
+  std::vector< char > nameTemplate( fileName.begin(), fileName.end() );
+  const char suffix[] = ".XXXXXX";
+  nameTemplate.insert( nameTemplate.end(), suffix, suffix + sizeof( suffix ) );
+
+  int fileDescriptor = mkstemp( &nameTemplate[0] );
+  if( fileDescriptor < 0 )
+  {
+    DALI_LOG_ERROR( "Error '%s' creating temporary file for %s\n", strerror( errno ), fileName.c_str() );
+    return false;
+  }
+  tempFileName = &nameTemplate[0];
+
+  // mkstemp creates the file readable by the owner only
+  fchmod( fileDescriptor, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH );
+
+  *file = fdopen( fileDescriptor, "w+b" );
+  if( *file == NULL )
+  {
+    DALI_LOG_ERROR( "Error '%s' opening temporary file %s\n", strerror( errno ), tempFileName.c_str() );
+    close( fileDescriptor );
+    unlink( tempFileName.c_str() );
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * Helper to close a temporary file and rename it over the file it replaces.
+ * @param[in] file the temporary file
+ * @param[in] tempFileName the name of the temporary file
+ * @param[in] fileName the name of the file to replace
+ */
+void ReplaceFile( FILE* file, const std::string& tempFileName, const std::string& fileName )
+{
+  // the contents must be on disk before the file is visible under its new name
+  bool ok = ( 0 == fflush( file ) ) && ( 0 == fsync( fileno( file ) ) );
+  ok = ( 0 == fclose( file ) ) && ok;
+
+  if( ok && ( 0 == rename( tempFileName.c_str(), fileName.c_str() ) ) )
+  {
+    return;
+  }
+
+  DALI_LOG_ERROR( "Error '%s' replacing %s\n", strerror( errno ), fileName.c_str() );
+  unlink( tempFileName.c_str() );
+}
+
 }; // unnamed namespace
 ////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////
@@ -409,11 +497,14 @@ void CheckAndRepairFiles( const std::string& indexFileName,
     FILE* indexFile = OpenFile( indexFileName, INDEX_FILE, NO_LOCK, READ_WRITE, CREATE_IF_MISSING );
     if( indexFile != NULL )
     {
-      if( ! CheckFilesAreValid( indexFile, dataFile, compressionMode, maxDataSize, maxNummberEntries) )
+      bool valid = CheckFilesAreValid( indexFile, dataFile, compressionMode, maxDataSize, maxNummberEntries);
+      fclose( indexFile);
+
+      if( ! valid )
       {
-        ReCreateFiles( indexFile, dataFile, compressionMode);
+        // the lock on the data file is held until it is closed
+        ReCreateFiles( indexFileName, dataFileName, compressionMode);
       }
-      fclose( indexFile);
     }
     fclose( dataFile);
   }
@@ -432,9 +523,18 @@ FILE* OpenFile(const std::string& fileName,
   {
     if((fileMode == READ_WRITE) && (creationMode == CREATE_IF_MISSING) )
     {
-      // Attempt to create a new file for reading / writing
+      // Attempt to create a new file for reading / writing.
+      // Another thread / process may create it at the same time, so it is never truncated.
       DALI_LOG_INFO( gLogFilter , Debug::Concise, "Creating new file: %s\n",fileName.c_str());
-      file = fopen( fileName.c_str(), "w+b");
+      int fileDescriptor = open( fileName.c_str(), O_RDWR | O_CREAT, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH );
+      if( fileDescriptor >= 0 )
+      {
+        file = fdopen( fileDescriptor, "r+b" );
+        if( file == NULL )
+        {
+          close( fileDescriptor );
+        }
+      }
       if( file == NULL )
       {
         DALI_LOG_ERROR( "Failed to create file %s, with error '%s'\n", fileName.c_str(), strerror( errno ) );
@@ -453,39 +553,41 @@ FILE* OpenFile(const std::string& fileName,
         fclose( file );
         file = NULL;
       }
+      else if( ! IsCurrentFile( file, fileName ) )
+      {
+        // the file was re-created while waiting for the lock, the lock must be taken on the new file
+        fclose( file );
+        file = OpenFile( fileName, fileType, lockMode, fileMode, creationMode );
+      }
     }
   }
 
   return file;
 }
 
-void ReCreateFiles(FILE* indexFile, FILE* dataFile, CompressionMode compressionMode )
+void ReCreateFiles( const std::string& indexFileName, const std::string& dataFileName, CompressionMode compressionMode )
 {
-  int resultStatus(0);
-
-  // Truncate to zero and then write new headers.
+  // The new files are written under temporary names then renamed over the old files.
+  // Truncating the old files would fault any reader still mapping them.
+  // The index file is replaced first, so a reader never sees entries without data.
 
   // index file
-  resultStatus = ftruncate( fileno( indexFile ), 0);
-  if( resultStatus )
-  {
-    DALI_LOG_ERROR( "Error '%s' truncating index file\n", strerror( errno ) );
-  }
-  else
+  FILE* indexFile( NULL );
+  std::string tempIndexFileName;
+  if( CreateTemporaryFile( indexFileName, tempIndexFileName, &indexFile ) )
   {
     WriteHeader( indexFile, INDEX_FILE_DESCRPITION, compressionMode);
     WriteNumberEntries( indexFile, 0 );
+    ReplaceFile( indexFile, tempIndexFileName, indexFileName );
   }
 
   // data file
-  resultStatus = ftruncate( fileno( dataFile ), 0);
-  if( resultStatus )
-  {
-    DALI_LOG_ERROR( "Error '%s' truncating data file\n", strerror( errno ) );
-  }
-  else
+  FILE* dataFile( NULL );
+  std::string tempDataFileName;
+  if( CreateTemporaryFile( dataFileName, tempDataFileName, &dataFile ) )
   {
     WriteHeader( dataFile, DATA_FILE_DESCRPITION, compressionMode);
+    ReplaceFile( dataFile, tempDataFileName, dataFileName );
   }
 }
 
@@ -552,6 +654,112 @@ bool ReadData( FILE* dataFile,
   return true;
 }
 
+bool ReadData( const unsigned char* mapping,
+              std::size_t mappingSize,
+              unsigned int offset,
+              DataKey key,
+              Data& data,
+              const unsigned char*& dataBuffer,
+              unsigned int bufferSize)
+{
+  // make sure the data meta information is in the mapping
+  if( ( offset < FILE_HEADER_SIZE ) || ( offset + DATA_META_SIZE > mappingSize ) )
+  {
+    DALI_LOG_INFO( gLogFilter, Debug::Verbose, "data offset %d is not in the mapping\n", offset );
+    return false;
+  }
+
+  // the data is not aligned in the file, so the meta information is copied out
+  DataMeta meta;
+  memcpy( &meta, mapping + offset, DATA_META_SIZE );
+
+  // check the key matches
+  if( meta.mKey != key )
+  {
+    DALI_LOG_ERROR("Key miss-match in data file\n");
+    return false;
+  }
+
+  // make sure the size is valid
+  if( meta.mLength > bufferSize )
+  {
+    DALI_LOG_ERROR("Data size is corrupt in data file %d data size, buffer size %d \n", meta.mLength, bufferSize);
+    return false;
+  }
+
+  // make sure all the data is in the mapping
+  if( offset + DATA_META_SIZE + meta.mLength > mappingSize )
+  {
+    DALI_LOG_INFO( gLogFilter, Debug::Verbose, "data at offset %d is not in the mapping\n", offset );
+    return false;
+  }
+
+  data.length = meta.mLength;
+  dataBuffer = mapping + offset + DATA_META_SIZE;
+
+  return true;
+}
+
+const unsigned char* MapFile( const std::string& fileName, std::size_t& mappingSize, FileIdentity& identity )
+{
+  mappingSize = 0;
+
+  int fileDescriptor = open( fileName.c_str(), O_RDONLY );
+  if( fileDescriptor < 0 )
+  {
+    DALI_LOG_ERROR( "Failed to open file %s, with error '%s'\n", fileName.c_str(), strerror( errno ) );
+    return NULL;
+  }
+
+  const unsigned char* mapping( NULL );
+
+  struct stat fileStatus;
+  if( 0 != fstat( fileDescriptor, &fileStatus ) )
+  {
+    DALI_LOG_ERROR( "Error '%s' reading the size of %s\n", strerror( errno ), fileName.c_str() );
+  }
+  else if( fileStatus.st_size > 0 )
+  {
+    SetIdentity( fileStatus, identity );
+
+    void* address = mmap( NULL, fileStatus.st_size, PROT_READ, MAP_SHARED, fileDescriptor, 0 );
+    if( MAP_FAILED == address )
+    {
+      DALI_LOG_ERROR( "Error '%s' mapping %s\n", strerror( errno ), fileName.c_str() );
+    }
+    else
+    {
+      mapping = static_cast< const unsigned char* >( address );
+      mappingSize = fileStatus.st_size;
+    }
+  }
+
+  // the mapping stays valid after the file is closed
+  close( fileDescriptor );
+
+  return mapping;
+}
+
+void UnmapFile( const unsigned char* mapping, std::size_t mappingSize )
+{
+  if( 0 != munmap( const_cast< unsigned char* >( mapping ), mappingSize ) )
+  {
+    DALI_LOG_ERROR( "Error '%s' unmapping file\n", strerror( errno ) );
+  }
+}
+
+bool GetFileIdentity( const std::string& fileName, FileIdentity& identity )
+{
+  struct stat fileStatus;
+  if( 0 != stat( fileName.c_str(), &fileStatus ) )
+  {
+    return false;
+  }
+
+  SetIdentity( fileStatus, identity );
+  return true;
+}
+
 bool ReadEntries(FILE *indexFile, KeyMeta* meta, unsigned int startIndex, unsigned int count)
 {
   // seek past the header and existing entries to startIndex
@@ -105,6 +105,32 @@ private:
   KeyMeta& operator=( const KeyMeta&);
 };
 
+/**
+ * Identifies a file on disk, rather than a file name.
+ * A file re-created under the same name has a different identity.
+ */
+struct FileIdentity
+{
+  /**
+   * Constructor
+   */
+  FileIdentity()
+  : mDevice( 0 ),
+    mInode( 0 )
+  {}
+
+  /**
+   * @return true if both identities refer to the same file
+   */
+  bool operator==( const FileIdentity& rhs ) const
+  {
+    return ( mDevice == rhs.mDevice ) && ( mInode == rhs.mInode );
+  }
+
+  unsigned long long mDevice;   ///< Device the file is on
+  unsigned long long mInode;    ///< Inode number of the file
+};
+
 /**
  *  Check the index and data files and repair if required
  *  @param[in] indexFileName index filename
@@ -127,6 +153,8 @@ void CheckAndRepairFiles( const std::string& indexFileName,
  * @param[in] fileMode whether to open the file for reading or read/writing.
  * @param[in] creationMode whether to create the file if it's missing or not
  * @return pointer to a file.
+ * If the file is locked, it is the file currently held under the file name;
+ * a file re-created by another thread / process while waiting for the lock is opened again.
  */
 FILE* OpenFile(const std::string& fileName,
               FileType fileType,
@@ -135,12 +163,17 @@ FILE* OpenFile(const std::string& fileName,
               FileCreationMode creationMode = DONT_CREATE_IF_MISSING);
 
 /**
- * Erases the contents of both index and data files and writes a new header.
- * @param[in] indexFile index file
- * @param[in] dataFile data file
+ * Re-creates both index and data files empty, with new headers.
+ * The new files are written under temporary names, then renamed over the old files.
+ * The old files are never truncated, so readers still mapping them are unaffected.
+ * The caller must hold the lock on the data file.
+ * @param[in] indexFileName index file name
+ * @param[in] dataFileName data file name
  * @param[in] compressionMode data compression mode
  */
-void ReCreateFiles(FILE* indexFile, FILE* dataFile, Dali::Platform::DataCache::CompressionMode compressionMode);
+void ReCreateFiles( const std::string& indexFileName,
+                    const std::string& dataFileName,
+                    Dali::Platform::DataCache::CompressionMode compressionMode );
 
 /**
  * Prepares both index and data file to have data written to.
@@ -179,6 +212,50 @@ bool ReadData( FILE* dataFile,
               unsigned char* dataBuffer,
               unsigned int bufferSize);
 
+/**
+ * Reads data from a memory mapped data file.
+ * The size of the data read is held in data.length.
+ * @param[in] mapping the memory mapped data file
+ * @param[in] mappingSize the size of the mapping in bytes
+ * @param[in] offset file offset
+ * @param[in] key the key value, used to ensure the correct data is read
+ * @param[out] data the data.length value is set to the data length.
+ * @param[out] dataBuffer set to point to the data in the mapping
+ * @param[in] bufferSize the maximum size of the data in bytes
+ * @return true on success, false if the data is not valid or not all of it is in the mapping
+ */
+bool ReadData( const unsigned char* mapping,
+              std::size_t mappingSize,
+              unsigned int offset,
+              Dali::Platform::DataCache::DataKey key,
+              Dali::Platform::DataCache::Data& data,
+              const unsigned char*& dataBuffer,
+              unsigned int bufferSize);
+
+/**
+ * Memory maps a file for reading.
+ * @param[in] fileName file name
+ * @param[out] mappingSize the size of the mapping in bytes
+ * @param[out] identity the identity of the file that was mapped
+ * @return pointer to the mapping, NULL on failure or if the file is empty
+ */
+const unsigned char* MapFile( const std::string& fileName, std::size_t& mappingSize, FileIdentity& identity );
+
+/**
+ * Unmaps a file mapped with MapFile().
+ * @param[in] mapping pointer to the mapping
+ * @param[in] mappingSize the size of the mapping in bytes
+ */
+void UnmapFile( const unsigned char* mapping, std::size_t mappingSize );
+
+/**
+ * Gets the identity of the file currently held under a file name.
+ * @param[in] fileName file name
+ * @param[out] identity the identity of the file
+ * @return true on success, false on failure
+ */
+bool GetFileIdentity( const std::string& fileName, FileIdentity& identity );
+
 /**
  * Read the | KEY | OFFSET | entries from the index file.
  * @param[in] indexFile the index file
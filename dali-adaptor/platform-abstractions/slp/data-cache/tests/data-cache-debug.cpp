@@ -237,13 +237,11 @@ void FullFileCheck(  FILE* indexFile,
 
 void ClearTestFiles( const std::string& indexFileName, const std::string& dataFileName )
 {
-  FILE* dataFile = DataCacheIo::OpenFile( dataFileName, DataCacheIo::DATA_FILE, DataCacheIo::NO_LOCK, DataCacheIo::READ_WRITE, DataCacheIo::CREATE_IF_MISSING );
-  FILE* indexFile = DataCacheIo::OpenFile( indexFileName, DataCacheIo::INDEX_FILE, DataCacheIo::NO_LOCK, DataCacheIo::READ_WRITE, DataCacheIo::CREATE_IF_MISSING);
+  FILE* dataFile = DataCacheIo::OpenFile( dataFileName, DataCacheIo::DATA_FILE, DataCacheIo::LOCK_FILE, DataCacheIo::READ_WRITE, DataCacheIo::CREATE_IF_MISSING );
 
-  ReCreateFiles( indexFile, dataFile, COMPRESSION_MODE);
+  ReCreateFiles( indexFileName, dataFileName, COMPRESSION_MODE);
 
   fclose( dataFile );
-  fclose( indexFile );
 }
 
 } // unnamed name space
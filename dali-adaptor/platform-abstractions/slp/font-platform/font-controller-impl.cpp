@@ -20,6 +20,8 @@
 
 // EXTERNAL HEADERS
 #include <fontconfig/fontconfig.h>
+#include <algorithm>
+#include <set>
 
 
 namespace Dali
@@ -44,6 +46,11 @@ const std::string SETTING_FONT_APP_FONT_PATH( FONT_APPLICATION_PATH );
 const uint32_t UNICODE_CR_LF = 0x85;
 const uint32_t UNICODE_CHAR_START = 0x20;       // start range of unicode characters (below are control chars)
 
+const uint32_t CHARACTER_PAGE_SHIFT = 8u;        // FontConfig character set pages hold 256 consecutive characters
+const uint32_t CHARACTER_PAGE_MASK = ( 1u << CHARACTER_PAGE_SHIFT ) - 1u;
+const uint32_t CHARACTER_MAP_WORD_SHIFT = 5u;    // each word of a page map holds 32 characters
+const uint32_t CHARACTER_MAP_BIT_MASK = ( 1u << CHARACTER_MAP_WORD_SHIFT ) - 1u;
+
 /**
  * @param[in] pattern pointer to a font config pattern
  * @return font style name or an empty string if the font has no style
@@ -82,6 +89,14 @@ std::string GetFontFamily( const FcPattern *pattern )
   return familyName;
 }
 
+bool IsDownloadedFont( const std::string& fileName )
+{
+  const std::string& downloadPath( SETTING_FONT_DOWNLOADED_FONT_PATH );
+  const std::size_t downloadLength = downloadPath.length();
+
+  return 0 == downloadPath.compare(0, downloadLength, fileName, 0, downloadLength);
+}
+
 bool CheckFontInstallPath( FontController::FontListMode listMode, const std::string& fileName )
 {
   switch( listMode )
@@ -89,12 +104,10 @@ bool CheckFontInstallPath( FontController::FontListMode listMode, const std::str
     case FontController::LIST_SYSTEM_FONTS:
     {
       const std::string& preloadPath( SETTING_FONT_PRELOAD_FONT_PATH );
-      const std::string& downloadPath( SETTING_FONT_DOWNLOADED_FONT_PATH );
       const std::size_t preloadLength = preloadPath.length();
-      const std::size_t downloadLength = downloadPath.length();
 
       if( 0 == preloadPath.compare(0, preloadLength, fileName, 0, preloadLength) ||
-           0 == downloadPath.compare(0, downloadLength, fileName, 0, downloadLength))
+          IsDownloadedFont( fileName ) )
       {
         return true;
       }
@@ -121,7 +134,59 @@ bool CheckFontInstallPath( FontController::FontListMode listMode, const std::str
 
 } // unnamed namespace
 
+/**
+ * Coverage index of the preferred fonts.
+ */
+struct FontController::FontCoverageIndex
+{
+  /**
+   * The characters of a page supported by a font.
+   */
+  struct PageCoverage
+  {
+    std::size_t mFontIndex;                  ///< index to the font in mFonts
+    FcChar32    mMap[FC_CHARSET_MAP_SIZE];   ///< one bit per character of the page
+  };
+
+  typedef std::vector<PageCoverage> PageCoverageList;     ///< coverage of a page, ordered by font index
+  typedef std::map<uint32_t, PageCoverageList> PageLookup; ///< lookup for page numbers and their coverage
+
+  /**
+   * Finds the first font, starting from the given one, which supports a character.
+   * @param[in] character The character.
+   * @param[in] firstFontIndex The index of the first font checked.
+   * @return The index of the font, or the number of fonts if none supports the character.
+   */
+  std::size_t FindFont( uint32_t character, std::size_t firstFontIndex ) const
+  {
+    PageLookup::const_iterator pageIt = mPages.find( character >> CHARACTER_PAGE_SHIFT );
+    if( pageIt != mPages.end() )
+    {
+      const std::size_t word = ( character & CHARACTER_PAGE_MASK ) >> CHARACTER_MAP_WORD_SHIFT;
+      const FcChar32 bit = 1u << ( character & CHARACTER_MAP_BIT_MASK );
+
+      for( PageCoverageList::const_iterator it = pageIt->second.begin(), endIt = pageIt->second.end(); it != endIt; ++it )
+      {
+        if( ( it->mFontIndex >= firstFontIndex ) && ( it->mMap[word] & bit ) )
+        {
+          return it->mFontIndex;
+        }
+      }
+    }
+
+    return mFonts.size();
+  }
+
+  std::vector<StyledFontFamily> mFonts;    ///< preferred fonts which have a font file and a character set, in order of preference
+  std::set<std::string>         mFamilies; ///< all the font families known when the index was built
+  PageLookup                    mPages;    ///< the coverage of every page supported by at least one font
+  unsigned int                  mGeneration; ///< the font configuration generation the index was built for
+};
+
 FontController::FontController()
+: mFontCoverageIndex( NULL ),
+  mFontCoverageIndexReaders( 0u ),
+  mFontConfigGeneration( 0u )
 {
   FcInit();
   FcConfigEnableHome(true);
@@ -136,6 +201,9 @@ void FontController::CreatePreferedFontList( )
   // clear the current list
   mPreferredFonts.clear();
 
+  // font config isn't thread safe
+  boost::mutex::scoped_lock fcLock( mFontConfigMutex );
+
   _FcPattern* searchPattern = CreateFontFamilyPattern( tizenFont );
 
   FcResult result(FcResultMatch);
@@ -172,10 +240,176 @@ void FontController::CreatePreferedFontList( )
 
 FontController::~FontController()
 {
+  delete mFontCoverageIndex;
+  for( std::vector< const FontCoverageIndex* >::iterator iter = mRetiredFontCoverageIndices.begin(), endIter = mRetiredFontCoverageIndices.end(); iter != endIter; ++iter )
+  {
+    delete *iter;
+  }
+
   // clear the font family cache
   ClearFontFamilyCache();
 }
 
+const FontController::FontCoverageIndex* FontController::AcquireFontCoverageIndex()
+{
+  // the index is read after the reader is counted, so a retired index can't be freed while it is read
+  (void)__sync_add_and_fetch( &mFontCoverageIndexReaders, 1u );
+
+  const FontCoverageIndex* index = mFontCoverageIndex;
+  __sync_synchronize();
+
+  if( index && ( index->mGeneration == mFontConfigGeneration ) )
+  {
+    return index;
+  }
+
+  boost::mutex::scoped_lock lock( mFontCoverageIndexMutex );
+
+  // another thread may have built the index while this one was waiting
+  index = mFontCoverageIndex;
+  const unsigned int generation = mFontConfigGeneration;
+  if( index && ( index->mGeneration == generation ) )
+  {
+    return index;
+  }
+
+  FontCoverageIndex* newIndex = CreateFontCoverageIndex();
+  newIndex->mGeneration = generation;
+
+  DALI_LOG_INFO( gLogFilter, Debug::General, "Font coverage index generation %u: %d fonts, %d pages\n", generation, newIndex->mFonts.size(), newIndex->mPages.size() );
+
+  // other threads may still be reading the previous index, so it is kept until the last reader releases it
+  if( index )
+  {
+    mRetiredFontCoverageIndices.push_back( index );
+  }
+
+  // the index must be complete before other threads can see it
+  __sync_synchronize();
+  mFontCoverageIndex = newIndex;
+
+  return newIndex;
+}
+
+void FontController::ReleaseFontCoverageIndex()
+{
+  if( 0u == __sync_sub_and_fetch( &mFontCoverageIndexReaders, 1u ) )
+  {
+    // if another thread holds the mutex, the retired indices are freed when the next lookup finishes
+    boost::mutex::scoped_try_lock lock( mFontCoverageIndexMutex );
+    if( lock.owns_lock() )
+    {
+      DeleteRetiredFontCoverageIndices();
+    }
+  }
+}
+
+void FontController::DeleteRetiredFontCoverageIndices()
+{
+  // readers which start after this check will read the current index, which is never retired while the mutex is locked
+  if( !mRetiredFontCoverageIndices.empty() && ( 0u == __sync_fetch_and_add( &mFontCoverageIndexReaders, 0u ) ) )
+  {
+    for( std::vector< const FontCoverageIndex* >::iterator iter = mRetiredFontCoverageIndices.begin(), endIter = mRetiredFontCoverageIndices.end(); iter != endIter; ++iter )
+    {
+      delete *iter;
+    }
+    mRetiredFontCoverageIndices.clear();
+  }
+}
+
+FontController::FontCoverageIndex* FontController::CreateFontCoverageIndex()
+{
+  FontCoverageIndex* index = new FontCoverageIndex();
+
+  CreatePreferedFontList();
+
+  for( std::vector< StyledFontFamily >::const_iterator iter = mPreferredFonts.begin(), endIter = mPreferredFonts.end(); iter != endIter; ++iter )
+  {
+    const StyledFontFamily& font = *iter;
+
+    index->mFamilies.insert( font.first );
+
+    // First make sure it is cached so we can access it's character set object
+    if( GetFontPath( font ).empty() )
+    {
+      continue;
+    }
+
+    _FcCharSet* charSet( NULL );
+    {
+      boost::mutex::scoped_lock lock( mFontFamilyCacheMutex );
+      charSet = GetCachedFontCharacterSet( font );
+    }
+
+    if( NULL == charSet )
+    {
+      continue;
+    }
+
+    const std::size_t fontIndex = index->mFonts.size();
+    index->mFonts.push_back( font );
+
+    // protect font config
+    boost::mutex::scoped_lock fcLock( mFontConfigMutex );
+
+    FcChar32 map[FC_CHARSET_MAP_SIZE];
+    FcChar32 next( 0 );
+    for( FcChar32 base = FcCharSetFirstPage( charSet, map, &next ); FC_CHARSET_DONE != base; base = FcCharSetNextPage( charSet, map, &next ) )
+    {
+      FontCoverageIndex::PageCoverage coverage;
+      coverage.mFontIndex = fontIndex;
+      std::copy( map, map + FC_CHARSET_MAP_SIZE, coverage.mMap );
+
+      index->mPages[ base >> CHARACTER_PAGE_SHIFT ].push_back( coverage );
+    }
+  }
+
+  return index;
+}
+
+void FontController::InvalidateFontCoverageIndex()
+{
+  (void)__sync_add_and_fetch( &mFontConfigGeneration, 1u );
+}
+
+void FontController::CheckDownloadedFont( const std::string& fileName, const std::string& fontFamily )
+{
+  const FontCoverageIndex* index = mFontCoverageIndex;
+  __sync_synchronize();
+
+  // if there is no index yet, the font will be in it when it is built
+  if( index &&
+      IsDownloadedFont( fileName ) &&
+      ( index->mFamilies.end() == index->mFamilies.find( fontFamily ) ) )
+  {
+    // FontConfig may not list the family in the preferred fonts, even after the index is rebuilt,
+    // so each family only invalidates the index the first time it is seen
+    bool newFamily( false );
+    {
+      boost::mutex::scoped_lock lock( mDownloadedFontsMutex );
+      newFamily = mDownloadedFontFamilies.insert( fontFamily ).second;
+    }
+
+    if( newFamily )
+    {
+      DALI_LOG_INFO( gLogFilter, Debug::General, "New downloaded font %s, invalidating the font coverage index\n", fontFamily.c_str() );
+
+      InvalidateFontCoverageIndex();
+    }
+  }
+}
+
+unsigned int FontController::GetFontConfigGeneration() const
+{
+  return mFontConfigGeneration;
+}
+
+unsigned int FontController::GetNumberOfRetiredFontCoverageIndices()
+{
+  boost::mutex::scoped_lock lock( mFontCoverageIndexMutex );
+  return mRetiredFontCoverageIndices.size();
+}
+
 std::string FontController::GetFontPath( const StyledFontFamily& styledFontFamily )
 {
   StyledFontFamily closestMachedStyledFontFamily;
@@ -276,35 +510,48 @@ bool FontController::ValidateFontFamilyName( const StyledFontFamily& styledFontF
 
 FontController::StyledFontFamily FontController::GetFontFamilyForChars(const TextArray& charsRequested)
 {
-  if( mPreferredFonts.empty() )
-  {
-    CreatePreferedFontList();
-  }
+  const FontCoverageIndex* index = AcquireFontCoverageIndex();
+  const std::size_t numberOfFonts = index->mFonts.size();
 
-  // Cycle through the preferred list of fonts on the system for 'Tizen'.
-  for( std::size_t n = 0; n < mPreferredFonts.size() ; n++ )
+  // Find the first preferred font for 'Tizen' which supports all the characters.
+  // Every character moves the candidate forward to the first font which supports it,
+  // until a pass over the text doesn't move it.
+  std::size_t fontIndex = 0u;
+  bool candidateMoved = true;
+  while( candidateMoved && ( fontIndex < numberOfFonts ) )
   {
-    StyledFontFamily font = mPreferredFonts[n];
+    candidateMoved = false;
 
-    // First make sure it is cached so we can access it's character set object
-    std::string filePath = GetFontPath( font );
-    if( filePath.empty())
+    for( TextArray::const_iterator iter = charsRequested.begin(), endIter = charsRequested.end(); iter != endIter; ++iter )
     {
-      filePath = GetFontPath( font );
-    }
+      const uint32_t character = (*iter);
 
-    if( filePath.empty())
-    {
-      continue;
-    }
-    bool matched = FontFamilySupportsText( font, charsRequested);
-    if( matched )
-    {
-      return font;
+      // if it's a control character then don't test it
+      if( IsAControlCharacter( character ) )
+      {
+        continue;
+      }
+
+      const std::size_t supportingFontIndex = index->FindFont( character, fontIndex );
+      if( supportingFontIndex != fontIndex )
+      {
+        fontIndex = supportingFontIndex;
+        candidateMoved = true;
+        break;
+      }
     }
   }
-  // return empty string
-  return StyledFontFamily();
+
+  // return empty string if no font supports the text
+  StyledFontFamily styledFontFamily;
+  if( fontIndex < numberOfFonts )
+  {
+    styledFontFamily = index->mFonts[fontIndex];
+  }
+
+  ReleaseFontCoverageIndex();
+
+  return styledFontFamily;
 }
 
 void FontController::CacheFontInfo(FcPattern* pattern, const StyledFontFamily& inputStyledFontFamily, StyledFontFamily& closestStyledFontFamilyMatch )
@@ -344,6 +591,8 @@ void FontController::CacheFontInfo(FcPattern* pattern, const StyledFontFamily& i
   // Add the match to the font cache
   AddCachedFont( closestStyledFontFamilyMatch, fileName, matchedCharSet );
 
+  CheckDownloadedFont( fileName, familyName );
+
 
   if( ( !inputStyledFontFamily.first.empty() &&
         inputStyledFontFamily.first != familyName ) ||
@@ -375,11 +624,21 @@ bool FontController::AllGlyphsSupported(const StyledFontFamily& styledFontFamily
 
 void FontController::SetDefaultFontFamily( const StyledFontFamily& styledFontFamily )
 {
-  // reload font configuration files
-  bool ok =  FcInitReinitialize();
-  DALI_ASSERT_ALWAYS( ok && "FcInitReinitialize failed");
+  boost::mutex::scoped_lock lock( mFontCoverageIndexMutex );
+
+  {
+    // font config isn't thread safe
+    boost::mutex::scoped_lock fcLock( mFontConfigMutex );
+
+    // reload font configuration files
+    bool ok =  FcInitReinitialize();
+    DALI_ASSERT_ALWAYS( ok && "FcInitReinitialize failed");
+  }
 
   CreatePreferedFontList();
+
+  // the preferred fonts and their character sets may have changed
+  InvalidateFontCoverageIndex();
 }
 
 void FontController::AddCachedFont(const StyledFontFamily& styledFontFamily, const std::string& fontPath, _FcCharSet *characterSet)
@@ -638,6 +897,8 @@ void FontController::AddToFontList(const std::string& fileName, const StyledFont
 {
   bool systemFont = CheckFontInstallPath(LIST_SYSTEM_FONTS, fileName);
 
+  CheckDownloadedFont( fileName, styledFontFamily.first );
+
   FontList* fontList(NULL);
 
   if( systemFont )
@@ -23,6 +23,8 @@
 // EXTERNAL INCLUDES
 #include <boost/thread.hpp>
 #include <map>
+#include <set>
+#include <vector>
 
 
 // forward declarations of font config types
@@ -46,11 +48,11 @@ typedef Dali::Platform::FontController::FontList FontList;
  * - List of fonts on the system, if the user calls GetFontList()
  * - List of fonts used by the application with both its filename and character set
  *
- * When searching for a font that can display a string of text, the follow occurs:
- *
- * - 1. Check the last used font to see if it supports the text
- * - 2. If 1 fails, check all other Fonts in the cache to see if they support the text
- * - 3. If 2 fails, use FontConfig to find a font which supports the text, then cache that font.
+ * When searching for a font that can display a string of text, a coverage index of the preferred fonts is used.
+ * The index maps every page of 256 characters to the preferred fonts which have characters in that page,
+ * and the characters each of them supports. It is built once per font configuration generation and is not
+ * modified afterwards, so it is read without locking FontConfig or the font cache.
+ * The generation changes when the default font family is set, or when a new downloaded font is found.
  *
  * Suggested future improvements:
  * Stop using FontConfig library, instead use FreeType directly to query and cache font family names and
@@ -102,6 +104,20 @@ public:
    */
   virtual void SetDefaultFontFamily( const StyledFontFamily& styledFontFamily );
 
+  /**
+   * Query the font configuration generation.
+   * It is incremented every time the coverage index of the preferred fonts needs to be rebuilt.
+   * @return The generation.
+   */
+  unsigned int GetFontConfigGeneration() const;
+
+  /**
+   * Query how many coverage indices of previous generations are still allocated.
+   * They are freed once no thread is reading them.
+   * @return The number of indices.
+   */
+  unsigned int GetNumberOfRetiredFontCoverageIndices();
+
 private:
 
   /**
@@ -220,6 +236,47 @@ private:
     */
   void CreatePreferedFontList();
 
+  struct FontCoverageIndex;
+
+  /**
+   * Retrieves the coverage index of the preferred fonts for the current font configuration generation.
+   * The index is rebuilt if the generation has changed since it was built.
+   * ReleaseFontCoverageIndex() must be called once the index is no longer read.
+   * @return The coverage index. It is valid until ReleaseFontCoverageIndex() is called.
+   */
+  const FontCoverageIndex* AcquireFontCoverageIndex();
+
+  /**
+   * Stops reading the coverage index retrieved by AcquireFontCoverageIndex().
+   * The last reader frees the indices of previous generations.
+   */
+  void ReleaseFontCoverageIndex();
+
+  /**
+   * Frees the indices of previous generations, if no thread is reading a coverage index.
+   * @pre mFontCoverageIndexMutex is locked.
+   */
+  void DeleteRetiredFontCoverageIndices();
+
+  /**
+   * Creates the preferred list of fonts and the coverage index of their character sets.
+   * @return A new coverage index.
+   */
+  FontCoverageIndex* CreateFontCoverageIndex();
+
+  /**
+   * Starts a new font configuration generation, so the coverage index is rebuilt the next time it is used.
+   */
+  void InvalidateFontCoverageIndex();
+
+  /**
+   * Invalidates the coverage index if the font is a downloaded font it doesn't know about.
+   * The index is invalidated only the first time each downloaded font family is seen.
+   * @param[in] fileName the font full filename with path
+   * @param[in] fontFamily The name of the font's family.
+   */
+  void CheckDownloadedFont( const std::string& fileName, const std::string& fontFamily );
+
   /**
    * Font cache item.
    */
@@ -236,6 +293,8 @@ private:
   boost::mutex      mFontConfigMutex;       ///< FontConfig needs serializing because it isn't thread safe
   boost::mutex      mFontFamilyCacheMutex;  ///< to protect the FontFamilyCache data
   boost::mutex      mFontListMutex;         ///< to prevent more than one thread creating the font list data
+  boost::mutex      mFontCoverageIndexMutex; ///< to prevent more than one thread creating the preferred font list and the coverage index
+  boost::mutex      mDownloadedFontsMutex;  ///< to protect mDownloadedFontFamilies
 
   StyledFontFamily  mDefaultStyledFont;     ///< default font
 
@@ -246,6 +305,12 @@ private:
   FontsNotFound     mFontsNotFound;         ///< lookup for fonts that haven't been found on the sytem, and the nearest matching font.
   std::vector< StyledFontFamily > mPreferredFonts; ///< Ordered list of preferred fonts.
 
+  const FontCoverageIndex* volatile mFontCoverageIndex;                ///< coverage index of the preferred fonts, replaced but never modified once published
+  std::vector< const FontCoverageIndex* > mRetiredFontCoverageIndices; ///< indices of previous generations, which may still be read by other threads
+  volatile unsigned int mFontCoverageIndexReaders;                     ///< number of threads reading a coverage index
+  volatile unsigned int mFontConfigGeneration;                         ///< incremented when the coverage index needs to be rebuilt
+  std::set< std::string > mDownloadedFontFamilies;                     ///< downloaded font families which have invalidated the coverage index
+
 };
 
 } // namespace SlpPlatform
@@ -0,0 +1,420 @@
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "image-resampler.h"
+
+#include <algorithm>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON__)
+#include <arm_neon.h>
+#endif
+
+#include <dali/public-api/images/image-attributes.h>
+#include <dali/public-api/math/math-utils.h>
+#include "platform-capabilities.h"
+
+namespace Dali
+{
+
+using Integration::Bitmap;
+using Integration::BitmapPtr;
+
+namespace SlpPlatform
+{
+
+namespace
+{
+
+const unsigned int MAXIMUM_BOX_FILTER_FACTOR = 256u; ///< Keeps the sums of a block within 32 bits
+const unsigned int FIXED_POINT_SHIFT = 16u;           ///< Sample positions are 16.16 fixed point
+const unsigned int WEIGHT_SHIFT = 8u;                 ///< Bilinear weights have 8 bits
+
+/**
+ * Calculates the position of the source samples for each row or column of the scaled image window.
+ * @param[in]  inputSize   The number of rows or columns of the input image
+ * @param[in]  scaledSize  The number of rows or columns of the whole scaled image
+ * @param[in]  offset      The first row or column of the window in the scaled image
+ * @param[in]  outputSize  The number of rows or columns of the window
+ * @param[out] first       Is set with the first input row or column of each sample
+ * @param[out] second      Is set with the second input row or column of each sample
+ * @param[out] weights     Is set with the weight of the second row or column of each sample
+ */
+void CalculateSamples( unsigned int inputSize, unsigned int scaledSize, unsigned int offset, unsigned int outputSize,
+                       std::vector<unsigned int>& first, std::vector<unsigned int>& second, std::vector<unsigned int>& weights )
+{
+  first.resize( outputSize );
+  second.resize( outputSize );
+  weights.resize( outputSize );
+
+  const int64_t lastPosition = static_cast<int64_t>( inputSize - 1u ) << FIXED_POINT_SHIFT;
+
+  for( unsigned int i = 0; i < outputSize; ++i )
+  {
+    // Map the centre of the scaled pixel to the input image.
+    int64_t position = ( ( static_cast<int64_t>( 2u * ( i + offset ) + 1u ) * inputSize ) << FIXED_POINT_SHIFT ) / ( 2u * scaledSize );
+    position -= 1 << ( FIXED_POINT_SHIFT - 1u );
+    position = std::max( static_cast<int64_t>( 0 ), std::min( position, lastPosition ) );
+
+    first[i] = static_cast<unsigned int>( position >> FIXED_POINT_SHIFT );
+    second[i] = std::min( first[i] + 1u, inputSize - 1u );
+    weights[i] = static_cast<unsigned int>( position >> ( FIXED_POINT_SHIFT - WEIGHT_SHIFT ) ) & ( ( 1u << WEIGHT_SHIFT ) - 1u );
+  }
+}
+
+/**
+ * Adds each byte of a row to its column sum.
+ * @param[in]     row   The bytes of the row
+ * @param[in,out] sums  The column sums
+ * @param[in]     count The number of bytes
+ */
+void AccumulateRow( const uint8_t* row, uint32_t* sums, unsigned int count )
+{
+  unsigned int i = 0;
+
+#if defined(__SSE2__)
+  const __m128i zero = _mm_setzero_si128();
+  for( ; i + 16u <= count; i += 16u )
+  {
+    const __m128i bytes = _mm_loadu_si128( reinterpret_cast<const __m128i*>( row + i ) );
+    const __m128i low = _mm_unpacklo_epi8( bytes, zero );
+    const __m128i high = _mm_unpackhi_epi8( bytes, zero );
+
+    __m128i* const sum = reinterpret_cast<__m128i*>( sums + i );
+    _mm_storeu_si128( sum,      _mm_add_epi32( _mm_loadu_si128( sum ),      _mm_unpacklo_epi16( low, zero ) ) );
+    _mm_storeu_si128( sum + 1u, _mm_add_epi32( _mm_loadu_si128( sum + 1u ), _mm_unpackhi_epi16( low, zero ) ) );
+    _mm_storeu_si128( sum + 2u, _mm_add_epi32( _mm_loadu_si128( sum + 2u ), _mm_unpacklo_epi16( high, zero ) ) );
+    _mm_storeu_si128( sum + 3u, _mm_add_epi32( _mm_loadu_si128( sum + 3u ), _mm_unpackhi_epi16( high, zero ) ) );
+  }
+#elif defined(__ARM_NEON__)
+  for( ; i + 8u <= count; i += 8u )
+  {
+    const uint16x8_t bytes = vmovl_u8( vld1_u8( row + i ) );
+
+    uint32_t* const sum = sums + i;
+    vst1q_u32( sum,      vaddw_u16( vld1q_u32( sum ),      vget_low_u16( bytes ) ) );
+    vst1q_u32( sum + 4u, vaddw_u16( vld1q_u32( sum + 4u ), vget_high_u16( bytes ) ) );
+  }
+#endif
+
+  for( ; i < count; ++i )
+  {
+    sums[i] += row[i];
+  }
+}
+
+} // unnamed namespace
+
+bool CalculateScaledDimensions( const ImageAttributes& attributes,
+                                unsigned int width, unsigned int height,
+                                unsigned int& scaledWidth, unsigned int& scaledHeight,
+                                unsigned int& desiredWidth, unsigned int& desiredHeight )
+{
+  scaledWidth = desiredWidth = width;
+  scaledHeight = desiredHeight = height;
+
+  const unsigned int requestedWidth = attributes.GetWidth();
+  const unsigned int requestedHeight = attributes.GetHeight();
+
+  if( ( 0u == requestedWidth && 0u == requestedHeight ) || 0u == width || 0u == height )
+  {
+    // Full size requested.
+    return false;
+  }
+
+  const float widthScale = static_cast<float>( requestedWidth ) / static_cast<float>( width );
+  const float heightScale = static_cast<float>( requestedHeight ) / static_cast<float>( height );
+
+  // A zero requested dimension leaves that dimension free.
+  float scale = 1.f;
+  switch( attributes.GetScalingMode() )
+  {
+    case ImageAttributes::ShrinkToFit:
+    {
+      scale = ( 0u == requestedWidth ) ? heightScale : ( 0u == requestedHeight ) ? widthScale : std::min( widthScale, heightScale );
+      break;
+    }
+    case ImageAttributes::FitWidth:
+    {
+      scale = ( 0u != requestedWidth ) ? widthScale : heightScale;
+      break;
+    }
+    case ImageAttributes::FitHeight:
+    {
+      scale = ( 0u != requestedHeight ) ? heightScale : widthScale;
+      break;
+    }
+    case ImageAttributes::ScaleToFill:
+    {
+      if( 0u == requestedWidth || 0u == requestedHeight )
+      {
+        scale = ( 0u != requestedWidth ) ? widthScale : heightScale;
+        break;
+      }
+
+      scale = std::max( widthScale, heightScale );
+      if( scale < 1.f )
+      {
+        // Cover the requested size and crop what overflows it.
+        scaledWidth = std::max( 1u, static_cast<unsigned int>( width * scale + 0.5f ) );
+        scaledHeight = std::max( 1u, static_cast<unsigned int>( height * scale + 0.5f ) );
+        desiredWidth = std::min( scaledWidth, requestedWidth );
+        desiredHeight = std::min( scaledHeight, requestedHeight );
+      }
+      else
+      {
+        // The image can't cover the requested size without scaling it up,
+        // so crop the largest window with the requested aspect ratio.
+        const float cropScale = std::min( 1.f / widthScale, 1.f / heightScale );
+        desiredWidth = std::min( width, std::max( 1u, static_cast<unsigned int>( requestedWidth * cropScale + 0.5f ) ) );
+        desiredHeight = std::min( height, std::max( 1u, static_cast<unsigned int>( requestedHeight * cropScale + 0.5f ) ) );
+      }
+
+      return ( scaledWidth != width ) || ( scaledHeight != height ) || ( desiredWidth != width ) || ( desiredHeight != height );
+    }
+  }
+
+  if( scale < 1.f )
+  {
+    scaledWidth = desiredWidth = std::max( 1u, static_cast<unsigned int>( width * scale + 0.5f ) );
+    scaledHeight = desiredHeight = std::max( 1u, static_cast<unsigned int>( height * scale + 0.5f ) );
+  }
+
+  return ( scaledWidth != width ) || ( scaledHeight != height );
+}
+
+bool CalculateCropRegion( const ImageAttributes& attributes,
+                          unsigned int width, unsigned int height,
+                          unsigned int& x, unsigned int& y,
+                          unsigned int& regionWidth, unsigned int& regionHeight )
+{
+  x = y = 0u;
+  regionWidth = width;
+  regionHeight = height;
+
+  if( 0u == width || 0u == height )
+  {
+    return false;
+  }
+
+  // Round the edges of the region to the nearest pixels, keeping at least one pixel of the image.
+  const Rect<float>& crop = attributes.GetCrop();
+  x = std::min( static_cast<unsigned int>( Clamp( crop.x, 0.f, 1.f ) * width + 0.5f ), width - 1u );
+  y = std::min( static_cast<unsigned int>( Clamp( crop.y, 0.f, 1.f ) * height + 0.5f ), height - 1u );
+  const unsigned int right = static_cast<unsigned int>( Clamp( crop.x + crop.width, 0.f, 1.f ) * width + 0.5f );
+  const unsigned int bottom = static_cast<unsigned int>( Clamp( crop.y + crop.height, 0.f, 1.f ) * height + 0.5f );
+  regionWidth = std::max( right, x + 1u ) - x;
+  regionHeight = std::max( bottom, y + 1u ) - y;
+
+  return ( regionWidth != width ) || ( regionHeight != height );
+}
+
+unsigned int CalculateBoxFilterFactor( unsigned int width, unsigned int height, unsigned int scaledWidth, unsigned int scaledHeight )
+{
+  unsigned int factor = 1u;
+
+  while( ( factor < MAXIMUM_BOX_FILTER_FACTOR ) &&
+         ( width / ( factor * 2u ) >= scaledWidth ) &&
+         ( height / ( factor * 2u ) >= scaledHeight ) )
+  {
+    factor *= 2u;
+  }
+
+  return factor;
+}
+
+bool IsResamplingSupported( Pixel::Format pixelFormat )
+{
+  switch( pixelFormat )
+  {
+    case Pixel::A8:
+    case Pixel::L8:
+    case Pixel::LA88:
+    case Pixel::RGB888:
+    case Pixel::RGB8888:
+    case Pixel::BGR8888:
+    case Pixel::RGBA8888:
+    case Pixel::BGRA8888:
+    {
+      return true;
+    }
+    default:
+    {
+      return false;
+    }
+  }
+}
+
+BoxFilter::BoxFilter( unsigned int width, unsigned int bytesPerPixel, unsigned int factor, uint8_t* output, unsigned int outputStride )
+: mWidth( width ),
+  mBytesPerPixel( bytesPerPixel ),
+  mFactor( factor ),
+  mOutput( output ),
+  mOutputStride( outputStride ),
+  mRowCount( 0u ),
+  mColumnSums( ( width / factor ) * factor * bytesPerPixel, 0u )
+{
+}
+
+void BoxFilter::AddRow( const uint8_t* row )
+{
+  if( mColumnSums.empty() )
+  {
+    return;
+  }
+
+  // The last (width % factor) columns are ignored.
+  AccumulateRow( row, &mColumnSums[0], mColumnSums.size() );
+
+  if( ++mRowCount < mFactor )
+  {
+    return;
+  }
+
+  const unsigned int outputWidth = GetOutputWidth();
+  const uint32_t area = mFactor * mFactor;
+  const uint32_t* sums = &mColumnSums[0];
+  uint8_t* output = mOutput;
+
+  for( unsigned int x = 0; x < outputWidth; ++x )
+  {
+    for( unsigned int channel = 0; channel < mBytesPerPixel; ++channel )
+    {
+      uint32_t sum = area / 2u;
+      for( unsigned int i = 0; i < mFactor; ++i )
+      {
+        sum += sums[i * mBytesPerPixel + channel];
+      }
+      *output++ = static_cast<uint8_t>( sum / area );
+    }
+    sums += mFactor * mBytesPerPixel;
+  }
+
+  std::fill( mColumnSums.begin(), mColumnSums.end(), 0u );
+  mRowCount = 0u;
+  mOutput += mOutputStride;
+}
+
+unsigned int BoxFilter::GetOutputWidth() const
+{
+  return mWidth / mFactor;
+}
+
+void ResampleBilinear( const uint8_t* input, unsigned int inputWidth, unsigned int inputHeight, unsigned int inputStride,
+                       unsigned int bytesPerPixel, unsigned int scaledWidth, unsigned int scaledHeight,
+                       uint8_t* output, unsigned int outputWidth, unsigned int outputHeight, unsigned int outputStride )
+{
+  std::vector<unsigned int> firstColumns, secondColumns, columnWeights;
+  std::vector<unsigned int> firstRows, secondRows, rowWeights;
+
+  CalculateSamples( inputWidth, scaledWidth, ( scaledWidth - outputWidth ) / 2u, outputWidth, firstColumns, secondColumns, columnWeights );
+  CalculateSamples( inputHeight, scaledHeight, ( scaledHeight - outputHeight ) / 2u, outputHeight, firstRows, secondRows, rowWeights );
+
+  const uint32_t ONE = 1u << WEIGHT_SHIFT;
+  const uint32_t ROUNDING = 1u << ( 2u * WEIGHT_SHIFT - 1u );
+
+  for( unsigned int y = 0; y < outputHeight; ++y )
+  {
+    const uint8_t* const top = input + firstRows[y] * inputStride;
+    const uint8_t* const bottom = input + secondRows[y] * inputStride;
+    const uint32_t bottomWeight = rowWeights[y];
+    const uint32_t topWeight = ONE - bottomWeight;
+
+    uint8_t* pixel = output + y * outputStride;
+    for( unsigned int x = 0; x < outputWidth; ++x )
+    {
+      const unsigned int left = firstColumns[x] * bytesPerPixel;
+      const unsigned int right = secondColumns[x] * bytesPerPixel;
+      const uint32_t rightWeight = columnWeights[x];
+      const uint32_t leftWeight = ONE - rightWeight;
+
+      for( unsigned int channel = 0; channel < bytesPerPixel; ++channel )
+      {
+        const uint32_t topValue = top[left + channel] * leftWeight + top[right + channel] * rightWeight;
+        const uint32_t bottomValue = bottom[left + channel] * leftWeight + bottom[right + channel] * rightWeight;
+
+        *pixel++ = static_cast<uint8_t>( ( topValue * topWeight + bottomValue * bottomWeight + ROUNDING ) >> ( 2u * WEIGHT_SHIFT ) );
+      }
+    }
+  }
+}
+
+BitmapPtr ApplyAttributesToBitmap( BitmapPtr bitmap, const ImageAttributes& attributes )
+{
+  Bitmap::PackedPixelsProfile* const profile = bitmap ? bitmap->GetPackedPixelsProfile() : NULL;
+  if( !profile || !IsResamplingSupported( bitmap->GetPixelFormat() ) )
+  {
+    return bitmap;
+  }
+
+  unsigned int x, y, width, height;
+  const bool cropped = CalculateCropRegion( attributes, bitmap->GetImageWidth(), bitmap->GetImageHeight(), x, y, width, height );
+
+  unsigned int scaledWidth, scaledHeight, desiredWidth, desiredHeight;
+  if( !CalculateScaledDimensions( attributes, width, height, scaledWidth, scaledHeight, desiredWidth, desiredHeight ) && !cropped )
+  {
+    return bitmap;
+  }
+
+  const Pixel::Format pixelFormat = bitmap->GetPixelFormat();
+  const unsigned int bytesPerPixel = Pixel::GetBytesPerPixel( pixelFormat );
+
+  // The filters read the region in place.
+  unsigned int inputStride = profile->GetBufferWidth() * bytesPerPixel;
+  const uint8_t* input = bitmap->GetBuffer() + y * inputStride + x * bytesPerPixel;
+  unsigned int inputWidth = width;
+  unsigned int inputHeight = height;
+
+  // Shrink by a power of two with a box filter first, so the bilinear filter never skips input pixels.
+  std::vector<uint8_t> filtered;
+  const unsigned int factor = CalculateBoxFilterFactor( width, height, scaledWidth, scaledHeight );
+  if( factor > 1u )
+  {
+    const unsigned int filteredWidth = width / factor;
+    const unsigned int filteredHeight = height / factor;
+    filtered.resize( filteredWidth * filteredHeight * bytesPerPixel );
+
+    BoxFilter filter( width, bytesPerPixel, factor, &filtered[0], filteredWidth * bytesPerPixel );
+    for( unsigned int row = 0; row < filteredHeight * factor; ++row )
+    {
+      filter.AddRow( input + row * inputStride );
+    }
+
+    input = &filtered[0];
+    inputWidth = filteredWidth;
+    inputHeight = filteredHeight;
+    inputStride = filteredWidth * bytesPerPixel;
+  }
+
+  const unsigned int bufferWidth = GetTextureDimension( desiredWidth );
+  const unsigned int bufferHeight = GetTextureDimension( desiredHeight );
+
+  BitmapPtr scaledBitmap = Bitmap::New( Bitmap::BITMAP_2D_PACKED_PIXELS, true );
+  uint8_t* const output = scaledBitmap->GetPackedPixelsProfile()->ReserveBuffer( pixelFormat, desiredWidth, desiredHeight, bufferWidth, bufferHeight );
+
+  ResampleBilinear( input, inputWidth, inputHeight, inputStride, bytesPerPixel,
+                    scaledWidth, scaledHeight,
+                    output, desiredWidth, desiredHeight, bufferWidth * bytesPerPixel );
+
+  scaledBitmap->GetPackedPixelsProfile()->TestForTransparency();
+
+  return scaledBitmap;
+}
+
+} // namespace SlpPlatform
+
+} // namespace Dali
@@ -0,0 +1,156 @@
+#ifndef __DALI_SLP_PLATFORM_IMAGE_RESAMPLER_H__
+#define __DALI_SLP_PLATFORM_IMAGE_RESAMPLER_H__
+
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <stdint.h>
+#include <dali/public-api/common/vector-wrapper.h>
+#include <dali/public-api/images/pixel.h>
+#include <dali/integration-api/bitmap.h>
+
+namespace Dali
+{
+
+struct ImageAttributes;
+
+namespace SlpPlatform
+{
+
+/**
+ * Works out the size a decoded image should be scaled to, to honour the size and scaling mode
+ * requested in its attributes. Images are never scaled up.
+ * @param[in]  attributes    The attributes requested for the image
+ * @param[in]  width         The width of the decoded image
+ * @param[in]  height        The height of the decoded image
+ * @param[out] scaledWidth   Is set with the width the whole image is scaled to
+ * @param[out] scaledHeight  Is set with the height the whole image is scaled to
+ * @param[out] desiredWidth  Is set with the width of the final image, centred in the scaled one (ScaleToFill crops)
+ * @param[out] desiredHeight Is set with the height of the final image, centred in the scaled one
+ * @return true if the decoded image has to be scaled or cropped, false otherwise
+ */
+bool CalculateScaledDimensions( const ImageAttributes& attributes,
+                                unsigned int width, unsigned int height,
+                                unsigned int& scaledWidth, unsigned int& scaledHeight,
+                                unsigned int& desiredWidth, unsigned int& desiredHeight );
+
+/**
+ * Works out the region of a decoded image selected by the crop requested in its attributes.
+ * @param[in]  attributes   The attributes requested for the image
+ * @param[in]  width        The width of the decoded image
+ * @param[in]  height       The height of the decoded image
+ * @param[out] x            Is set with the first column of the region
+ * @param[out] y            Is set with the first row of the region
+ * @param[out] regionWidth  Is set with the width of the region, at least one pixel
+ * @param[out] regionHeight Is set with the height of the region, at least one pixel
+ * @return true if the region is smaller than the image, false otherwise
+ */
+bool CalculateCropRegion( const ImageAttributes& attributes,
+                          unsigned int width, unsigned int height,
+                          unsigned int& x, unsigned int& y,
+                          unsigned int& regionWidth, unsigned int& regionHeight );
+
+/**
+ * Works out the largest power of two an image can be box filtered by, without becoming smaller than the scaled size.
+ * @param[in] width        The width of the image
+ * @param[in] height       The height of the image
+ * @param[in] scaledWidth  The width the image is scaled to
+ * @param[in] scaledHeight The height the image is scaled to
+ * @return The box filter factor, 1 if the image can't be box filtered
+ */
+unsigned int CalculateBoxFilterFactor( unsigned int width, unsigned int height, unsigned int scaledWidth, unsigned int scaledHeight );
+
+/**
+ * Whether images of the given pixel format can be resampled; every byte of a pixel must be an independent channel.
+ * @param[in] pixelFormat The pixel format
+ * @return true if the format is supported
+ */
+bool IsResamplingSupported( Pixel::Format pixelFormat );
+
+/**
+ * Shrinks an image by averaging square blocks of pixels.
+ * Rows are added one at a time, so decoders can stream rows into the filter
+ * instead of holding the whole image in memory.
+ */
+class BoxFilter
+{
+public:
+  /**
+   * Constructor.
+   * @param[in] width         The width of the input rows, in pixels
+   * @param[in] bytesPerPixel The number of bytes of each pixel
+   * @param[in] factor        The size of the averaged blocks, in pixels
+   * @param[in] output        The buffer the filtered rows are written to. It must hold (height / factor) rows of (width / factor) pixels
+   * @param[in] outputStride  The distance between the output rows, in bytes
+   */
+  BoxFilter( unsigned int width, unsigned int bytesPerPixel, unsigned int factor, uint8_t* output, unsigned int outputStride );
+
+  /**
+   * Adds the next row of the image. A row of the output is written every factor rows;
+   * the last (height % factor) rows of the image are ignored.
+   * @param[in] row The pixels of the row
+   */
+  void AddRow( const uint8_t* row );
+
+  /**
+   * @return The width of the output rows, in pixels
+   */
+  unsigned int GetOutputWidth() const;
+
+private:
+  unsigned int          mWidth;         ///< The width of the input rows, in pixels
+  unsigned int          mBytesPerPixel; ///< The number of bytes of each pixel
+  unsigned int          mFactor;        ///< The size of the averaged blocks
+  uint8_t*              mOutput;        ///< The next output row
+  unsigned int          mOutputStride;  ///< The distance between the output rows, in bytes
+  unsigned int          mRowCount;      ///< The number of rows added to mColumnSums
+  std::vector<uint32_t> mColumnSums;    ///< The sums of each byte of the rows added since the last output row
+};
+
+/**
+ * Scales an image with a bilinear filter, writing only a centred window of the scaled image.
+ * When the scaled size matches the input size the window is copied unchanged.
+ * @param[in]  input         The pixels of the image
+ * @param[in]  inputWidth    The width of the image
+ * @param[in]  inputHeight   The height of the image
+ * @param[in]  inputStride   The distance between the rows of the image, in bytes
+ * @param[in]  bytesPerPixel The number of bytes of each pixel
+ * @param[in]  scaledWidth   The width the whole image is scaled to
+ * @param[in]  scaledHeight  The height the whole image is scaled to
+ * @param[out] output        The buffer the window is written to
+ * @param[in]  outputWidth   The width of the window, at most scaledWidth
+ * @param[in]  outputHeight  The height of the window, at most scaledHeight
+ * @param[in]  outputStride  The distance between the output rows, in bytes
+ */
+void ResampleBilinear( const uint8_t* input, unsigned int inputWidth, unsigned int inputHeight, unsigned int inputStride,
+                       unsigned int bytesPerPixel, unsigned int scaledWidth, unsigned int scaledHeight,
+                       uint8_t* output, unsigned int outputWidth, unsigned int outputHeight, unsigned int outputStride );
+
+/**
+ * Crops and scales a decoded bitmap to honour the crop, size and scaling mode requested in its attributes.
+ * The requested size applies to the cropped region.
+ * Loaders which can't scale or crop while decoding leave this to the resource thread.
+ * @param[in] bitmap     The decoded bitmap
+ * @param[in] attributes The attributes requested for the image
+ * @return The scaled bitmap, or the decoded one if it doesn't need scaling or can't be resampled
+ */
+Integration::BitmapPtr ApplyAttributesToBitmap( Integration::BitmapPtr bitmap, const ImageAttributes& attributes );
+
+} // namespace SlpPlatform
+
+} // namespace Dali
+
+#endif // __DALI_SLP_PLATFORM_IMAGE_RESAMPLER_H__
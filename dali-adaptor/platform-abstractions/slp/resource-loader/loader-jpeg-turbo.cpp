@@ -24,6 +24,7 @@
 #include <dali/public-api/images/image-attributes.h>
 #include <resource-loader/debug/resource-loader-debug.h>
 #include "platform-capabilities.h"
+#include "image-resampler.h"
 #include <libexif/exif-data.h>
 #include <libexif/exif-loader.h>
 #include <libexif/exif-tag.h>
@@ -164,6 +165,58 @@ namespace
 
     unsigned char * const mTjMem;
   };
+
+  /**
+   * Losslessly cuts a region out of the compressed data of a JPEG image, so only the region has to be decoded.
+   * The left and top edges of the region are moved to the grid of MCU blocks the image is made of.
+   * @param[in]  jpegBuffer       The compressed image
+   * @param[in]  jpegBufferSize   The size of the compressed image
+   * @param[in]  subsampling      The chrominance subsampling of the image, which sets the size of its MCU blocks
+   * @param[in]  region           The region of the image to cut out
+   * @param[out] cut              Is set with the region which was cut out; it contains the requested one
+   * @param[out] regionBuffer     Is set with the compressed region, to be freed with tjFree()
+   * @param[out] regionBufferSize Is set with the size of the compressed region
+   * @return true if the region was cut out, false otherwise
+   */
+  bool CutRegion( unsigned char* jpegBuffer, unsigned long jpegBufferSize, int subsampling, const tjregion& region,
+                  tjregion& cut, unsigned char*& regionBuffer, unsigned long& regionBufferSize )
+  {
+    regionBuffer = NULL;
+    regionBufferSize = 0;
+
+    if( subsampling < 0 || subsampling >= TJ_NUMSAMP )
+    {
+      return false;
+    }
+
+    cut.x = region.x - region.x % tjMCUWidth[subsampling];
+    cut.y = region.y - region.y % tjMCUHeight[subsampling];
+    cut.w = region.x + region.w - cut.x;
+    cut.h = region.y + region.h - cut.y;
+
+    AutoJpg autoJpg( tjInitTransform() );
+    if( autoJpg.GetHandle() == NULL )
+    {
+      DALI_LOG_ERROR("%s\n", tjGetErrorStr());
+      return false;
+    }
+
+    tjtransform cropping;
+    memset( &cropping, 0, sizeof( cropping ) );
+    cropping.r = cut;
+    cropping.op = TJXOP_NONE;
+    cropping.options = TJXOPT_CROP;
+
+    if( tjTransform( autoJpg.GetHandle(), jpegBuffer, jpegBufferSize, 1, &regionBuffer, &regionBufferSize, &cropping, 0 ) == -1 )
+    {
+      DALI_LOG_ERROR("%s\n", tjGetErrorStr());
+      tjFree( regionBuffer );
+      regionBuffer = NULL;
+      return false;
+    }
+
+    return true;
+  }
 } // namespace
 
 bool JpegRotate90 (unsigned char *buffer, int width, int height, int bpp);
@@ -296,6 +349,41 @@ bool LoadBitmapFromJpeg( FILE *fp, Bitmap& bitmap, ImageAttributes& attributes )
   int requiredWidth  = attributes.GetWidth();
   int requiredHeight = attributes.GetHeight();
 
+  // Only decode the region of interest, when one was requested. The region of an image which
+  // doesn't need transforming is cut out of the compressed data; the part of the crop which is
+  // left, within the MCU blocks, is handed back in the attributes for the resource thread.
+  unsigned char* imageBuffer = jpegBufferPtr;
+  unsigned long imageBufferSize = jpegBufferSize;
+  unsigned char* regionBuffer = NULL;
+  unsigned long regionBufferSize = 0;
+  Rect<float> remainingCrop( attributes.GetCrop() );
+
+  const bool swapDimensions = ( transform == JPGFORM_ROT_90 || transform == JPGFORM_ROT_270 );
+  unsigned int imageWidth  = swapDimensions ? preXformImageHeight : preXformImageWidth;
+  unsigned int imageHeight = swapDimensions ? preXformImageWidth : preXformImageHeight;
+  unsigned int regionX, regionY, regionWidth, regionHeight;
+
+  if( CalculateCropRegion( attributes, imageWidth, imageHeight, regionX, regionY, regionWidth, regionHeight ) )
+  {
+    const tjregion region = { static_cast<int>( regionX ), static_cast<int>( regionY ), static_cast<int>( regionWidth ), static_cast<int>( regionHeight ) };
+    tjregion cut;
+    if( transform == JPGFORM_NONE &&
+        CutRegion( jpegBufferPtr, jpegBufferSize, chrominanceSubsampling, region, cut, regionBuffer, regionBufferSize ) )
+    {
+      imageBuffer = regionBuffer;
+      imageBufferSize = regionBufferSize;
+      imageWidth = preXformImageWidth = cut.w;
+      imageHeight = preXformImageHeight = cut.h;
+      remainingCrop = Rect<float>( static_cast<float>( region.x - cut.x ) / cut.w, static_cast<float>( region.y - cut.y ) / cut.h,
+                                   static_cast<float>( region.w ) / cut.w, static_cast<float>( region.h ) / cut.h );
+    }
+
+    // The requested size applies to the region, so the decoded image has to be proportionally larger
+    requiredWidth  = ( static_cast<unsigned long long>( requiredWidth ) * imageWidth ) / regionWidth;
+    requiredHeight = ( static_cast<unsigned long long>( requiredHeight ) * imageHeight ) / regionHeight;
+  }
+  AutoJpgMem autoRegionBuffer( regionBuffer );
+
   // If transform is a 90 or 270 degree rotation, the logical width and height
   // request from the client needs to be adjusted to account by effectively
   // rotating that too, and the final width and height need to be swapped:
@@ -317,7 +405,7 @@ bool LoadBitmapFromJpeg( FILE *fp, Bitmap& bitmap, ImageAttributes& attributes )
   unsigned char * const bitmapPixelBuffer =  bitmap.GetPackedPixelsProfile()->ReserveBuffer(Pixel::RGB888, scaledPostXformWidth, scaledPostXformHeight);
 
   const int pitch = scaledPreXformWidth * DECODED_PIXEL_SIZE;
-  if( tjDecompress2( autoJpg.GetHandle(), jpegBufferPtr, jpegBufferSize, bitmapPixelBuffer, scaledPreXformWidth, pitch, scaledPreXformHeight, DECODED_PIXEL_LIBJPEG_TYPE, flags ) == -1 )
+  if( tjDecompress2( autoJpg.GetHandle(), imageBuffer, imageBufferSize, bitmapPixelBuffer, scaledPreXformWidth, pitch, scaledPreXformHeight, DECODED_PIXEL_LIBJPEG_TYPE, flags ) == -1 )
   {
     DALI_LOG_ERROR("%s\n", tjGetErrorStr());
     return false;
@@ -325,6 +413,7 @@ bool LoadBitmapFromJpeg( FILE *fp, Bitmap& bitmap, ImageAttributes& attributes )
 
   attributes.SetSize( scaledPostXformWidth, scaledPostXformHeight );
   attributes.SetPixelFormat( Pixel::RGB888 );
+  attributes.SetCrop( remainingCrop );
 
   const unsigned int  bufferWidth  = GetTextureDimension( scaledPreXformWidth );
   const unsigned int  bufferHeight = GetTextureDimension( scaledPreXformHeight );
@@ -26,6 +26,7 @@
 #include "dali/public-api/math/math-utils.h"
 #include "dali/public-api/math/vector2.h"
 #include "platform-capabilities.h"
+#include "image-resampler.h"
 
 namespace Dali
 {
@@ -120,24 +121,8 @@ bool LoadPngHeader(FILE *fp, const ImageAttributes& attributes, unsigned int &wi
   png_infop info = NULL;
   auto_png autoPng(png, info);
 
-  bool success = LoadPngHeader(fp, width, height, png, info);
-
-  if( success )
-  {
-    bool crop = (attributes.GetScalingMode() == Dali::ImageAttributes::ScaleToFill);
-    if(crop)
-    {
-      Size req((float) attributes.GetWidth(), (float) attributes.GetHeight());
-      const Size orig((float)width, (float)height);
-
-      // calculate actual width, height
-      req = FitScaleToFill(req, orig);
-
-      width = (int) req.width;
-      height = (int) req.height;
-    }
-  }
-  return success;
+  // The requested scaling is applied after decoding, so report the size of the whole image
+  return LoadPngHeader(fp, width, height, png, info);
 }
 
 bool LoadBitmapFromPng(FILE *fp, Bitmap& bitmap, ImageAttributes& attributes)
@@ -296,89 +281,79 @@ bool LoadBitmapFromPng(FILE *fp, Bitmap& bitmap, ImageAttributes& attributes)
 
   unsigned int rowBytes = png_get_rowbytes(png, info);
 
-  unsigned int bufferWidth   = GetTextureDimension(width);
-  unsigned int bufferHeight  = GetTextureDimension(height);
-  unsigned int stride        = bufferWidth*bpp;
-
-  // not sure if this ever happens
-  if( rowBytes > stride )
-  {
-    stride = GetTextureDimension(rowBytes);
-    bufferWidth = stride / bpp;
-  }
-
-  /// @todo support more scaling types
-  bool crop = (attributes.GetScalingMode() == Dali::ImageAttributes::ScaleToFill);
-
-  if(crop)
-  {
-    pixels = new unsigned char[stride*bufferHeight];
-  }
-  else
+  // Shrink large images while reading their rows, so the whole image is never held in memory.
+  // Interlaced images deliver their rows in several passes and are decoded whole.
+  // Any remaining scaling and cropping is applied by the resource thread.
+  // The requested size applies to the cropped region, so that sets the factor.
+  unsigned int regionX, regionY, regionWidth, regionHeight;
+  unsigned int scaledWidth, scaledHeight, desiredWidth, desiredHeight;
+  unsigned int factor = 1;
+  CalculateCropRegion( attributes, width, height, regionX, regionY, regionWidth, regionHeight );
+  if( png_get_interlace_type(png, info) == PNG_INTERLACE_NONE &&
+      IsResamplingSupported( pixelFormat ) &&
+      CalculateScaledDimensions( attributes, regionWidth, regionHeight, scaledWidth, scaledHeight, desiredWidth, desiredHeight ) )
   {
-    // decode the whole image into bitmap buffer
-    pixels = bitmap.GetPackedPixelsProfile()->ReserveBuffer(pixelFormat, width, height, bufferWidth, bufferHeight);
+    factor = CalculateBoxFilterFactor( regionWidth, regionHeight, scaledWidth, scaledHeight );
   }
 
-  DALI_ASSERT_DEBUG(pixels);
-  rows = (png_bytep*) malloc(sizeof(png_bytep) * height);
-  for(y=0; y<height; y++)
+  if( factor > 1 )
   {
-    rows[y] = (png_byte*) (pixels + y * stride);
-  }
+    const unsigned int filteredWidth  = width / factor;
+    const unsigned int filteredHeight = height / factor;
+    const unsigned int bufferWidth    = GetTextureDimension(filteredWidth);
+    const unsigned int bufferHeight   = GetTextureDimension(filteredHeight);
 
-  // decode image
-  png_read_image(png, rows);
-
-  // copy part of the buffer to bitmap
-  if(crop)
-  {
-    Size req((float) attributes.GetWidth(), (float) attributes.GetHeight());
-    const Size orig((float)width, (float)height);
+    pixels = bitmap.GetPackedPixelsProfile()->ReserveBuffer(pixelFormat, filteredWidth, filteredHeight, bufferWidth, bufferHeight);
+    DALI_ASSERT_DEBUG(pixels);
 
-    // calculate actual width, height
-    req = FitScaleToFill(req, orig);
+    // decode image one row at a time
+    BoxFilter filter(width, bpp, factor, pixels, bufferWidth*bpp);
+    std::vector<png_byte> row(rowBytes);
+    for(y=0; y<height; y++)
+    {
+      png_read_row(png, &row[0], NULL);
+      filter.AddRow(&row[0]);
+    }
 
-    // modify attributes with result
-    attributes.SetSize((int) req.width, (int) req.height);
+    // set the attributes
+    attributes.SetSize(filteredWidth, filteredHeight);
     attributes.SetPixelFormat(pixelFormat);
+  }
+  else
+  {
+    unsigned int bufferWidth   = GetTextureDimension(width);
+    unsigned int bufferHeight  = GetTextureDimension(height);
+    unsigned int stride        = bufferWidth*bpp;
 
-    bufferWidth  = GetTextureDimension(attributes.GetWidth());
-    bufferHeight = GetTextureDimension(attributes.GetHeight());
-
-    // cropped buffer's stride
-    int lstride = bufferWidth*bpp;
-
-    // calculate offsets
-    int x_offset = ((width  - attributes.GetWidth())  / 2) * bpp;
-    int y_offset = ((height - attributes.GetHeight()) / 2) * stride;
+    // not sure if this ever happens
+    if( rowBytes > stride )
+    {
+      stride = GetTextureDimension(rowBytes);
+      bufferWidth = stride / bpp;
+    }
 
-    // allocate bitmap buffer using requested size
-    unsigned char *bitmapBuffer = bitmap.GetPackedPixelsProfile()->ReserveBuffer(pixelFormat, attributes.GetWidth(), attributes.GetHeight(), bufferWidth, bufferHeight);
+    // decode the whole image into bitmap buffer
+    pixels = bitmap.GetPackedPixelsProfile()->ReserveBuffer(pixelFormat, width, height, bufferWidth, bufferHeight);
 
-    // copy memory area from y and x to bitmap buffer line-by-line
-    unsigned char *bufptr = bitmapBuffer;
-    unsigned char *lptr = pixels+y_offset+x_offset;
-    for(unsigned int i = 0; i < attributes.GetHeight(); ++i)
+    DALI_ASSERT_DEBUG(pixels);
+    rows = (png_bytep*) malloc(sizeof(png_bytep) * height);
+    for(y=0; y<height; y++)
     {
-      memcpy(bufptr, lptr, attributes.GetWidth()*bpp);
-      bufptr += lstride;
-      lptr += stride;
+      rows[y] = (png_byte*) (pixels + y * stride);
     }
 
-    delete[] pixels;
-  }
-  else
-  {
+    // decode image
+    png_read_image(png, rows);
+
+    free(rows);
+
     // set the attributes
-     attributes.SetSize(width, height);
-     attributes.SetPixelFormat(pixelFormat);
+    attributes.SetSize(width, height);
+    attributes.SetPixelFormat(pixelFormat);
   }
 
   bitmap.GetPackedPixelsProfile()->TestForTransparency();
 
-  free(rows);
-
   return true;
 }
 
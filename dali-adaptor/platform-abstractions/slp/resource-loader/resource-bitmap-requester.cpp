@@ -70,8 +70,8 @@ void ResourceBitmapRequester::LoadResource( Integration::ResourceRequest& reques
 
 Integration::LoadStatus ResourceBitmapRequester::LoadFurtherResources( Integration::ResourceRequest& request, LoadedResource partialResource )
 {
-  // Nothing to do
-  return RESOURCE_COMPLETELY_LOADED;
+  // A partially loaded bitmap is a low resolution preview; the whole image follows as a loaded resource
+  return RESOURCE_PARTIALLY_LOADED;
 }
 
 void ResourceBitmapRequester::SaveResource(const Integration::ResourceRequest& request )
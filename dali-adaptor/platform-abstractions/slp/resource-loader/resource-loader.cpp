@@ -35,6 +35,7 @@
 #include "resource-model-requester.h"
 #include "resource-shader-requester.h"
 #include "resource-text-requester.h"
+#include "resource-thread-pool.h"
 #include "debug/resource-loader-debug.h"
 #include "loader-font.h"
 #include "../interfaces/font-controller.h"
@@ -211,6 +212,27 @@ struct ResourceLoader::ResourceLoaderImpl
       requester->CancelLoad( id, typeId );
     }
     ClearRequest( id );
+
+    {
+      // Drop any result which has not been fetched by core yet
+      unique_lock<mutex> lock(mQueueMutex);
+      RemoveLoadedResource( mPartiallyLoadedQueue, id );
+      RemoveLoadedResource( mLoadedQueue, id );
+    }
+  }
+
+  void RemoveLoadedResource(LoadedQueue& queue, ResourceId id)
+  {
+    LoadedQueue remaining;
+    while( !queue.empty() )
+    {
+      if( queue.front().id != id )
+      {
+        remaining.push( queue.front() );
+      }
+      queue.pop();
+    }
+    queue = remaining;
   }
 
   LoadStatus LoadFurtherResources( LoadedResource partialResource )
@@ -391,8 +413,11 @@ struct ResourceLoader::ResourceLoaderImpl
 /****************************   RESOURCE LOADER METHODS  ************************/
 /********************************************************************************/
 ResourceLoader::ResourceLoader()
-: mTerminateThread(0)
+: mThreadPool(NULL),
+  mImpl(NULL),
+  mTerminateThread(0)
 {
+  mThreadPool = new ResourceThreadPool();
   mImpl = new ResourceLoaderImpl( this );
 }
 
@@ -401,7 +426,11 @@ ResourceLoader::~ResourceLoader()
   // Flag that the ResourceLoader is exiting
   (void)__sync_or_and_fetch( &mTerminateThread, -1 );
 
+  // Finish the requests being processed, before the resource threads are destroyed
+  mThreadPool->Terminate();
+
   delete mImpl;
+  delete mThreadPool;
 }
 
 void ResourceLoader::Pause()
@@ -419,6 +448,11 @@ bool ResourceLoader::IsTerminating()
   return __sync_fetch_and_or( &mTerminateThread, 0 );
 }
 
+ResourceThreadPool& ResourceLoader::GetThreadPool()
+{
+  return *mThreadPool;
+}
+
 void ResourceLoader::GetResources(ResourceCache& cache)
 {
   mImpl->GetResources( cache );
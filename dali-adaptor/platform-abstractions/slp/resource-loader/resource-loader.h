@@ -46,6 +46,8 @@ class FontController;
 namespace SlpPlatform
 {
 
+class ResourceThreadPool;
+
 /**
  * Contains information about a successfully loaded resource
  */
@@ -166,8 +168,9 @@ struct FailedResource
 /**
  * This implements the resource loading part of the PlatformAbstraction API.
  * The requests for a specific resource type are farmed-out to a resource
- * requester for that type which handles them in their own dedicated loading
- * threads.
+ * requester for that type, which queues them in its resource threads.
+ * The requests of every queue are processed by one pool of worker threads,
+ * in order of their priority.
  */
 class ResourceLoader
 {
@@ -201,6 +204,12 @@ public:
    */
   bool IsTerminating();
 
+  /**
+   * Get the worker threads which process the requests of the resource threads.
+   * @return The thread pool.
+   */
+  ResourceThreadPool& GetThreadPool();
+
   /**
    * Add a partially loaded resource to the PartiallyLoadedResource queue
    * @param[in] resource The resource's information and data
@@ -374,6 +383,7 @@ private:
 
 private:
   struct ResourceLoaderImpl;
+  ResourceThreadPool* mThreadPool;      ///< Created before and destroyed after mImpl, whose resource threads it serves
   ResourceLoaderImpl* mImpl;
 
   volatile int mTerminateThread;        ///< Set to <> 0 in destructor, signals threads to exit their controlling loops
@@ -16,7 +16,7 @@
 
 #include <dali/integration-api/debug.h>
 #include "resource-thread-base.h"
-#include "slp-logging.h"
+#include "resource-thread-pool.h"
 
 using namespace std;
 using namespace Dali::Integration;
@@ -30,14 +30,18 @@ namespace Dali
 namespace SlpPlatform
 {
 
-ResourceThreadBase::ResourceThreadBase(ResourceLoader& resourceLoader)
-: mResourceLoader(resourceLoader), mPaused(false)
+ResourceThreadBase::ResourceThreadBase(ResourceLoader& resourceLoader, unsigned int maximumConcurrentRequests)
+: mResourceLoader(resourceLoader),
+  mThreadPool(resourceLoader.GetThreadPool()),
+  mMaximumConcurrentRequests(maximumConcurrentRequests),
+  mPaused(false),
+  mRegistered(true)
 {
 #if defined(DEBUG_ENABLED)
   mLogFilter = Debug::Filter::New(Debug::Concise, false, "LOG_RESOURCE_THREAD_BASE");
 #endif
 
-  mThread = new boost::thread(boost::bind(&ResourceThreadBase::ThreadLoop, this));
+  mThreadPool.Register( *this );
 }
 
 ResourceThreadBase::~ResourceThreadBase()
@@ -51,38 +55,38 @@ ResourceThreadBase::~ResourceThreadBase()
 
 void ResourceThreadBase::TerminateThread()
 {
-  if (mThread)
+  if( mRegistered )
   {
-    // wake thread
-    mCondition.notify_all();
-    // wait for thread to exit
-    mThread->join();
-    // delete thread instance
-    delete mThread;
-    // mark thread terminated
-    mThread = NULL;
+    // Waits for the worker threads to finish the requests they are processing
+    mThreadPool.Unregister( *this );
+    mRegistered = false;
   }
 }
 
 void ResourceThreadBase::AddRequest(const ResourceRequest& request, const RequestType type)
 {
-  bool wasEmpty = false;
   bool wasPaused = false;
 
   {
     // Lock while adding to the request queue
-    unique_lock<mutex> lock( mMutex );
+    unique_lock<mutex> lock( mThreadPool.mMutex );
 
-    wasEmpty = mQueue.empty();
     wasPaused = mPaused;
 
-    mQueue.push_back( make_pair(request, type) );
+    // Keep the queue sorted by priority; requests of equal priority are processed in the order they were added
+    RequestQueueIter iterator = mQueue.end();
+    while( iterator != mQueue.begin() && ((iterator - 1)->request).GetPriority() < request.GetPriority() )
+    {
+      --iterator;
+    }
+
+    mQueue.insert( iterator, RequestInfo( request, type, mThreadPool.mNextSequenceNumber++ ) );
   }
 
-  if( wasEmpty && !wasPaused )
+  if( !wasPaused )
   {
-    // Wake-up the thread
-    mCondition.notify_all();
+    // Wake-up a worker; the others may still be busy with earlier requests
+    mThreadPool.mCondition.notify_one();
   }
 }
 
@@ -90,129 +94,108 @@ void ResourceThreadBase::CancelRequest( Integration::ResourceId resourceId )
 {
   {
     // Lock while searching and removing from the request queue:
-    unique_lock<mutex> lock( mMutex );
+    unique_lock<mutex> lock( mThreadPool.mMutex );
 
+    bool found = false;
     for( RequestQueueIter iterator = mQueue.begin();
          iterator != mQueue.end();
          ++iterator )
     {
-      if( ((*iterator).first).GetId() == resourceId )
+      if( ((*iterator).request).GetId() == resourceId )
       {
         iterator = mQueue.erase( iterator );
+        found = true;
         break;
       }
     }
+
+    if( !found && mProcessingRequests.find( resourceId ) != mProcessingRequests.end() )
+    {
+      // Too late to remove it, so let the thread processing it drop the result
+      mCancelledRequests.insert( resourceId );
+    }
   }
 }
 
 void ResourceThreadBase::Pause()
 {
-  unique_lock<mutex> lock( mMutex );
+  unique_lock<mutex> lock( mThreadPool.mMutex );
   mPaused = true;
 }
 
 void ResourceThreadBase::Resume()
 {
-  // Clear the paused flag and if we weren't running already, also wake up the background thread:
+  // Clear the paused flag and if we weren't running already, also wake up the worker threads:
   bool wasPaused = false;
   {
-    unique_lock<mutex> lock( mMutex );
+    unique_lock<mutex> lock( mThreadPool.mMutex );
     wasPaused = mPaused;
     mPaused = false;
   }
 
-  // If we were paused, wake up the background thread and give it a
+  // If we were paused, wake up the worker threads and give them a
   // chance to do some work:
   if( wasPaused )
   {
-    mCondition.notify_all();
+    mThreadPool.mCondition.notify_all();
   }
 }
 
-//----------------- Called from separate thread (mThread) -----------------
-
-void ResourceThreadBase::ThreadLoop()
+bool ResourceThreadBase::IsBackgroundRequest( const ResourceRequest& request )
 {
-  InstallLogging();
+  return request.GetPriority() <= LoadPriorityLow;
+}
 
-  while( !mResourceLoader.IsTerminating() )
-  {
-    WaitForRequests();
+//----------------- Called from the worker threads of mThreadPool -----------------
 
-    if ( !mResourceLoader.IsTerminating() )
-    {
-      ProcessNextRequest();
-    }
-  }
+bool ResourceThreadBase::CanProcessNextRequest() const
+{
+  return !mPaused && !mQueue.empty() && mProcessingRequests.size() < mMaximumConcurrentRequests;
 }
 
-void ResourceThreadBase::WaitForRequests()
+ResourceThreadBase::RequestInfo ResourceThreadBase::TakeNextRequest()
 {
-  unique_lock<mutex> lock(mMutex);
+  RequestInfo info( mQueue.front() );
+  mQueue.pop_front();
+  mProcessingRequests.insert( info.request.GetId() );
 
-  if( mQueue.empty() || mPaused == true )
-  {
-    // Waiting for a wake up from resource loader control thread
-    // This will be to process a new request or terminate
-    mCondition.wait(lock);
-  }
+  return info;
 }
 
-void ResourceThreadBase::ProcessNextRequest()
+void ResourceThreadBase::ProcessRequest( const RequestInfo& info )
 {
-  ResourceRequest* request(NULL);
-  RequestType type(RequestLoad);
-
+  switch( info.type )
   {
-    // lock the queue and extract the next request
-    unique_lock<mutex> lock(mMutex);
-
-    if (!mQueue.empty())
+    case RequestLoad:
     {
-      const RequestInfo & front = mQueue.front();
-      request = new ResourceRequest( front.first );
-      type = front.second;
-      mQueue.pop_front();
+      Load( info.request );
     }
-  } // unlock the queue
+    break;
 
-  // process request outside of lock
-  if ( NULL != request )
-  {
-    std::auto_ptr<ResourceRequest> deleter( request );
-    switch( type )
+    case RequestDecode:
     {
-      case RequestLoad:
-      {
-        Load(*request);
-      }
-      break;
-
-      case RequestDecode:
-      {
-        Decode(*request);
-      }
-      break;
+      Decode( info.request );
+    }
+    break;
 
-      case RequestSave:
-      {
-        Save(*request);
-      }
-      break;
+    case RequestSave:
+    {
+      Save( info.request );
     }
+    break;
   }
 }
 
-void ResourceThreadBase::InstallLogging()
+void ResourceThreadBase::FinishRequest( Integration::ResourceId resourceId )
 {
-  // resource loading thread will send its logs to SLP Platform's LogMessage handler.
-  Dali::Integration::Log::InstallLogFunction(Dali::SlpPlatform::LogMessage);
+  mProcessingRequests.erase( resourceId );
+  mCancelledRequests.erase( resourceId );
 }
 
-void ResourceThreadBase::UninstallLogging()
+bool ResourceThreadBase::IsRequestCancelled( Integration::ResourceId resourceId )
 {
-  // uninstall it on resource loading thread.
-  Dali::Integration::Log::UninstallLogFunction();
+  unique_lock<mutex> lock( mThreadPool.mMutex );
+  return mCancelledRequests.find( resourceId ) != mCancelledRequests.end();
 }
 
 void ResourceThreadBase::Decode(const Integration::ResourceRequest& request)
@@ -225,4 +208,3 @@ void ResourceThreadBase::Decode(const Integration::ResourceRequest& request)
 } // namespace SlpPlatform
 
 } // namespace Dali
-
@@ -19,6 +19,8 @@
 
 #include "resource-loader.h"
 #include <deque>
+#include <set>
+#include <vector>
 #include <boost/thread.hpp>
 
 #include <dali/integration-api/platform-abstraction.h>
@@ -30,8 +32,12 @@ namespace Dali
 namespace SlpPlatform
 {
 
+class ResourceThreadPool;
+
 /**
- * Resource loader worker thread
+ * Resource loader request queue, for one kind of resource.
+ * The requests are processed by the worker threads of the ResourceLoader's ResourceThreadPool,
+ * in order of their load priority, and in the order they were added within the same priority.
  */
 class ResourceThreadBase
 {
@@ -50,28 +56,57 @@ public:
     RequestSave
   };
 
-  typedef std::pair<Integration::ResourceRequest, RequestType>  RequestInfo;
+  /**
+   * A queued request.
+   */
+  struct RequestInfo
+  {
+    RequestInfo( const Integration::ResourceRequest& resourceRequest, RequestType requestType, unsigned int requestSequenceNumber )
+    : request( resourceRequest ),
+      type( requestType ),
+      sequenceNumber( requestSequenceNumber )
+    {
+    }
+
+    Integration::ResourceRequest request;
+    RequestType type;
+    unsigned int sequenceNumber;          ///< Orders requests of equal priority, across the queues of the thread pool
+  };
+
   typedef std::deque<RequestInfo>                               RequestQueue;
   typedef RequestQueue::iterator                                RequestQueueIter;
+  typedef std::set<Integration::ResourceId>                     ResourceIdSet;
 
 public:
   // C'tors and D'tors
-  ResourceThreadBase(ResourceLoader& resourceLoader);
+
+  /**
+   * Constructor. Adds the queue to the thread pool of the resource loader.
+   * @param[in] resourceLoader            The resource loader which receives the results of the requests.
+   * @param[in] maximumConcurrentRequests The number of requests which may be processed at the same time.
+   *                                      Only subclasses whose Load(), Decode() and Save() are reentrant may use more than one.
+   */
+  ResourceThreadBase(ResourceLoader& resourceLoader, unsigned int maximumConcurrentRequests = 1u);
   virtual ~ResourceThreadBase();
 
 protected:
+  /**
+   * Stop processing requests; this waits until the requests being processed have finished.
+   * Subclasses call this before destroying anything used by Load(), Decode() or Save().
+   */
   void TerminateThread();
 
 public:
   /**
-   * Add a resource request to the back of the queue
+   * Add a resource request to the queue, behind any request of the same or higher priority
    * @param[in] request The requested resource/file url and attributes
    * @param[in] type    Load or save flag
    */
   void AddRequest(const Integration::ResourceRequest& request, const RequestType type);
 
   /**
-   * Cancel a resource request. Removes the request from the queue.
+   * Cancel a resource request. Removes the request from the queue, or if it is
+   * already being processed, marks it so its result is discarded.
    * @param[in] resourceId ID of the resource to be canceled
    */
   void CancelRequest(Integration::ResourceId  resourceId);
@@ -86,60 +121,82 @@ public:
    */
   void Resume();
 
+  /**
+   * Query whether a request is a background request.
+   * Background requests are never given every worker thread of the pool.
+   * @param[in] request The request
+   * @return true if the request has LoadPriorityLow or lower.
+   */
+  static bool IsBackgroundRequest(const Integration::ResourceRequest& request);
 
 protected:
   /**
-   * Main control loop for the thread.
-   * The thread is terminated when this function exits
+   * Check whether a request being processed has been cancelled since it was taken from the queue.
+   * Subclasses use this to skip work and to discard the results of cancelled requests.
+   * @param[in] resourceId ID of the resource being processed
+   * @return true if the request has been cancelled
    */
-  void ThreadLoop();
+  bool IsRequestCancelled(Integration::ResourceId resourceId);
 
   /**
-   * Wait for an incoming resource request or termination
+   * Load a resource
+   * @param[in] request  The requested resource/file url and attributes
    */
-  void WaitForRequests();
+  virtual void Load(const Integration::ResourceRequest& request) = 0;
 
   /**
-   * Process the resource request at the head of the queue
+   * Decode a resource exactly as if it were being loaded but source its data
+   * from a memory buffer attached directly to the request object.
+   * @param[in] request  The requested resource data and attributes
    */
-  void ProcessNextRequest();
+  virtual void Decode(const Integration::ResourceRequest& request);
 
   /**
-   * Install a logging function in to core for this thread.
+   * Save a resource
+   * @param[in] request  The requested resource/file url and attributes
    */
-  void InstallLogging();
+  virtual void Save(const Integration::ResourceRequest& request) = 0;
+
+private:
+
+  friend class ResourceThreadPool;
 
   /**
-   * Uninstall a logging function.
+   * Query whether the next request in the queue may be processed now.
+   * @pre The mutex of the thread pool is locked.
+   * @return true if the queue is not paused or empty, and fewer than the maximum number of requests are being processed.
    */
-  void UninstallLogging();
+  bool CanProcessNextRequest() const;
 
   /**
-   * Load a resource
-   * @param[in] request  The requested resource/file url and attributes
+   * Take the next request from the queue, to be processed by a worker thread.
+   * @pre The mutex of the thread pool is locked, and CanProcessNextRequest() returned true.
+   * @return The request.
    */
-  virtual void Load(const Integration::ResourceRequest& request) = 0;
+  RequestInfo TakeNextRequest();
 
   /**
-   * Decode a resource exactly as if it were being loaded but source its data
-   * from a memory buffer attached directly to the request object.
-   * @param[in] request  The requested resource data and attributes
+   * Process a request taken from the queue; called by a worker thread, without the mutex of the thread pool.
+   * @param[in] info The request
    */
-  virtual void Decode(const Integration::ResourceRequest& request);
+  void ProcessRequest(const RequestInfo& info);
 
   /**
-   * Save a resource
-   * @param[in] request  The requested resource/file url and attributes
+   * Called by a worker thread once a request has been processed.
+   * @pre The mutex of the thread pool is locked.
+   * @param[in] resourceId ID of the resource which was processed
    */
-  virtual void Save(const Integration::ResourceRequest& request) = 0;
+  void FinishRequest(Integration::ResourceId resourceId);
 
 protected:
   ResourceLoader& mResourceLoader;
-  boost::thread* mThread;                       ///< thread instance
-  boost::condition_variable mCondition;         ///< condition variable
-  boost::mutex mMutex;                          ///< used to protect mQueue
-  RequestQueue mQueue;                          ///< Request queue
+  ResourceThreadPool& mThreadPool;              ///< Processes the requests; its mutex protects the members below
+  RequestQueue mQueue;                          ///< Request queue, ordered by priority
+  ResourceIdSet mProcessingRequests;            ///< Requests taken from the queue and not yet processed
+  ResourceIdSet mCancelledRequests;             ///< Requests cancelled while being processed
+  unsigned int mMaximumConcurrentRequests;      ///< The number of requests which may be processed at the same time
   bool mPaused;                                 ///< Whether to process work in mQueue
+  bool mRegistered;                             ///< Whether the queue is still processed by mThreadPool
 
 #if defined(DEBUG_ENABLED)
 public:
@@ -15,6 +15,7 @@
 //
 
 #include "resource-thread-image.h"
+#include <algorithm>
 #include <dali/public-api/common/ref-counted-dali-vector.h>
 #include <dali/integration-api/bitmap.h>
 #include <dali/integration-api/debug.h>
@@ -27,6 +28,8 @@
 #include "loader-ico.h"
 #include "loader-ktx.h"
 #include "loader-wbmp.h"
+#include "image-resampler.h"
+#include "resource-thread-pool.h"
 
 using namespace std;
 using namespace Dali::Integration;
@@ -97,6 +100,9 @@ const BitmapLoader BITMAP_LOADER_LOOKUP_TABLE[FORMAT_TOTAL_COUNT] =
 
 const unsigned int MAGIC_LENGTH = 2;
 
+const unsigned int PREVIEW_SCALE_FACTOR = 8u;            ///< Progressively loaded images are previewed at an eighth of their size
+const unsigned int MINIMUM_PREVIEWED_DIMENSION = 512u;   ///< Smaller images decode quickly enough to be delivered whole
+
 /**
  * This code tries to predict the file format from the filename to help with format picking.
  */
@@ -240,10 +246,70 @@ bool GetBitmapLoaderFunctions( FILE *fp,
   return loaderFound;
 }
 
+/**
+ * Decodes a low resolution version of an image, when one can be decoded much faster than the whole image.
+ * JPEG decoders produce one from the DC coefficients of each block, skipping most of the work.
+ * @param[in] fp         The file to decode; it is left at its start
+ * @param[in] loader     The function which decodes the image
+ * @param[in] header     The function which decodes the header of the image
+ * @param[in] attributes The attributes requested for the image
+ * @return The low resolution version, or NULL if the image should be delivered whole
+ */
+BitmapPtr DecodePreview( FILE* fp, LoadBitmapFunction loader, LoadBitmapHeaderFunction header, const ImageAttributes& attributes )
+{
+  BitmapPtr preview;
+
+  if( loader != LoadBitmapFromJpeg )
+  {
+    return preview;
+  }
+
+  unsigned int width = 0, height = 0;
+  if( header( fp, ImageAttributes::DEFAULT_ATTRIBUTES, width, height ) )
+  {
+    unsigned int x, y, scaledWidth, scaledHeight;
+    CalculateCropRegion( attributes, width, height, x, y, width, height );
+    CalculateScaledDimensions( attributes, width, height, scaledWidth, scaledHeight, width, height );
+
+    if( std::max( width, height ) >= MINIMUM_PREVIEWED_DIMENSION )
+    {
+      ImageAttributes previewAttributes( attributes );
+      previewAttributes.SetSize( std::max( 1u, width / PREVIEW_SCALE_FACTOR ), std::max( 1u, height / PREVIEW_SCALE_FACTOR ) );
+      if( previewAttributes.GetScalingMode() != ImageAttributes::ScaleToFill )
+      {
+        // The size already honours the scaling mode
+        previewAttributes.SetScalingMode( ImageAttributes::ShrinkToFit );
+      }
+
+      if( fseek( fp, 0, SEEK_SET ) == 0 )
+      {
+        ImageAttributes decodedAttributes( previewAttributes );
+        preview = Bitmap::New( Bitmap::BITMAP_2D_PACKED_PIXELS, true );
+        if( loader( fp, *preview, decodedAttributes ) )
+        {
+          previewAttributes.SetCrop( decodedAttributes.GetCrop() );
+          preview = ApplyAttributesToBitmap( preview, previewAttributes );
+        }
+        else
+        {
+          preview = NULL;
+        }
+      }
+    }
+  }
+
+  if( fseek( fp, 0, SEEK_SET ) )
+  {
+    DALI_LOG_ERROR("Error seeking to start of file\n");
+  }
+
+  return preview;
+}
+
 }
 
 ResourceThreadImage::ResourceThreadImage(ResourceLoader& resourceLoader)
-: ResourceThreadBase(resourceLoader)
+: ResourceThreadBase(resourceLoader, resourceLoader.GetThreadPool().GetNumberOfThreads())
 {
 }
 
@@ -277,6 +343,11 @@ void ResourceThreadImage::GetClosestImageSize( const std::string& filename,
         DALI_LOG_WARNING("Image Decoder failed to read header for %s\n", filename.c_str());
       }
 
+      // Report the size the image will have once the requested attributes are applied to it
+      unsigned int x, y, scaledWidth, scaledHeight;
+      CalculateCropRegion( attributes, width, height, x, y, width, height );
+      CalculateScaledDimensions( attributes, width, height, scaledWidth, scaledHeight, width, height );
+
       closestSize.width = (float)width;
       closestSize.height = (float)height;
     }
@@ -330,6 +401,11 @@ void ResourceThreadImage::GetClosestImageSize( ResourcePointer resourceBuffer,
             DALI_LOG_WARNING("Image Decoder failed to read header for resourceBuffer\n");
           }
 
+          // Report the size the image will have once the requested attributes are applied to it
+          unsigned int x, y, scaledWidth, scaledHeight;
+          CalculateCropRegion( attributes, width, height, x, y, width, height );
+          CalculateScaledDimensions( attributes, width, height, scaledWidth, scaledHeight, width, height );
+
           closestSize.width = (float) width;
           closestSize.height = (float) height;
         }
@@ -340,7 +416,7 @@ void ResourceThreadImage::GetClosestImageSize( ResourcePointer resourceBuffer,
 }
 
 
-//----------------- Called from separate thread (mThread) -----------------
+//----------------- Called from the worker threads of the thread pool -----------------
 
 void ResourceThreadImage::Load(const ResourceRequest& request)
 {
@@ -454,10 +530,23 @@ BitmapPtr ResourceThreadImage::ConvertStreamToBitmap(const ResourceRequest& requ
     {
       bitmap = Bitmap::New(profile, true);
 
-      DALI_LOG_SET_OBJECT_STRING(bitmap, request.GetPath());
       BitmapResourceType& resType = static_cast<BitmapResourceType&>(*(request.GetType()));
       ImageAttributes& attributes  = resType.imageAttributes;
 
+      // The loaders replace the requested size with the decoded one
+      ImageAttributes requestedAttributes = attributes;
+
+      if( requestedAttributes.GetProgressiveLoading() )
+      {
+        BitmapPtr preview = DecodePreview( fp, function, header, requestedAttributes );
+        if( preview && !IsRequestCancelled( request.GetId() ) )
+        {
+          // Drawn until the whole image has been decoded
+          LoadedResource resource( request.GetId(), request.GetType()->id, ResourcePointer( preview.Get() ) );
+          mResourceLoader.AddPartiallyLoadedResource( resource );
+        }
+      }
+
       result = function(fp, *bitmap, attributes);
 
       if (!result)
@@ -465,6 +554,15 @@ BitmapPtr ResourceThreadImage::ConvertStreamToBitmap(const ResourceRequest& requ
         DALI_LOG_WARNING("Unable to decode %s\n", path.c_str());
         bitmap = 0;
       }
+      else
+      {
+        // Scale the images of loaders that can't scale, or only approximately, while decoding.
+        // Loaders which decode only the region of interest leave the part of it still to be cropped.
+        requestedAttributes.SetCrop( attributes.GetCrop() );
+        bitmap = ApplyAttributesToBitmap( bitmap, requestedAttributes );
+        attributes.SetSize( bitmap->GetImageWidth(), bitmap->GetImageHeight() );
+        DALI_LOG_SET_OBJECT_STRING(bitmap, request.GetPath());
+      }
     }
     else
     {
@@ -473,7 +571,12 @@ BitmapPtr ResourceThreadImage::ConvertStreamToBitmap(const ResourceRequest& requ
     fclose(fp); ///! Not exception safe, but an exception on a resource thread will bring the process down anyway.
   }
 
-  if ( result )
+  if ( result && IsRequestCancelled( request.GetId() ) )
+  {
+    // The ticket was discarded while decoding; nobody is waiting for the image
+    DALI_LOG_INFO( mLogFilter, Debug::Verbose, "Discarding cancelled image %s\n", path.c_str() );
+  }
+  else if ( result )
   {
     // Construct LoadedResource and ResourcePointer for image data
     LoadedResource resource( request.GetId(), request.GetType()->id, ResourcePointer( bitmap.Get() ) );
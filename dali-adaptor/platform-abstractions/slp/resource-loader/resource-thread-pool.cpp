@@ -0,0 +1,206 @@
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include "resource-thread-pool.h"
+#include <algorithm>
+#include <dali/integration-api/debug.h>
+#include "resource-thread-base.h"
+#include "slp-logging.h"
+
+using boost::mutex;
+using boost::unique_lock;
+
+namespace Dali
+{
+
+namespace SlpPlatform
+{
+
+namespace
+{
+
+const unsigned int MINIMUM_NUMBER_OF_THREADS = 2u; ///< So that a visible resource can be loaded while a background one is
+const unsigned int MAXIMUM_NUMBER_OF_THREADS = 4u; ///< Bounds the memory held by images being decoded at the same time
+
+/**
+ * Query whether a request was added before another, when both have the same priority.
+ * The sequence numbers may wrap around.
+ */
+bool IsEarlier( unsigned int sequenceNumber, unsigned int otherSequenceNumber )
+{
+  return static_cast<int>( sequenceNumber - otherSequenceNumber ) < 0;
+}
+
+} // unnamed namespace
+
+ResourceThreadPool::ResourceThreadPool( unsigned int numberOfThreads )
+: mNextSequenceNumber( 0u ),
+  mBackgroundRequests( 0u ),
+  mTerminating( false )
+{
+  for( unsigned int i = 0; i < numberOfThreads; ++i )
+  {
+    mThreads.push_back( new boost::thread(boost::bind(&ResourceThreadPool::ThreadLoop, this)) );
+  }
+}
+
+ResourceThreadPool::~ResourceThreadPool()
+{
+  Terminate();
+
+  DALI_ASSERT_DEBUG( mResourceThreads.empty() && "Resource threads must be destroyed before the thread pool" );
+}
+
+void ResourceThreadPool::Terminate()
+{
+  {
+    unique_lock<mutex> lock( mMutex );
+    mTerminating = true;
+  }
+
+  // wake threads
+  mCondition.notify_all();
+
+  for( ThreadContainer::iterator iter = mThreads.begin(); iter != mThreads.end(); ++iter )
+  {
+    // wait for thread to exit
+    (*iter)->join();
+    // delete thread instance
+    delete *iter;
+  }
+  mThreads.clear();
+}
+
+unsigned int ResourceThreadPool::GetNumberOfThreads() const
+{
+  return mThreads.size();
+}
+
+unsigned int ResourceThreadPool::GetDefaultNumberOfThreads()
+{
+  const unsigned int numberOfCores = boost::thread::hardware_concurrency();
+
+  return std::max( MINIMUM_NUMBER_OF_THREADS, std::min( numberOfCores, MAXIMUM_NUMBER_OF_THREADS ) );
+}
+
+void ResourceThreadPool::Register( ResourceThreadBase& resourceThread )
+{
+  unique_lock<mutex> lock( mMutex );
+  mResourceThreads.push_back( &resourceThread );
+}
+
+void ResourceThreadPool::Unregister( ResourceThreadBase& resourceThread )
+{
+  unique_lock<mutex> lock( mMutex );
+
+  ResourceThreadContainer::iterator iter = std::find( mResourceThreads.begin(), mResourceThreads.end(), &resourceThread );
+  if( iter != mResourceThreads.end() )
+  {
+    mResourceThreads.erase( iter );
+  }
+
+  // The worker threads notify the condition whenever a request has been processed
+  while( !resourceThread.mProcessingRequests.empty() )
+  {
+    mCondition.wait( lock );
+  }
+}
+
+//----------------- Called from separate threads (mThreads) -----------------
+
+void ResourceThreadPool::ThreadLoop()
+{
+  // resource loading threads send their logs to SLP Platform's LogMessage handler.
+  Dali::Integration::Log::InstallLogFunction(Dali::SlpPlatform::LogMessage);
+
+  unique_lock<mutex> lock( mMutex );
+
+  while( !mTerminating )
+  {
+    ResourceThreadBase* resourceThread = GetNextResourceThread();
+
+    if( NULL == resourceThread )
+    {
+      // Wait for a new request, a finished request, a resumed queue or termination
+      mCondition.wait( lock );
+    }
+    else
+    {
+      const ResourceThreadBase::RequestInfo info( resourceThread->TakeNextRequest() );
+      const bool background = ResourceThreadBase::IsBackgroundRequest( info.request );
+      if( background )
+      {
+        ++mBackgroundRequests;
+      }
+
+      // process request outside of lock
+      lock.unlock();
+      resourceThread->ProcessRequest( info );
+      lock.lock();
+
+      resourceThread->FinishRequest( info.request.GetId() );
+      if( background )
+      {
+        --mBackgroundRequests;
+      }
+
+      // Requests which were waiting for this one may now be processed, and Unregister() may be waiting
+      mCondition.notify_all();
+    }
+  }
+
+  Dali::Integration::Log::UninstallLogFunction();
+}
+
+ResourceThreadBase* ResourceThreadPool::GetNextResourceThread()
+{
+  // Keep one worker for requests which are not in the background
+  const bool backgroundAllowed = mThreads.size() < MINIMUM_NUMBER_OF_THREADS || mBackgroundRequests + 1u < mThreads.size();
+
+  ResourceThreadBase* next = NULL;
+  for( ResourceThreadContainer::iterator iter = mResourceThreads.begin(); iter != mResourceThreads.end(); ++iter )
+  {
+    ResourceThreadBase* resourceThread = *iter;
+    if( resourceThread->CanProcessNextRequest() )
+    {
+      const ResourceThreadBase::RequestInfo& info = resourceThread->mQueue.front();
+      if( !backgroundAllowed && ResourceThreadBase::IsBackgroundRequest( info.request ) )
+      {
+        continue;
+      }
+
+      if( NULL == next )
+      {
+        next = resourceThread;
+      }
+      else
+      {
+        const ResourceThreadBase::RequestInfo& nextInfo = next->mQueue.front();
+        if( info.request.GetPriority() > nextInfo.request.GetPriority() ||
+            ( info.request.GetPriority() == nextInfo.request.GetPriority() && IsEarlier( info.sequenceNumber, nextInfo.sequenceNumber ) ) )
+        {
+          next = resourceThread;
+        }
+      }
+    }
+  }
+
+  return next;
+}
+
+} // namespace SlpPlatform
+
+} // namespace Dali
@@ -0,0 +1,122 @@
+#ifndef __DALI_SLP_PLATFORM_RESOURCE_THREAD_POOL_H__
+#define __DALI_SLP_PLATFORM_RESOURCE_THREAD_POOL_H__
+
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <vector>
+#include <boost/thread.hpp>
+
+namespace Dali
+{
+
+namespace SlpPlatform
+{
+
+class ResourceThreadBase;
+
+/**
+ * The worker threads shared by the resource threads of a ResourceLoader.
+ * Each worker takes the highest priority request from the queues of all the resource threads;
+ * requests of equal priority are processed in the order they were added, whatever their type.
+ * Background requests (LoadPriorityLow or lower) are never given every worker, so that a request
+ * for a visible resource can start as soon as it is added.
+ */
+class ResourceThreadPool
+{
+public:
+
+  typedef std::vector<boost::thread*>      ThreadContainer;
+  typedef std::vector<ResourceThreadBase*> ResourceThreadContainer;
+
+  /**
+   * Constructor. Starts the worker threads.
+   * @param[in] numberOfThreads The number of worker threads.
+   */
+  ResourceThreadPool( unsigned int numberOfThreads = GetDefaultNumberOfThreads() );
+
+  /**
+   * Non-virtual destructor; stops the worker threads.
+   */
+  ~ResourceThreadPool();
+
+  /**
+   * Stop the worker threads, once they have finished the requests they are processing.
+   * The requests which are still queued are not processed.
+   */
+  void Terminate();
+
+  /**
+   * Query the number of worker threads.
+   * @return The number of threads.
+   */
+  unsigned int GetNumberOfThreads() const;
+
+  /**
+   * Get the default number of worker threads; one per core, between two and four.
+   * More threads would increase the memory held by images decoded at the same time.
+   * @return The number of threads.
+   */
+  static unsigned int GetDefaultNumberOfThreads();
+
+private:
+
+  friend class ResourceThreadBase;
+
+  /**
+   * Add a resource thread, whose requests are processed by the worker threads.
+   * @param[in] resourceThread The resource thread.
+   */
+  void Register( ResourceThreadBase& resourceThread );
+
+  /**
+   * Remove a resource thread; this waits until none of its requests are being processed.
+   * @param[in] resourceThread The resource thread.
+   */
+  void Unregister( ResourceThreadBase& resourceThread );
+
+  /**
+   * Main control loop of a worker thread.
+   */
+  void ThreadLoop();
+
+  /**
+   * Find the resource thread whose next request should be processed.
+   * @pre mMutex is locked.
+   * @return The resource thread, or NULL if no request can be processed now.
+   */
+  ResourceThreadBase* GetNextResourceThread();
+
+  // Undefined
+  ResourceThreadPool( const ResourceThreadPool& );
+  ResourceThreadPool& operator=( const ResourceThreadPool& );
+
+private:
+
+  boost::mutex mMutex;                      ///< Protects the request queues of every resource thread, and the members below
+  boost::condition_variable mCondition;     ///< Signalled when a request can be processed, or one has finished
+  ResourceThreadContainer mResourceThreads; ///< The registered resource threads; not owned
+  ThreadContainer mThreads;                 ///< The worker threads
+  unsigned int mNextSequenceNumber;         ///< Orders the requests of equal priority, across all the queues
+  unsigned int mBackgroundRequests;         ///< The number of background requests being processed
+  bool mTerminating;                        ///< Set to stop the worker threads
+};
+
+} // namespace SlpPlatform
+
+} // namespace Dali
+
+#endif // __DALI_SLP_PLATFORM_RESOURCE_THREAD_POOL_H__
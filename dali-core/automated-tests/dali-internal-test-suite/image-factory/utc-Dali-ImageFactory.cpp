@@ -63,6 +63,7 @@ TEST_FUNCTION( UtcDaliImageFactoryUseCachedRequest04,   POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliImageFactoryCompatibleResource01, POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliImageFactoryCompatibleResource02, POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliImageFactoryCompatibleResource03, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliImageFactoryDifferentCrop,        POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliImageFactoryReload01,             POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliImageFactoryReload02,             POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliImageFactoryReload03,             POSITIVE_TC_IDX );
@@ -330,6 +331,62 @@ static void UtcDaliImageFactoryCompatibleResource03()
   DALI_TEST_EQUALS( ticket->GetId(), ticket2->GetId(), TEST_LOCATION ); // same resource
 }
 
+// Different crops of the same image are different resources
+static void UtcDaliImageFactoryDifferentCrop()
+{
+  TestApplication application;
+  tet_infoline( "UtcDaliImageFactoryDifferentCrop - Two crops of the same image load two resources" );
+
+  ImageFactory& imageFactory  = Internal::ThreadLocalStorage::Get().GetImageFactory();
+
+  Vector2 testSize(80.0f, 80.0f);
+  application.GetPlatform().SetClosestImageSize(testSize);
+
+  ImageAttributes attr = ImageAttributes::New();
+  attr.SetSize( 80, 80 );
+  attr.SetCrop( Rect<float>( 0.0f, 0.0f, 1.0f, 1.0f ) );
+  RequestPtr req = imageFactory.RegisterRequest( gTestImageFilename, &attr );
+  ResourceTicketPtr ticket = imageFactory.Load( req.Get() );
+
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_CHECK( application.GetPlatform().WasCalled( TestPlatformAbstraction::LoadResourceFunc ) );
+  application.GetPlatform().ResetTrace();
+
+  // emulate load success
+  EmulateImageLoaded( application, 80, 80 );
+
+  // A crop inside the loaded crop selects a different region of the image, so it is loaded separately
+  ImageAttributes attr2 = ImageAttributes::New();
+  attr2.SetSize( 80, 80 );
+  attr2.SetCrop( Rect<float>( 0.0f, 0.0f, 0.5f, 0.5f ) );
+  RequestPtr req2 = imageFactory.RegisterRequest( gTestImageFilename, &attr2 );
+  ResourceTicketPtr ticket2 = imageFactory.Load( req2.Get() );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK( req != req2 ); // different requests
+  DALI_TEST_CHECK( ticket->GetId() != ticket2->GetId() ); // different resources
+  DALI_TEST_CHECK( application.GetPlatform().WasCalled( TestPlatformAbstraction::LoadResourceFunc ) );
+  application.GetPlatform().ResetTrace();
+
+  EmulateImageLoaded( application, 80, 80 );
+
+  // The same crop again uses the cached request
+  ImageAttributes attr3 = ImageAttributes::New();
+  attr3.SetSize( 80, 80 );
+  attr3.SetCrop( Rect<float>( 0.0f, 0.0f, 0.5f, 0.5f ) );
+  RequestPtr req3 = imageFactory.RegisterRequest( gTestImageFilename, &attr3 );
+  ResourceTicketPtr ticket3 = imageFactory.Load( req3.Get() );
+
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_EQUALS( ticket2->GetId(), ticket3->GetId(), TEST_LOCATION );
+  DALI_TEST_CHECK( !application.GetPlatform().WasCalled( TestPlatformAbstraction::LoadResourceFunc ) );
+}
+
 // Test for reloading image
 static void UtcDaliImageFactoryReload01()
 {
@@ -0,0 +1,404 @@
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <iostream>
+#include <algorithm>
+#include <vector>
+
+#include <stdlib.h>
+#include <time.h>
+#include <tet_api.h>
+
+#include <boost/thread.hpp>
+
+#include <dali/public-api/dali-core.h>
+
+#include <dali-test-suite-utils.h>
+
+// Internal headers are allowed here
+
+#include <dali/internal/common/message.h>
+#include <dali/internal/common/message-ring.h>
+#include <dali/internal/common/event-to-update.h>
+#include <dali/internal/event/common/thread-local-storage.h>
+
+using namespace Dali;
+using Internal::MessageRing;
+
+static void Startup();
+static void Cleanup();
+
+extern "C" {
+  void (*tet_startup)() = Startup;
+  void (*tet_cleanup)() = Cleanup;
+}
+
+enum {
+  POSITIVE_TC_IDX = 0x01,
+  NEGATIVE_TC_IDX,
+};
+
+#define MAX_NUMBER_OF_TESTS 10000
+extern "C" {
+  struct tet_testlist tet_testlist[MAX_NUMBER_OF_TESTS];
+}
+
+// Add test functionality for all APIs in the class (Positive and Negative)
+TEST_FUNCTION( UtcDaliMessageRingReadInOrder, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliMessageRingUnpublishedMessages, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliMessageRingRecycleSegments, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliMessageRingOversizedMessage, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliMessageRingTwoThreads, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliMessageQueueStress, POSITIVE_TC_IDX );
+
+// Called only once before first test is run.
+static void Startup()
+{
+}
+
+// Called only once after last test is run
+static void Cleanup()
+{
+}
+
+namespace
+{
+
+const std::size_t SEGMENT_SIZE = 1024;
+const std::size_t MAX_CAPACITY = 4096;
+
+/**
+ * Write a message of "words" words, each containing value.
+ */
+void WriteMessage( MessageRing& ring, unsigned int words, unsigned int value )
+{
+  unsigned int* slot = ring.ReserveMessageSlot( words * sizeof(unsigned int) );
+  for( unsigned int i = 0u; i < words; ++i )
+  {
+    slot[i] = value;
+  }
+}
+
+/**
+ * Read the messages written by WriteMessage(); returns the number of batches read
+ */
+unsigned int ReadMessages( MessageRing& ring, unsigned int& nextValue, bool& inOrder )
+{
+  unsigned int batches = 0u;
+
+  ring.AcquirePublished();
+
+  unsigned int batchData( 0u );
+  while( ring.HasAcquiredMessages() )
+  {
+    unsigned int* message = ring.Read( batchData );
+    if( message )
+    {
+      inOrder = inOrder && ( nextValue == message[0] );
+      ++nextValue;
+    }
+    else
+    {
+      ++batches;
+    }
+  }
+
+  return batches;
+}
+
+/**
+ * Time in nanoseconds, from an arbitrary point
+ */
+unsigned long long GetNanoseconds()
+{
+  timespec time;
+  clock_gettime( CLOCK_MONOTONIC, &time );
+  return static_cast<unsigned long long>( time.tv_sec ) * 1000000000ull + time.tv_nsec;
+}
+
+/**
+ * Used as the target of the messages in the stress test
+ */
+struct MessageCounter
+{
+  MessageCounter()
+  : count( 0u ),
+    sum( 0u )
+  {
+  }
+
+  void Add( unsigned int value )
+  {
+    ++count;
+    sum += value;
+  }
+
+  unsigned int count;
+  unsigned long long sum;
+};
+
+typedef Internal::MessageValue1< MessageCounter, unsigned int > CounterMessage;
+
+} // unnamed namespace
+
+static void UtcDaliMessageRingReadInOrder()
+{
+  TestApplication application;
+
+  MessageRing ring( SEGMENT_SIZE, MAX_CAPACITY );
+
+  // Nothing to read yet
+  ring.AcquirePublished();
+  DALI_TEST_CHECK( !ring.HasAcquiredMessages() );
+
+  // Write enough messages of varying size to fill several segments
+  for( unsigned int i = 0u; i < 200u; ++i )
+  {
+    WriteMessage( ring, 1u + i % 7u, i );
+  }
+  ring.Publish( 42u );
+
+  ring.AcquirePublished();
+
+  unsigned int batchData( 0u );
+  for( unsigned int i = 0u; i < 200u; ++i )
+  {
+    DALI_TEST_CHECK( ring.HasAcquiredMessages() );
+
+    unsigned int* message = ring.Read( batchData );
+    DALI_TEST_CHECK( NULL != message );
+
+    const unsigned int words = 1u + i % 7u;
+    for( unsigned int j = 0u; j < words; ++j )
+    {
+      DALI_TEST_EQUALS( message[j], i, TEST_LOCATION );
+    }
+  }
+
+  // Followed by the end of the batch
+  DALI_TEST_CHECK( ring.HasAcquiredMessages() );
+  DALI_TEST_CHECK( NULL == ring.Read( batchData ) );
+  DALI_TEST_EQUALS( batchData, 42u, TEST_LOCATION );
+
+  DALI_TEST_CHECK( !ring.HasAcquiredMessages() );
+}
+
+static void UtcDaliMessageRingUnpublishedMessages()
+{
+  TestApplication application;
+
+  MessageRing ring( SEGMENT_SIZE, MAX_CAPACITY );
+
+  WriteMessage( ring, 4u, 0u );
+  ring.Publish( 1u );
+
+  // Reserved, but not published
+  WriteMessage( ring, 4u, 1u );
+
+  unsigned int nextValue( 0u );
+  bool inOrder( true );
+  DALI_TEST_EQUALS( ReadMessages( ring, nextValue, inOrder ), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( nextValue, 1u, TEST_LOCATION );
+
+  // Published after the messages were acquired
+  ring.Publish( 2u );
+  DALI_TEST_CHECK( !ring.HasAcquiredMessages() );
+
+  DALI_TEST_EQUALS( ReadMessages( ring, nextValue, inOrder ), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( nextValue, 2u, TEST_LOCATION );
+  DALI_TEST_CHECK( inOrder );
+}
+
+static void UtcDaliMessageRingRecycleSegments()
+{
+  TestApplication application;
+
+  MessageRing ring( SEGMENT_SIZE, MAX_CAPACITY );
+
+  unsigned int nextValue( 0u );
+  unsigned int writtenValue( 0u );
+  bool inOrder( true );
+
+  // Write a few segments worth of messages per frame
+  for( unsigned int frame = 0u; frame < 100u; ++frame )
+  {
+    for( unsigned int i = 0u; i < 500u; ++i )
+    {
+      WriteMessage( ring, 2u, writtenValue++ );
+    }
+    ring.Publish( frame );
+
+    ReadMessages( ring, nextValue, inOrder );
+  }
+
+  DALI_TEST_CHECK( inOrder );
+  DALI_TEST_EQUALS( nextValue, writtenValue, TEST_LOCATION );
+
+  // The consumed segments are recycled, rather than growing the ring each frame
+  DALI_TEST_CHECK( ring.GetCapacity() <= 2u * 500u * 3u * sizeof(unsigned int) + 2u * SEGMENT_SIZE );
+
+  // A burst of messages is trimmed back towards the maximum capacity, once consumed
+  for( unsigned int i = 0u; i < 10000u; ++i )
+  {
+    WriteMessage( ring, 2u, writtenValue++ );
+  }
+  ring.Publish( 0u );
+  ReadMessages( ring, nextValue, inOrder );
+
+  WriteMessage( ring, 2u, writtenValue++ );
+  for( unsigned int i = 0u; i < 500u; ++i )
+  {
+    WriteMessage( ring, 2u, writtenValue++ );
+  }
+  ring.Publish( 0u );
+  ReadMessages( ring, nextValue, inOrder );
+
+  DALI_TEST_CHECK( inOrder );
+  DALI_TEST_CHECK( ring.GetCapacity() <= MAX_CAPACITY + 2u * SEGMENT_SIZE );
+}
+
+static void UtcDaliMessageRingOversizedMessage()
+{
+  TestApplication application;
+
+  MessageRing ring( SEGMENT_SIZE, MAX_CAPACITY );
+
+  const unsigned int words = 3u * SEGMENT_SIZE / sizeof(unsigned int);
+
+  WriteMessage( ring, 1u, 0u );
+  WriteMessage( ring, words, 1u );
+  WriteMessage( ring, 1u, 2u );
+  ring.Publish( 0u );
+
+  ring.AcquirePublished();
+
+  unsigned int batchData( 0u );
+  DALI_TEST_EQUALS( ring.Read( batchData )[0], 0u, TEST_LOCATION );
+
+  unsigned int* message = ring.Read( batchData );
+  DALI_TEST_EQUALS( message[0], 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( message[words - 1u], 1u, TEST_LOCATION );
+
+  DALI_TEST_EQUALS( ring.Read( batchData )[0], 2u, TEST_LOCATION );
+  DALI_TEST_CHECK( NULL == ring.Read( batchData ) );
+  DALI_TEST_CHECK( !ring.HasAcquiredMessages() );
+}
+
+namespace
+{
+
+const unsigned int THREAD_MESSAGE_COUNT = 1000000u;
+const unsigned int THREAD_BATCH_SIZE    = 1000u;
+
+void ProduceMessages( MessageRing* ring )
+{
+  for( unsigned int i = 0u; i < THREAD_MESSAGE_COUNT; ++i )
+  {
+    WriteMessage( *ring, 1u + i % 5u, i );
+
+    if( 0u == ( i + 1u ) % THREAD_BATCH_SIZE )
+    {
+      ring->Publish( i );
+    }
+  }
+}
+
+} // unnamed namespace
+
+static void UtcDaliMessageRingTwoThreads()
+{
+  TestApplication application;
+
+  MessageRing ring( SEGMENT_SIZE, MAX_CAPACITY );
+
+  boost::thread producer( ProduceMessages, &ring );
+
+  // The consumer never waits for the producer, it spins until every message is read
+  unsigned int nextValue( 0u );
+  unsigned int batches( 0u );
+  bool inOrder( true );
+  while( nextValue < THREAD_MESSAGE_COUNT )
+  {
+    batches += ReadMessages( ring, nextValue, inOrder );
+  }
+
+  producer.join();
+
+  DALI_TEST_CHECK( inOrder );
+  DALI_TEST_EQUALS( nextValue, THREAD_MESSAGE_COUNT, TEST_LOCATION );
+  DALI_TEST_EQUALS( batches, THREAD_MESSAGE_COUNT / THREAD_BATCH_SIZE, TEST_LOCATION );
+}
+
+static void UtcDaliMessageQueueStress()
+{
+  TestApplication application;
+
+  // Posts MessageValue messages through the event-to-update queue, and reports the throughput & latency
+  const unsigned int frameCount( 200u );
+  const unsigned int messagesPerFrame( 10000u );
+  const unsigned int messageCount( frameCount * messagesPerFrame );
+
+  Internal::EventToUpdate& eventToUpdate = Internal::ThreadLocalStorage::Get().GetEventToUpdate();
+
+  MessageCounter counter;
+  std::vector< unsigned int > latencies( messageCount );
+
+  unsigned long long postTime( 0u );
+  unsigned long long processTime( 0u );
+  unsigned long long expectedSum( 0u );
+
+  for( unsigned int frame = 0u; frame < frameCount; ++frame )
+  {
+    for( unsigned int i = 0u; i < messagesPerFrame; ++i )
+    {
+      const unsigned int value = frame * messagesPerFrame + i;
+      expectedSum += value;
+
+      const unsigned long long start = GetNanoseconds();
+
+      unsigned int* slot = eventToUpdate.ReserveMessageSlot( sizeof( CounterMessage ), false );
+      new (slot) CounterMessage( &counter, &MessageCounter::Add, value );
+
+      const unsigned long long latency = GetNanoseconds() - start;
+      latencies[ value ] = static_cast<unsigned int>( latency );
+      postTime += latency;
+    }
+
+    application.SendNotification();
+
+    const unsigned long long start = GetNanoseconds();
+    application.Render( 16u );
+    processTime += GetNanoseconds() - start;
+  }
+
+  DALI_TEST_EQUALS( counter.count, messageCount, TEST_LOCATION );
+  DALI_TEST_CHECK( counter.sum == expectedSum );
+
+  std::sort( latencies.begin(), latencies.end() );
+
+  const double postSeconds( static_cast<double>( postTime ) * 1e-9 );
+  const double processSeconds( static_cast<double>( processTime ) * 1e-9 );
+
+  tet_printf( "MessageQueue stress: %u messages\n", messageCount );
+  tet_printf( "  post throughput:    %.2f million messages/s\n", static_cast<double>( messageCount ) * 1e-6 / postSeconds );
+  tet_printf( "  process throughput: %.2f million messages/s (including Render)\n", static_cast<double>( messageCount ) * 1e-6 / processSeconds );
+  tet_printf( "  post latency (ns):  p50 %u, p99 %u, p99.9 %u, p99.99 %u, max %u\n",
+              latencies[ messageCount / 2u ],
+              latencies[ messageCount - messageCount / 100u ],
+              latencies[ messageCount - messageCount / 1000u ],
+              latencies[ messageCount - messageCount / 10000u ],
+              latencies.back() );
+}
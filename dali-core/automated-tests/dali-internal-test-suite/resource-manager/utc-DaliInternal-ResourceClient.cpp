@@ -81,6 +81,7 @@ TEST_FUNCTION( UtcDaliInternalRequestResourceTicket01,         POSITIVE_TC_IDX )
 TEST_FUNCTION( UtcDaliInternalRequestResourceTicket02,         POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliInternalLoadShaderRequest01,             POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliInternalLoadShaderRequest02,             POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliInternalLoadShaderRequest03,             POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliInternalAllocateBitmapImage01,           POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliInternalAddBitmapImage01,                POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliInternalAddBitmapImage02,                POSITIVE_TC_IDX );
@@ -1106,6 +1107,88 @@ static void UtcDaliInternalLoadShaderRequest02()
   DALI_TEST_CHECK( testTicketObserver.SaveSucceededCalled() );
 }
 
+static void UtcDaliInternalLoadShaderRequest03()
+{
+  TestApplication application;
+  tet_infoline("Testing the program binary cache");
+  testTicketObserver.Reset();
+
+  // Clear through all of the outstanding shader load requests from the default shader effect
+  std::vector< unsigned char > buffer;
+  application.GetPlatform().SetLoadFileResult( true, buffer );
+  application.GetGlAbstraction().SetLinkStatus(1);
+  application.SendNotification();
+  application.Render();
+  application.SendNotification();
+  application.Render();
+  application.SendNotification();
+
+  Internal::ResourceClient& resourceClient  = Internal::ThreadLocalStorage::Get().GetResourceClient();
+  Internal::SceneGraph::UpdateManager& updateManager = Internal::ThreadLocalStorage::Get().GetUpdateManager();
+  TraceCallStack& shaderTrace = application.GetGlAbstraction().GetShaderTrace();
+
+  // Nothing cached; the program is compiled and its binary saved
+  Integration::ShaderResourceType shaderRequest(123, "vertex src", "frag src");
+  Internal::ResourceTicketPtr ticket = resourceClient.LoadShader(shaderRequest, "shader.bin");
+
+  ShaderEffect::GeometryHints hints = ShaderEffect::HINT_NONE;
+  Internal::SceneGraph::Shader* sceneObject = new Internal::SceneGraph::Shader( hints );
+  AddShaderMessage( updateManager, *sceneObject );
+  SetShaderProgramMessage( updateManager, *sceneObject, GEOMETRY_TYPE_IMAGE, Internal::SHADER_DEFAULT, ticket->GetId(), 123u );
+
+  application.GetGlAbstraction().ResetShaderCallStack();
+  application.GetGlAbstraction().EnableShaderCallTrace( true );
+  application.GetGlAbstraction().SetProgramBinaryLength(20);
+  application.GetPlatform().ResetTrace();
+
+  application.SendNotification();
+  application.Render();
+  application.Render();
+  application.Render();
+  application.SendNotification(); // Send save request to event thread
+  application.Render();           // this update will process save request
+
+  DALI_TEST_CHECK( shaderTrace.FindMethod("CompileShader") );
+  DALI_TEST_CHECK( ! shaderTrace.FindMethod("ProgramBinary") );
+  DALI_TEST_CHECK( application.GetPlatform().WasCalled(TestPlatformAbstraction::SaveResourceFunc ) );
+
+  // The saved binary has a header in front of the driver's bytecode
+  Integration::ResourceRequest* saveRequest = application.GetPlatform().GetRequest();
+  DALI_TEST_CHECK( saveRequest );
+  Integration::ShaderData* savedData = static_cast< Integration::ShaderData* >( saveRequest->GetResource().Get() );
+  std::vector< unsigned char > savedBinary( savedData->buffer );
+  DALI_TEST_CHECK( savedBinary.size() > 20u );
+
+  // The saved binary is used instead of compiling the program
+  application.GetPlatform().SetLoadFileResult( true, savedBinary );
+  Integration::ShaderResourceType cachedShaderRequest(456, "vertex src", "frag src");
+  Internal::ResourceTicketPtr cachedTicket = resourceClient.LoadShader(cachedShaderRequest, "cached-shader.bin");
+  SetShaderProgramMessage( updateManager, *sceneObject, GEOMETRY_TYPE_TEXT, Internal::SHADER_DEFAULT, cachedTicket->GetId(), 456u );
+
+  application.GetGlAbstraction().ResetShaderCallStack();
+  application.GetPlatform().ResetTrace();
+  application.SendNotification();
+  application.Render();
+  application.Render();
+  application.SendNotification();
+  application.Render();
+
+  DALI_TEST_CHECK( shaderTrace.FindMethod("ProgramBinary") );
+  DALI_TEST_CHECK( ! shaderTrace.FindMethod("CompileShader") );
+  DALI_TEST_CHECK( ! application.GetPlatform().WasCalled(TestPlatformAbstraction::SaveResourceFunc ) );
+
+  // A binary of another driver is ignored
+  GLubyte driverVersion[] = "Updated driver";
+  application.GetGlAbstraction().SetGetStringResult( driverVersion );
+  application.GetGlAbstraction().ResetShaderCallStack();
+  application.ResetContext();
+
+  DALI_TEST_CHECK( shaderTrace.FindMethod("CompileShader") );
+  DALI_TEST_CHECK( ! shaderTrace.FindMethod("ProgramBinary") );
+
+  application.GetGlAbstraction().SetGetStringResult( NULL );
+}
+
 static void UtcDaliInternalAllocateBitmapImage01()
 {
   TestApplication application;
@@ -0,0 +1,340 @@
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <iostream>
+
+#include <stdlib.h>
+#include <sys/time.h>
+#include <tet_api.h>
+
+#include <dali/public-api/dali-core.h>
+
+#include <dali-test-suite-utils.h>
+
+// Internal headers are allowed here
+
+#include <dali/internal/event/text/atlas/atlas.h>
+#include <dali/internal/event/text/atlas/atlas-size.h>
+
+using namespace Dali;
+using Dali::Internal::Atlas;
+using Dali::Internal::AtlasUvInterface;
+using Dali::Internal::UvRect;
+
+static void Startup();
+static void Cleanup();
+
+extern "C" {
+  void (*tet_startup)() = Startup;
+  void (*tet_cleanup)() = Cleanup;
+}
+
+enum {
+  POSITIVE_TC_IDX = 0x01,
+  NEGATIVE_TC_IDX,
+};
+
+#define MAX_NUMBER_OF_TESTS 10000
+extern "C" {
+  struct tet_testlist tet_testlist[MAX_NUMBER_OF_TESTS];
+}
+
+TEST_FUNCTION( UtcDaliAtlasInsertRemove, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliAtlasNonPowerOfTwo, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliAtlasMultiBlock, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliAtlasMultiBlockNoSpace, NEGATIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliAtlasCloneContents, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliAtlasBenchmark, POSITIVE_TC_IDX );
+
+namespace
+{
+
+const unsigned int BLOCK_SIZE = 64u;
+
+float GetMicroseconds( const timeval& start, const timeval& end )
+{
+  return static_cast<float>( end.tv_sec - start.tv_sec ) * 1000000.0f +
+         static_cast<float>( end.tv_usec - start.tv_usec );
+}
+
+} // unnamed namespace
+
+// Called only once before first test is run.
+static void Startup()
+{
+}
+
+// Called only once after last test is run
+static void Cleanup()
+{
+}
+
+static void UtcDaliAtlasInsertRemove()
+{
+  TestApplication application;
+
+  tet_infoline("Test blocks are allocated in order, and freed blocks are re-used.");
+
+  // 4 x 4 blocks
+  Atlas atlas( 4u * BLOCK_SIZE, BLOCK_SIZE );
+
+  for( unsigned int i = 0; i < 16u; ++i )
+  {
+    DALI_TEST_CHECK( atlas.Insert( i ) );
+
+    unsigned int xPos( 0u ), yPos( 0u );
+    atlas.GetXYPosition( i, xPos, yPos );
+    DALI_TEST_EQUALS( xPos, ( i % 4u ) * BLOCK_SIZE, TEST_LOCATION );
+    DALI_TEST_EQUALS( yPos, ( i / 4u ) * BLOCK_SIZE, TEST_LOCATION );
+  }
+
+  // full
+  DALI_TEST_CHECK( !atlas.Insert( 100u ) );
+
+  // free a block in the third row, it is re-used by the next insertion
+  atlas.Remove( 9u );
+  DALI_TEST_CHECK( atlas.Insert( 100u ) );
+
+  unsigned int xPos( 0u ), yPos( 0u );
+  atlas.GetXYPosition( 100u, xPos, yPos );
+  DALI_TEST_EQUALS( xPos, 1u * BLOCK_SIZE, TEST_LOCATION );
+  DALI_TEST_EQUALS( yPos, 2u * BLOCK_SIZE, TEST_LOCATION );
+
+  const AtlasUvInterface& uvInterface( atlas );
+  UvRect uv = uvInterface.GetUvCoordinates( 100u );
+  DALI_TEST_EQUALS( uv.u0, 0.25f, Math::MACHINE_EPSILON_1, TEST_LOCATION );
+  DALI_TEST_EQUALS( uv.v0, 0.5f, Math::MACHINE_EPSILON_1, TEST_LOCATION );
+  DALI_TEST_EQUALS( uv.u2, 0.5f, Math::MACHINE_EPSILON_1, TEST_LOCATION );
+  DALI_TEST_EQUALS( uv.v2, 0.75f, Math::MACHINE_EPSILON_1, TEST_LOCATION );
+}
+
+static void UtcDaliAtlasNonPowerOfTwo()
+{
+  TestApplication application;
+
+  tet_infoline("Test an atlas with a row count which is not a multiple of the word size.");
+
+  // 12 x 12 blocks
+  const unsigned int blocksPerRow = 12u;
+  Atlas atlas( blocksPerRow * BLOCK_SIZE, BLOCK_SIZE );
+
+  for( unsigned int i = 0; i < blocksPerRow * blocksPerRow; ++i )
+  {
+    DALI_TEST_CHECK( atlas.Insert( i ) );
+  }
+  DALI_TEST_CHECK( !atlas.Insert( 1000u ) );
+
+  // the last block
+  unsigned int xPos( 0u ), yPos( 0u );
+  atlas.GetXYPosition( blocksPerRow * blocksPerRow - 1u, xPos, yPos );
+  DALI_TEST_EQUALS( xPos, ( blocksPerRow - 1u ) * BLOCK_SIZE, TEST_LOCATION );
+  DALI_TEST_EQUALS( yPos, ( blocksPerRow - 1u ) * BLOCK_SIZE, TEST_LOCATION );
+
+  atlas.Remove( blocksPerRow * blocksPerRow - 1u );
+  DALI_TEST_CHECK( atlas.Insert( 1000u ) );
+  atlas.GetXYPosition( 1000u, xPos, yPos );
+  DALI_TEST_EQUALS( xPos, ( blocksPerRow - 1u ) * BLOCK_SIZE, TEST_LOCATION );
+  DALI_TEST_EQUALS( yPos, ( blocksPerRow - 1u ) * BLOCK_SIZE, TEST_LOCATION );
+}
+
+static void UtcDaliAtlasMultiBlock()
+{
+  TestApplication application;
+
+  tet_infoline("Test inserting rectangles of blocks.");
+
+  // 8 x 8 blocks
+  Atlas atlas( 8u * BLOCK_SIZE, BLOCK_SIZE );
+
+  // a single block, then a 2 x 2 rectangle beside it
+  DALI_TEST_CHECK( atlas.Insert( 1u ) );
+  DALI_TEST_CHECK( atlas.Insert( 2u, 2u, 2u ) );
+
+  unsigned int xPos( 0u ), yPos( 0u );
+  atlas.GetXYPosition( 2u, xPos, yPos );
+  DALI_TEST_EQUALS( xPos, 1u * BLOCK_SIZE, TEST_LOCATION );
+  DALI_TEST_EQUALS( yPos, 0u, TEST_LOCATION );
+
+  const AtlasUvInterface& uvInterface( atlas );
+  UvRect uv = uvInterface.GetUvCoordinates( 2u );
+  DALI_TEST_EQUALS( uv.u0, 0.125f, Math::MACHINE_EPSILON_1, TEST_LOCATION );
+  DALI_TEST_EQUALS( uv.v0, 0.0f, Math::MACHINE_EPSILON_1, TEST_LOCATION );
+  DALI_TEST_EQUALS( uv.u2, 0.375f, Math::MACHINE_EPSILON_1, TEST_LOCATION );
+  DALI_TEST_EQUALS( uv.v2, 0.25f, Math::MACHINE_EPSILON_1, TEST_LOCATION );
+
+  // a 6 x 1 rectangle does not fit in the first row, only 5 blocks remain
+  DALI_TEST_CHECK( atlas.Insert( 3u, 6u, 1u ) );
+  atlas.GetXYPosition( 3u, xPos, yPos );
+  DALI_TEST_EQUALS( xPos, 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( yPos, 2u * BLOCK_SIZE, TEST_LOCATION );
+
+  // single blocks fill the gaps
+  DALI_TEST_CHECK( atlas.Insert( 4u ) );
+  atlas.GetXYPosition( 4u, xPos, yPos );
+  DALI_TEST_EQUALS( xPos, 3u * BLOCK_SIZE, TEST_LOCATION );
+  DALI_TEST_EQUALS( yPos, 0u, TEST_LOCATION );
+
+  // when removed, the rectangle is free again
+  atlas.Remove( 2u );
+  DALI_TEST_CHECK( atlas.Insert( 5u, 2u, 2u ) );
+  atlas.GetXYPosition( 5u, xPos, yPos );
+  DALI_TEST_EQUALS( xPos, 1u * BLOCK_SIZE, TEST_LOCATION );
+  DALI_TEST_EQUALS( yPos, 0u, TEST_LOCATION );
+
+  // the whole atlas
+  Atlas emptyAtlas( 8u * BLOCK_SIZE, BLOCK_SIZE );
+  DALI_TEST_CHECK( emptyAtlas.Insert( 1u, 8u, 8u ) );
+  DALI_TEST_CHECK( !emptyAtlas.Insert( 2u ) );
+}
+
+static void UtcDaliAtlasMultiBlockNoSpace()
+{
+  TestApplication application;
+
+  tet_infoline("Test inserting rectangles which do not fit.");
+
+  // 4 x 4 blocks
+  Atlas atlas( 4u * BLOCK_SIZE, BLOCK_SIZE );
+
+  DALI_TEST_CHECK( !atlas.Insert( 1u, 5u, 1u ) );
+  DALI_TEST_CHECK( !atlas.Insert( 1u, 1u, 5u ) );
+
+  // a checker board pattern leaves no 2 x 1 space
+  for( unsigned int i = 0; i < 16u; ++i )
+  {
+    DALI_TEST_CHECK( atlas.Insert( i ) );
+  }
+  for( unsigned int i = 0; i < 16u; ++i )
+  {
+    if( ( ( i % 4u ) + ( i / 4u ) ) % 2u )
+    {
+      atlas.Remove( i );
+    }
+  }
+  DALI_TEST_CHECK( !atlas.Insert( 100u, 2u, 1u ) );
+  DALI_TEST_CHECK( !atlas.Insert( 100u, 1u, 2u ) );
+  DALI_TEST_CHECK( atlas.Insert( 100u ) );
+}
+
+static void UtcDaliAtlasCloneContents()
+{
+  TestApplication application;
+
+  tet_infoline("Test items keep their positions, when cloned into a larger atlas.");
+
+  Atlas atlas( 4u * BLOCK_SIZE, BLOCK_SIZE );
+  for( unsigned int i = 0; i < 16u; ++i )
+  {
+    atlas.Insert( i );
+  }
+  atlas.Remove( 5u );
+
+  Atlas largerAtlas( 8u * BLOCK_SIZE, BLOCK_SIZE );
+  largerAtlas.CloneContents( &atlas );
+
+  unsigned int xPos( 0u ), yPos( 0u );
+  largerAtlas.GetXYPosition( 15u, xPos, yPos );
+  DALI_TEST_EQUALS( xPos, 3u * BLOCK_SIZE, TEST_LOCATION );
+  DALI_TEST_EQUALS( yPos, 3u * BLOCK_SIZE, TEST_LOCATION );
+
+  // the first free block is to the right of the original contents
+  DALI_TEST_CHECK( largerAtlas.Insert( 100u ) );
+  largerAtlas.GetXYPosition( 100u, xPos, yPos );
+  DALI_TEST_EQUALS( xPos, 4u * BLOCK_SIZE, TEST_LOCATION );
+  DALI_TEST_EQUALS( yPos, 0u, TEST_LOCATION );
+
+  // once the first row is full, the block removed from the original is used
+  for( unsigned int i = 0; i < 3u; ++i )
+  {
+    DALI_TEST_CHECK( largerAtlas.Insert( 200u + i ) );
+  }
+  DALI_TEST_CHECK( largerAtlas.Insert( 300u ) );
+  largerAtlas.GetXYPosition( 300u, xPos, yPos );
+  DALI_TEST_EQUALS( xPos, 1u * BLOCK_SIZE, TEST_LOCATION );
+  DALI_TEST_EQUALS( yPos, 1u * BLOCK_SIZE, TEST_LOCATION );
+}
+
+static void UtcDaliAtlasBenchmark()
+{
+  TestApplication application;
+
+  tet_infoline("Fill and churn an atlas of each glyph atlas size.");
+
+  const unsigned int CHURN_ROUNDS = 20u;
+
+  unsigned int size = Internal::GlyphAtlasSize::GetInitialSize( 1u );
+  while( true )
+  {
+    const unsigned int blockCount = Internal::GlyphAtlasSize::GetAtlasCharacterCount( size );
+
+    Atlas atlas( size, Internal::GlyphAtlasSize::GetBlockSize() );
+
+    timeval start, end;
+    gettimeofday( &start, NULL );
+
+    bool ok( true );
+    for( unsigned int i = 0; i < blockCount; ++i )
+    {
+      ok = atlas.Insert( i ) && ok;
+    }
+
+    gettimeofday( &end, NULL );
+    const float fillTime = GetMicroseconds( start, end );
+
+    DALI_TEST_CHECK( ok );
+    DALI_TEST_CHECK( !atlas.Insert( blockCount ) );
+
+    // remove half of the blocks at pseudo-random, then fill the atlas again
+    unsigned int nextId = blockCount;
+    unsigned int random = 12345u;
+    std::vector< unsigned int > ids;
+    for( unsigned int i = 0; i < blockCount; ++i )
+    {
+      ids.push_back( i );
+    }
+
+    gettimeofday( &start, NULL );
+
+    for( unsigned int round = 0; round < CHURN_ROUNDS; ++round )
+    {
+      for( unsigned int i = 0; i < blockCount / 2u; ++i )
+      {
+        random = random * 1103515245u + 12345u;
+        const unsigned int index = ( random >> 8u ) % blockCount;
+
+        atlas.Remove( ids[index] );
+        ok = atlas.Insert( nextId ) && ok;
+        ids[index] = nextId++;
+      }
+    }
+
+    gettimeofday( &end, NULL );
+    const float churnTime = GetMicroseconds( start, end );
+
+    DALI_TEST_CHECK( ok );
+
+    tet_printf( "Atlas %4u x %4u (%4u blocks): fill %.3f us/block, churn %.3f us/block\n",
+                size, size, blockCount,
+                fillTime / blockCount,
+                churnTime / ( CHURN_ROUNDS * ( blockCount / 2u ) ) );
+
+    if( size == Internal::GlyphAtlasSize::GetMaxSize() )
+    {
+      break;
+    }
+    size = Internal::GlyphAtlasSize::GetNextSize( size );
+  }
+}
@@ -0,0 +1,463 @@
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <algorithm>
+#include <iostream>
+#include <set>
+#include <vector>
+
+#include <stdlib.h>
+#include <tet_api.h>
+
+#include <dali/public-api/dali-core.h>
+
+#include <dali-test-suite-utils.h>
+
+// Internal headers are allowed here
+
+#include <dali/internal/common/text-vertex-buffer.h>
+#include <dali/internal/event/common/thread-local-storage.h>
+#include <dali/internal/event/resources/resource-client.h>
+#include <dali/internal/event/text/font-metrics-interface.h>
+#include <dali/internal/event/text/glyph-metric.h>
+#include <dali/internal/event/text/text-format.h>
+#include <dali/internal/event/text/atlas/atlas-size.h>
+#include <dali/internal/event/text/atlas/glyph-atlas-manager.h>
+#include <dali/internal/event/text/resource/font-lookup-interface.h>
+#include <dali/internal/event/text/resource/glyph-texture-observer.h>
+
+using namespace Dali;
+using Dali::Internal::GlyphAtlasManager;
+namespace GlyphAtlasSize = Dali::Internal::GlyphAtlasSize;
+using Dali::Internal::TextFormat;
+using Dali::Internal::TextVertexBuffer;
+
+static void Startup();
+static void Cleanup();
+
+extern "C" {
+  void (*tet_startup)() = Startup;
+  void (*tet_cleanup)() = Cleanup;
+}
+
+enum {
+  POSITIVE_TC_IDX = 0x01,
+  NEGATIVE_TC_IDX,
+};
+
+#define MAX_NUMBER_OF_TESTS 10000
+extern "C" {
+  struct tet_testlist tet_testlist[MAX_NUMBER_OF_TESTS];
+}
+
+TEST_FUNCTION( UtcDaliGlyphAtlasManagerAddPage,              POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliGlyphAtlasManagerReleaseUnusedPages,   POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliGlyphAtlasManagerFillPastCapacity,     POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliGlyphAtlasManagerReplaceText,          POSITIVE_TC_IDX );
+
+namespace
+{
+
+const Internal::FontId FONT_ID = 1u;
+const uint32_t FIRST_CJK_CHARACTER = 0x4e00;
+
+/**
+ * Every font has the same glyphs, which fill an atlas block.
+ */
+class TestFontLookup : public Internal::FontLookupInterface
+{
+public:
+
+  virtual void GetFontInformation( Internal::FontId fontId,
+                                   std::string& family,
+                                   std::string& style,
+                                   float& maxGlyphWidth,
+                                   float& maxGlyphHeight ) const
+  {
+    family = "TestFont";
+    style = "Regular";
+    maxGlyphWidth = 64.0f;
+    maxGlyphHeight = 64.0f;
+  }
+};
+
+class TestFontMetrics : public Internal::FontMetricsInterface
+{
+public:
+
+  TestFontMetrics()
+  : mGlyph( FIRST_CJK_CHARACTER, 48.0f, 48.0f, 40.0f, 2.0f, 52.0f ),
+    mFamily( "TestFont" ),
+    mStyle( "Regular" )
+  {
+  }
+
+  virtual void LoadMetricsSynchronously( const TextArray& text ) {}
+  virtual const Internal::GlyphMetric* GetGlyph( uint32_t charIndex ) const { return &mGlyph; }
+  virtual Internal::FontId GetFontId() const { return FONT_ID; }
+  virtual const std::string& GetFontFamilyName() const { return mFamily; }
+  virtual const std::string& GetFontStyleName() const { return mStyle; }
+  virtual void GetMaximumGylphSize( float& width, float& height ) const { width = 64.0f; height = 64.0f; }
+  virtual float GetUnitsToPixels( const float pointSize ) const { return 1.0f; }
+  virtual float GetLineHeight() const { return 64.0f; }
+  virtual float GetAscender() const { return 48.0f; }
+  virtual float GetUnderlinePosition() const { return 4.0f; }
+  virtual float GetUnderlineThickness() const { return 2.0f; }
+  virtual float GetMaxWidth() const { return 64.0f; }
+  virtual float GetMaxHeight() const { return 64.0f; }
+  virtual float GetPadAdjustX() const { return 0.0f; }
+  virtual float GetPadAdjustY() const { return 0.0f; }
+
+private:
+
+  Internal::GlyphMetric mGlyph;
+  std::string mFamily;
+  std::string mStyle;
+};
+
+/**
+ * Create a string of consecutive characters.
+ */
+TextArray CreateText( uint32_t first, unsigned int count )
+{
+  TextArray text;
+  for( unsigned int i = 0; i < count; ++i )
+  {
+    text.push_back( first + i );
+  }
+  return text;
+}
+
+/**
+ * Query whether the texture of an atlas exists; the glyph resource manager holds a ticket for every atlas texture.
+ */
+bool TextureExists( unsigned int textureId )
+{
+  Internal::ResourceClient& resourceClient = Internal::ThreadLocalStorage::Get().GetResourceClient();
+  return resourceClient.RequestResourceTicket( textureId );
+}
+
+/**
+ * The end of an event cycle; the atlas manager sends its glyph requests and releases unused pages.
+ * The test platform abstraction loads the glyphs synchronously, so the textures of resized atlases are deleted here.
+ */
+void EndEventCycle( TestApplication& application, GlyphAtlasManager& atlasManager )
+{
+  atlasManager.SendTextRequests();
+  application.SendNotification();
+  application.Render();
+}
+
+/**
+ * The text referenced by a test, and the textures it is displayed with.
+ * Like a text actor, this observes the atlas textures, as an atlas is given a new texture when it is resized.
+ * The text which is still referenced is released on destruction.
+ */
+class ReferencedText : public Internal::GlyphTextureObserver
+{
+public:
+
+  ReferencedText( GlyphAtlasManager& atlasManager, TestFontMetrics& metrics )
+  : mAtlasManager( atlasManager ),
+    mMetrics( metrics )
+  {
+    mAtlasManager.AddTextureObserver( *this );
+  }
+
+  virtual ~ReferencedText()
+  {
+    while( !mTexts.empty() )
+    {
+      Release( 0u );
+    }
+    mAtlasManager.RemoveTextureObserver( *this );
+  }
+
+  /**
+   * Reference some text.
+   * @return the id of the texture the text is displayed with
+   */
+  unsigned int Add( const TextArray& text )
+  {
+    TextVertexBuffer* buffer = mAtlasManager.TextRequired( text, mFormat, mMetrics );
+    DALI_TEST_CHECK( buffer );
+
+    const unsigned int textureId = buffer->mTextureId;
+    delete buffer;
+
+    mTexts.push_back( text );
+    mTextTextureIds.push_back( textureId );
+    mTextureIds.insert( textureId );
+
+    return textureId;
+  }
+
+  void Release( unsigned int index )
+  {
+    mAtlasManager.TextNotRequired( mTexts[index], mFormat, FONT_ID, mTextTextureIds[index] );
+
+    mTexts.erase( mTexts.begin() + index );
+    mTextTextureIds.erase( mTextTextureIds.begin() + index );
+  }
+
+  unsigned int Count() const
+  {
+    return mTexts.size();
+  }
+
+  unsigned int GetTextureId( unsigned int index ) const
+  {
+    return mTextTextureIds[index];
+  }
+
+  /**
+   * Count the textures, of those the text has been displayed with, which still exist.
+   */
+  unsigned int CountTextures() const
+  {
+    unsigned int count( 0u );
+    for( std::set<unsigned int>::const_iterator iter = mTextureIds.begin(), endIter = mTextureIds.end(); iter != endIter; ++iter )
+    {
+      if( TextureExists( *iter ) )
+      {
+        ++count;
+      }
+    }
+    return count;
+  }
+
+  const std::set<unsigned int>& GetTextureIds() const
+  {
+    return mTextureIds;
+  }
+
+  virtual void TextureResized( const Internal::TextureIdList& oldTextureIds, unsigned int newTextureId )
+  {
+    for( std::size_t i = 0; i < oldTextureIds.size(); ++i )
+    {
+      std::replace( mTextTextureIds.begin(), mTextTextureIds.end(), oldTextureIds[i], newTextureId );
+    }
+    mTextureIds.insert( newTextureId );
+  }
+
+  virtual void TextureSplit( Internal::FontId fontId, const Internal::TextureIdList& oldTextureIds, unsigned int newTextureId )
+  {
+  }
+
+private:
+
+  GlyphAtlasManager& mAtlasManager;
+  TestFontMetrics& mMetrics;
+  TextFormat mFormat;
+  std::vector<TextArray> mTexts;
+  std::vector<unsigned int> mTextTextureIds;
+  std::set<unsigned int> mTextureIds;  ///< every texture the text has been displayed with
+};
+
+} // unnamed namespace
+
+// Called only once before first test is run.
+static void Startup()
+{
+}
+
+// Called only once after last test is run
+static void Cleanup()
+{
+}
+
+static void UtcDaliGlyphAtlasManagerAddPage()
+{
+  TestApplication application;
+
+  tet_infoline("Test a new atlas page is added when the atlas has reached the page size and is full.");
+
+  TestFontLookup fontLookup;
+  TestFontMetrics metrics;
+  GlyphAtlasManager atlasManager( fontLookup );
+  ReferencedText referencedText( atlasManager, metrics );
+
+  // Fill a page with strings which all stay referenced; the atlas grows up to the page size
+  const unsigned int pageCharacters = GlyphAtlasSize::GetAtlasCharacterCount( GlyphAtlasSize::GetMaxPageSize() );
+  const unsigned int stringLength = 64u;
+
+  for( unsigned int i = 0; i < pageCharacters / stringLength; ++i )
+  {
+    referencedText.Add( CreateText( FIRST_CJK_CHARACTER + i * stringLength, stringLength ) );
+    EndEventCycle( application, atlasManager );
+  }
+
+  const unsigned int pageTextureId = referencedText.GetTextureId( 0u );
+  for( unsigned int i = 0; i < referencedText.Count(); ++i )
+  {
+    DALI_TEST_EQUALS( referencedText.GetTextureId( i ), pageTextureId, TEST_LOCATION );
+  }
+  DALI_TEST_EQUALS( referencedText.CountTextures(), 1u, TEST_LOCATION );
+
+  // The page is full, so the next string is given a new page
+  const TextArray text = CreateText( FIRST_CJK_CHARACTER + pageCharacters, stringLength );
+  const unsigned int newPageTextureId = referencedText.Add( text );
+  EndEventCycle( application, atlasManager );
+
+  DALI_TEST_CHECK( newPageTextureId != pageTextureId );
+  DALI_TEST_CHECK( TextureExists( newPageTextureId ) );
+  DALI_TEST_CHECK( TextureExists( pageTextureId ) );
+  DALI_TEST_EQUALS( referencedText.CountTextures(), 2u, TEST_LOCATION );
+
+  // Text already in a page is found there
+  DALI_TEST_EQUALS( referencedText.Add( CreateText( FIRST_CJK_CHARACTER, stringLength ) ), pageTextureId, TEST_LOCATION );
+  DALI_TEST_EQUALS( referencedText.Add( text ), newPageTextureId, TEST_LOCATION );
+}
+
+static void UtcDaliGlyphAtlasManagerReleaseUnusedPages()
+{
+  TestApplication application;
+
+  tet_infoline("Test the textures of atlas pages which hold no referenced text are released, keeping one spare page.");
+
+  TestFontLookup fontLookup;
+  TestFontMetrics metrics;
+  GlyphAtlasManager atlasManager( fontLookup );
+  ReferencedText referencedText( atlasManager, metrics );
+
+  // Strings which fill a page each
+  const unsigned int pageCharacters = GlyphAtlasSize::GetAtlasCharacterCount( GlyphAtlasSize::GetMaxPageSize() );
+  const unsigned int numberOfPages = 3u;
+
+  for( unsigned int i = 0; i < numberOfPages; ++i )
+  {
+    referencedText.Add( CreateText( FIRST_CJK_CHARACTER + i * pageCharacters, pageCharacters ) );
+    EndEventCycle( application, atlasManager );
+  }
+  DALI_TEST_EQUALS( referencedText.GetTextureIds().size(), static_cast<size_t>( numberOfPages ), TEST_LOCATION );
+  DALI_TEST_EQUALS( referencedText.CountTextures(), numberOfPages, TEST_LOCATION );
+
+  // While one string is referenced, its page is kept
+  const unsigned int firstPageTextureId = referencedText.GetTextureId( 0u );
+  while( referencedText.Count() > 1u )
+  {
+    referencedText.Release( 1u );
+  }
+  EndEventCycle( application, atlasManager );
+
+  // One unused page is kept as a spare
+  DALI_TEST_CHECK( TextureExists( firstPageTextureId ) );
+  DALI_TEST_EQUALS( referencedText.CountTextures(), 2u, TEST_LOCATION );
+
+  // When no text is referenced, only the spare page is left
+  referencedText.Release( 0u );
+  EndEventCycle( application, atlasManager );
+  DALI_TEST_EQUALS( referencedText.CountTextures(), 1u, TEST_LOCATION );
+
+  // New text uses the spare page, instead of creating a texture
+  const std::set<unsigned int> textureIds( referencedText.GetTextureIds() );
+  const unsigned int textureId = referencedText.Add( CreateText( FIRST_CJK_CHARACTER + numberOfPages * pageCharacters, 16u ) );
+  DALI_TEST_CHECK( textureIds.find( textureId ) != textureIds.end() );
+  DALI_TEST_CHECK( TextureExists( textureId ) );
+}
+
+static void UtcDaliGlyphAtlasManagerFillPastCapacity()
+{
+  TestApplication application;
+
+  tet_infoline("Test referencing more characters than the largest atlas holds adds pages, and does not assert.");
+
+  TestFontLookup fontLookup;
+  TestFontMetrics metrics;
+  GlyphAtlasManager atlasManager( fontLookup );
+  ReferencedText referencedText( atlasManager, metrics );
+
+  const unsigned int maxAtlasCharacters = GlyphAtlasSize::GetAtlasCharacterCount( GlyphAtlasSize::GetMaxSize() );
+  const unsigned int pageCharacters = GlyphAtlasSize::GetAtlasCharacterCount( GlyphAtlasSize::GetMaxPageSize() );
+  const unsigned int stringLength = 100u;
+  const unsigned int numberOfStrings = ( maxAtlasCharacters + pageCharacters ) / stringLength;
+
+  // Keep every string referenced, until there are more characters than the largest atlas holds
+  unsigned int characterCount( 0u );
+  try
+  {
+    for( unsigned int i = 0; i < numberOfStrings; ++i )
+    {
+      referencedText.Add( CreateText( FIRST_CJK_CHARACTER + characterCount, stringLength ) );
+      characterCount += stringLength;
+      EndEventCycle( application, atlasManager );
+    }
+
+    // A single string which needs an atlas larger than a page
+    referencedText.Add( CreateText( FIRST_CJK_CHARACTER + characterCount, maxAtlasCharacters ) );
+    characterCount += maxAtlasCharacters;
+    EndEventCycle( application, atlasManager );
+  }
+  catch( Dali::DaliException& e )
+  {
+    tet_printf( "Assertion %s failed at %s\n", e.mCondition.c_str(), e.mLocation.c_str() );
+    tet_result( TET_FAIL );
+  }
+  DALI_TEST_EQUALS( referencedText.Count(), numberOfStrings + 1u, TEST_LOCATION );
+
+  // Each page holds as many whole strings as fit in it, and the long string has an atlas of its own
+  const unsigned int stringsPerPage = pageCharacters / stringLength;
+  const unsigned int expectedTextureCount = ( numberOfStrings + stringsPerPage - 1u ) / stringsPerPage + 1u;
+
+  const unsigned int textureCount = referencedText.CountTextures();
+  tet_printf( "%u characters referenced in %u atlas textures\n", characterCount, textureCount );
+  DALI_TEST_EQUALS( textureCount, expectedTextureCount, TEST_LOCATION );
+}
+
+static void UtcDaliGlyphAtlasManagerReplaceText()
+{
+  TestApplication application;
+
+  tet_infoline("Test the texture memory stays bounded when text is continually replaced with new characters.");
+
+  TestFontLookup fontLookup;
+  TestFontMetrics metrics;
+  GlyphAtlasManager atlasManager( fontLookup );
+  ReferencedText referencedText( atlasManager, metrics );
+
+  const unsigned int pageCharacters = GlyphAtlasSize::GetAtlasCharacterCount( GlyphAtlasSize::GetMaxPageSize() );
+  const unsigned int stringLength = 200u;
+  const unsigned int visibleStrings = 4u;
+  const unsigned int numberOfStrings = 40000u / stringLength;
+
+  // The referenced characters fit in one page, and the replaced characters are evicted from it
+  DALI_TEST_CHECK( visibleStrings * stringLength <= pageCharacters );
+
+  // Scroll through more characters than the dead time counter can hold, keeping a few strings referenced
+  unsigned int maximumTextureCount( 0u );
+  try
+  {
+    for( unsigned int i = 0; i < numberOfStrings; ++i )
+    {
+      if( referencedText.Count() == visibleStrings )
+      {
+        referencedText.Release( 0u );
+      }
+      referencedText.Add( CreateText( FIRST_CJK_CHARACTER + i * stringLength, stringLength ) );
+      EndEventCycle( application, atlasManager );
+
+      maximumTextureCount = std::max( maximumTextureCount, referencedText.CountTextures() );
+    }
+  }
+  catch( Dali::DaliException& e )
+  {
+    tet_printf( "Assertion %s failed at %s\n", e.mCondition.c_str(), e.mLocation.c_str() );
+    tet_result( TET_FAIL );
+  }
+
+  tet_printf( "%u characters used, in at most %u atlas textures at once\n", numberOfStrings * stringLength, maximumTextureCount );
+  DALI_TEST_EQUALS( maximumTextureCount, 1u, TEST_LOCATION );
+}
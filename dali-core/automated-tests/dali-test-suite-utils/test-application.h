@@ -76,14 +76,16 @@ public:
     }
   }
 
-  void Initialize()
+  void Initialize( unsigned int updateWorkerCount = 0u, bool tripleBuffered = false )
   {
     mCore = Dali::Integration::Core::New(
         mRenderController,
         mPlatformAbstraction,
         mGlAbstraction,
         mGlSyncAbstraction,
-        mGestureManager );
+        mGestureManager,
+        updateWorkerCount,
+        tripleBuffered );
 
     mCore->ContextCreated();
     mCore->SurfaceResized( mSurfaceWidth, mSurfaceHeight );
@@ -188,6 +190,11 @@ public:
     return mStatus.KeepUpdating();
   }
 
+  Integration::RenderStatus& GetRenderStatus()
+  {
+    return mRenderStatus;
+  }
+
   bool UpdateOnly( unsigned int intervalMilliseconds = DEFAULT_RENDER_INTERVAL )
   {
     // Update Time values
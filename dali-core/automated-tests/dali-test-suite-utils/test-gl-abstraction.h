@@ -57,10 +57,12 @@ public:
     mCurrentProgram = 0;
     mCompileStatus = GL_TRUE;
     mLinkStatus = GL_TRUE;
+    mCompletionStatus = GL_TRUE;
 
     mGetAttribLocationResult = 0;
     mGetErrorResult = 0;
     mGetStringResult = NULL;
+    mGetExtensionsResult = reinterpret_cast< const GLubyte* >( "GL_KHR_parallel_shader_compile" ); // Programs are compiled without waiting, see SetCompletionStatus()
     mIsBufferResult = 0;
     mIsEnabledResult = 0;
     mIsFramebufferResult = 0;
@@ -594,6 +596,9 @@ public:
       case GL_LINK_STATUS:
         *params = mLinkStatus;
         break;
+      case GL_COMPLETION_STATUS_KHR:
+        *params = mCompletionStatus;
+        break;
       case GL_PROGRAM_BINARY_LENGTH_OES:
         *params = mProgramBinaryLength;
         break;
@@ -628,6 +633,10 @@ public:
 
   const GLubyte* GetString(GLenum name)
   {
+    if( GL_EXTENSIONS == name )
+    {
+      return mGetExtensionsResult;
+    }
     return mGetStringResult;
   }
 
@@ -757,6 +766,12 @@ public:
 
   void Scissor(GLint x, GLint y, GLsizei width, GLsizei height)
   {
+    mLastScissor.Set( x, y, width, height );
+  }
+
+  const Rect<int>& GetLastScissor() const
+  {
+    return mLastScissor;
   }
 
   void ShaderBinary(GLsizei n, const GLuint* shaders, GLenum binaryformat, const void* binary, GLsizei length)
@@ -1467,10 +1482,18 @@ public:
 
   void GetProgramBinary(GLuint program, GLsizei bufSize, GLsizei* length, GLenum* binaryFormat, GLvoid* binary)
   {
+    if( length )
+    {
+      *length = bufSize < mProgramBinaryLength ? bufSize : mProgramBinaryLength;
+    }
+    *binaryFormat = mBinaryFormats;
   }
 
   void ProgramBinary(GLuint program, GLenum binaryFormat, const GLvoid* binary, GLsizei length)
   {
+    std::stringstream out;
+    out << program << ", " << binaryFormat << ", " << length;
+    mShaderTrace.PushCall("ProgramBinary", out.str());
   }
 
   void ProgramParameteri(GLuint program, GLenum pname, GLint value)
@@ -1500,9 +1523,11 @@ public:
 public: // TEST FUNCTIONS
   void SetCompileStatus( GLuint value ) { mCompileStatus = value; }
   void SetLinkStatus( GLuint value ) { mLinkStatus = value; }
+  void SetCompletionStatus( GLuint value ) { mCompletionStatus = value; }
   void SetGetAttribLocationResult(  int result) { mGetAttribLocationResult = result; }
   void SetGetErrorResult(  GLenum result) { mGetErrorResult = result; }
   void SetGetStringResult(  GLubyte* result) { mGetStringResult = result; }
+  void SetGetExtensionsResult(  const GLubyte* result) { mGetExtensionsResult = result; }
   void SetIsBufferResult(  GLboolean result) { mIsBufferResult = result; }
   void SetIsEnabledResult(  GLboolean result) { mIsEnabledResult = result; }
   void SetIsFramebufferResult(  GLboolean result) { mIsFramebufferResult = result; }
@@ -1635,9 +1660,11 @@ private:
   GLuint     mCurrentProgram;
   GLuint     mCompileStatus;
   GLuint     mLinkStatus;
+  GLuint     mCompletionStatus;
   GLint      mGetAttribLocationResult;
   GLenum     mGetErrorResult;
   GLubyte*   mGetStringResult;
+  const GLubyte* mGetExtensionsResult;
   GLboolean  mIsBufferResult;
   GLboolean  mIsEnabledResult;
   GLboolean  mIsFramebufferResult;
@@ -1656,6 +1683,7 @@ private:
   ShaderSourceMap mShaderSources;
   GLuint     mLastShaderCompiled;
 
+  Rect<int> mLastScissor;
   Vector4 mLastBlendColor;
   GLenum  mLastBlendEquationRgb;
   GLenum  mLastBlendEquationAlpha;
@@ -45,6 +45,7 @@ public:
     Integration::ResourceId      loadedId;
     Integration::ResourceTypeId  loadedType;
     Integration::ResourcePointer loadedResource;
+    Integration::LoadStatus      loadedStatus;
 
     bool                         loadFailed;
     Integration::ResourceId      loadFailedId;
@@ -175,7 +176,7 @@ public:
 
     if(mResources.loaded)
     {
-      cache.LoadResponse( mResources.loadedId, mResources.loadedType, mResources.loadedResource, Integration::RESOURCE_COMPLETELY_LOADED );
+      cache.LoadResponse( mResources.loadedId, mResources.loadedType, mResources.loadedResource, mResources.loadedStatus );
     }
     if(mResources.loadFailed)
     {
@@ -621,6 +622,15 @@ public: // TEST FUNCTIONS
     mResources.loadedId = loadedId;
     mResources.loadedType = loadedType;
     mResources.loadedResource = loadedResource;
+    mResources.loadedStatus = Integration::RESOURCE_COMPLETELY_LOADED;
+  }
+
+  void SetResourcePartiallyLoaded(Integration::ResourceId  loadedId,
+                                  Integration::ResourceTypeId  loadedType,
+                                  Integration::ResourcePointer loadedResource)
+  {
+    SetResourceLoaded( loadedId, loadedType, loadedResource );
+    mResources.loadedStatus = Integration::RESOURCE_PARTIALLY_LOADED;
   }
 
   void SetResourceLoadFailed(Integration::ResourceId  id,
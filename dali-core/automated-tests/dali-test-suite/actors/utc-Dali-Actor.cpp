@@ -61,6 +61,7 @@ TEST_FUNCTION( UtcDaliActorGetLayer,                       POSITIVE_TC_IDX ); //
 TEST_FUNCTION( UtcDaliActorAdd,                            POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliActorRemove01,                       POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliActorRemove02,                       NEGATIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliActorRemove03,                       POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliActorGetChildCount,                  POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliActorGetChildren01,                  POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliActorGetChildren02,                  POSITIVE_TC_IDX );
@@ -87,6 +88,9 @@ TEST_FUNCTION( UtcDaliActorSetZ,                           POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliActorMoveBy,                         POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliActorGetCurrentPosition,             POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliActorGetCurrentWorldPosition,        POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliActorGetCurrentWorldPositionReparent, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliActorGetCurrentWorldPositionWorkerThreads, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliActorGetCurrentWorldPositionTripleBuffered, POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliActorInheritPosition,                POSITIVE_TC_IDX );
 
 TEST_FUNCTION( UtcDaliActorSetRotation01,                  POSITIVE_TC_IDX );
@@ -482,6 +486,72 @@ static void UtcDaliActorRemove02()
   DALI_TEST_CHECK(parent.GetChildCount() == 1);
 }
 
+static void UtcDaliActorRemove03()
+{
+  tet_infoline("Testing that animated actors are reset correctly, while many actors are added & removed");
+  TestApplication application;
+
+  Actor parent = Actor::New();
+  Stage::GetCurrent().Add( parent );
+
+  std::vector< Actor > actors;
+  for( unsigned int i = 0u; i < 50u; ++i )
+  {
+    Actor actor = Actor::New();
+    parent.Add( actor );
+    actors.push_back( actor );
+  }
+
+  application.SendNotification();
+  application.Render(0);
+
+  // Remove every other actor, then add them back in reverse order
+  for( unsigned int i = 0u; i < actors.size(); i += 2u )
+  {
+    parent.Remove( actors[i] );
+  }
+
+  application.SendNotification();
+  application.Render(0);
+
+  for( unsigned int i = actors.size(); i > 0u; i -= 2u )
+  {
+    parent.Add( actors[i - 2u] );
+  }
+
+  // Animate every actor
+  Animation animation = Animation::New( 1.0f );
+  for( unsigned int i = 0u; i < actors.size(); ++i )
+  {
+    animation.MoveTo( actors[i], Vector3( float(i), 0.0f, 0.0f ), AlphaFunctions::Linear );
+  }
+  animation.Play();
+
+  application.SendNotification();
+  application.Render(1001u/*just beyond the animation duration*/);
+
+  for( unsigned int i = 0u; i < actors.size(); ++i )
+  {
+    DALI_TEST_EQUALS( actors[i].GetCurrentPosition(), Vector3( float(i), 0.0f, 0.0f ), TEST_LOCATION );
+  }
+
+  // Reset the positions, then remove every actor except the last
+  for( unsigned int i = 0u; i < actors.size(); ++i )
+  {
+    actors[i].SetPosition( Vector3::ZERO );
+  }
+  for( unsigned int i = 0u; i + 1u < actors.size(); ++i )
+  {
+    parent.Remove( actors[i] );
+  }
+
+  application.SendNotification();
+  application.Render(0);
+
+  DALI_TEST_EQUALS( parent.GetChildCount(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( actors.back().GetCurrentPosition(), Vector3::ZERO, TEST_LOCATION );
+}
+
 static void UtcDaliActorGetChildCount()
 {
   TestApplication application;
@@ -975,6 +1045,190 @@ static void UtcDaliActorGetCurrentWorldPosition()
   DALI_TEST_EQUALS( child.GetCurrentWorldPosition(), parentPosition + childPosition, TEST_LOCATION );
 }
 
+static void UtcDaliActorGetCurrentWorldPositionReparent()
+{
+  TestApplication application;
+
+  Actor parent1 = Actor::New();
+  Vector3 parent1Position( 10.0f, 20.0f, 30.0f );
+  parent1.SetPosition( parent1Position );
+  parent1.SetParentOrigin( ParentOrigin::CENTER );
+  Stage::GetCurrent().Add( parent1 );
+
+  Actor parent2 = Actor::New();
+  Vector3 parent2Position( -5.0f, 0.0f, 0.0f );
+  parent2.SetPosition( parent2Position );
+  parent2.SetParentOrigin( ParentOrigin::CENTER );
+  parent2.SetScale( 2.0f );
+  parent1.Add( parent2 );
+
+  Actor child = Actor::New();
+  Vector3 childPosition( 1.0f, 2.0f, 3.0f );
+  child.SetPosition( childPosition );
+  child.SetParentOrigin( ParentOrigin::CENTER );
+  parent1.Add( child );
+
+  application.SendNotification();
+  application.Render(0);
+
+  DALI_TEST_EQUALS( parent2.GetCurrentWorldPosition(), parent1Position + parent2Position, TEST_LOCATION );
+  DALI_TEST_EQUALS( child.GetCurrentWorldPosition(), parent1Position + childPosition, TEST_LOCATION );
+
+  // Move the child deeper into the hierarchy
+  parent2.Add( child );
+
+  application.SendNotification();
+  application.Render(0);
+
+  DALI_TEST_EQUALS( child.GetCurrentWorldPosition(), parent1Position + parent2Position + childPosition * 2.0f, TEST_LOCATION );
+
+  // Changes made while the parent is hidden are picked up when it is shown again
+  parent2.SetVisible( false );
+  application.SendNotification();
+  application.Render(0);
+
+  parent1.SetPosition( Vector3::ZERO );
+  application.SendNotification();
+  application.Render(0);
+
+  parent2.SetVisible( true );
+  application.SendNotification();
+  application.Render(0);
+
+  DALI_TEST_EQUALS( parent2.GetCurrentWorldPosition(), parent2Position, TEST_LOCATION );
+  DALI_TEST_EQUALS( child.GetCurrentWorldPosition(), parent2Position + childPosition * 2.0f, TEST_LOCATION );
+}
+
+static void UtcDaliActorGetCurrentWorldPositionWorkerThreads()
+{
+  tet_infoline("Testing world positions are inherited correctly, when independent subtrees are updated by worker threads");
+  TestApplication application( false );
+  application.Initialize( 3u );
+
+  // Enough subtrees of enough actors, for each subtree to be updated by a separate job
+  const unsigned int subtreeCount = 4u;
+  const unsigned int depth = 100u;
+  const Vector3 step( 1.0f, 2.0f, 0.0f );
+
+  std::vector< Actor > subtrees;
+  std::vector< Actor > leaves;
+  for( unsigned int i = 0u; i < subtreeCount; ++i )
+  {
+    Actor parent = Actor::New();
+    parent.SetParentOrigin( ParentOrigin::CENTER );
+    parent.SetPosition( Vector3( 10.0f * i, 0.0f, 0.0f ) );
+    Stage::GetCurrent().Add( parent );
+    subtrees.push_back( parent );
+
+    for( unsigned int j = 0u; j < depth; ++j )
+    {
+      Actor child = Actor::New();
+      child.SetParentOrigin( ParentOrigin::CENTER );
+      child.SetPosition( step );
+      parent.Add( child );
+      parent = child;
+    }
+    leaves.push_back( parent );
+  }
+
+  application.SendNotification();
+  application.Render(0);
+
+  for( unsigned int i = 0u; i < subtreeCount; ++i )
+  {
+    DALI_TEST_EQUALS( leaves[i].GetCurrentWorldPosition(), Vector3( 10.0f * i, 0.0f, 0.0f ) + step * depth, TEST_LOCATION );
+  }
+
+  // Move one subtree; the others are unchanged
+  subtrees[1].SetPosition( Vector3( 0.0f, -50.0f, 0.0f ) );
+
+  application.SendNotification();
+  application.Render(0);
+
+  DALI_TEST_EQUALS( leaves[0].GetCurrentWorldPosition(), step * depth, TEST_LOCATION );
+  DALI_TEST_EQUALS( leaves[1].GetCurrentWorldPosition(), Vector3( 0.0f, -50.0f, 0.0f ) + step * depth, TEST_LOCATION );
+  DALI_TEST_EQUALS( leaves[3].GetCurrentWorldPosition(), Vector3( 30.0f, 0.0f, 0.0f ) + step * depth, TEST_LOCATION );
+}
+
+static void UtcDaliActorGetCurrentWorldPositionTripleBuffered()
+{
+  tet_infoline("Testing current positions are correct in every buffer, when the scene-graph is triple-buffered");
+  TestApplication application( false );
+  application.Initialize( 0u, true );
+
+  // The update may run a frame further ahead of the rendering, when Dali is built with --enable-triple-buffering;
+  // otherwise the Core falls back to double-buffering, and the values below must still be correct.
+  const unsigned int maximumUpdateCount = application.GetCore().GetMaximumUpdateCount();
+  DALI_TEST_CHECK( 2u == maximumUpdateCount || 3u == maximumUpdateCount );
+
+  Actor parent = Actor::New();
+  parent.SetParentOrigin( ParentOrigin::CENTER );
+  Stage::GetCurrent().Add( parent );
+
+  Actor child = Actor::New();
+  child.SetParentOrigin( ParentOrigin::CENTER );
+  const Vector3 childPosition( 6.0f, 6.0f, 6.0f );
+  child.SetPosition( childPosition );
+  parent.Add( child );
+
+  const Vector3 parentPosition( 1.0f, 2.0f, 3.0f );
+  parent.SetPosition( parentPosition );
+
+  // Each frame is read from the next buffer
+  for( unsigned int frame = 0u; frame < 4u; ++frame )
+  {
+    application.SendNotification();
+    application.Render(0);
+
+    DALI_TEST_EQUALS( parent.GetCurrentPosition(), parentPosition, TEST_LOCATION );
+    DALI_TEST_EQUALS( child.GetCurrentWorldPosition(), parentPosition + childPosition, TEST_LOCATION );
+  }
+
+  // Animated values are reset to the base value in every buffer
+  Animation animation = Animation::New( 1.0f );
+  animation.AnimateBy( Property( parent, Actor::POSITION ), Vector3( 10.0f, 0.0f, 0.0f ) );
+  animation.Play();
+
+  application.SendNotification();
+  application.Render( 500 );
+  DALI_TEST_EQUALS( parent.GetCurrentPosition(), parentPosition + Vector3( 5.0f, 0.0f, 0.0f ), TEST_LOCATION );
+
+  application.Render( 500 );
+  application.SendNotification();
+
+  for( unsigned int frame = 0u; frame < 4u; ++frame )
+  {
+    application.SendNotification();
+    application.Render(0);
+
+    DALI_TEST_EQUALS( parent.GetCurrentPosition(), parentPosition + Vector3( 10.0f, 0.0f, 0.0f ), TEST_LOCATION );
+    DALI_TEST_EQUALS( child.GetCurrentWorldPosition(), parentPosition + Vector3( 10.0f, 0.0f, 0.0f ) + childPosition, TEST_LOCATION );
+  }
+
+  // A value which is only Set (not Baked) by a constraint is reset in every buffer when the constraint is removed
+  Constraint constraint = Constraint::New<Vector3>( Actor::POSITION, Source( parent, Actor::SIZE ), EqualToConstraint() );
+  constraint.SetRemoveAction( Constraint::Discard );
+  child.ApplyConstraint( constraint );
+
+  for( unsigned int frame = 0u; frame < 3u; ++frame )
+  {
+    application.SendNotification();
+    application.Render(0);
+
+    DALI_TEST_EQUALS( child.GetCurrentPosition(), Vector3::ZERO, TEST_LOCATION );
+  }
+
+  child.RemoveConstraints();
+
+  for( unsigned int frame = 0u; frame < 4u; ++frame )
+  {
+    application.SendNotification();
+    application.Render(0);
+
+    DALI_TEST_EQUALS( child.GetCurrentPosition(), childPosition, TEST_LOCATION );
+  }
+}
+
 static void UtcDaliActorInheritPosition()
 {
   tet_infoline("Testing Actor::SetPositionInheritanceMode");
@@ -78,6 +78,9 @@ TEST_FUNCTION( UtcDaliImageActorNewNullWithArea,      POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliImageActorSetImage,             POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliImageActorPropertyIndices,      POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliImageActorImageProperty,        POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliImageActorBatching01,           POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliImageActorBatching02,           POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliImageActorBatching03,           POSITIVE_TC_IDX );
 
 // Called only once before first test is run.
 static void Startup()
@@ -988,3 +991,93 @@ void UtcDaliImageActorImageProperty()
   DALI_TEST_CHECK( imageMap.HasKey( "filename" ) );
   DALI_TEST_EQUALS( imageMap.GetValue( "filename" ).Get< std::string >(), "MY_PATH", TEST_LOCATION );
 }
+
+void UtcDaliImageActorBatching01()
+{
+  TestApplication application;
+  tet_infoline("Testing that image actors sharing an image are drawn with a single draw call");
+
+  TraceCallStack& drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable(true);
+
+  BitmapImage image = BitmapImage::New( 10, 10 );
+  for( int i = 0; i < 10; ++i )
+  {
+    ImageActor actor = ImageActor::New( image );
+    actor.SetSize( 20, 20 );
+    actor.SetPosition( i * 30.0f + 50.0f, 100.0f );
+    Stage::GetCurrent().Add( actor );
+  }
+
+  application.SendNotification();
+  application.Render();
+  application.Render();
+
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( drawTrace.GetCallStack().size(), 1u, TEST_LOCATION );
+  DALI_TEST_CHECK( drawTrace.FindMethodAndParams( "DrawArrays", "4, 0, 60" ) );
+}
+
+void UtcDaliImageActorBatching02()
+{
+  TestApplication application;
+  tet_infoline("Testing that image actors with different images or colors are not batched");
+
+  TraceCallStack& drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable(true);
+
+  BitmapImage image = BitmapImage::New( 10, 10 );
+  ImageActor actor1 = ImageActor::New( image );
+  Stage::GetCurrent().Add( actor1 );
+  ImageActor actor2 = ImageActor::New( image );
+  Stage::GetCurrent().Add( actor2 );
+  ImageActor actor3 = ImageActor::New( BitmapImage::New( 10, 10 ) );
+  Stage::GetCurrent().Add( actor3 );
+
+  application.SendNotification();
+  application.Render();
+  application.Render();
+
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( drawTrace.GetCallStack().size(), 2u, TEST_LOCATION );
+
+  actor2.SetColor( Vector4( 1.0f, 0.0f, 0.0f, 1.0f ) );
+  application.SendNotification();
+  application.Render();
+
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( drawTrace.GetCallStack().size(), 3u, TEST_LOCATION );
+}
+
+void UtcDaliImageActorBatching03()
+{
+  TestApplication application;
+  tet_infoline("Testing that image actors using a custom shader effect are not batched");
+
+  TraceCallStack& drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable(true);
+
+  BitmapImage image = BitmapImage::New( 10, 10 );
+  ShaderEffect effect = ShaderEffect::New( "", "" );
+  for( int i = 0; i < 3; ++i )
+  {
+    ImageActor actor = ImageActor::New( image );
+    actor.SetShaderEffect( effect );
+    Stage::GetCurrent().Add( actor );
+  }
+
+  application.SendNotification();
+  application.Render();
+  application.Render();
+
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( drawTrace.GetCallStack().size(), 3u, TEST_LOCATION );
+}
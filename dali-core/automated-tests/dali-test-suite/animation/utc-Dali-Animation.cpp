@@ -18,6 +18,7 @@
 #include <algorithm>
 
 #include <stdlib.h>
+#include <sys/time.h>
 #include <tet_api.h>
 
 #include <dali/public-api/dali-core.h>
@@ -204,6 +205,11 @@ TEST_FUNCTION( UtcDaliAnimationAnimateBetweenActorColorFunction, POSITIVE_TC_IDX
 TEST_FUNCTION( UtcDaliAnimationAnimateBetweenActorColorFunctionTimePeriod, POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliAnimationAnimateVector3Func, POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliAnimationCreateDestroy, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliAnimationDiscardWithUnanimatedActors, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliAnimationAnimatorOrder, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliAnimationBatchedAnimators, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliAnimationWorkerThreads, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliAnimationUpdateBenchmark, POSITIVE_TC_IDX );
 
 // Called only once before first test is run.
 static void Startup()
@@ -8784,3 +8790,254 @@ static void UtcDaliAnimationCreateDestroy()
   DALI_TEST_CHECK( animation );
   delete animation;
 }
+
+static void UtcDaliAnimationDiscardWithUnanimatedActors()
+{
+  TestApplication application;
+
+  // Only the animated properties are reset each frame; check that the other actors keep their values
+  Actor animatedActor = Actor::New();
+  Stage::GetCurrent().Add(animatedActor);
+
+  std::vector<Actor> actors;
+  for( unsigned int i = 0u; i < 10u; ++i )
+  {
+    Actor actor = Actor::New();
+    actor.SetPosition( Vector3( static_cast<float>( i ), 0.0f, 0.0f ) );
+    Stage::GetCurrent().Add(actor);
+    actors.push_back( actor );
+  }
+
+  application.SendNotification();
+  application.Render(0);
+
+  // Build the animation
+  float durationSeconds(1.0f);
+  Animation animation = Animation::New(durationSeconds);
+  Vector3 targetPosition(100.0f, 100.0f, 100.0f);
+  animation.MoveTo(animatedActor, targetPosition, AlphaFunctions::Linear);
+  animation.SetEndAction(Animation::Discard);
+  animation.Play();
+
+  bool signalReceived(false);
+  AnimationFinishCheck finishCheck(signalReceived);
+  animation.FinishedSignal().Connect(&application, finishCheck);
+
+  application.SendNotification();
+  application.Render(static_cast<unsigned int>(durationSeconds*500.0f)/* 50% progress */);
+  DALI_TEST_EQUALS( targetPosition*0.5f, animatedActor.GetCurrentPosition(), TEST_LOCATION );
+
+  // Move one of the unanimated actors during the animation
+  actors[0].SetPosition( Vector3( 0.0f, 50.0f, 0.0f ) );
+
+  application.SendNotification();
+  application.Render(static_cast<unsigned int>(durationSeconds*500.0f) + 1u/*just beyond the animation duration*/);
+
+  application.SendNotification();
+  finishCheck.CheckSignalReceived();
+  DALI_TEST_EQUALS( targetPosition, animatedActor.GetCurrentPosition(), TEST_LOCATION );
+
+  // The position should be discarded in the next frame, and remain discarded after a couple of buffer swaps
+  for( unsigned int frame = 0u; frame < 3u; ++frame )
+  {
+    application.Render(0);
+    DALI_TEST_EQUALS( Vector3::ZERO/*discarded*/, animatedActor.GetCurrentPosition(), TEST_LOCATION );
+
+    DALI_TEST_EQUALS( Vector3( 0.0f, 50.0f, 0.0f ), actors[0].GetCurrentPosition(), TEST_LOCATION );
+    for( unsigned int i = 1u; i < actors.size(); ++i )
+    {
+      DALI_TEST_EQUALS( Vector3( static_cast<float>( i ), 0.0f, 0.0f ), actors[i].GetCurrentPosition(), TEST_LOCATION );
+    }
+  }
+}
+
+static void UtcDaliAnimationAnimatorOrder()
+{
+  TestApplication application;
+
+  // Each animator starts from the value where the previous one stopped; they must be applied in order
+  Actor actor = Actor::New();
+  Stage::GetCurrent().Add(actor);
+
+  Animation animation = Animation::New(3.0f);
+  animation.AnimateTo(Property(actor, Actor::POSITION_X), 100.0f, AlphaFunctions::Linear, TimePeriod(0.0f, 1.0f));
+  animation.AnimateTo(Property(actor, Actor::POSITION_X), 200.0f, AlphaFunctions::EaseIn, TimePeriod(1.0f, 1.0f));
+  animation.AnimateTo(Property(actor, Actor::POSITION_X), 300.0f, AlphaFunctions::Linear, TimePeriod(2.0f, 1.0f));
+  animation.Play();
+
+  application.SendNotification();
+  application.Render(500u);
+  DALI_TEST_EQUALS( actor.GetCurrentPosition().x, 50.0f, TEST_LOCATION );
+
+  application.Render(1000u);
+  DALI_TEST_EQUALS( actor.GetCurrentPosition().x, 100.0f + 100.0f * AlphaFunctions::EaseIn( 0.5f ), TEST_LOCATION );
+
+  application.Render(1000u);
+  DALI_TEST_EQUALS( actor.GetCurrentPosition().x, 250.0f, TEST_LOCATION );
+
+  application.Render(501u);
+  application.SendNotification();
+  DALI_TEST_EQUALS( actor.GetCurrentPosition().x, 300.0f, TEST_LOCATION );
+}
+
+static void UtcDaliAnimationBatchedAnimators()
+{
+  TestApplication application;
+
+  // Interleave animators of different types and alpha functions, which are updated in batches
+  std::vector<Actor> actors;
+  Animation animation = Animation::New(1.0f);
+  for( unsigned int i = 0u; i < 20u; ++i )
+  {
+    Actor actor = Actor::New();
+    Stage::GetCurrent().Add(actor);
+    actors.push_back( actor );
+
+    animation.AnimateTo(Property(actor, Actor::POSITION), Vector3( 100.0f, 100.0f, 0.0f ), ( i % 2u ) ? AlphaFunctions::EaseIn : AlphaFunctions::Linear );
+    animation.AnimateTo(Property(actor, Actor::COLOR_ALPHA), 0.0f );
+    animation.AnimateBy(Property(actor, Actor::SCALE), Vector3( 1.0f, 1.0f, 1.0f ) );
+  }
+  animation.Play();
+
+  application.SendNotification();
+  application.Render(500u);
+
+  const float easeIn( AlphaFunctions::EaseIn( 0.5f ) );
+  for( unsigned int i = 0u; i < actors.size(); ++i )
+  {
+    const float progress( ( i % 2u ) ? easeIn : 0.5f );
+    DALI_TEST_EQUALS( actors[i].GetCurrentPosition(), Vector3( 100.0f * progress, 100.0f * progress, 0.0f ), TEST_LOCATION );
+    DALI_TEST_EQUALS( actors[i].GetCurrentColor().a, 0.5f, TEST_LOCATION );
+    DALI_TEST_EQUALS( actors[i].GetCurrentScale(), Vector3( 1.5f, 1.5f, 1.5f ), TEST_LOCATION );
+  }
+
+  // Orphaned animators are removed from their batch
+  for( unsigned int i = 0u; i < actors.size(); i += 2u )
+  {
+    Stage::GetCurrent().Remove( actors[i] );
+  }
+  application.SendNotification();
+  application.Render(501u);
+  application.SendNotification();
+
+  for( unsigned int i = 1u; i < actors.size(); i += 2u )
+  {
+    DALI_TEST_EQUALS( actors[i].GetCurrentPosition(), Vector3( 100.0f, 100.0f, 0.0f ), TEST_LOCATION );
+    DALI_TEST_EQUALS( actors[i].GetCurrentColor().a, 0.0f, TEST_LOCATION );
+    DALI_TEST_EQUALS( actors[i].GetCurrentScale(), Vector3( 2.0f, 2.0f, 2.0f ), TEST_LOCATION );
+  }
+}
+
+static void UtcDaliAnimationWorkerThreads()
+{
+  tet_infoline("Testing animators are applied in order, when they are distributed between worker threads");
+  TestApplication application( false );
+  application.Initialize( 3u );
+
+  // Enough animators for them to be applied in parallel; each property is animated by two animations
+  const unsigned int ACTORS( 300u );
+
+  std::vector<Actor> actors;
+  Animation first = Animation::New(1.0f);
+  Animation second = Animation::New(2.0f);
+  for( unsigned int i = 0u; i < ACTORS; ++i )
+  {
+    Actor actor = Actor::New();
+    Stage::GetCurrent().Add(actor);
+    actors.push_back( actor );
+
+    first.AnimateTo(Property(actor, Actor::POSITION), Vector3( 100.0f, 100.0f, 0.0f ), ( i % 2u ) ? AlphaFunctions::EaseIn : AlphaFunctions::Linear );
+    first.AnimateTo(Property(actor, Actor::COLOR_ALPHA), 0.0f );
+    second.AnimateBy(Property(actor, Actor::POSITION), Vector3( 10.0f, 0.0f, 0.0f ) );
+    second.AnimateBy(Property(actor, Actor::SCALE), Vector3( 1.0f, 1.0f, 1.0f ) );
+  }
+  first.Play();
+  second.Play();
+
+  bool signalReceived(false);
+  AnimationFinishCheck finishCheck(signalReceived);
+  first.FinishedSignal().Connect(&application, finishCheck);
+
+  application.SendNotification();
+  application.Render(500u);
+
+  const float easeIn( AlphaFunctions::EaseIn( 0.5f ) );
+  for( unsigned int i = 0u; i < ACTORS; ++i )
+  {
+    const float progress( ( i % 2u ) ? easeIn : 0.5f );
+    DALI_TEST_EQUALS( actors[i].GetCurrentPosition(), Vector3( 100.0f * progress + 2.5f, 100.0f * progress, 0.0f ), TEST_LOCATION );
+    DALI_TEST_EQUALS( actors[i].GetCurrentColor().a, 0.5f, TEST_LOCATION );
+    DALI_TEST_EQUALS( actors[i].GetCurrentScale(), Vector3( 1.25f, 1.25f, 1.25f ), TEST_LOCATION );
+  }
+
+  // The first animation bakes its final value; the second animation continues from there
+  application.Render(501u);
+  application.SendNotification();
+  finishCheck.CheckSignalReceived();
+
+  for( unsigned int i = 0u; i < ACTORS; ++i )
+  {
+    DALI_TEST_EQUALS( actors[i].GetCurrentPosition(), Vector3( 100.0f + 5.0f, 100.0f, 0.0f ), 0.01f, TEST_LOCATION );
+    DALI_TEST_EQUALS( actors[i].GetCurrentColor().a, 0.0f, TEST_LOCATION );
+  }
+
+  application.Render(1000u);
+  application.SendNotification();
+
+  for( unsigned int i = 0u; i < ACTORS; ++i )
+  {
+    DALI_TEST_EQUALS( actors[i].GetCurrentPosition(), Vector3( 110.0f, 100.0f, 0.0f ), TEST_LOCATION );
+    DALI_TEST_EQUALS( actors[i].GetCurrentScale(), Vector3( 2.0f, 2.0f, 2.0f ), TEST_LOCATION );
+  }
+}
+
+static void UtcDaliAnimationUpdateBenchmark()
+{
+  tet_infoline("Benchmark the update of 10000 animators, four for each of 2500 actors");
+
+  TestApplication application;
+
+  const unsigned int ACTORS( 2500u );
+  const unsigned int FRAMES( 60u );
+
+  std::vector<Actor> actors;
+  Animation animation = Animation::New(2.0f);
+  for( unsigned int i = 0u; i < ACTORS; ++i )
+  {
+    Actor actor = Actor::New();
+    Stage::GetCurrent().Add(actor);
+    actors.push_back( actor );
+
+    animation.AnimateTo(Property(actor, Actor::POSITION), Vector3( 100.0f, 200.0f, 0.0f ), AlphaFunctions::EaseInOut );
+    animation.AnimateTo(Property(actor, Actor::COLOR), Vector4( 1.0f, 0.0f, 0.0f, 0.5f ) );
+    animation.AnimateBy(Property(actor, Actor::SCALE), Vector3( 1.0f, 1.0f, 0.0f ) );
+    animation.RotateTo(actor, Degree( 90.0f ), Vector3::ZAXIS );
+  }
+  animation.Play();
+
+  application.SendNotification();
+  application.Render(0);
+
+  timeval start;
+  gettimeofday( &start, NULL );
+  for( unsigned int frame = 0u; frame < FRAMES; ++frame )
+  {
+    application.SendNotification();
+    application.Render(16u);
+  }
+  timeval end;
+  gettimeofday( &end, NULL );
+
+  const double milliseconds( ( end.tv_sec - start.tv_sec ) * 1000.0 + ( end.tv_usec - start.tv_usec ) / 1000.0 );
+  tet_printf( "%u animators: %.3f ms per frame\n", ACTORS * 4u, milliseconds / FRAMES );
+
+  application.Render(2000u);
+  application.SendNotification();
+  for( unsigned int i = 0u; i < ACTORS; i += 100u )
+  {
+    DALI_TEST_EQUALS( actors[i].GetCurrentPosition(), Vector3( 100.0f, 200.0f, 0.0f ), TEST_LOCATION );
+    DALI_TEST_EQUALS( actors[i].GetCurrentColor(), Vector4( 1.0f, 0.0f, 0.0f, 0.5f ), TEST_LOCATION );
+    DALI_TEST_EQUALS( actors[i].GetCurrentScale(), Vector3( 2.0f, 2.0f, 1.0f ), TEST_LOCATION );
+    DALI_TEST_EQUALS( actors[i].GetCurrentRotation(), Quaternion( Radian( Degree( 90.0f ) ), Vector3::ZAXIS ), ROTATION_EPSILON, TEST_LOCATION );
+  }
+}
@@ -0,0 +1,324 @@
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <iostream>
+
+#include <stdlib.h>
+#include <tet_api.h>
+
+#include <dali/public-api/dali-core.h>
+
+#include <dali-test-suite-utils.h>
+
+using namespace Dali;
+
+static void Startup();
+static void Cleanup();
+
+extern "C" {
+  void (*tet_startup)() = Startup;
+  void (*tet_cleanup)() = Cleanup;
+}
+
+enum {
+  POSITIVE_TC_IDX = 0x01,
+  NEGATIVE_TC_IDX,
+};
+
+#define MAX_NUMBER_OF_TESTS 10000
+extern "C" {
+  struct tet_testlist tet_testlist[MAX_NUMBER_OF_TESTS];
+}
+
+TEST_FUNCTION( UtcDaliPropertyValueConstructors, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliPropertyValueConstructorsFromType, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliPropertyValueCopyAndAssignment, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliPropertyValueAssignFromOwnContainer, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliPropertyValueRotation, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliPropertyValueAssignBetweenTypes, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliPropertyValueNegativeGet, NEGATIVE_TC_IDX );
+
+// Called only once before first test is run.
+static void Startup()
+{
+}
+
+// Called only once after last test is run
+static void Cleanup()
+{
+}
+
+static void UtcDaliPropertyValueConstructors()
+{
+  TestApplication application;
+
+  tet_infoline("Test Property::Value constructors.");
+
+  Property::Value none;
+  DALI_TEST_EQUALS( none.GetType(), Property::NONE, TEST_LOCATION );
+
+  Property::Value boolValue( true );
+  DALI_TEST_EQUALS( boolValue.GetType(), Property::BOOLEAN, TEST_LOCATION );
+  DALI_TEST_EQUALS( boolValue.Get<bool>(), true, TEST_LOCATION );
+
+  Property::Value floatValue( 1.5f );
+  DALI_TEST_EQUALS( floatValue.GetType(), Property::FLOAT, TEST_LOCATION );
+  DALI_TEST_EQUALS( floatValue.Get<float>(), 1.5f, TEST_LOCATION );
+
+  Property::Value intValue( -3 );
+  DALI_TEST_EQUALS( intValue.GetType(), Property::INTEGER, TEST_LOCATION );
+  DALI_TEST_EQUALS( intValue.Get<int>(), -3, TEST_LOCATION );
+
+  Property::Value unsignedValue( 7u );
+  DALI_TEST_EQUALS( unsignedValue.GetType(), Property::UNSIGNED_INTEGER, TEST_LOCATION );
+  DALI_TEST_EQUALS( unsignedValue.Get<unsigned int>(), 7u, TEST_LOCATION );
+
+  Property::Value vector2Value( Vector2( 1.0f, 2.0f ) );
+  DALI_TEST_EQUALS( vector2Value.GetType(), Property::VECTOR2, TEST_LOCATION );
+  DALI_TEST_EQUALS( vector2Value.Get<Vector2>(), Vector2( 1.0f, 2.0f ), TEST_LOCATION );
+
+  Property::Value vector3Value( Vector3( 1.0f, 2.0f, 3.0f ) );
+  DALI_TEST_EQUALS( vector3Value.GetType(), Property::VECTOR3, TEST_LOCATION );
+  DALI_TEST_EQUALS( vector3Value.Get<Vector3>(), Vector3( 1.0f, 2.0f, 3.0f ), TEST_LOCATION );
+
+  Property::Value vector4Value( Vector4( 1.0f, 2.0f, 3.0f, 4.0f ) );
+  DALI_TEST_EQUALS( vector4Value.GetType(), Property::VECTOR4, TEST_LOCATION );
+  DALI_TEST_EQUALS( vector4Value.Get<Vector4>(), Vector4( 1.0f, 2.0f, 3.0f, 4.0f ), TEST_LOCATION );
+
+  Matrix3 matrix3( 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f );
+  Property::Value matrix3Value( matrix3 );
+  DALI_TEST_EQUALS( matrix3Value.GetType(), Property::MATRIX3, TEST_LOCATION );
+  DALI_TEST_CHECK( matrix3Value.Get<Matrix3>() == matrix3 );
+
+  Matrix matrix;
+  matrix.SetTransformComponents( Vector3( 2.0f, 2.0f, 2.0f ), Quaternion( Radian( 0.5f ), Vector3::ZAXIS ), Vector3( 1.0f, 2.0f, 3.0f ) );
+  Property::Value matrixValue( matrix );
+  DALI_TEST_EQUALS( matrixValue.GetType(), Property::MATRIX, TEST_LOCATION );
+  DALI_TEST_EQUALS( matrixValue.Get<Matrix>(), matrix, 0.001f, TEST_LOCATION );
+
+  Property::Value rectValue( Rect<int>( 1, 2, 3, 4 ) );
+  DALI_TEST_EQUALS( rectValue.GetType(), Property::RECTANGLE, TEST_LOCATION );
+  DALI_TEST_CHECK( rectValue.Get< Rect<int> >() == Rect<int>( 1, 2, 3, 4 ) );
+
+  Property::Value stringValue( "dali" );
+  DALI_TEST_EQUALS( stringValue.GetType(), Property::STRING, TEST_LOCATION );
+  DALI_TEST_EQUALS( stringValue.Get<std::string>(), "dali", TEST_LOCATION );
+
+  Property::Array array;
+  array.push_back( Property::Value( 1 ) );
+  array.push_back( Property::Value( "two" ) );
+  Property::Value arrayValue( array );
+  DALI_TEST_EQUALS( arrayValue.GetType(), Property::ARRAY, TEST_LOCATION );
+  DALI_TEST_EQUALS( arrayValue.GetSize(), 2, TEST_LOCATION );
+  DALI_TEST_EQUALS( arrayValue.GetItem( 1 ).Get<std::string>(), "two", TEST_LOCATION );
+
+  Property::Map map;
+  map.push_back( Property::StringValuePair( "size", Property::Value( Vector3::ONE ) ) );
+  Property::Value mapValue( map );
+  DALI_TEST_EQUALS( mapValue.GetType(), Property::MAP, TEST_LOCATION );
+  DALI_TEST_CHECK( mapValue.HasKey( "size" ) );
+  DALI_TEST_EQUALS( mapValue.GetValue( "size" ).Get<Vector3>(), Vector3::ONE, TEST_LOCATION );
+}
+
+static void UtcDaliPropertyValueConstructorsFromType()
+{
+  TestApplication application;
+
+  tet_infoline("Test Property::Value constructor from a type.");
+
+  DALI_TEST_EQUALS( Property::Value( Property::BOOLEAN ).Get<bool>(), false, TEST_LOCATION );
+  DALI_TEST_EQUALS( Property::Value( Property::FLOAT ).Get<float>(), 0.0f, TEST_LOCATION );
+  DALI_TEST_EQUALS( Property::Value( Property::INTEGER ).Get<int>(), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( Property::Value( Property::UNSIGNED_INTEGER ).Get<unsigned int>(), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( Property::Value( Property::VECTOR2 ).Get<Vector2>(), Vector2::ZERO, TEST_LOCATION );
+  DALI_TEST_EQUALS( Property::Value( Property::VECTOR3 ).Get<Vector3>(), Vector3::ZERO, TEST_LOCATION );
+  DALI_TEST_EQUALS( Property::Value( Property::VECTOR4 ).Get<Vector4>(), Vector4::ZERO, TEST_LOCATION );
+  DALI_TEST_CHECK( Property::Value( Property::MATRIX3 ).Get<Matrix3>() == Matrix3::IDENTITY );
+  DALI_TEST_EQUALS( Property::Value( Property::MATRIX ).Get<Matrix>(), Matrix(), 0.001f, TEST_LOCATION );
+  DALI_TEST_CHECK( Property::Value( Property::RECTANGLE ).Get< Rect<int> >() == Rect<int>() );
+  DALI_TEST_EQUALS( Property::Value( Property::ROTATION ).Get<Quaternion>(), Quaternion( 0.0f, Vector4::YAXIS ), 0.001f, TEST_LOCATION );
+  DALI_TEST_EQUALS( Property::Value( Property::STRING ).Get<std::string>(), "", TEST_LOCATION );
+  DALI_TEST_EQUALS( Property::Value( Property::ARRAY ).GetSize(), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( Property::Value( Property::MAP ).GetSize(), 0, TEST_LOCATION );
+  DALI_TEST_EQUALS( Property::Value( Property::NONE ).GetType(), Property::NONE, TEST_LOCATION );
+}
+
+static void UtcDaliPropertyValueCopyAndAssignment()
+{
+  TestApplication application;
+
+  tet_infoline("Test Property::Value copy constructor and assignment operator.");
+
+  Property::Value stringValue( "first" );
+  Property::Value copy( stringValue );
+  DALI_TEST_EQUALS( copy.Get<std::string>(), "first", TEST_LOCATION );
+
+  // The copy must not share the string
+  stringValue = Property::Value( "second" );
+  DALI_TEST_EQUALS( copy.Get<std::string>(), "first", TEST_LOCATION );
+  DALI_TEST_EQUALS( stringValue.Get<std::string>(), "second", TEST_LOCATION );
+
+  // Assign between types with & without allocated contents
+  Property::Value value( Vector3( 1.0f, 2.0f, 3.0f ) );
+  value = stringValue;
+  DALI_TEST_EQUALS( value.GetType(), Property::STRING, TEST_LOCATION );
+  DALI_TEST_EQUALS( value.Get<std::string>(), "second", TEST_LOCATION );
+
+  value = Property::Value( Vector4( 1.0f, 2.0f, 3.0f, 4.0f ) );
+  DALI_TEST_EQUALS( value.GetType(), Property::VECTOR4, TEST_LOCATION );
+  DALI_TEST_EQUALS( value.Get<Vector4>(), Vector4( 1.0f, 2.0f, 3.0f, 4.0f ), TEST_LOCATION );
+
+  value = Property::Value();
+  DALI_TEST_EQUALS( value.GetType(), Property::NONE, TEST_LOCATION );
+
+  // Self assignment
+  stringValue = stringValue;
+  DALI_TEST_EQUALS( stringValue.Get<std::string>(), "second", TEST_LOCATION );
+
+  // Nested containers are copied deeply
+  Property::Value mapValue( Property::MAP );
+  mapValue.SetValue( "inner", Property::Value( Property::ARRAY ) );
+  mapValue.GetValue( "inner" ).AppendItem( Property::Value( 1.0f ) );
+
+  Property::Value mapCopy( mapValue );
+  mapValue.GetValue( "inner" ).AppendItem( Property::Value( 2.0f ) );
+
+  DALI_TEST_EQUALS( mapValue.GetValue( "inner" ).GetSize(), 2, TEST_LOCATION );
+  DALI_TEST_EQUALS( mapCopy.GetValue( "inner" ).GetSize(), 1, TEST_LOCATION );
+}
+
+static void UtcDaliPropertyValueAssignFromOwnContainer()
+{
+  TestApplication application;
+
+  tet_infoline("Test assigning a Property::Value from an item in its own container.");
+
+  Property::Value arrayValue( Property::ARRAY );
+  arrayValue.AppendItem( Property::Value( "item" ) );
+  arrayValue = arrayValue.GetItem( 0 );
+
+  DALI_TEST_EQUALS( arrayValue.GetType(), Property::STRING, TEST_LOCATION );
+  DALI_TEST_EQUALS( arrayValue.Get<std::string>(), "item", TEST_LOCATION );
+
+  Property::Value mapValue( Property::MAP );
+  mapValue.SetValue( "key", Property::Value( Vector2( 3.0f, 4.0f ) ) );
+  mapValue = mapValue.GetValue( "key" );
+
+  DALI_TEST_EQUALS( mapValue.GetType(), Property::VECTOR2, TEST_LOCATION );
+  DALI_TEST_EQUALS( mapValue.Get<Vector2>(), Vector2( 3.0f, 4.0f ), TEST_LOCATION );
+}
+
+static void UtcDaliPropertyValueRotation()
+{
+  TestApplication application;
+
+  tet_infoline("Test Property::Value holding a rotation as a quaternion or an angle-axis.");
+
+  Quaternion quaternion( Radian( Degree( 90.0f ) ), Vector3::XAXIS );
+
+  Property::Value quaternionValue( quaternion );
+  DALI_TEST_EQUALS( quaternionValue.GetType(), Property::ROTATION, TEST_LOCATION );
+  DALI_TEST_EQUALS( quaternionValue.Get<Quaternion>(), quaternion, 0.001f, TEST_LOCATION );
+
+  AngleAxis angleAxis = quaternionValue.Get<AngleAxis>();
+  DALI_TEST_EQUALS( float( angleAxis.angle ), 90.0f, 0.001f, TEST_LOCATION );
+  DALI_TEST_EQUALS( angleAxis.axis, Vector3::XAXIS, 0.001f, TEST_LOCATION );
+
+  Property::Value angleAxisValue( AngleAxis( Degree( 90.0f ), Vector3::XAXIS ) );
+  DALI_TEST_EQUALS( angleAxisValue.GetType(), Property::ROTATION, TEST_LOCATION );
+  DALI_TEST_EQUALS( angleAxisValue.Get<Quaternion>(), quaternion, 0.001f, TEST_LOCATION );
+
+  angleAxis = angleAxisValue.Get<AngleAxis>();
+  DALI_TEST_EQUALS( float( angleAxis.angle ), 90.0f, 0.001f, TEST_LOCATION );
+  DALI_TEST_EQUALS( angleAxis.axis, Vector3::XAXIS, 0.001f, TEST_LOCATION );
+
+  // The representation is preserved when copied
+  Property::Value copy( angleAxisValue );
+  angleAxis = copy.Get<AngleAxis>();
+  DALI_TEST_EQUALS( float( angleAxis.angle ), 90.0f, 0.001f, TEST_LOCATION );
+}
+
+static void UtcDaliPropertyValueAssignBetweenTypes()
+{
+  TestApplication application;
+
+  tet_infoline("Test assigning between fixed-size and allocated Property::Values.");
+
+  Matrix matrix;
+  matrix.SetTransformComponents( Vector3::ONE, Quaternion( Radian( 0.5f ), Vector3::ZAXIS ), Vector3( 1.0f, 2.0f, 3.0f ) );
+
+  Property::Value vector3Value( Vector3( 1.0f, 2.0f, 3.0f ) );
+  Property::Value matrixValue( matrix );
+  Property::Value rectValue( Rect<int>( 1, 2, 3, 4 ) );
+  Property::Value stringValue( "string" );
+
+  Property::Value value( vector3Value );
+  DALI_TEST_EQUALS( value.Get<Vector3>(), Vector3( 1.0f, 2.0f, 3.0f ), TEST_LOCATION );
+
+  value = rectValue;
+  DALI_TEST_CHECK( value.GetType() == Property::RECTANGLE );
+  DALI_TEST_CHECK( value.Get< Rect<int> >() == Rect<int>( 1, 2, 3, 4 ) );
+
+  value = matrixValue;
+  DALI_TEST_CHECK( value.GetType() == Property::MATRIX );
+  DALI_TEST_EQUALS( value.Get<Matrix>(), matrix, 0.001f, TEST_LOCATION );
+
+  value = stringValue;
+  DALI_TEST_CHECK( value.GetType() == Property::STRING );
+  DALI_TEST_EQUALS( value.Get<std::string>(), std::string( "string" ), TEST_LOCATION );
+
+  value = Property::Value( 0.5f );
+  DALI_TEST_CHECK( value.GetType() == Property::FLOAT );
+  DALI_TEST_EQUALS( value.Get<float>(), 0.5f, TEST_LOCATION );
+
+  // The source values are unchanged
+  DALI_TEST_EQUALS( matrixValue.Get<Matrix>(), matrix, 0.001f, TEST_LOCATION );
+  DALI_TEST_EQUALS( stringValue.Get<std::string>(), std::string( "string" ), TEST_LOCATION );
+}
+
+static void UtcDaliPropertyValueNegativeGet()
+{
+  TestApplication application;
+
+  tet_infoline("Test that Property::Value::Get asserts with the wrong type.");
+
+  Property::Value value( Vector3::ONE );
+
+  bool asserted = false;
+  try
+  {
+    value.Get<Vector4>();
+  }
+  catch( Dali::DaliException& e )
+  {
+    tet_printf( "Assertion %s failed at %s\n", e.mCondition.c_str(), e.mLocation.c_str() );
+    DALI_TEST_ASSERT( e, "Property::VECTOR4 == GetType()", TEST_LOCATION );
+    asserted = true;
+  }
+  DALI_TEST_CHECK( asserted );
+
+  asserted = false;
+  try
+  {
+    value.Get<std::string>();
+  }
+  catch( Dali::DaliException& e )
+  {
+    DALI_TEST_ASSERT( e, "Property::STRING == GetType()", TEST_LOCATION );
+    asserted = true;
+  }
+  DALI_TEST_CHECK( asserted );
+}
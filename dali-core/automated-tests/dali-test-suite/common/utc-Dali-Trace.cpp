@@ -0,0 +1,140 @@
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <stdlib.h>
+#include <tet_api.h>
+
+#include <dali/integration-api/trace.h>
+
+#include <dali-test-suite-utils.h>
+
+using namespace Dali;
+
+static void Startup();
+static void Cleanup();
+
+extern "C" {
+  void (*tet_startup)() = Startup;
+  void (*tet_cleanup)() = Cleanup;
+}
+
+enum {
+  POSITIVE_TC_IDX = 0x01,
+  NEGATIVE_TC_IDX,
+};
+
+#define MAX_NUMBER_OF_TESTS 10000
+extern "C" {
+  struct tet_testlist tet_testlist[MAX_NUMBER_OF_TESTS];
+}
+
+TEST_FUNCTION( UtcDaliTraceScope,          POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliTraceUninstalled,    NEGATIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliTraceUpdateAndRender, POSITIVE_TC_IDX );
+
+// Called only once before first test is run.
+static void Startup()
+{
+}
+
+// Called only once after last test is run
+static void Cleanup()
+{
+  Integration::Trace::InstallTraceFunction( NULL );
+}
+
+namespace
+{
+
+std::vector< std::string > gTrace;
+
+void RecordTrace( const char* name, bool start )
+{
+  gTrace.push_back( std::string( start ? "+" : "-" ) + name );
+}
+
+bool IsTraced( const std::string& entry )
+{
+  for( std::vector< std::string >::const_iterator iter = gTrace.begin(); iter != gTrace.end(); ++iter )
+  {
+    if( *iter == entry )
+    {
+      return true;
+    }
+  }
+  return false;
+}
+
+} // unnamed namespace
+
+static void UtcDaliTraceScope()
+{
+  gTrace.clear();
+  Integration::Trace::InstallTraceFunction( RecordTrace );
+
+  {
+    DALI_TRACE_SCOPE( "Outer" );
+    DALI_TRACE_SCOPE( "Inner" );
+  }
+
+  Integration::Trace::InstallTraceFunction( NULL );
+
+  DALI_TEST_EQUALS( gTrace.size(), 4u, TEST_LOCATION );
+  DALI_TEST_EQUALS( gTrace[0], std::string( "+Outer" ), TEST_LOCATION );
+  DALI_TEST_EQUALS( gTrace[1], std::string( "+Inner" ), TEST_LOCATION );
+  DALI_TEST_EQUALS( gTrace[2], std::string( "-Inner" ), TEST_LOCATION );
+  DALI_TEST_EQUALS( gTrace[3], std::string( "-Outer" ), TEST_LOCATION );
+}
+
+static void UtcDaliTraceUninstalled()
+{
+  gTrace.clear();
+
+  Integration::Trace::Start( "Section" );
+  {
+    DALI_TRACE_SCOPE( "Scope" );
+  }
+  Integration::Trace::End( "Section" );
+
+  DALI_TEST_CHECK( gTrace.empty() );
+}
+
+static void UtcDaliTraceUpdateAndRender()
+{
+  TestApplication application;
+
+  ImageActor actor = ImageActor::New( BitmapImage::New( 10, 10 ) );
+  Stage::GetCurrent().Add( actor );
+
+  gTrace.clear();
+  Integration::Trace::InstallTraceFunction( RecordTrace );
+
+  application.SendNotification();
+  application.Render();
+
+  Integration::Trace::InstallTraceFunction( NULL );
+
+  // The update and render timers of the performance monitor are traced
+  DALI_TEST_CHECK( IsTraced( "+Update" ) );
+  DALI_TEST_CHECK( IsTraced( "-Update" ) );
+  DALI_TEST_CHECK( IsTraced( "+AnimateNodes" ) );
+  DALI_TEST_CHECK( IsTraced( "+DrawNodes" ) );
+  DALI_TEST_CHECK( IsTraced( "-DrawNodes" ) );
+}
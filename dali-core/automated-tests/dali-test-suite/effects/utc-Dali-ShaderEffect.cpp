@@ -104,6 +104,8 @@ TEST_FUNCTION( UtcDaliShaderEffectFromProperties02, NEGATIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliShaderEffectFromProperties03, NEGATIVE_TC_IDX );
 
 TEST_FUNCTION( UtcDaliShaderEffectPropertyIndices, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliShaderEffectParallelCompile, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliShaderEffectCompileWithoutParallelExtension, POSITIVE_TC_IDX );
 
 // Called only once before first test is run.
 static void Startup()
@@ -1191,3 +1193,110 @@ void UtcDaliShaderEffectPropertyIndices()
   DALI_TEST_CHECK( ! indices.empty() );
   DALI_TEST_EQUALS( indices.size(), effect.GetPropertyCount(), TEST_LOCATION );
 }
+
+static void UtcDaliShaderEffectParallelCompile()
+{
+  TestApplication application;
+  tet_infoline("Testing that actors aren't drawn while the driver is compiling their shader effect");
+
+  // Report GL_KHR_parallel_shader_compile
+  static const GLubyte extensions[] = "GL_KHR_parallel_shader_compile";
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  glAbstraction.SetGetExtensionsResult( extensions );
+  application.ResetContext();
+
+  // Call render to compile default shaders.
+  application.SendNotification();
+  application.Render();
+  application.Render();
+  application.Render();
+
+  TraceCallStack& drawTrace = glAbstraction.GetDrawTrace();
+  drawTrace.Enable( true );
+
+  // The driver is still linking the program of the effect
+  glAbstraction.SetCompletionStatus( GL_FALSE );
+
+  ShaderEffect effect = ShaderEffect::New( VertexSource, FragmentSource );
+  BitmapImage image = CreateBitmapImage();
+  ImageActor actor = ImageActor::New( image );
+  actor.SetSize( 100.0f, 100.0f );
+  actor.SetShaderEffect( effect );
+  Stage::GetCurrent().Add( actor );
+
+  application.SendNotification();
+  application.Render();
+
+  // Keeps updating until the program has linked
+  DALI_TEST_CHECK( application.Render() );
+  DALI_TEST_EQUALS( drawTrace.GetCallStack().size(), 0u, TEST_LOCATION );
+
+  // The program finishes loading after the next frame is drawn
+  glAbstraction.SetCompletionStatus( GL_TRUE );
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_CHECK( !drawTrace.FindMethod( "DrawArrays" ) );
+
+  application.Render();
+  DALI_TEST_CHECK( drawTrace.FindMethod( "DrawArrays" ) );
+}
+
+static void UtcDaliShaderEffectCompileWithoutParallelExtension()
+{
+  TestApplication application;
+  tet_infoline("Testing that without GL_KHR_parallel_shader_compile, the programs are finished after drawing, one per frame");
+
+  // The driver doesn't report GL_KHR_parallel_shader_compile
+  TestGlAbstraction& glAbstraction = application.GetGlAbstraction();
+  glAbstraction.SetGetExtensionsResult( NULL );
+  application.ResetContext();
+
+  // Call render to compile default shaders; one program is waited for per frame
+  application.SendNotification();
+  for( unsigned int i = 0u; i < 30u; ++i )
+  {
+    application.Render();
+  }
+
+  TraceCallStack& drawTrace = glAbstraction.GetDrawTrace();
+  drawTrace.Enable( true );
+
+  BitmapImage image = CreateBitmapImage();
+
+  ShaderEffect effect1 = ShaderEffect::New( VertexSource, FragmentSource );
+  ImageActor actor1 = ImageActor::New( image );
+  actor1.SetSize( 100.0f, 100.0f );
+  actor1.SetShaderEffect( effect1 );
+  Stage::GetCurrent().Add( actor1 );
+
+  ShaderEffect effect2 = ShaderEffect::New( VertexSource, FragmentSourceUsingExtensions );
+  ImageActor actor2 = ImageActor::New( image );
+  actor2.SetSize( 100.0f, 100.0f );
+  actor2.SetShaderEffect( effect2 );
+  Stage::GetCurrent().Add( actor2 );
+
+  // None of the programs is waited for before the frame is drawn
+  application.SendNotification();
+  DALI_TEST_CHECK( application.Render() );
+  DALI_TEST_EQUALS( drawTrace.GetCallStack().size(), 0u, TEST_LOCATION );
+
+  // One program is finished after each frame, oldest first
+  unsigned int frames = 1u;
+  while( drawTrace.GetCallStack().empty() && frames < 30u )
+  {
+    application.Render();
+    ++frames;
+  }
+  DALI_TEST_EQUALS( drawTrace.GetCallStack().size(), 1u, TEST_LOCATION );
+  const unsigned int firstEffectFrames = frames;
+  DALI_TEST_CHECK( firstEffectFrames > 1u );
+
+  while( drawTrace.GetCallStack().size() < 2u && frames < 60u )
+  {
+    drawTrace.Reset();
+    application.Render();
+    ++frames;
+  }
+  DALI_TEST_EQUALS( drawTrace.GetCallStack().size(), 2u, TEST_LOCATION );
+  DALI_TEST_CHECK( frames > firstEffectFrames );
+}
@@ -15,6 +15,7 @@
 //
 
 #include <iostream>
+#include <algorithm>
 
 #include <stdlib.h>
 #include <tet_api.h>
@@ -83,6 +84,7 @@ TEST_FUNCTION( UtcDaliPanGestureDirectionProcessing, POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliPanGestureSetProperties, POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliPanGestureSetPropertiesAlreadyPanning, NEGATIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliPanGesturePropertyIndices, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliPanGesturePredictionReplay, POSITIVE_TC_IDX );
 
 // Called only once before first test is run.
 static void Startup()
@@ -268,6 +270,139 @@ PanGesture GeneratePan( unsigned int time,
   return pan;
 }
 
+// A recorded flick: the time (in milliseconds) and screen position of each touch, decelerating
+struct PanTraceSample
+{
+  unsigned int time;
+  float x;
+  float y;
+};
+
+const PanTraceSample PAN_TRACE[] =
+{
+  {   0u,   30.0f,  200.0f },
+  {   8u,   41.1f,  202.4f },
+  {  16u,   51.8f,  204.7f },
+  {  25u,   63.6f,  207.2f },
+  {  32u,   72.5f,  209.2f },
+  {  39u,   81.3f,  211.1f },
+  {  46u,   89.7f,  213.0f },
+  {  54u,   99.2f,  215.0f },
+  {  61u,  107.2f,  216.8f },
+  {  69u,  116.1f,  218.8f },
+  {  76u,  123.7f,  220.5f },
+  {  83u,  131.0f,  222.1f },
+  {  92u,  140.2f,  224.2f },
+  { 101u,  149.0f,  226.2f },
+  { 108u,  155.5f,  227.7f },
+  { 116u,  162.8f,  229.4f },
+  { 123u,  168.9f,  230.8f },
+  { 132u,  176.5f,  232.6f },
+  { 139u,  182.1f,  234.0f },
+  { 146u,  187.5f,  235.3f },
+  { 154u,  193.4f,  236.7f },
+  { 161u,  198.4f,  237.9f },
+  { 170u,  204.4f,  239.4f },
+  { 177u,  208.9f,  240.6f },
+  { 185u,  213.7f,  241.8f },
+  { 192u,  217.7f,  242.9f },
+  { 200u,  222.0f,  244.0f },
+  { 208u,  226.0f,  245.1f },
+  { 217u,  230.2f,  246.3f },
+  { 225u,  233.6f,  247.2f },
+  { 232u,  236.4f,  248.1f },
+  { 240u,  239.3f,  249.0f },
+  { 248u,  241.9f,  249.8f }
+};
+const unsigned int PAN_TRACE_SIZE( sizeof( PAN_TRACE ) / sizeof( PAN_TRACE[0] ) );
+
+// Where the touch was at the given time, interpolated between the samples of the trace
+Vector2 GetPanTracePosition( unsigned int time )
+{
+  unsigned int next( 1u );
+  while( ( next < PAN_TRACE_SIZE - 1u ) && ( PAN_TRACE[next].time < time ) )
+  {
+    ++next;
+  }
+
+  const PanTraceSample& from( PAN_TRACE[next - 1u] );
+  const PanTraceSample& to( PAN_TRACE[next] );
+  const float progress( std::min( static_cast<float>( time - from.time ) / ( to.time - from.time ), 1.0f ) );
+
+  return Vector2( from.x + ( to.x - from.x ) * progress, from.y + ( to.y - from.y ) * progress );
+}
+
+// Replays PAN_TRACE through the update, rendering every 16 milliseconds, and returns the mean distance between
+// the screen position given to constraints and the position of the touch when each frame is rendered
+float ReplayPanTrace( int predictionMode )
+{
+  TestApplication application;
+  application.GetCore().SetPanGesturePredictionMode( predictionMode );
+
+  Actor actor = Actor::New();
+  actor.SetSize(100.0f, 100.0f);
+  actor.SetAnchorPoint(AnchorPoint::TOP_LEFT);
+  Stage::GetCurrent().Add(actor);
+
+  PanGestureDetector detector = PanGestureDetector::New();
+  detector.Attach( actor );
+
+  Property::Index property = actor.RegisterProperty( "Dummy Property", Vector3::ZERO );
+
+  ConstraintData constraintData;
+  actor.ApplyConstraint( Constraint::New<Vector3>( property, Source( detector, PanGestureDetector::SCREEN_POSITION ),
+                                                             Source( detector, PanGestureDetector::SCREEN_DISPLACEMENT ),
+                                                             Source( detector, PanGestureDetector::LOCAL_POSITION ),
+                                                             Source( detector, PanGestureDetector::LOCAL_DISPLACEMENT ),
+                                                             PanConstraint( constraintData ) ) );
+
+  application.SendNotification();
+  application.Render();
+
+  unsigned int seconds( 0u ), microseconds( 0u );
+  application.GetPlatform().GetTimeMicroseconds( seconds, microseconds );
+  const unsigned int startTime( seconds * 1000u + microseconds / 1000u );
+
+  const unsigned int frameInterval( 16u );
+  float totalError( 0.0f );
+  unsigned int frames( 0u );
+  unsigned int sample( 0u );
+  Vector2 previousPosition;
+  Vector2 totalDisplacement;
+
+  for( unsigned int updateTime = frameInterval; sample < PAN_TRACE_SIZE; updateTime += frameInterval )
+  {
+    // The touches received before the update
+    for( ; ( sample < PAN_TRACE_SIZE ) && ( PAN_TRACE[sample].time <= updateTime ); ++sample )
+    {
+      const Vector2 position( PAN_TRACE[sample].x, PAN_TRACE[sample].y );
+      const Gesture::State state( sample == 0u ? Gesture::Started : Gesture::Continuing );
+      const Vector2 displacement( sample == 0u ? Vector2::ZERO : position - previousPosition );
+      const Vector2 velocity( sample == 0u ? Vector2( 1.4f, 0.3f ) : displacement / static_cast<float>( PAN_TRACE[sample].time - PAN_TRACE[sample - 1u].time ) );
+
+      PanGestureDetector::SetPanGestureProperties( GeneratePan( startTime + PAN_TRACE[sample].time, state, position, position, displacement, displacement, velocity ) );
+      previousPosition = position;
+    }
+
+    application.SendNotification();
+    application.Render( frameInterval );
+
+    totalDisplacement += constraintData.screenDisplacement;
+
+    // The displacements add up to the position, unless it is averaged
+    if( predictionMode != 1 )
+    {
+      DALI_TEST_EQUALS( constraintData.screenPosition - totalDisplacement, Vector2( 30.0f, 200.0f ), 0.01f, TEST_LOCATION );
+    }
+
+    // The frame is rendered one frame interval after the update
+    totalError += ( constraintData.screenPosition - GetPanTracePosition( updateTime + frameInterval ) ).Length();
+    ++frames;
+  }
+
+  return totalError / frames;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 
 // Positive test case for a method
@@ -2053,3 +2188,19 @@ void UtcDaliPanGesturePropertyIndices()
   DALI_TEST_CHECK( ! indices.empty() );
   DALI_TEST_EQUALS( indices.size(), detector.GetPropertyCount(), TEST_LOCATION );
 }
+
+void UtcDaliPanGesturePredictionReplay()
+{
+  const float latestError( ReplayPanTrace( 0 ) );
+  const float averageError( ReplayPanTrace( 1 ) );
+  const float predictedError( ReplayPanTrace( 2 ) );
+
+  tet_printf( "Mean pan position error: latest %f, average %f, predicted %f\n", latestError, averageError, predictedError );
+
+  // Blending with the previous gesture lags further behind the touch
+  DALI_TEST_CHECK( averageError > latestError );
+
+  // Extrapolating to the render time follows the touch closely
+  DALI_TEST_CHECK( predictedError < latestError * 0.5f );
+  DALI_TEST_CHECK( predictedError < 3.0f );
+}
@@ -16,8 +16,12 @@
 
 #include <iostream>
 #include <algorithm>
+#include <vector>
 
+#include <math.h>
 #include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
 #include <tet_api.h>
 
 #include <dali/public-api/dali-core.h>
@@ -36,6 +40,9 @@ extern "C" {
 }
 
 static void UtcDaliGenerateDistanceField();
+static void UtcDaliGenerateDistanceFieldParityGlyphs();
+static void UtcDaliGenerateDistanceFieldParityLargeImage();
+static void UtcDaliGenerateDistanceFieldBenchmark();
 
 enum {
   POSITIVE_TC_IDX = 0x01,
@@ -48,6 +55,9 @@ static const float ROTATION_EPSILON = 0.0001f;
 extern "C" {
   struct tet_testlist tet_testlist[] = {
     { UtcDaliGenerateDistanceField, POSITIVE_TC_IDX },
+    { UtcDaliGenerateDistanceFieldParityGlyphs, POSITIVE_TC_IDX },
+    { UtcDaliGenerateDistanceFieldParityLargeImage, POSITIVE_TC_IDX },
+    { UtcDaliGenerateDistanceFieldBenchmark, POSITIVE_TC_IDX },
     { NULL, 0 }
   };
 }
@@ -95,3 +105,366 @@ static void UtcDaliGenerateDistanceField()
     tet_result(TET_FAIL);
   }
 }
+
+namespace
+{
+
+/**
+ * The scalar, single-threaded implementation GenerateDistanceFieldMap() must match bit for bit.
+ */
+namespace Reference
+{
+
+float Interpolate( float a, float b, float factor )
+{
+  return a * (1.0f - factor) + b * factor;
+}
+
+float Bilinear( float a, float b, float c, float d, float dx, float dy )
+{
+  return Interpolate( Interpolate( a, b, dx), Interpolate( c, d, dx ), dy );
+}
+
+void ScaleField( int width, int height, float* in, int targetWidth, int targetHeight, float* out )
+{
+  float xScale = static_cast< float >(width) / targetWidth;
+  float yScale = static_cast< float >(height) / targetHeight;
+
+  for(int y = 0; y < targetHeight; ++y)
+  {
+    const int sampleY = static_cast< int >( yScale * y );
+    const int otherY = std::min( sampleY + 1, height - 1 );
+    const float dy = (yScale * y ) - sampleY;
+
+    for (int x = 0; x < targetWidth; ++x)
+    {
+      const int sampleX = static_cast< int >( xScale * x );
+      const int otherX = std::min( sampleX + 1, width - 1 );
+      const float dx = (xScale * x) - sampleX;
+
+      float value = Bilinear( in[ sampleY * width + sampleX ],
+                              in[ sampleY * width + otherX ],
+                              in[ otherY * width + sampleX ],
+                              in[ otherY * width + otherX ],
+                              dx, dy );
+
+      out[y * targetWidth + x] = std::min( value, 1.0f );
+    }
+  }
+}
+
+#define SQUARE(a) ((a) * (a))
+const float MAX_DISTANCE( 1e20 );
+
+void DistanceTransform( float *source, float* dest, unsigned int length )
+{
+  std::vector<int> parabolas( length );
+  std::vector<float> edge( length + 1 );
+  int rightmost(0);
+
+  parabolas[0] = 0;
+  edge[0] = -MAX_DISTANCE;
+  edge[1] = +MAX_DISTANCE;
+  for( unsigned int i = 1; i <= length - 1; i++ )
+  {
+    const float initialDistance( source[i] + SQUARE( i ) );
+    int parabola = parabolas[rightmost];
+    float newDistance( (initialDistance - (source[parabola] + SQUARE( parabola ))) / (2 * i - 2 * parabola) );
+    while( newDistance <= edge[rightmost] )
+    {
+      rightmost--;
+      parabola = parabolas[rightmost];
+      newDistance = (initialDistance - (source[parabola] + SQUARE( parabola ))) / (2 * i - 2 * parabola);
+    }
+
+    rightmost++;
+    parabolas[rightmost] = i;
+    edge[rightmost] = newDistance;
+    edge[rightmost + 1] = MAX_DISTANCE;
+  }
+
+  rightmost = 0;
+  for( unsigned int i = 0; i <= length - 1; ++i )
+  {
+    while( edge[rightmost + 1] < i )
+    {
+      ++rightmost;
+    }
+    dest[i] = SQUARE( i - parabolas[rightmost] ) + source[parabolas[rightmost]];
+  }
+}
+
+void DistanceTransform( float* data, unsigned int width, unsigned int height, float* sourceBuffer, float* destBuffer )
+{
+  for( unsigned int x = 0; x < width; ++x )
+  {
+    for( unsigned int y = 0; y < height; ++y )
+    {
+      sourceBuffer[y] = data[ y * width + x ];
+    }
+
+    DistanceTransform( sourceBuffer, destBuffer, height );
+
+    for( unsigned int y = 0; y < height; y++ )
+    {
+      data[y * width + x] = destBuffer[y];
+    }
+  }
+
+  for( unsigned int y = 0; y < height; ++y )
+  {
+    for( unsigned int x = 0; x < width; ++x )
+    {
+      sourceBuffer[x] = data[ y * width + x ];
+    }
+
+    DistanceTransform( sourceBuffer, destBuffer, width );
+
+    for( unsigned int x = 0; x < width; x++ )
+    {
+      data[y * width + x] = destBuffer[x];
+    }
+  }
+}
+
+void GenerateDistanceFieldMap(const unsigned char* const imagePixels, const Vector2& imageSize,
+                              unsigned char* const distanceMap, const Vector2& distanceMapSize,
+                              const unsigned int fieldBorder,
+                              const Vector2& maxSize,
+                              bool highQuality)
+{
+  const int originalWidth( static_cast<int>(imageSize.width) );
+  const int originalHeight( static_cast<int>(imageSize.height) );
+  const int paddedWidth( originalWidth + (fieldBorder * 2 ) );
+  const int paddedHeight( originalHeight + (fieldBorder * 2 ) );
+  const int scaledWidth( static_cast<int>(distanceMapSize.width) );
+  const int scaledHeight( static_cast<int>(distanceMapSize.height) );
+  const int maxWidth( static_cast<int>(maxSize.width) + (fieldBorder * 2 ));
+  const int maxHeight( static_cast<int>(maxSize.height) + (fieldBorder * 2 ) );
+
+  const int bufferLength( std::max( maxWidth, std::max(paddedWidth, scaledWidth) ) *
+                          std::max( maxHeight, std::max(paddedHeight, scaledHeight) ) );
+
+  std::vector<float> outsidePixels( bufferLength, 0.0f );
+  std::vector<float> insidePixels( bufferLength, 0.0f );
+
+  float* outside( &outsidePixels[0] );
+  float* inside( &insidePixels[0] );
+
+  for( int y = 0; y < paddedHeight; ++y )
+  {
+    for ( int x = 0; x < paddedWidth; ++x)
+    {
+      if( y < (int)fieldBorder || y >= (paddedHeight - (int)fieldBorder) ||
+          x < (int)fieldBorder || x >= (paddedWidth - (int)fieldBorder) )
+      {
+        outside[ y * paddedWidth + x ] = MAX_DISTANCE;
+        inside[ y * paddedWidth + x ] = 0.0f;
+      }
+      else
+      {
+        unsigned int pixel( imagePixels[ (y - fieldBorder) * originalWidth + (x - fieldBorder) ] );
+        outside[ y * paddedWidth + x ] = (pixel == 0) ? MAX_DISTANCE : SQUARE((255 - pixel) / 255.0f);
+        inside[ y * paddedWidth + x ] = (pixel == 255) ? MAX_DISTANCE : SQUARE(pixel / 255.0f);
+      }
+    }
+  }
+
+  if( highQuality )
+  {
+    const int tempBufferLength( std::max(paddedWidth, paddedHeight) );
+    std::vector<float> tempSourceBuffer( tempBufferLength, 0.0f );
+    std::vector<float> tempDestBuffer( tempBufferLength, 0.0f );
+
+    DistanceTransform( outside, paddedWidth, paddedHeight, &tempSourceBuffer[0], &tempDestBuffer[0] );
+    DistanceTransform( inside, paddedWidth, paddedHeight, &tempSourceBuffer[0], &tempDestBuffer[0] );
+  }
+
+  for( int y = 0; y < paddedHeight; ++y)
+  {
+    for( int x = 0; x < paddedWidth; ++x )
+    {
+      const int offset( y * paddedWidth + x );
+      float pixel( sqrtf(outside[offset]) - sqrtf(inside[offset]) );
+      pixel = 128.0f + pixel * 16.0f;
+      pixel = Clamp( pixel, 0.0f, 255.0f );
+      outside[offset] = (255.0f - pixel) / 255.0f;
+    }
+  }
+
+  ScaleField( paddedWidth, paddedHeight, outside, scaledWidth, scaledHeight, inside );
+
+  for( int y = 0; y < scaledHeight; ++y )
+  {
+    for( int x = 0; x < scaledWidth; ++x )
+    {
+      float pixel( inside[ y * scaledWidth + x ] );
+      distanceMap[y * scaledWidth + x ] = static_cast< unsigned char >(pixel * 255.0f);
+    }
+  }
+}
+
+#undef SQUARE
+
+} // namespace Reference
+
+/**
+ * Draws a glyph-like image: a few anti-aliased discs and strokes.
+ */
+void CreateGlyphImage( std::vector<unsigned char>& image, unsigned int width, unsigned int height, unsigned int seed )
+{
+  srand( seed );
+  image.assign( width * height, 0u );
+
+  const unsigned int numberOfShapes( 1u + rand() % 4u );
+  for( unsigned int shape = 0; shape < numberOfShapes; ++shape )
+  {
+    const float centreX( rand() % width );
+    const float centreY( rand() % height );
+    const float radius( 1.0f + rand() % std::max( 1u, std::min( width, height ) / 2u ) );
+    const float thickness( ( rand() % 2 ) ? radius : 1.0f + rand() % 3 );
+
+    for( unsigned int y = 0; y < height; ++y )
+    {
+      for( unsigned int x = 0; x < width; ++x )
+      {
+        const float distance( sqrtf( ( x - centreX ) * ( x - centreX ) + ( y - centreY ) * ( y - centreY ) ) );
+        const float coverage( Clamp( std::min( radius - distance, distance - ( radius - thickness ) ) + 0.5f, 0.0f, 1.0f ) );
+        unsigned char& pixel( image[ y * width + x ] );
+        pixel = std::max( pixel, static_cast<unsigned char>( coverage * 255.0f ) );
+      }
+    }
+  }
+}
+
+/**
+ * Generates the distance field with both implementations and compares them.
+ * @return The number of different bytes.
+ */
+unsigned int CompareWithReference( const std::vector<unsigned char>& image, const Vector2& imageSize, const Vector2& fieldSize,
+                                   unsigned int fieldBorder, const Vector2& maxSize, bool highQuality )
+{
+  const unsigned int length( static_cast<unsigned int>( fieldSize.width * fieldSize.height ) );
+  std::vector<unsigned char> expected( length, 0u );
+  std::vector<unsigned char> result( length, 1u );
+
+  Reference::GenerateDistanceFieldMap( &image[0], imageSize, &expected[0], fieldSize, fieldBorder, maxSize, highQuality );
+  GenerateDistanceFieldMap( &image[0], imageSize, &result[0], fieldSize, fieldBorder, maxSize, highQuality );
+
+  unsigned int differences( 0u );
+  for( unsigned int i = 0; i < length; ++i )
+  {
+    if( expected[i] != result[i] )
+    {
+      ++differences;
+    }
+  }
+  return differences;
+}
+
+double GetMilliseconds()
+{
+  timeval time;
+  gettimeofday( &time, NULL );
+  return time.tv_sec * 1000.0 + time.tv_usec / 1000.0;
+}
+
+} // unnamed namespace
+
+static void UtcDaliGenerateDistanceFieldParityGlyphs()
+{
+  tet_infoline("Testing Dali::GenerateDistanceFieldMap matches the scalar implementation for glyph sized images");
+
+  const unsigned int sizes[][2] = { { 1, 1 }, { 3, 7 }, { 8, 8 }, { 17, 23 }, { 32, 32 }, { 41, 64 }, { 64, 48 }, { 64, 64 } };
+  const unsigned int borders[] = { 0, 2, 4 };
+
+  unsigned int seed( 0u );
+  for( unsigned int s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s )
+  {
+    const unsigned int width( sizes[s][0] );
+    const unsigned int height( sizes[s][1] );
+
+    for( unsigned int b = 0; b < sizeof(borders) / sizeof(borders[0]); ++b )
+    {
+      std::vector<unsigned char> image;
+      CreateGlyphImage( image, width, height, ++seed );
+
+      const Vector2 imageSize( width, height );
+      const Vector2 maxSize( width + 3, height + 3 );
+
+      DALI_TEST_EQUALS( CompareWithReference( image, imageSize, Vector2( 32, 32 ), borders[b], maxSize, true ), 0u, TEST_LOCATION );
+      DALI_TEST_EQUALS( CompareWithReference( image, imageSize, Vector2( 32, 32 ), borders[b], maxSize, false ), 0u, TEST_LOCATION );
+      DALI_TEST_EQUALS( CompareWithReference( image, imageSize, Vector2( width, height ), borders[b], imageSize, true ), 0u, TEST_LOCATION );
+    }
+  }
+
+  // Images without edges
+  const Vector2 imageSize( 16, 16 );
+  std::vector<unsigned char> image( 16 * 16, 0u );
+  DALI_TEST_EQUALS( CompareWithReference( image, imageSize, imageSize, 2, imageSize, true ), 0u, TEST_LOCATION );
+  image.assign( 16 * 16, 255u );
+  DALI_TEST_EQUALS( CompareWithReference( image, imageSize, imageSize, 2, imageSize, true ), 0u, TEST_LOCATION );
+
+  // Noise
+  srand( 1234u );
+  for( unsigned int i = 0; i < image.size(); ++i )
+  {
+    image[i] = rand() % 256;
+  }
+  DALI_TEST_EQUALS( CompareWithReference( image, imageSize, Vector2( 8, 8 ), 1, imageSize, true ), 0u, TEST_LOCATION );
+
+  tet_result(TET_PASS);
+}
+
+static void UtcDaliGenerateDistanceFieldParityLargeImage()
+{
+  tet_infoline("Testing Dali::GenerateDistanceFieldMap matches the scalar implementation for images large enough to be transformed by several threads");
+
+  const unsigned int width( 300 );
+  const unsigned int height( 257 );
+  std::vector<unsigned char> image;
+  CreateGlyphImage( image, width, height, 42u );
+
+  const Vector2 imageSize( width, height );
+  DALI_TEST_EQUALS( CompareWithReference( image, imageSize, imageSize, 8, imageSize, true ), 0u, TEST_LOCATION );
+  DALI_TEST_EQUALS( CompareWithReference( image, imageSize, Vector2( 64, 64 ), 4, imageSize, true ), 0u, TEST_LOCATION );
+
+  tet_result(TET_PASS);
+}
+
+static void UtcDaliGenerateDistanceFieldBenchmark()
+{
+  tet_infoline("Benchmark Dali::GenerateDistanceFieldMap against the scalar implementation for typical glyph sizes");
+
+  const unsigned int ITERATIONS( 200u );
+  const unsigned int sizes[] = { 16, 32, 48, 64, 128 };
+
+  for( unsigned int s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s )
+  {
+    const unsigned int size( sizes[s] );
+    const Vector2 imageSize( size, size );
+    const Vector2 fieldSize( 32, 32 );
+
+    std::vector<unsigned char> image;
+    CreateGlyphImage( image, size, size, size );
+    std::vector<unsigned char> field( 32 * 32 );
+
+    double start( GetMilliseconds() );
+    for( unsigned int i = 0; i < ITERATIONS; ++i )
+    {
+      Reference::GenerateDistanceFieldMap( &image[0], imageSize, &field[0], fieldSize, 4, imageSize, true );
+    }
+    const double referenceTime( GetMilliseconds() - start );
+
+    start = GetMilliseconds();
+    for( unsigned int i = 0; i < ITERATIONS; ++i )
+    {
+      GenerateDistanceFieldMap( &image[0], imageSize, &field[0], fieldSize, 4, imageSize, true );
+    }
+    const double time( GetMilliseconds() - start );
+
+    tet_printf( "%ux%u glyph: scalar %.3f ms, current %.3f ms per distance field\n", size, size, referenceTime / ITERATIONS, time / ITERATIONS );
+  }
+
+  tet_result(TET_PASS);
+}
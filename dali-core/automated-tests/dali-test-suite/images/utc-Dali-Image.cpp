@@ -74,6 +74,8 @@ TEST_FUNCTION( UtcDaliImageSignalUploaded,                 POSITIVE_TC_IDX ); //
 TEST_FUNCTION( UtcDaliImageDiscard01,                      POSITIVE_TC_IDX ); // 24
 TEST_FUNCTION( UtcDaliImageDiscard02,                      POSITIVE_TC_IDX ); // 25
 TEST_FUNCTION( UtcDaliImageDiscard03,                      POSITIVE_TC_IDX ); // 26
+TEST_FUNCTION( UtcDaliImageLoadPriority,                   POSITIVE_TC_IDX ); // 27
+TEST_FUNCTION( UtcDaliImageProgressiveLoad,                POSITIVE_TC_IDX ); // 28
 
 
 // Called only once before first test is run.
@@ -1117,3 +1119,110 @@ static void UtcDaliImageDiscard03()
 
   // Test what?!
 }
+
+// 1.27
+static void UtcDaliImageLoadPriority()
+{
+  TestApplication application;
+  tet_infoline("UtcDaliImageLoadPriority - images needed by on-stage actors are loaded with a higher priority");
+
+  // An immediately loaded image is prefetched at the normal priority
+  Image immediateImage = Image::New(gTestImageFilename, Image::Immediate, Image::Never);
+
+  application.SendNotification();
+  application.Render(16);
+
+  DALI_TEST_CHECK( application.GetPlatform().WasCalled(TestPlatformAbstraction::LoadResourceFunc) );
+  Integration::ResourceRequest* request = application.GetPlatform().GetRequest();
+  DALI_TEST_CHECK( request );
+  if( request )
+  {
+    DALI_TEST_EQUALS( request->GetPriority(), Integration::LoadPriorityNormal, TEST_LOCATION );
+  }
+
+  // An image loaded on demand is only requested once it is needed on stage
+  application.GetPlatform().ResetTrace();
+  Image onDemandImage = Image::New("on-demand.png", Image::OnDemand, Image::Never);
+  ImageActor actor = ImageActor::New(onDemandImage);
+  Stage::GetCurrent().Add(actor);
+
+  application.SendNotification();
+  application.Render(16);
+
+  DALI_TEST_CHECK( application.GetPlatform().WasCalled(TestPlatformAbstraction::LoadResourceFunc) );
+  request = application.GetPlatform().GetRequest();
+  DALI_TEST_CHECK( request );
+  if( request )
+  {
+    DALI_TEST_EQUALS( request->GetPath(), std::string("on-demand.png"), TEST_LOCATION );
+    DALI_TEST_EQUALS( request->GetPriority(), Integration::LoadPriorityHigh, TEST_LOCATION );
+  }
+}
+
+// 1.28
+static void UtcDaliImageProgressiveLoad()
+{
+  TestApplication application;
+  tet_infoline("UtcDaliImageProgressiveLoad - a low resolution version of an image is drawn until the whole image has loaded");
+
+  Vector2 testSize(80.0f, 80.0f);
+  application.GetPlatform().SetClosestImageSize(testSize);
+
+  ImageAttributes attributes;
+  attributes.SetProgressiveLoading( true );
+  Image image = Image::New( gTestImageFilename, attributes );
+  image.LoadingFinishedSignal().Connect( SignalLoadHandler );
+  SignalLoadFlag = false;
+
+  ImageActor actor = ImageActor::New( image );
+  actor.SetSize( 80, 80 );
+  Stage::GetCurrent().Add( actor );
+
+  TraceCallStack& drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable( true );
+
+  application.SendNotification();
+  application.Render(16);
+  application.SendNotification();
+  application.Render(16);
+
+  // Nothing to draw yet
+  DALI_TEST_EQUALS( drawTrace.GetCallStack().size(), 0u, TEST_LOCATION );
+
+  Integration::ResourceRequest* request = application.GetPlatform().GetRequest();
+  DALI_TEST_CHECK( request );
+  if( request )
+  {
+    Integration::Bitmap* preview = Integration::Bitmap::New( Integration::Bitmap::BITMAP_2D_PACKED_PIXELS, true );
+    preview->GetPackedPixelsProfile()->ReserveBuffer( Pixel::RGBA8888, 10, 10, 10, 10 );
+    application.GetPlatform().SetResourcePartiallyLoaded( request->GetId(), request->GetType()->id, Integration::ResourcePointer( preview ) );
+  }
+
+  application.Render(16);
+  application.GetPlatform().ClearReadyResources();
+  application.SendNotification();
+  application.Render(16);
+  application.SendNotification();
+
+  // The preview is drawn, but the image hasn't finished loading and its size isn't taken from the preview
+  DALI_TEST_CHECK( drawTrace.GetCallStack().size() > 0u );
+  DALI_TEST_CHECK( SignalLoadFlag == false );
+  DALI_TEST_CHECK( image.GetWidth() != 10u );
+  DALI_TEST_CHECK( image.GetHeight() != 10u );
+
+  if( request )
+  {
+    Integration::Bitmap* bitmap = Integration::Bitmap::New( Integration::Bitmap::BITMAP_2D_PACKED_PIXELS, true );
+    bitmap->GetPackedPixelsProfile()->ReserveBuffer( Pixel::RGBA8888, 80, 80, 80, 80 );
+    application.GetPlatform().SetResourceLoaded( request->GetId(), request->GetType()->id, Integration::ResourcePointer( bitmap ) );
+  }
+
+  application.Render(16);
+  application.SendNotification();
+  application.Render(16);
+  application.SendNotification();
+
+  DALI_TEST_CHECK( SignalLoadFlag == true );
+  DALI_TEST_EQUALS( image.GetWidth(), 80u, TEST_LOCATION );
+  DALI_TEST_EQUALS( image.GetHeight(), 80u, TEST_LOCATION );
+}
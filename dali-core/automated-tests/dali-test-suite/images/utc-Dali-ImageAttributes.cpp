@@ -39,6 +39,7 @@ static void UtcDaliImageAttributesConstructor();
 static void UtcDaliImageAttributesLessThan();
 static void UtcDaliImageAttributesEquality();
 static void UtcDaliImageAttributesInEquality();
+static void UtcDaliImageAttributesProgressiveLoading();
 
 enum {
   POSITIVE_TC_IDX = 0x01,
@@ -54,6 +55,7 @@ extern "C" {
     { UtcDaliImageAttributesLessThan,     POSITIVE_TC_IDX },
     { UtcDaliImageAttributesEquality,     POSITIVE_TC_IDX },
     { UtcDaliImageAttributesInEquality,   POSITIVE_TC_IDX },
+    { UtcDaliImageAttributesProgressiveLoading, POSITIVE_TC_IDX },
     { NULL, 0 }
   };
 }
@@ -142,4 +144,27 @@ static void UtcDaliImageAttributesInEquality()
   DALI_TEST_CHECK((imageAttributes02 != imageAttributes01) == false);
 }
 
+static void UtcDaliImageAttributesProgressiveLoading()
+{
+  TestApplication application;
+
+  tet_infoline("UtcDaliImageAttributesProgressiveLoading");
 
+  ImageAttributes imageAttributes;
+  DALI_TEST_CHECK( !imageAttributes.GetProgressiveLoading() );
+
+  ImageAttributes progressiveAttributes;
+  progressiveAttributes.SetProgressiveLoading( true );
+  DALI_TEST_CHECK( progressiveAttributes.GetProgressiveLoading() );
+
+  // Copies keep the hint
+  ImageAttributes copy( progressiveAttributes );
+  DALI_TEST_CHECK( copy.GetProgressiveLoading() );
+  copy = imageAttributes;
+  DALI_TEST_CHECK( !copy.GetProgressiveLoading() );
+
+  // It's a loading hint, so it doesn't distinguish attributes
+  DALI_TEST_CHECK( imageAttributes == progressiveAttributes );
+  DALI_TEST_CHECK( !( imageAttributes < progressiveAttributes ) );
+  DALI_TEST_CHECK( !( progressiveAttributes < imageAttributes ) );
+}
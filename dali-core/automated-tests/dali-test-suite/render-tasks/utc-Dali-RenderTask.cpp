@@ -97,6 +97,8 @@ TEST_FUNCTION( UtcDaliRenderTaskOnceNoSync07,                       POSITIVE_TC_
 TEST_FUNCTION( UtcDaliRenderTaskOnceNoSync08,                       POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliRenderTaskOnceChain01,                        POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliRenderTaskProperties,                         POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliRenderTaskViewFrustumCulling,                 POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliRenderTaskPartialUpdate,                      POSITIVE_TC_IDX );
 
 // TODO - work out how to reload images in test harness
 
@@ -2770,3 +2772,126 @@ void UtcDaliRenderTaskProperties()
   DALI_TEST_CHECK( ! indices.empty() );
   DALI_TEST_EQUALS( indices.size(), task.GetPropertyCount(), TEST_LOCATION );
 }
+
+void UtcDaliRenderTaskViewFrustumCulling()
+{
+  TestApplication application;
+
+  tet_infoline("Testing that actors outside the view-frustum of the camera are not drawn");
+
+  TraceCallStack& drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable(true);
+
+  // Use separate images, so that the actors are not batched together
+  ImageActor onStageActor = ImageActor::New( BitmapImage::New( 10, 10 ) );
+  onStageActor.SetSize( 80, 80 );
+  Stage::GetCurrent().Add( onStageActor );
+
+  ImageActor offScreenActor = ImageActor::New( BitmapImage::New( 10, 10 ) );
+  offScreenActor.SetSize( 80, 80 );
+  offScreenActor.SetPosition( 10000.0f, 0.0f );
+  Stage::GetCurrent().Add( offScreenActor );
+
+  application.SendNotification();
+  application.Render();
+  application.Render();
+
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( drawTrace.GetCallStack().size(), 1u, TEST_LOCATION );
+
+  // Partially inside the frustum; should be drawn
+  const Vector2& stageSize = Stage::GetCurrent().GetSize();
+  offScreenActor.SetPosition( stageSize.width * 0.5f + 30.0f, 0.0f );
+  application.SendNotification();
+  application.Render();
+
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( drawTrace.GetCallStack().size(), 2u, TEST_LOCATION );
+
+  // Behind the camera
+  offScreenActor.SetPosition( 0.0f, 0.0f, 10000.0f );
+  application.SendNotification();
+  application.Render();
+
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( drawTrace.GetCallStack().size(), 1u, TEST_LOCATION );
+}
+
+void UtcDaliRenderTaskPartialUpdate()
+{
+  TestApplication application;
+
+  tet_infoline("Testing that only the area which changed is redrawn, when the back buffer is kept");
+
+  TraceCallStack& drawTrace = application.GetGlAbstraction().GetDrawTrace();
+  drawTrace.Enable(true);
+
+  ImageActor actor = ImageActor::New( BitmapImage::New( 10, 10 ) );
+  actor.SetParentOrigin( ParentOrigin::CENTER );
+  actor.SetSize( Vector3( 80.0f, 80.0f, 0.0f ) );
+  Stage::GetCurrent().Add( actor );
+
+  // The contents of the back buffer are undefined by default; everything is redrawn
+  application.SendNotification();
+  application.Render();
+  application.Render();
+  application.Render();
+  DALI_TEST_CHECK( application.GetRenderStatus().HasRendered() );
+  DALI_TEST_CHECK( application.GetRenderStatus().GetDamagedArea().IsEmpty() );
+
+  // Nothing changed since the frame in the back buffer
+  application.GetCore().SetBackBufferAge( 1u );
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( drawTrace.GetCallStack().size(), 0u, TEST_LOCATION );
+  DALI_TEST_CHECK( !application.GetRenderStatus().HasRendered() );
+
+  // The previous and the current area of the actor are redrawn
+  actor.SetPosition( 100.0f, 0.0f );
+  drawTrace.Reset();
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_EQUALS( drawTrace.GetCallStack().size(), 1u, TEST_LOCATION );
+  DALI_TEST_CHECK( application.GetRenderStatus().HasRendered() );
+
+  const Vector2& stageSize = Stage::GetCurrent().GetSize();
+  const Rect<int> damagedArea = application.GetRenderStatus().GetDamagedArea();
+  const float left = stageSize.width * 0.5f - 40.0f;
+  const float bottom = stageSize.height * 0.5f - 40.0f;
+  DALI_TEST_EQUALS( static_cast<float>( damagedArea.x ), left, 2.0f, TEST_LOCATION );
+  DALI_TEST_EQUALS( static_cast<float>( damagedArea.y ), bottom, 2.0f, TEST_LOCATION );
+  DALI_TEST_EQUALS( static_cast<float>( damagedArea.width ), 180.0f, 4.0f, TEST_LOCATION );
+  DALI_TEST_EQUALS( static_cast<float>( damagedArea.height ), 80.0f, 4.0f, TEST_LOCATION );
+  DALI_TEST_CHECK( application.GetGlAbstraction().GetLastScissor() == damagedArea );
+
+  application.SendNotification();
+  application.Render();
+  drawTrace.Reset();
+  application.Render();
+  DALI_TEST_EQUALS( drawTrace.GetCallStack().size(), 0u, TEST_LOCATION );
+
+  // A back buffer two frames old is missing the previous change too
+  actor.SetColor( Color::RED );
+  application.SendNotification();
+  application.Render();
+  application.GetCore().SetBackBufferAge( 2u );
+  drawTrace.Reset();
+  application.Render();
+  DALI_TEST_EQUALS( drawTrace.GetCallStack().size(), 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( static_cast<float>( application.GetRenderStatus().GetDamagedArea().width ), 80.0f, 4.0f, TEST_LOCATION );
+
+  // Everything is redrawn when the camera moves
+  application.GetCore().SetBackBufferAge( 1u );
+  Stage::GetCurrent().GetRenderTaskList().GetTask( 0u ).GetCameraActor().SetPosition( 10.0f, 0.0f, 800.0f );
+  application.SendNotification();
+  application.Render();
+  DALI_TEST_CHECK( application.GetRenderStatus().HasRendered() );
+  DALI_TEST_CHECK( application.GetRenderStatus().GetDamagedArea().IsEmpty() );
+}
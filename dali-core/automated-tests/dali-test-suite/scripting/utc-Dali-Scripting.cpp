@@ -549,6 +549,14 @@ void UtcDaliScriptingNewImage()
     DALI_TEST_EQUALS( crop.height, 80, TEST_LOCATION );
   }
 
+  // progressive
+  map.push_back( Property::StringValuePair( "progressive", true ) );
+  {
+    Image image = NewImage( map );
+    ImageAttributes attributes = image.GetAttributes();
+    DALI_TEST_CHECK( attributes.GetProgressiveLoading() );
+  }
+
   // type FrameBufferImage
   map.push_back( Property::StringValuePair( "type", "FrameBufferImage" ) );
   {
@@ -51,6 +51,7 @@ TEST_FUNCTION( UtcDaliCharacterIsLeftToRight, POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliGetCharacterDirection, POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliCharacterIsWhiteSpace, POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliCharacterIsNewLine, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliCharacterGetCodePoint, POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliCharacterGetImplementation,POSITIVE_TC_IDX );
 
 // Called only once before first test is run.
@@ -184,6 +185,18 @@ static void UtcDaliCharacterIsNewLine()
   DALI_TEST_CHECK(!text[8].IsNewLine()); // 'f'
 }
 
+static void UtcDaliCharacterGetCodePoint()
+{
+  tet_infoline("UtcDaliCharacterGetCodePoint ");
+  TestApplication application;
+
+  Text text( std::string("a\n\xe4\xb8\x80") ); // 'a', '\n', U+4E00
+
+  DALI_TEST_EQUALS( text[0].GetCodePoint(), 0x61u, TEST_LOCATION );
+  DALI_TEST_EQUALS( text[1].GetCodePoint(), 0x0Au, TEST_LOCATION );
+  DALI_TEST_EQUALS( text[2].GetCodePoint(), 0x4E00u, TEST_LOCATION );
+}
+
 static void UtcDaliCharacterGetImplementation()
 {
   tet_infoline("UtcDaliCharacterIsWhiteSpace ");
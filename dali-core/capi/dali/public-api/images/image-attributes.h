@@ -156,6 +156,8 @@ public:
    * (0.0, 0.0) is top left corner, (1.0, 1.0) is the full width and height
    * defaults are (0,0,1,1) so that whole image is loaded
    * (0.25, 0.25, 0.5, 0.5) would mean that 50% of the image is loaded from the middle
+   * The requested size and scaling mode apply to the cropped region. JPEG images decode
+   * only the region, so a tile of a very large image can be loaded cheaply.
    *
    * @param [in] cropRect - The crop rectangle
    */
@@ -180,6 +182,19 @@ public:
    */
   void SetOrientationCorrection(bool enabled);
 
+  /**
+   * @brief Set whether a low resolution version of the image is delivered while it loads.
+   *
+   * Large JPEG images can be decoded at an eighth of their size far faster than at
+   * full resolution. When this is enabled, that version is uploaded and drawn first,
+   * stretched to the image size, and replaced once the whole image has been decoded.
+   * The LoadingFinished signal is only emitted for the full resolution image.
+   * This is a loading hint; it isn't taken into account when attributes are compared.
+   *
+   * By default progressive loading is disabled.
+   * @param [in] enabled If true, a low resolution version of the image is delivered first.
+   */
+  void SetProgressiveLoading(bool enabled);
 
   /**
    * @brief Return the width currently represented by the attribute.
@@ -252,6 +267,13 @@ public:
    */
   bool GetOrientationCorrection() const;
 
+  /**
+   * @brief Whether a low resolution version of the image is delivered while it loads.
+   *
+   * @return true if progressive loading is enabled.
+   */
+  bool GetProgressiveLoading() const;
+
   /**
    * @brief Less then comparison operator.
    *
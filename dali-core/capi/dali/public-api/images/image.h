@@ -79,8 +79,8 @@ class ImageAttributes;
  * Before loading a new image the internal image resource cache is checked by dali.
  * If there is an Image already loaded in memory and is deemed "compatible" with the requested Image,
  * that resource is reused.
- * This happens for example if a loaded image exists with the same filename, and the difference between both
- * of the dimensions is less than 50%.
+ * This happens for example if a loaded image exists with the same filename and cropping area, and the difference
+ * between both of the dimensions is less than 50%.
  *
  * <i>Reloading Images</i>
  *
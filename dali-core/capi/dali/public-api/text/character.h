@@ -25,6 +25,9 @@
 // INTERNAL INCLUDES
 #include <dali/public-api/common/dali-common.h>
 
+// EXTERNAL INCLUDES
+#include <stdint.h>
+
 namespace Dali DALI_IMPORT_API
 {
 
@@ -123,6 +126,13 @@ public:
    */
   bool IsNewLine() const;
 
+  /**
+   * @brief Returns the character's unicode code point.
+   *
+   * @return The UTF-32 encoded character.
+   */
+  uint32_t GetCodePoint() const;
+
 private:
   Internal::Character* mImpl;
 
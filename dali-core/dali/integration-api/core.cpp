@@ -51,10 +51,11 @@ const unsigned int RENDER_TASK_SYNC       = 0x80;  ///< The refresh once render
 } // namespace KeepUpdating
 
 Core* Core::New(RenderController& renderController, PlatformAbstraction& platformAbstraction,
-                GlAbstraction& glAbstraction, GlSyncAbstraction& glSyncAbstraction, GestureManager& gestureManager)
+                GlAbstraction& glAbstraction, GlSyncAbstraction& glSyncAbstraction, GestureManager& gestureManager,
+                unsigned int updateWorkerCount, bool tripleBuffered)
 {
   Core* instance = new Core;
-  instance->mImpl = new Internal::Core( renderController, platformAbstraction, glAbstraction, glSyncAbstraction, gestureManager );
+  instance->mImpl = new Internal::Core( renderController, platformAbstraction, glAbstraction, glSyncAbstraction, gestureManager, updateWorkerCount, tripleBuffered );
 
   return instance;
 }
@@ -79,6 +80,11 @@ void Core::SurfaceResized(unsigned int width, unsigned int height)
   mImpl->SurfaceResized(width, height);
 }
 
+void Core::SetBackBufferAge(unsigned int age)
+{
+  mImpl->SetBackBufferAge(age);
+}
+
 void Core::SetDpi(unsigned int dpiHorizontal, unsigned int dpiVertical)
 {
   mImpl->SetDpi(dpiHorizontal, dpiVertical);
@@ -89,6 +95,21 @@ void Core::SetMinimumFrameTimeInterval(unsigned int interval)
   mImpl->SetMinimumFrameTimeInterval(interval);
 }
 
+void Core::SetPanGesturePredictionMode(int mode)
+{
+  mImpl->SetPanGesturePredictionMode(mode);
+}
+
+void Core::SetPanGesturePredictionAmount(unsigned int amount)
+{
+  mImpl->SetPanGesturePredictionAmount(amount);
+}
+
+void Core::SetPanGestureSmoothingAmount(float amount)
+{
+  mImpl->SetPanGestureSmoothingAmount(amount);
+}
+
 void Core::Suspend()
 {
   mImpl->Suspend();
@@ -19,6 +19,7 @@
 
 // EXTERNAL INCLUDES
 #include <dali/public-api/common/dali-common.h>
+#include <dali/public-api/math/rect.h>
 
 namespace Dali
 {
@@ -117,7 +118,8 @@ public:
    */
   RenderStatus()
   : needsUpdate(false),
-    hasRendered(false)
+    hasRendered(false),
+    damagedArea()
   {
   }
 
@@ -145,10 +147,24 @@ public:
    */
   bool HasRendered() { return hasRendered; }
 
+  /**
+   * Set the area of the surface which was redrawn, when the rest of the previous frame was kept.
+   * @param[in] area The redrawn area in GL window coordinates, i.e. the origin is the bottom-left corner of the surface.
+   * An empty area means the whole surface was redrawn.
+   */
+  void SetDamagedArea(const Rect<int>& area) { damagedArea = area; }
+
+  /**
+   * Query the area of the surface which was redrawn; only this area needs to be posted to the display.
+   * @return The redrawn area in GL window coordinates, or an empty area if the whole surface was redrawn.
+   */
+  const Rect<int>& GetDamagedArea() const { return damagedArea; }
+
 private:
 
   bool needsUpdate;
   bool hasRendered;
+  Rect<int> damagedArea;
 };
 
 /**
@@ -204,13 +220,21 @@ public:
    * @param[in] glAbstraction The interface providing OpenGL services.
    * @param[in] glSyncAbstraction The interface providing OpenGL sync objects.
    * @param[in] gestureManager The interface providing gesture manager services.
+   * @param[in] updateWorkerCount The number of worker threads which may be used to parallelize parts of each update;
+   *                              the default of zero means that Update() does all of its work in the calling thread.
+   * @param[in] tripleBuffered Whether the scene-graph values are triple-buffered. This allows the update for frame N+2
+   *                           to be processed whilst frame N is being rendered; see GetMaximumUpdateCount().
+   *                           The default is double-buffering, which uses less memory. Triple-buffering needs Dali built
+   *                           with --enable-triple-buffering, otherwise the Core is double-buffered.
    * @return A newly allocated Core.
    */
   static Core* New(RenderController& renderController,
                    PlatformAbstraction& platformAbstraction,
                    GlAbstraction& glAbstraction,
                    GlSyncAbstraction& glSyncAbstraction,
-                   GestureManager& gestureManager);
+                   GestureManager& gestureManager,
+                   unsigned int updateWorkerCount = 0u,
+                   bool tripleBuffered = false);
 
   /**
    * Non-virtual destructor. Core is not intended as a base class.
@@ -245,6 +269,17 @@ public:
    */
   void SurfaceResized(unsigned int width, unsigned int height);
 
+  /**
+   * Notify the Core of the age of the back buffer, before rendering to it.
+   * The age is the number of frames since the buffer was last posted; the contents of a buffer with age N
+   * are those rendered N frames ago, so only the area which changed since then has to be redrawn.
+   * Zero means the contents are undefined, and the whole surface is redrawn; this is the default.
+   * The redrawn area is returned in RenderStatus::GetDamagedArea().
+   * Multi-threading note: this method should be called from the rendering thread only
+   * @param[in] age The age of the back buffer, as reported by EGL_EXT_buffer_age.
+   */
+  void SetBackBufferAge(unsigned int age);
+
   // Core setters
 
   /**
@@ -273,6 +308,37 @@ public:
    */
   void SetMinimumFrameTimeInterval(unsigned int interval);
 
+  /**
+   * Sets how the pan gesture properties used by constraints are worked out from the pan gestures received since the
+   * last update.
+   * The supported modes are:
+   * - 0: the latest pan gesture is used as it is.
+   * - 1: the latest pan gesture is blended with the one used in the previous update (the default).
+   * - 2: the latest pan gesture is extrapolated along its smoothed velocity to the predicted time of the next render,
+   *      so that whatever follows the touch lags less behind it.
+   * Unsupported modes are ignored.
+   * Multi-threading note: this method should be called from the main thread
+   * @param[in] mode The prediction mode.
+   */
+  void SetPanGesturePredictionMode(int mode);
+
+  /**
+   * Sets the time added to the predicted time of the next render, when pan gestures are extrapolated.
+   * This can compensate for the time between a render and the frame being shown, e.g. in the compositor.
+   * The default is zero.
+   * Multi-threading note: this method should be called from the main thread
+   * @param[in] amount The time added, in milliseconds.
+   */
+  void SetPanGesturePredictionAmount(unsigned int amount);
+
+  /**
+   * Sets how much the velocity of the pan gestures is smoothed, when they are extrapolated.
+   * Each pan gesture moves the velocity ( 1 - amount ) of the way towards the velocity measured since the previous one.
+   * Multi-threading note: this method should be called from the main thread
+   * @param[in] amount The smoothing amount, between 0 (no smoothing) and 1.
+   */
+  void SetPanGestureSmoothingAmount(float amount);
+
   // Core Lifecycle
 
   /**
@@ -324,6 +390,8 @@ public:
    * For example if the maximum update count is 2, then Core::Update() for frame N+1 may be processed
    * whilst frame N is being rendered. However the Core::Update() for frame N+2 may not be called, until
    * the Core::Render() method for frame N has returned.
+   * The maximum update count is 3 when the Core was created with triple-buffering, and Dali was built with
+   * --enable-triple-buffering.
    * @return The maximum update count (>= 1).
    */
   unsigned int GetMaximumUpdateCount() const;
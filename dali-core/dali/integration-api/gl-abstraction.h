@@ -822,6 +822,11 @@
 #define GL_PROGRAM_BINARY_FORMATS_OES                           0x87FF
 #endif
 
+/* GL_KHR_parallel_shader_compile */
+#ifndef GL_COMPLETION_STATUS_KHR
+#define GL_COMPLETION_STATUS_KHR                                0x91B1
+#endif
+
 
 /* OpenGL ES 3.0 */
 struct __GLsync;
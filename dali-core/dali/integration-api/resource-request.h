@@ -37,13 +37,16 @@ typedef IntrusivePtr<Dali::RefObject> ResourcePointer;
 
 /**
  * Used to prioritize between loading operations.
+ * Resources which are needed to draw the current frame should be requested with LoadPriorityHigh or higher,
+ * resources which will probably be needed soon (prefetching) with LoadPriorityNormal, and
+ * resources which are loaded or saved in the background with LoadPriorityLow or lower.
  */
 enum LoadResourcePriority
 {
   LoadPriorityLowest,
-  LoadPriorityLow,
-  LoadPriorityNormal,
-  LoadPriorityHigh,
+  LoadPriorityLow,     ///< Background requests
+  LoadPriorityNormal,  ///< Prefetch requests
+  LoadPriorityHigh,    ///< Requests for visible resources
   LoadPriorityHighest,
 };
 
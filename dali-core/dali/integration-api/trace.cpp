@@ -0,0 +1,68 @@
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// CLASS HEADER
+#include <dali/integration-api/trace.h>
+
+namespace Dali
+{
+
+namespace Integration
+{
+
+namespace Trace
+{
+
+namespace
+{
+
+/**
+ * Shared by every thread; written once by the adaptor, so the threads which trace don't need a lock.
+ */
+TraceFunction gTraceFunction = NULL;
+
+} // unnamed namespace
+
+void InstallTraceFunction( TraceFunction traceFunction )
+{
+  __sync_synchronize();
+  gTraceFunction = traceFunction;
+  __sync_synchronize();
+}
+
+void Start( const char* name )
+{
+  const TraceFunction traceFunction = gTraceFunction;
+  if( traceFunction )
+  {
+    traceFunction( name, true );
+  }
+}
+
+void End( const char* name )
+{
+  const TraceFunction traceFunction = gTraceFunction;
+  if( traceFunction )
+  {
+    traceFunction( name, false );
+  }
+}
+
+} // namespace Trace
+
+} // namespace Integration
+
+} // namespace Dali
@@ -0,0 +1,112 @@
+#ifndef __DALI_INTEGRATION_TRACE_H__
+#define __DALI_INTEGRATION_TRACE_H__
+
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-common.h>
+
+namespace Dali
+{
+
+namespace Integration
+{
+
+namespace Trace
+{
+
+/**
+ * typedef for the trace function.
+ * It is called from any thread which marks the start or the end of a traced section, so it must be thread-safe.
+ * @param[in] name The name of the section; a string literal, which outlives the trace.
+ * @param[in] start True when the section starts, false when it ends.
+ */
+typedef void (*TraceFunction)( const char* name, bool start );
+
+/**
+ * Installs the function which records the traced sections of every thread.
+ * This should be done by the adaptor, before the update and render threads are started.
+ * @param[in] traceFunction The trace function, or NULL to stop tracing.
+ */
+DALI_IMPORT_API void InstallTraceFunction( TraceFunction traceFunction );
+
+/**
+ * Marks the start of a traced section, on the current thread.
+ * Does nothing unless a trace function is installed.
+ * @param[in] name The name of the section; must be a string literal.
+ */
+DALI_IMPORT_API void Start( const char* name );
+
+/**
+ * Marks the end of a traced section, on the current thread.
+ * @param[in] name The name of the section; must be a string literal.
+ */
+DALI_IMPORT_API void End( const char* name );
+
+/**
+ * Traces the section of code in which it is in scope.
+ */
+class DALI_IMPORT_API ScopedTrace
+{
+public:
+
+  /**
+   * Constructor; marks the start of the section.
+   * @param[in] name The name of the section; must be a string literal.
+   */
+  ScopedTrace( const char* name )
+  : mName( name )
+  {
+    Start( mName );
+  }
+
+  /**
+   * Non-virtual destructor; marks the end of the section.
+   */
+  ~ScopedTrace()
+  {
+    End( mName );
+  }
+
+private:
+
+  // Undefined
+  ScopedTrace( const ScopedTrace& );
+
+  // Undefined
+  ScopedTrace& operator=( const ScopedTrace& );
+
+private:
+
+  const char* mName;
+};
+
+} // namespace Trace
+
+} // namespace Integration
+
+} // namespace Dali
+
+#define DALI_TRACE_CONCATENATE_IMPL( a, b ) a##b
+#define DALI_TRACE_CONCATENATE( a, b ) DALI_TRACE_CONCATENATE_IMPL( a, b )
+
+/**
+ * Traces the rest of the enclosing scope, e.g. DALI_TRACE_SCOPE( "ItemView::Relayout" );
+ */
+#define DALI_TRACE_SCOPE( name ) Dali::Integration::Trace::ScopedTrace DALI_TRACE_CONCATENATE( daliTraceScope, __LINE__ )( name )
+
+#endif // __DALI_INTEGRATION_TRACE_H__
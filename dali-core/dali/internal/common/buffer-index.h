@@ -25,6 +25,13 @@ namespace Internal
 
 typedef unsigned int BufferIndex;
 
+// The number of buffers per scene-graph value; three when Dali is built with --enable-triple-buffering, see SceneGraphBuffers
+#ifdef DALI_TRIPLE_BUFFERING_ENABLED
+static const unsigned int NUM_SCENE_GRAPH_BUFFERS = 3;
+#else
+static const unsigned int NUM_SCENE_GRAPH_BUFFERS = 2;
+#endif
+
 } // namespace Internal
 
 } // namespace Dali
@@ -36,6 +36,7 @@
 #include <dali/internal/render/common/performance-monitor.h>
 #include <dali/internal/render/common/render-manager.h>
 #include <dali/internal/update/common/discard-queue.h>
+#include <dali/internal/update/common/scene-graph-buffers.h>
 #include <dali/internal/common/event-to-update.h>
 #include <dali/internal/common/frame-time.h>
 #include <dali/internal/update/resources/resource-manager.h>
@@ -55,9 +56,7 @@ using Dali::Internal::SceneGraph::RenderManager;
 using Dali::Internal::SceneGraph::DiscardQueue;
 using Dali::Internal::SceneGraph::RenderQueue;
 using Dali::Internal::SceneGraph::TextureCache;
-
-// The Update for frame N+1 may be processed whilst frame N is being rendered.
-static const unsigned int MAXIMUM_UPDATE_COUNT = 2u;
+using Dali::Internal::SceneGraph::SceneGraphBuffers;
 
 namespace Dali
 {
@@ -76,7 +75,7 @@ using Integration::RenderStatus;
 
 Core::Core( RenderController& renderController, PlatformAbstraction& platform,
             GlAbstraction& glAbstraction, GlSyncAbstraction& glSyncAbstraction,
-            GestureManager& gestureManager)
+            GestureManager& gestureManager, unsigned int updateWorkerCount, bool tripleBuffered )
 : mRenderController( renderController ),
   mPlatform(platform),
   mGestureEventProcessor(NULL),
@@ -91,12 +90,25 @@ Core::Core( RenderController& renderController, PlatformAbstraction& platform,
   mImageFactory(NULL),
   mModelFactory(NULL),
   mShaderFactory(NULL),
+  mMaximumUpdateCount(2u),
   mIsActive(true),
   mProcessingEvent(false)
 {
   // Create the thread local storage
   CreateThreadLocalStorage();
 
+  if( tripleBuffered )
+  {
+    if( NUM_SCENE_GRAPH_BUFFERS > 2u )
+    {
+      mMaximumUpdateCount = NUM_SCENE_GRAPH_BUFFERS;
+    }
+    else
+    {
+      DALI_LOG_WARNING( "Triple-buffering requires Dali built with --enable-triple-buffering; using double-buffering\n" );
+    }
+  }
+
   // This does nothing until Core is built with --enable-performance-monitor
   PERFORMANCE_MONITOR_INIT( platform );
 
@@ -137,7 +149,8 @@ Core::Core( RenderController& renderController, PlatformAbstraction& platform,
                                       *mRenderManager,
                                        renderQueue,
                                        textureCache,
-                                      *mTouchResampler );
+                                      *mTouchResampler,
+                                       updateWorkerCount );
 
   mResourceClient = new ResourceClient( *mResourceManager, *mUpdateManager );
 
@@ -215,6 +228,11 @@ void Core::SurfaceResized(unsigned int width, unsigned int height)
   mStage->SetSize(width, height);
 }
 
+void Core::SetBackBufferAge(unsigned int age)
+{
+  mRenderManager->SetBackBufferAge(age);
+}
+
 void Core::SetDpi(unsigned int dpiHorizontal, unsigned int dpiVertical)
 {
   mPlatform.SetDpi( dpiHorizontal, dpiVertical  );
@@ -227,6 +245,24 @@ void Core::SetMinimumFrameTimeInterval(unsigned int interval)
   mFrameTime->SetMinimumFrameTimeInterval(interval);
 }
 
+void Core::SetPanGesturePredictionMode(int mode)
+{
+  if( ( mode >= SceneGraph::PanGesture::PREDICTION_NONE ) && ( mode <= SceneGraph::PanGesture::PREDICTION_MODE_LAST ) )
+  {
+    SetPanGesturePredictionModeMessage( *mUpdateManager, static_cast< SceneGraph::PanGesture::PredictionMode >( mode ) );
+  }
+}
+
+void Core::SetPanGesturePredictionAmount(unsigned int amount)
+{
+  SetPanGesturePredictionAmountMessage( *mUpdateManager, amount );
+}
+
+void Core::SetPanGestureSmoothingAmount(float amount)
+{
+  SetPanGestureSmoothingAmountMessage( *mUpdateManager, amount );
+}
+
 void Core::Update( UpdateStatus& status )
 {
   // get the last delta and the predict when this update will be rendered
@@ -381,7 +417,8 @@ void Core::UpdateTouchData(const Integration::TouchData& touch)
 
 unsigned int Core::GetMaximumUpdateCount() const
 {
-  return MAXIMUM_UPDATE_COUNT;
+  // The Update for frame N+1 (or N+2, when triple-buffered) may be processed whilst frame N is being rendered.
+  return mMaximumUpdateCount;
 }
 
 Integration::SystemOverlay& Core::GetSystemOverlay()
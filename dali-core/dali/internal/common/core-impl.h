@@ -81,7 +81,9 @@ public:
         Integration::PlatformAbstraction& platform,
         Integration::GlAbstraction& glAbstraction,
         Integration::GlSyncAbstraction& glSyncAbstraction,
-        Integration::GestureManager& gestureManager );
+        Integration::GestureManager& gestureManager,
+        unsigned int updateWorkerCount,
+        bool tripleBuffered );
 
   /**
    * Destructor
@@ -103,6 +105,11 @@ public:
    */
   void SurfaceResized(unsigned int width, unsigned int height);
 
+  /**
+   * @copydoc Dali::Integration::Core::SetBackBufferAge(unsigned int)
+   */
+  void SetBackBufferAge(unsigned int age);
+
   /**
    * @copydoc Dali::Integration::Core::SetDpi(unsigned int, unsigned int)
    */
@@ -113,6 +120,21 @@ public:
    */
   void SetMinimumFrameTimeInterval(unsigned int interval);
 
+  /**
+   * @copydoc Dali::Integration::Core::SetPanGesturePredictionMode(int)
+   */
+  void SetPanGesturePredictionMode(int mode);
+
+  /**
+   * @copydoc Dali::Integration::Core::SetPanGesturePredictionAmount(unsigned int)
+   */
+  void SetPanGesturePredictionAmount(unsigned int amount);
+
+  /**
+   * @copydoc Dali::Integration::Core::SetPanGestureSmoothingAmount(float)
+   */
+  void SetPanGestureSmoothingAmount(float amount);
+
   /**
    * @copydoc Dali::Integration::Core::Update()
    */
@@ -285,6 +307,7 @@ private:
   ResourceManager*                          mResourceManager;             ///< Asynchronous Resource Loading
   TouchResampler*                           mTouchResampler;              ///< Resamples touches to correct frame rate.
 
+  unsigned int                              mMaximumUpdateCount;          ///< The number of updates which may be processed ahead of the rendering
   bool                                      mIsActive         : 1;        ///< Whether Core is active or suspended
   bool                                      mProcessingEvent  : 1;        ///< True during ProcessEvents()
 
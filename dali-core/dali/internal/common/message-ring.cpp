@@ -0,0 +1,251 @@
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// CLASS HEADER
+#include <dali/internal/common/message-ring.h>
+
+// EXTERNAL INCLUDES
+#include <cstdlib>
+
+// INTERNAL INCLUDES
+#include <dali/integration-api/debug.h>
+
+namespace // unnamed namespace
+{
+
+const unsigned int MESSAGE_SIZE_FIELD = 1u; // Size required to mark the message size
+const unsigned int SEGMENT_END_FIELD  = 1u; // Size required to mark the end of a segment
+const unsigned int BATCH_END_FIELDS   = 2u; // Size required to mark the end of a batch, followed by the batch data
+
+const unsigned int SEGMENT_END_MARKER = 0u;           // Found in place of a message size, when the next segment should be read
+const unsigned int BATCH_END_MARKER   = 0xFFFFFFFFu;  // Found in place of a message size, at the end of a published batch
+
+const unsigned int MAX_DIVISION_BY_WORD_REMAINDER = sizeof(unsigned int) - 1u; // For word alignment on ARM
+
+} // unnamed namespace
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+/**
+ * A fixed-size block of messages, in a singly-linked chain.
+ */
+struct MessageRing::Segment
+{
+  /**
+   * Allocate a segment.
+   * @param[in] capacity The capacity with respect to sizeof(unsigned int).
+   * @return The new segment.
+   */
+  static Segment* New( std::size_t capacity )
+  {
+    Segment* segment = new Segment;
+
+    segment->next  = NULL;
+    segment->begin = reinterpret_cast<unsigned int*>( malloc( capacity * sizeof(unsigned int) ) );
+    DALI_ASSERT_ALWAYS( NULL != segment->begin );
+    segment->end   = segment->begin + capacity;
+
+    return segment;
+  }
+
+  /**
+   * Free a segment.
+   * @param[in] segment The segment to free.
+   */
+  static void Delete( Segment* segment )
+  {
+    free( segment->begin );
+    delete segment;
+  }
+
+  /**
+   * @return The capacity with respect to sizeof(unsigned int).
+   */
+  std::size_t GetCapacity() const
+  {
+    return end - begin;
+  }
+
+  Segment* volatile next;  ///< The next segment in the chain; written by the producer
+  unsigned int*     begin; ///< The first word of the segment
+  unsigned int*     end;   ///< One past the last word of the segment
+};
+
+MessageRing::MessageRing( std::size_t segmentCapacity, std::size_t maxCapacity )
+: mSegmentCapacity( segmentCapacity / sizeof(unsigned int) ),
+  mMaxCapacity( maxCapacity / sizeof(unsigned int) ),
+  mFirstSegment( NULL ),
+  mWriteSegment( NULL ),
+  mWritePosition( NULL ),
+  mCapacity( 0 ),
+  mPublished( NULL ),
+  mReadSegment( NULL ),
+  mReadPosition( NULL ),
+  mAcquired( NULL )
+{
+  DALI_ASSERT_DEBUG( mSegmentCapacity > BATCH_END_FIELDS + SEGMENT_END_FIELD );
+
+  mFirstSegment = Segment::New( mSegmentCapacity );
+  mCapacity = mSegmentCapacity;
+
+  mWriteSegment = mReadSegment = mFirstSegment;
+  mWritePosition = mPublished = mReadPosition = mAcquired = mFirstSegment->begin;
+}
+
+MessageRing::~MessageRing()
+{
+  while( NULL != mFirstSegment )
+  {
+    Segment* next = mFirstSegment->next;
+    Segment::Delete( mFirstSegment );
+    mFirstSegment = next;
+  }
+}
+
+unsigned int* MessageRing::ReserveMessageSlot( std::size_t size )
+{
+  DALI_ASSERT_DEBUG( 0 != size );
+
+  const std::size_t requestedSize = (size + MAX_DIVISION_BY_WORD_REMAINDER) / sizeof(unsigned int);
+
+  unsigned int* slot = Allocate( requestedSize + MESSAGE_SIZE_FIELD );
+
+  *slot++ = requestedSize; // Object size marker is stored in first word
+
+  return slot;
+}
+
+void MessageRing::Publish( unsigned int batchData )
+{
+  unsigned int* marker = Allocate( BATCH_END_FIELDS );
+  marker[0] = BATCH_END_MARKER;
+  marker[1] = batchData;
+
+  // The messages must be visible to the consumer, before the new end position
+  __sync_synchronize();
+
+  mPublished = mWritePosition;
+}
+
+std::size_t MessageRing::GetCapacity() const
+{
+  return mCapacity * sizeof(unsigned int);
+}
+
+void MessageRing::AcquirePublished()
+{
+  mAcquired = mPublished;
+
+  // The messages must be read after the end position
+  __sync_synchronize();
+}
+
+unsigned int* MessageRing::Read( unsigned int& batchData )
+{
+  DALI_ASSERT_DEBUG( HasAcquiredMessages() );
+
+  unsigned int size = *mReadPosition;
+
+  if( SEGMENT_END_MARKER == size )
+  {
+    Segment* next = mReadSegment->next;
+    mReadPosition = next->begin;
+
+    // The messages in the previous segment must have been read, before the producer is allowed to recycle it
+    __sync_synchronize();
+    mReadSegment = next;
+
+    // The producer does not publish an empty segment
+    size = *mReadPosition;
+  }
+
+  if( BATCH_END_MARKER == size )
+  {
+    batchData = mReadPosition[1];
+    mReadPosition += BATCH_END_FIELDS;
+
+    return NULL;
+  }
+
+  unsigned int* message = mReadPosition + MESSAGE_SIZE_FIELD;
+  mReadPosition = message + size;
+
+  return message;
+}
+
+unsigned int* MessageRing::Allocate( std::size_t size )
+{
+  // There must always be space to mark the end of the segment
+  if( mWritePosition + size + SEGMENT_END_FIELD > mWriteSegment->end )
+  {
+    Segment* segment = GetEmptySegment( size + SEGMENT_END_FIELD );
+
+    // Link the new segment before the end marker is written; the consumer follows the link after reading the marker
+    mWriteSegment->next = segment;
+    *mWritePosition = SEGMENT_END_MARKER;
+
+    mWriteSegment = segment;
+    mWritePosition = segment->begin;
+  }
+
+  unsigned int* slot = mWritePosition;
+  mWritePosition += size;
+
+  return slot;
+}
+
+MessageRing::Segment* MessageRing::GetEmptySegment( std::size_t capacity )
+{
+  // The segments before mReadSegment are no longer used by the consumer
+  Segment* readSegment = mReadSegment;
+  __sync_synchronize();
+
+  // Guard against excessive growth, after a burst of messages
+  while( mFirstSegment != readSegment &&
+         mCapacity > mMaxCapacity )
+  {
+    Segment* next = mFirstSegment->next;
+    mCapacity -= mFirstSegment->GetCapacity();
+    Segment::Delete( mFirstSegment );
+    mFirstSegment = next;
+  }
+
+  if( mFirstSegment != readSegment &&
+      mFirstSegment->GetCapacity() >= capacity )
+  {
+    // Recycle the oldest segment
+    Segment* segment = mFirstSegment;
+    mFirstSegment = segment->next;
+    segment->next = NULL;
+
+    return segment;
+  }
+
+  // Oversized messages are given a segment of their own
+  const std::size_t segmentCapacity = ( capacity > mSegmentCapacity ) ? capacity : mSegmentCapacity;
+
+  mCapacity += segmentCapacity;
+
+  return Segment::New( segmentCapacity );
+}
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,153 @@
+#ifndef __DALI_INTERNAL_MESSAGE_RING_H__
+#define __DALI_INTERNAL_MESSAGE_RING_H__
+
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// EXTERNAL INCLUDES
+#include <cstddef>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+/**
+ * A lock-free queue of messages, with a single producer thread and a single consumer thread.
+ *
+ * Messages are written into a chain of fixed-size segments; a full segment is never reallocated, instead another
+ * segment is linked to the end of the chain. Segments which have been read by the consumer are recycled by the producer.
+ *
+ * The producer reserves messages in batches; the messages are not visible to the consumer until the batch is published.
+ * Neither thread ever waits for the other.
+ */
+class MessageRing
+{
+public:
+
+  /**
+   * Create a new MessageRing.
+   * @param[in] segmentCapacity The capacity of each segment, with respect to the size of type "char".
+   * @param[in] maxCapacity Recycled segments are freed, whilst the total capacity exceeds this.
+   */
+  MessageRing( std::size_t segmentCapacity, std::size_t maxCapacity );
+
+  /**
+   * Non-virtual destructor; not suitable as a base class.
+   * @pre The messages have been read, or their contents have been destroyed by the owner.
+   */
+  ~MessageRing();
+
+  // Producer
+
+  /**
+   * Reserve space for another message in the current batch; only called by the producer thread.
+   * @pre size is greater than zero.
+   * @param[in] size The message size with respect to the size of type "char".
+   * @return A pointer to the address allocated for the message.
+   */
+  unsigned int* ReserveMessageSlot( std::size_t size );
+
+  /**
+   * Publish the current batch of messages to the consumer; only called by the producer thread.
+   * The end of the batch is marked in the ring, and can be detected with Read().
+   * @param[in] batchData A value passed to the consumer, when the end of the batch is read.
+   */
+  void Publish( unsigned int batchData );
+
+  /**
+   * Query the total capacity of the segments allocated by the ring; only called by the producer thread.
+   * @return The capacity with respect to the size of type "char".
+   */
+  std::size_t GetCapacity() const;
+
+  // Consumer
+
+  /**
+   * Make the messages published so far available to Read(); only called by the consumer thread.
+   * Messages published afterwards are not available until the next call.
+   */
+  void AcquirePublished();
+
+  /**
+   * Query whether there are acquired messages, which have not been read; only called by the consumer thread.
+   * @return True if Read() can be called.
+   */
+  bool HasAcquiredMessages() const
+  {
+    return mReadPosition != mAcquired;
+  }
+
+  /**
+   * Read the next acquired message, or the end of a batch; only called by the consumer thread.
+   * The memory of the message may be recycled after the next call to Read(), therefore the consumer should have
+   * finished with the message by then.
+   * @pre HasAcquiredMessages() returns true.
+   * @param[out] batchData Set to the value passed to Publish(), when the end of a batch is read.
+   * @return The next message, or NULL when the end of a batch is read.
+   */
+  unsigned int* Read( unsigned int& batchData );
+
+private:
+
+  struct Segment;
+
+  /**
+   * Helper to allocate space at the end of the ring; a new segment is linked if necessary.
+   * @param[in] size The required size, with respect to sizeof(unsigned int).
+   * @return The allocated space.
+   */
+  unsigned int* Allocate( std::size_t size );
+
+  /**
+   * Helper to retrieve an empty segment; a segment is recycled if the consumer has finished with it.
+   * @param[in] capacity The required capacity, with respect to sizeof(unsigned int).
+   * @return The segment.
+   */
+  Segment* GetEmptySegment( std::size_t capacity );
+
+  // Undefined
+  MessageRing( const MessageRing& );
+
+  // Undefined
+  MessageRing& operator=( const MessageRing& rhs );
+
+private:
+
+  const std::size_t       mSegmentCapacity; ///< The capacity of each segment, with respect to sizeof(unsigned int)
+  const std::size_t       mMaxCapacity;     ///< Recycled segments are freed, whilst the total capacity exceeds this
+
+  // Owned by the producer
+  Segment*                mFirstSegment;    ///< The oldest segment; segments before mReadSegment can be recycled
+  Segment*                mWriteSegment;    ///< The segment currently being written
+  unsigned int*           mWritePosition;   ///< The next free location in mWriteSegment
+  std::size_t             mCapacity;        ///< The total capacity of the segments, with respect to sizeof(unsigned int)
+
+  // Shared between the producer & consumer
+  unsigned int* volatile  mPublished;       ///< The end of the published messages; written by the producer
+  Segment* volatile       mReadSegment;     ///< The segment currently being read; written by the consumer
+
+  // Owned by the consumer
+  unsigned int*           mReadPosition;    ///< The next message to read
+  unsigned int*           mAcquired;        ///< The end of the acquired messages
+};
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_MESSAGE_RING_H__
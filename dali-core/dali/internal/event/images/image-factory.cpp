@@ -72,7 +72,7 @@ Request* ImageFactory::RegisterRequest( const std::string &filename, const Image
   return foundReq;
 }
 
-ResourceTicketPtr ImageFactory::Load( Request *req )
+ResourceTicketPtr ImageFactory::Load( Request *req, LoadResourcePriority priority )
 {
   ResourceTicketPtr ticket;
   DALI_ASSERT_DEBUG( req );
@@ -98,7 +98,7 @@ ResourceTicketPtr ImageFactory::Load( Request *req )
     if( !ticket )
     {
       // didn't find compatible resource
-      ticket = IssueLoadRequest( req->url, req->attributes );
+      ticket = IssueLoadRequest( req->url, req->attributes, priority );
     }
 
     req->resourceId = ticket->GetId();
@@ -109,7 +109,7 @@ ResourceTicketPtr ImageFactory::Load( Request *req )
     if( !ticket )
     {
       // resource has been discarded since
-      ticket = IssueLoadRequest( req->url, req->attributes );
+      ticket = IssueLoadRequest( req->url, req->attributes, priority );
       req->resourceId = ticket->GetId();
     }
     DALI_ASSERT_DEBUG( ticket->GetTypePath().type->id == ResourceBitmap      ||
@@ -128,7 +128,7 @@ ResourceTicketPtr ImageFactory::Load( Request *req )
 // In this case both requests will be associated with the resource of size (40, 40)
 // If image changes on filesystem to size (96, 96) -> now after reloading Req2 would load a
 // new resource of size (96, 96), but reloading Req1 would load a scaled down version
-ResourceTicketPtr ImageFactory::Reload( Request* request )
+ResourceTicketPtr ImageFactory::Reload( Request* request, LoadResourcePriority priority )
 {
   DALI_ASSERT_ALWAYS( request );
 
@@ -146,7 +146,7 @@ ResourceTicketPtr ImageFactory::Reload( Request* request )
   // ticket might have been deleted, eg. Image::Disconnect
   if( !ticket )
   {
-    ticket = IssueLoadRequest( request->url, request->attributes );
+    ticket = IssueLoadRequest( request->url, request->attributes, priority );
     request->resourceId = ticket->GetId();
   }
   else // ticket still alive
@@ -168,12 +168,12 @@ ResourceTicketPtr ImageFactory::Reload( Request* request )
 
     if( size == attrib.GetSize() )
     {
-      mResourceClient.ReloadResource( ticket->GetId() );
+      mResourceClient.ReloadResource( ticket->GetId(), priority );
     }
     else
     {
       // if not, return a different ticket
-      ticket = IssueLoadRequest( request->url, request->attributes );
+      ticket = IssueLoadRequest( request->url, request->attributes, priority );
       request->resourceId = ticket->GetId();
     }
   }
@@ -235,7 +235,8 @@ bool ImageFactory::CompareAttributes( const Dali::ImageAttributes& requested,
   // do not load image resource again if there is a similar resource loaded
   // eg. if size is less than 50% different of what we have
   // see explanation in image.h of what is deemed compatible
-  return (actual.GetCrop().Contains(requested.GetCrop())) &&
+  // the crop selects the region of the image which is loaded, so it must match exactly
+  return (requested.GetCrop() == actual.GetCrop()) &&
          (requested.GetScalingMode() == actual.GetScalingMode()) &&
          (requested.GetPixelFormat() == actual.GetPixelFormat()) &&
          (requested.GetFieldBorder() == actual.GetFieldBorder()) &&
@@ -365,7 +366,7 @@ ResourceTicketPtr ImageFactory::FindCompatibleResource( const std::string& filen
   return ticket;
 }
 
-ResourceTicketPtr ImageFactory::IssueLoadRequest( const std::string& filename, const ImageAttributes* attr )
+ResourceTicketPtr ImageFactory::IssueLoadRequest( const std::string& filename, const ImageAttributes* attr, LoadResourcePriority priority )
 {
   ImageAttributes attributes;
 
@@ -381,7 +382,7 @@ ResourceTicketPtr ImageFactory::IssueLoadRequest( const std::string& filename, c
   }
 
   BitmapResourceType resourceType( attributes );
-  ResourceTicketPtr ticket = mResourceClient.RequestResource( resourceType, filename );
+  ResourceTicketPtr ticket = mResourceClient.RequestResource( resourceType, filename, priority );
   return ticket;
 }
 
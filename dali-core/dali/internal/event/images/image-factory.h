@@ -18,6 +18,7 @@
 //
 
 // INTERNAL INCLUDES
+#include <dali/integration-api/resource-cache.h>
 #include <dali/internal/event/resources/resource-type-path-id-map.h>
 #include <dali/internal/event/resources/resource-ticket.h>
 #include <dali/internal/event/images/image-factory-cache.h>
@@ -66,10 +67,11 @@ public:
   /**
    * Issue a request which has already been registered with ImageFactory.
    * If the associated Ticket is no longer alive ImageFactory issues a resource load request.
-   * @param [in] req pointer to request
+   * @param [in] req      pointer to request
+   * @param [in] priority the priority of the load request, if one is issued
    * @return     intrusive pointer to image ticket. If Load fails, returned pointer is invalid. (!ret)
    */
-  ResourceTicketPtr Load( ImageFactoryCache::Request* req );
+  ResourceTicketPtr Load( ImageFactoryCache::Request* req, Integration::LoadResourcePriority priority = Integration::LoadPriorityNormal );
 
   /**
    * Tells ResourceManager to reload image from filesystem.
@@ -78,9 +80,10 @@ public:
    * @pre req must be registered with ImageFactory
    * @note if image is still loading, no new load request will be issued
    * @param [in]  req Request pointer
+   * @param [in]  priority The priority of the load request, if one is issued
    * @return[out] the ResourceTicket mapped to the request
    */
-  ResourceTicketPtr Reload( ImageFactoryCache::Request* req );
+  ResourceTicketPtr Reload( ImageFactoryCache::Request* req, Integration::LoadResourcePriority priority = Integration::LoadPriorityNormal );
 
   /**
    * Get resource path used in request.
@@ -177,9 +180,10 @@ private:
    * Helper function that requests the image resource from platform abstraction.
    * @param [in] filename   The url of the image resource.
    * @param [in] attributes Pointer to ImageAttributes to be used for the request or NULL if default attributes are used.
+   * @param [in] priority   The priority of the load request.
    * @return intrusive pointer to Ticket
    */
-  ResourceTicketPtr IssueLoadRequest( const std::string& filename, const ImageAttributes* attributes );
+  ResourceTicketPtr IssueLoadRequest( const std::string& filename, const ImageAttributes* attributes, Integration::LoadResourcePriority priority = Integration::LoadPriorityNormal );
 
 private:
   ResourceClient&                        mResourceClient;
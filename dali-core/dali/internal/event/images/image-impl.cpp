@@ -160,7 +160,9 @@ void Image::Reload()
 {
   if ( mRequest )
   {
-    ResourceTicketPtr ticket = mImageFactory.Reload( mRequest.Get() );
+    // Images which are not on-stage are reloaded in the background
+    const Integration::LoadResourcePriority priority = ( mConnectionCount > 0 ) ? Integration::LoadPriorityHigh : Integration::LoadPriorityLow;
+    ResourceTicketPtr ticket = mImageFactory.Reload( mRequest.Get(), priority );
     SetTicket( ticket.Get() );
   }
 }
@@ -244,7 +246,8 @@ void Image::Connect()
     // ticket was thrown away when related actors went offstage or image loading on demand
     if( !mTicket )
     {
-      ResourceTicketPtr newTicket = mImageFactory.Load( mRequest.Get() );
+      // The image is needed to draw an on-stage actor, so load it ahead of prefetched images
+      ResourceTicketPtr newTicket = mImageFactory.Load( mRequest.Get(), Integration::LoadPriorityHigh );
       SetTicket( newTicket.Get() );
     }
   }
@@ -16,6 +16,7 @@
 
 // INTERNAL INCLUDES
 #include <dali/internal/event/text/atlas/atlas-rank-generator.h>
+#include <dali/internal/event/text/atlas/atlas-size.h>
 
 namespace Dali
 {
@@ -86,10 +87,18 @@ AtlasRanking GetAtlasRanking( const TextArray& text,
 
   AtlasRanking::CharacterMatch charMatchStatus = GetTextMatchStatus( text.size(), charsNotLoaded );
 
-  AtlasRanking::SpaceStatus spaceStatus = GetAtlasSpaceStatus( canFit,  atlasResizable);
+  // the dead characters are cleared when an atlas is resized, so the text only fits in a resized atlas
+  // if it fits alongside the referenced characters in an atlas of the page size
+  const unsigned int pageCharacterCount = GlyphAtlasSize::GetAtlasCharacterCount( GlyphAtlasSize::GetMaxPageSize() );
+  const bool fitsWhenResized = ( container.GetNumberOfReferencedCharacters() + charsNotLoaded <= pageCharacterCount );
+
+  AtlasRanking::SpaceStatus spaceStatus = GetAtlasSpaceStatus( canFit,  atlasResizable && fitsWhenResized );
+
+  // prefer atlas pages which already hold characters of the same font
+  AtlasRanking::FontMatch fontMatchStatus = container.ContainsFont( fontId ) ? AtlasRanking::FONT_MATCHED : AtlasRanking::NO_FONT_MATCHED;
 
   AtlasRanking ranking( charMatchStatus,
-                         AtlasRanking::FONT_MATCHED, // @todo hard coded for now, until atlas splitting supported
+                         fontMatchStatus,
                          spaceStatus,
                          charsNotLoaded );
   return ranking;
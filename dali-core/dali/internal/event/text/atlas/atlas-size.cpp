@@ -58,6 +58,12 @@ const unsigned int ATLAS_SIZES[] =
 
 const std::size_t ATLAS_SIZE_COUNT = (sizeof( ATLAS_SIZES))/ (sizeof(unsigned int)) ;
 
+/**
+ * Atlases grow up to 2048 x 2048 (1024 characters, 4 MB).
+ * Larger atlases are only created for a single string, which would not fit in a page.
+ */
+const unsigned int MAX_PAGE_SIZE( 32 * DISTANCE_FIELD_BLOCK_SIZE );
+
 }  // un-named name space
 
 unsigned int GlyphAtlasSize::GetAtlasCharacterCount( unsigned int size )
@@ -99,6 +105,11 @@ unsigned int GlyphAtlasSize::GetMaxSize()
   return ATLAS_SIZES[ ATLAS_SIZE_COUNT -1];
 }
 
+unsigned int GlyphAtlasSize::GetMaxPageSize()
+{
+  return MAX_PAGE_SIZE;
+}
+
 unsigned int GlyphAtlasSize::GetBlockSize()
 {
   return DISTANCE_FIELD_BLOCK_SIZE;
@@ -52,6 +52,14 @@ unsigned int GetNextSize( unsigned int currentSize);
  */
 unsigned int GetMaxSize();
 
+/**
+ * This returns the size at which an atlas stops growing.
+ * Beyond this size, text is placed in additional atlas pages, rather than cloning
+ * the atlas contents into an ever larger texture.
+ * @return the maximum page size
+ */
+unsigned int GetMaxPageSize();
+
 /**
  * Return the atlas block size.
  * @return block size
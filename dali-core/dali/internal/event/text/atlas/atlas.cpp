@@ -22,9 +22,6 @@
 #include <dali/integration-api/debug.h>
 #include <dali/internal/event/text/atlas/debug/atlas-debug.h>
 
-// EXTERNAL INCLUDES
-#include <math.h>
-
 namespace Dali
 {
 
@@ -34,27 +31,43 @@ namespace Internal
 namespace // un-named namespace
 {
 
-void GetByteAndBitPosition( unsigned int blockNum, unsigned int& bytePos, unsigned int& bitPos )
-{
-  // divide by 8 to calculate the byte this block is in
-  // 1 byte holds bitmask for 8 blocks
-  // Example:  If block = 10, then block is in byte 1.
-  //
-  //   byte 0            byte 1             byte 3
-  // [ 0000,0000 ],  [ 00  X  ..... ]   ,    [.........]
-  //   0123 4567       89  ^10th bit set
-  // blockNum / 8 = byte number
-  //
+const unsigned int MAX_BLOCKS_PER_ROW = 64u;                         ///< A row of blocks is held in a 64 bit word
+const uint64_t ALL_BITS_SET = ~static_cast< uint64_t >( 0u );
 
-  bytePos = blockNum >> 3;  // >>3 = divide by 8
+/**
+ * @param[in] count number of bits
+ * @return a mask with the lowest count bits set
+ */
+inline uint64_t GetLowBits( unsigned int count )
+{
+  return ( count >= MAX_BLOCKS_PER_ROW ) ? ALL_BITS_SET : ( ( static_cast< uint64_t >( 1u ) << count ) - 1u );
+}
 
-  // calculate the bit, within the byte which the block uses
-  // the lower 3 bits define it's position with the block
-  // if block = 10, in binary this is 1010. Lower 3 bits = 010.
-  // So bit position = 2 ( zero based)
+/**
+ * @pre value is not zero
+ * @param[in] value the value
+ * @return the index of the lowest bit set
+ */
+inline unsigned int FindFirstSetBit( uint64_t value )
+{
+  return __builtin_ctzll( value );
+}
 
-  bitPos = blockNum & 7;  // AND With binary 111 to lower 3 bits
+#ifdef DEBUG_ATLAS
+/**
+ * Build a lookup between block number and id, for the debug output
+ */
+template< typename Lookup >
+BlockIdLookup GetBlockIds( const Lookup& lookup, unsigned int blocksPerRow )
+{
+  BlockIdLookup blockIds;
+  for( typename Lookup::const_iterator iter = lookup.begin(); iter != lookup.end(); ++iter )
+  {
+    blockIds[ (*iter).second.row * blocksPerRow + (*iter).second.column ] = (*iter).first;
+  }
+  return blockIds;
 }
+#endif
 
 } // un-named namespace
 
@@ -62,21 +75,28 @@ void GetByteAndBitPosition( unsigned int blockNum, unsigned int& bytePos, unsign
 Atlas::Atlas(const unsigned int atlasSize,
             const unsigned int blockSize)
 : mSize(atlasSize),
-  mBlockSize(blockSize)
+  mBlockSize(blockSize),
+  mRowMask( 0u )
 {
   DALI_ASSERT_DEBUG(mBlockSize > 0  && atlasSize  >= blockSize);
 
   // Atlases are square
-  unsigned int totalBlocks = GetBlocksPerRow() * GetBlocksPerRow();
+  const unsigned int blocksPerRow = GetBlocksPerRow();
+
+  DALI_ASSERT_ALWAYS( blocksPerRow <= MAX_BLOCKS_PER_ROW && "Atlas has too many blocks per row" );
+
+  mRowMask = GetLowBits( blocksPerRow );
 
-  DALI_ASSERT_DEBUG(  (totalBlocks % 8) == 0 && "Atlas num blocks must be factor of 8" );
+  // one word per row, contents initialised to zero (all free)
+  mRows.resize( blocksPerRow );
 
-  // block allocation is using a bitmask in a 1D array.
-  // e.g. 256 blocks require 256 bits to say whether a block is allocated
-  // 256 / 8  = 32 bytes (or >> 3 to divide by 8 ).
-  unsigned int bitMaskBytes = totalBlocks >> 3;
+  // one bit per row, 64 rows per word.
+  // Bits past the last row are set, so that they are never considered free
+  const unsigned int summaryWords = ( blocksPerRow + MAX_BLOCKS_PER_ROW - 1u ) / MAX_BLOCKS_PER_ROW;
+  mFullRows.resize( summaryWords );
 
-  mFreeBlocks.resize( bitMaskBytes );  // contents auto-initialised to zero
+  const unsigned int rowsInLastWord = blocksPerRow - ( summaryWords - 1u ) * MAX_BLOCKS_PER_ROW;
+  mFullRows[ summaryWords - 1u ] = ~GetLowBits( rowsInLastWord );
 }
 
 Atlas::~Atlas()
@@ -86,11 +106,9 @@ Atlas::~Atlas()
 
 void Atlas::CloneContents( Atlas* clone )
 {
-  // Internally atlas allocation is done using a 1 dimensional array.
+  // Internally atlas allocation is done using one bitmask per row.
   // A single bit set in the array represents an allocation.
   //
-  // So an atlas of size 8 x 8 blocks is 64 bits long.
-  //
   // When cloning we keep the allocated blocks in the same 2D space.
   //
   //
@@ -114,48 +132,52 @@ void Atlas::CloneContents( Atlas* clone )
 
   DALI_ASSERT_DEBUG( clone->mSize <= mSize);
 
-  // go through each allocated block in the cloned atlas, and add to the this atlas.
+  // go through each allocated item in the cloned atlas, and add to the this atlas.
 
   BlockLookup::const_iterator endIter = clone->mBlockLookup.end();
   for( BlockLookup::const_iterator iter = clone->mBlockLookup.begin(); iter != endIter; ++iter )
   {
-    unsigned int key = (*iter).first;
-    unsigned int block = (*iter).second;
-    unsigned int row,column;
-
-    clone->GetPositionOfBlock( block, row, column );
+    const Block& block( (*iter).second );
 
-    unsigned int newBlockId = AllocateBlock( row, column );
+    MarkBlocks( block, true );
 
-    mBlockLookup[ key ] = newBlockId;
+    mBlockLookup[ (*iter).first ] = block;
   }
 
 #ifdef DEBUG_ATLAS
-  DebugPrintAtlasWithIds( clone->mFreeBlocks, clone->mBlockLookup, clone->GetBlocksPerRow());
-  DebugPrintAtlasWithIds( mFreeBlocks,mBlockLookup,  GetBlocksPerRow() );
+  DebugPrintAtlasWithIds( clone->mRows, GetBlockIds( clone->mBlockLookup, clone->GetBlocksPerRow() ), clone->GetBlocksPerRow() );
+  DebugPrintAtlasWithIds( mRows, GetBlockIds( mBlockLookup, GetBlocksPerRow() ), GetBlocksPerRow() );
 #endif
 }
 
 bool Atlas::Insert( unsigned int id)
 {
-  unsigned int blockNum(0);
+  return Insert( id, 1u, 1u );
+}
 
-  bool ok = AllocateBlock( blockNum );
+bool Atlas::Insert( unsigned int id, unsigned int blockWidth, unsigned int blockHeight )
+{
+  DALI_ASSERT_DEBUG( blockWidth > 0 && blockHeight > 0 );
+
+  Block block;
+  block.width = blockWidth;
+  block.height = blockHeight;
+
+  bool ok = ( blockWidth == 1u && blockHeight == 1u ) ? AllocateBlock( block ) : AllocateBlocks( block );
 
   if (!ok)
   {
-    DALI_ASSERT_DEBUG( 0 && "Atlas full ");
     // Atlas full
     return false;
   }
 
   DALI_ASSERT_ALWAYS( mBlockLookup.find(id) == mBlockLookup.end() && "Inserted duplicate id into the atlas" );
 
-  // store the link between block number and unique id
-  mBlockLookup[id] = blockNum;
+  // store the link between the blocks and unique id
+  mBlockLookup[id] = block;
 
 #ifdef DEBUG_ATLAS
-  DebugPrintAtlas( mFreeBlocks, GetBlocksPerRow() );
+  DebugPrintAtlas( mRows, GetBlocksPerRow() );
 #endif
 
   return true;
@@ -163,14 +185,14 @@ bool Atlas::Insert( unsigned int id)
 
 void Atlas::Remove(unsigned int id)
 {
-  BlockLookup::const_iterator iter = mBlockLookup.find( id );
+  BlockLookup::iterator iter = mBlockLookup.find( id );
 
   DALI_ASSERT_ALWAYS( iter != mBlockLookup.end() && "Failed to find id in atlas\n");
 
-  DeAllocateBlock( (*iter).second );
+  DeAllocateBlocks( (*iter).second );
 
   // remove the id from the lookup
-  mBlockLookup.erase( id );
+  mBlockLookup.erase( iter );
 }
 
 unsigned int Atlas::GetSize() const
@@ -182,8 +204,7 @@ void Atlas::GetXYPosition( unsigned int id, unsigned int& xPos, unsigned int& yP
 {
   AtlasItem item;
 
-  unsigned int blockNum( GetBlockNumber( id ) );
-  FillAtlasItem( blockNum, item, DONT_CALCULATE_UV );
+  FillAtlasItem( GetBlock( id ), item, DONT_CALCULATE_UV );
 
   xPos = item.xPos;
   yPos = item.yPos;
@@ -193,74 +214,122 @@ UvRect Atlas::GetUvCoordinates( unsigned int id ) const
 {
   AtlasItem item;
 
-  unsigned int blockNum( GetBlockNumber( id ) );
-  FillAtlasItem( blockNum, item, CALCULATE_UV );
+  FillAtlasItem( GetBlock( id ), item, CALCULATE_UV );
 
   return item.uv;
 }
 
 Atlas::Atlas()
 :mSize( 0 ),
- mBlockSize( 0 )
+ mBlockSize( 0 ),
+ mRowMask( 0 )
 {
 
 }
 
-bool Atlas::AllocateBlock( unsigned int& blockNum )
+bool Atlas::AllocateBlock( Block& block )
 {
-  // scan the bitmask for a free block
-  // each byte is a bitmask for 8 blocks, so 0000 0011, means blocks 1 and 2 are allocated
-  for( size_t i = 0, end = mFreeBlocks.size(); i < end; ++i )
+  // find the first row which isn't full, using the summary
+  for( std::size_t i = 0, end = mFullRows.size(); i < end; ++i )
   {
-    // check if a free bit is available
-    unsigned char mask = mFreeBlocks[i];
-    if( 0xFF != mask)
+    const uint64_t notFullRows = ~mFullRows[i];
+    if( 0u != notFullRows )
     {
-      for( int n = 0; n < 8 ; n++)
-      {
-        // check if a bit is not set.
-        if( ! (mask & (1 << n) ) )
-        {
-          // we have found a free bit, set it to 1.
-          mask|= (1 << n);
-          blockNum = i * 8 + n;
-          mFreeBlocks[i] = mask;
-
-          return true;
-        }
-      }
+      const unsigned int row = i * MAX_BLOCKS_PER_ROW + FindFirstSetBit( notFullRows );
+
+      // then the first free block in the row
+      block.row = row;
+      block.column = FindFirstSetBit( ~mRows[ row ] & mRowMask );
+
+      MarkBlocks( block, true );
+
+      return true;
     }
   }
-  blockNum = 0;
   return false;
 }
 
-void Atlas::DeAllocateBlock( unsigned int blockNum )
+bool Atlas::AllocateBlocks( Block& block )
 {
-  unsigned int bytePos,bitPos;
+  const unsigned int blocksPerRow = GetBlocksPerRow();
+
+  if( block.width > blocksPerRow || block.height > blocksPerRow )
+  {
+    return false;
+  }
+
+  for( unsigned int row = 0, lastRow = blocksPerRow - block.height; row <= lastRow; ++row )
+  {
+    // the columns which are free in every row the rectangle would cover
+    uint64_t allocated = 0u;
+    for( unsigned int i = 0; i < block.height; ++i )
+    {
+      allocated |= mRows[ row + i ];
+    }
+    const uint64_t freeColumns = ~allocated & mRowMask;
+
+    // a bit remains set, for each column which starts a free run of the required width
+    uint64_t runStarts = freeColumns;
+    for( unsigned int i = 1; i < block.width && 0u != runStarts; ++i )
+    {
+      runStarts &= freeColumns >> i;
+    }
 
-  GetByteAndBitPosition( blockNum, bytePos, bitPos );
+    if( 0u != runStarts )
+    {
+      block.row = row;
+      block.column = FindFirstSetBit( runStarts );
 
-  unsigned char mask = mFreeBlocks[ bytePos ];
+      MarkBlocks( block, true );
 
-  // check the block was allocated
-  DALI_ASSERT_DEBUG( ((mask & (1<< bitPos))) && "DeAllocated a block, that was never allocated" );
+      return true;
+    }
+  }
+  return false;
+}
 
-  // clear the bit
-  mask &= ~(1 << bitPos);
+void Atlas::DeAllocateBlocks( const Block& block )
+{
+  MarkBlocks( block, false );
+}
 
-  mFreeBlocks[ bytePos ] = mask;
+void Atlas::MarkBlocks( const Block& block, bool allocated )
+{
+  const uint64_t columns = GetLowBits( block.width ) << block.column;
 
+  for( unsigned int row = block.row, endRow = block.row + block.height; row < endRow; ++row )
+  {
+    uint64_t& mask = mRows.at( row );
+    uint64_t& fullRows = mFullRows[ row / MAX_BLOCKS_PER_ROW ];
+    const uint64_t rowBit = static_cast< uint64_t >( 1u ) << ( row % MAX_BLOCKS_PER_ROW );
+
+    if( allocated )
+    {
+      mask |= columns; // set the bits to mark as allocated
+
+      if( mask == mRowMask )
+      {
+        fullRows |= rowBit;
+      }
+    }
+    else
+    {
+      // check the blocks were allocated
+      DALI_ASSERT_DEBUG( ( ( mask & columns ) == columns ) && "DeAllocated a block, that was never allocated" );
+
+      // clear the bits
+      mask &= ~columns;
+      fullRows &= ~rowBit;
+    }
+  }
 }
 
-void Atlas::FillAtlasItem( unsigned int blockNum, AtlasItem& atlasItem, UvMode mode ) const
+void Atlas::FillAtlasItem( const Block& block, AtlasItem& atlasItem, UvMode mode ) const
 {
   UvRect& uv(atlasItem.uv);
 
-  unsigned int block1dPos = blockNum * mBlockSize;
-
-  unsigned int blockX = block1dPos  % mSize;
-  unsigned int blockY = mBlockSize * floor( block1dPos / mSize ) ;
+  unsigned int blockX = block.column * mBlockSize;
+  unsigned int blockY = block.row * mBlockSize;
 
   atlasItem.xPos = blockX;
   atlasItem.yPos = blockY;
@@ -273,12 +342,12 @@ void Atlas::FillAtlasItem( unsigned int blockNum, AtlasItem& atlasItem, UvMode m
 
   uv.u0 = ratio * (blockX);
   uv.v0 = ratio * (blockY);
-  uv.u2 = ratio * (blockX + mBlockSize);
-  uv.v2 =  ratio * (blockY + mBlockSize);
+  uv.u2 = ratio * (blockX + mBlockSize * block.width);
+  uv.v2 =  ratio * (blockY + mBlockSize * block.height);
 
 }
 
-unsigned int Atlas::GetBlockNumber( unsigned int id) const
+const Atlas::Block& Atlas::GetBlock( unsigned int id) const
 {
   BlockLookup::const_iterator iter = mBlockLookup.find( id );
 
@@ -292,36 +361,6 @@ unsigned int Atlas::GetBlocksPerRow() const
   return  mSize / mBlockSize;
 }
 
-void Atlas::GetPositionOfBlock( unsigned int block1dPos, unsigned int& row, unsigned int& column )
-{
-  column = 0;
-  if( block1dPos > 0)
-  {
-    column =  block1dPos % GetBlocksPerRow();
-  }
-  row =  floor( block1dPos / GetBlocksPerRow() ) ;
-
-  unsigned int bytePos, bitPos;
-
-  GetByteAndBitPosition( block1dPos, bytePos, bitPos );
-}
-
-unsigned int Atlas::AllocateBlock( unsigned int row, unsigned int column )
-{
-  unsigned int blockNum = (row * GetBlocksPerRow()) + column;
-
-  unsigned int bytePos, bitPos;
-
-  GetByteAndBitPosition( blockNum, bytePos, bitPos );
-
-  unsigned char& mask = mFreeBlocks.at( bytePos);
-
-  mask |= 1<< bitPos; // set the bit to mark as allocated
-
-  return blockNum;
-}
-
-
 } // namespace Internal
 
 } // namespace Dali
@@ -23,6 +23,9 @@
 #include <dali/internal/render/common/uv-rect.h>
 #include <dali/internal/event/text/atlas/atlas-uv-interface.h>
 
+// EXTERNAL INCLUDES
+#include <stdint.h>
+
 namespace Dali
 {
 
@@ -36,11 +39,12 @@ namespace Internal
  * Note: There is no physical storage done, the class just maps out where
  * blocks should be placed in the texture.
  *
- * The class uses a bitmask to represent which blocks are used.
+ * The class uses a bitmask to represent which blocks are used; each row of
+ * the atlas is held in a 64 bit word, so an atlas has at most 64 blocks per row.
  * E.g if we have a simple 8 x 8 block Atlas. It would be represent like:
  *
- * 0000 0000    ( one byte)
- * 0000 0000
+ * 0000 0000    ( row 0, bits 0 to 7 )
+ * 0000 0000    ( row 1 )
  * 0000 0000
  * 0000 0000.
  *
@@ -51,7 +55,10 @@ namespace Internal
  * .... ....
  * Means blocks 0,1,2,7 and 13 are allocated.
  *
- * Internally instead of having a 2D array, the bitmask is just a 1D array.
+ * A second bitmask summarises which rows are full, so a free block is found with
+ * a count-trailing-zeros on the summary, followed by one on the row; rather than scanning every block.
+ *
+ * An item may also span a rectangle of blocks, e.g. for a glyph at a large point size.
  *
  * The class also provides an API to access the position and texture coordinates of each block.
  *
@@ -89,6 +96,16 @@ public:
    */
   bool Insert( unsigned int id );
 
+  /**
+   * Inserts a rectangle of blocks in to the atlas.
+   *
+   * @param[in] id, a user defined unique id, which can be used to delete the blocks in the future
+   * @param[in] blockWidth the width of the rectangle in blocks
+   * @param[in] blockHeight the height of the rectangle in blocks
+   * @return true on success, false if there is no space in the atlas
+   */
+  bool Insert( unsigned int id, unsigned int blockWidth, unsigned int blockHeight );
+
   /**
    * Remove a block from the atlas
    * @param[in] id, a unique id of the block to be deleted
@@ -131,17 +148,42 @@ private:
   Atlas& operator=( const Atlas& );
 
   /**
-   * Allocate a block in the atlas
-   * @param[out] blockNum assigned a free block number
+   * The position and size of an item, in blocks
+   */
+  struct Block
+  {
+    unsigned int row;     ///< row of the top left block
+    unsigned int column;  ///< column of the top left block
+    unsigned int width;   ///< width in blocks
+    unsigned int height;  ///< height in blocks
+  };
+
+  /**
+   * Allocate a single block in the atlas
+   * @param[out] block assigned a free block
+   * @return true on success, false if the atlas is full
+   */
+  bool AllocateBlock( Block& block );
+
+  /**
+   * Allocate a rectangle of blocks in the atlas.
+   * @param[in,out] block the width and height are used, the row and column are assigned
+   * @return true on success, false if there is no space
    */
-  bool AllocateBlock( unsigned int& blockNum );
+  bool AllocateBlocks( Block& block );
 
+  /**
+   * De-allocate the blocks of an item
+   * @param[in] block the blocks to mark as free
+   */
+  void DeAllocateBlocks( const Block& block );
 
   /**
-   * De-allocate a block in the atlas
-   * @param[in] blockNum the block number to mark as free
+   * Set or clear the bits of a rectangle of blocks, and update the full row summary.
+   * @param[in] block the blocks
+   * @param[in] allocated whether to mark the blocks as allocated or free
    */
-  void DeAllocateBlock( unsigned int blockNum );
+  void MarkBlocks( const Block& block, bool allocated );
 
    /**
     * Used to control whether the uv-coordinates are generated
@@ -180,19 +222,19 @@ private:
    };
 
   /**
-   * Allocate a block in the atlas
-   * @param[in] blockNum the block number
+   * Fill in the position and uv-coordinates of an item
+   * @param[in] block the blocks of the item
    * @param[out] atlasItem filled with information about the block
    * @param[in] mode whether to generate uv-coordinates or not
    */
-  void FillAtlasItem( unsigned int blockNum, AtlasItem& atlasItem, UvMode mode) const;
+  void FillAtlasItem( const Block& block, AtlasItem& atlasItem, UvMode mode) const;
 
   /**
-   * Given a unique ID, returns the block number
+   * Given a unique ID, returns the blocks of the item
    * @param[in] id unique user defined id
-   * @return block number
+   * @return the blocks
    */
-  unsigned int GetBlockNumber( unsigned int id) const;
+  const Block& GetBlock( unsigned int id) const;
 
   /**
    * Gets the blocks per row. E.g. a 4 x 4 Atlas will return 4.
@@ -201,46 +243,21 @@ private:
   unsigned int GetBlocksPerRow( ) const;
 
   /**
-   * Returns if a block is allocated or not, along with the unique id of the block
-   * @param[in] row block row
-   * @param[in] column block column
-   * @param[out] id unique id
-   * @return true if block is allocated
-   */
-  bool IsBlockAllocated( unsigned int row, unsigned int column, unsigned int& id );
-
-  /**
-   * Gets a position of the block within the atlas.
-   * E.g. In a 8 x 8 Atlas, block 8 (zero based) with have row = 1, col = 0.
-   *
-   * @param[in] block1dPos block id
-   * @param[out] row atlas row
-   * @param[out] column atlas column
-   */
-  void GetPositionOfBlock( unsigned int block1dPos, unsigned int& row, unsigned int& column );
-
-  /**
-   * Mark a block as a allocated
-   * @param[in] row atlas row
-   * @param[in] column atlas column
-   * @return the id of the block that was allocated
-   */
-  unsigned int AllocateBlock( unsigned int row, unsigned int column );
-
-  /**
-   * Lookup between a user defined unique id, and a block number
+   * Lookup between a user defined unique id, and the blocks of the item
    */
-  typedef std::map< unsigned int /* user defined id */, unsigned int /* block num */ >   BlockLookup;
+  typedef std::map< unsigned int /* user defined id */, Block >   BlockLookup;
 
   /**
-   * Bitmask, each bit set represents an allocated block
+   * Bitmask, each bit set represents an allocated block or a full row
    */
-  typedef std::vector<unsigned char> FreeBlocks;
+  typedef std::vector< uint64_t > BitMask;
 
   unsigned int  mSize;                    ///< The size of the atlas
   unsigned int  mBlockSize;               ///< The block size
-  FreeBlocks    mFreeBlocks;              ///< Bitmask of free blocks
-  BlockLookup   mBlockLookup;             ///< lookup between block number and unique id given by user
+  uint64_t      mRowMask;                 ///< The bits of a row, which are within the atlas
+  BitMask       mRows;                    ///< Bitmask of allocated blocks, one word per row
+  BitMask       mFullRows;                ///< Bitmask of full rows, one bit per row
+  BlockLookup   mBlockLookup;             ///< lookup between unique id given by user and the blocks
 
 
 }; // class Atlas
@@ -45,39 +45,30 @@ namespace Internal
 namespace
 {
 
-unsigned int GetBlockId( unsigned int blockIndex, const BlockLookup* blockLookup)
+unsigned int GetBlockId( unsigned int blockIndex, const BlockIdLookup* blockLookup)
 {
-  // this is a reverse lookup between the block number and the character code
-  BlockLookup::const_iterator endIter = blockLookup->end();
-  for(BlockLookup::const_iterator iter = blockLookup->begin(); iter != endIter; ++iter )
+  // this is a lookup between the block number and the character code
+  BlockIdLookup::const_iterator iter = blockLookup->find( blockIndex );
+  if( iter != blockLookup->end() )
   {
+    unsigned int charCode;
+    FontId fontId;
 
-    if( blockIndex ==  (*iter).second )
-    {
-      unsigned int charCode;
-      FontId fontId;
-
-      // the value stored in the lookup is encoded to CharacterCode | Font Id
-      GlyphStatus::GetDecodedValue( (*iter).first , charCode, fontId);
+    // the value stored in the lookup is encoded to CharacterCode | Font Id
+    GlyphStatus::GetDecodedValue( (*iter).second , charCode, fontId);
 
-      return charCode;
-    }
+    return charCode;
   }
   return -1;
 }
 
-void PrintByte( unsigned int byteIndex, unsigned char block, const BlockLookup* blockLookup,  unsigned int blocksPerRows )
+void PrintRow( unsigned int rowIndex, uint64_t row, const BlockIdLookup* blockLookup,  unsigned int blocksPerRow )
 {
-  for( unsigned int n = 0; n < 8; ++n)
+  for( unsigned int n = 0; n < blocksPerRow; ++n)
   {
-    unsigned int blockNum = (byteIndex * 8) + n;  // 8 blocks per byte
-
-    if(( blockNum > 0) && ( blockNum % blocksPerRows) == 0 )
-    {
-      std::cout << std::endl;
-    }
+    unsigned int blockNum = (rowIndex * blocksPerRow) + n;
 
-    bool bitset= block& (1<<n);
+    bool bitset= row & ( static_cast<uint64_t>( 1u ) << n );
 
     if( bitset )
     {
@@ -97,6 +88,7 @@ void PrintByte( unsigned int byteIndex, unsigned char block, const BlockLookup*
       }
     }
   }
+  std::cout << std::endl;
 }
 
 } // un-named namespace
@@ -108,15 +100,14 @@ void DebugPrintAtlas( const FreeBlocks& blocks,
 
   for( std::size_t i = 0 ; i < blocks.size() ; ++i)
   {
-    unsigned char block = blocks[i];
-    PrintByte( i, block, NULL, blocksPerRow );
+    PrintRow( i, blocks[i], NULL, blocksPerRow );
   }
-  std::cout << std::endl << "-------------- " << std::endl;
+  std::cout << "-------------- " << std::endl;
 }
 
 
 void DebugPrintAtlasWithIds( const FreeBlocks& blocks,
-                             const BlockLookup& blockLookup,
+                             const BlockIdLookup& blockLookup,
                              unsigned int blocksPerRow)
 
 {
@@ -125,10 +116,9 @@ void DebugPrintAtlasWithIds( const FreeBlocks& blocks,
 
   for( std::size_t i = 0 ; i < blocks.size() ; ++i)
   {
-    unsigned char block = blocks[i];
-    PrintByte( i, block, &blockLookup, blocksPerRow  );
+    PrintRow( i, blocks[i], &blockLookup, blocksPerRow  );
   }
-  std::cout << std::endl << "-------------- " << std::endl;
+  std::cout << "-------------- " << std::endl;
 
 }
 
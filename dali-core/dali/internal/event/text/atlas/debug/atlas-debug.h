@@ -39,6 +39,9 @@ extern Debug::Filter* gTextAtlasLogFilter;
 #include <dali/public-api/common/vector-wrapper.h>
 #include <dali/public-api/common/map-wrapper.h>
 
+// EXTERNAL INCLUDES
+#include <stdint.h>
+
 namespace Dali
 {
 namespace Internal
@@ -47,14 +50,14 @@ namespace Internal
 // typedefs below are only defined if DEBUG_ATLAS is defined
 
 /**
- * lookup typedef between a block and a character code.
+ * lookup typedef between the top left block of an item and a character code.
  */
-typedef std::map< unsigned int /* used defined id */, unsigned int /* block num */ >   BlockLookup;
+typedef std::map< unsigned int /* block num */, unsigned int /* used defined id */ >   BlockIdLookup;
 
 /**
- * array of bytes. Each bit represents an allocation block
+ * array of rows. Each bit represents an allocation block
  */
-typedef std::vector<unsigned char> FreeBlocks;
+typedef std::vector<uint64_t> FreeBlocks;
 
 /**
  * Print the atlas. E.g. for a 4x4 atlas print
@@ -64,7 +67,7 @@ typedef std::vector<unsigned char> FreeBlocks;
  * _ _ _ _
  *
  * The 1's represent an allocated block
- * @param blocks Array of bytes, each bit set represents an allocated block
+ * @param blocks Array of rows, each bit set represents an allocated block
  * @param blocksPerRow how blocks per row. E.g. for a 4x4 atlas, it is 4 blocks per row
  */
 void DebugPrintAtlas( const FreeBlocks& blocks,
@@ -75,12 +78,12 @@ void DebugPrintAtlas( const FreeBlocks& blocks,
  * E.g.
  * 1 (34) 1(65) 1(13)  _
  * _      _     _      _
- * @param blocks Array of bytes, each bit set represents an allocated block
- * @param blockLookup lookup that maps a block id, to a character id
+ * @param blocks Array of rows, each bit set represents an allocated block
+ * @param blockLookup lookup that maps a block number, to a character id
  * @param blocksPerRow how blocks per row. E.g. for a 4x4 atlas, it is 4 blocks per row
  */
 void DebugPrintAtlasWithIds( const FreeBlocks& blocks,
-                             const BlockLookup& blockLookup,
+                             const BlockIdLookup& blockLookup,
                              unsigned int blocksPerRow);
 
 
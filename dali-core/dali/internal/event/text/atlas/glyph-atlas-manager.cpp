@@ -54,10 +54,10 @@ TextVertexBuffer* GlyphAtlasManager::TextRequired( const TextArray& text ,
   // find the atlas which is best suited to displaying the text string
   GlyphAtlas* atlas  = FindAtlas( text, format, fontId, bestRank);
 
-  // if the atlas is full, create a new larger one
+  // if the atlas is full and below the page size, create a new larger one
   if( bestRank.GetSpaceStatus() == AtlasRanking::FULL_CAN_BE_RESIZED )
   {
-    atlas = CreateLargerAtlas( atlas );
+    atlas = CreateLargerAtlas( atlas, atlas->GetRequiredCharacterCount( text, format, fontId ) );
   }
 
   // assign the text to it
@@ -118,6 +118,9 @@ void GlyphAtlasManager::SendTextRequests()
     mAtlasesChanged = false;
   }
 
+  // free the textures of atlas pages which are no longer used by any text
+  ReleaseUnusedAtlases();
+
   // this is called at the end of an event cycle.
   // Each atlas builds up a list of text load requests
   // We grab the requests here and pass them on to glyph-resource-manager
@@ -167,8 +170,12 @@ GlyphAtlas* GlyphAtlasManager::FindAtlas( const TextArray& text ,  const TextFor
     return CreateAtlas( size );
   }
 
-  // go through each atlas finding the best match
+  // go through each atlas finding the best match.
+  // An atlas the text fits in is preferred to one which has to be resized; dead characters
+  // (ref count of zero) count as free space, as they are replaced in the existing texture.
   GlyphAtlas* bestMatch( NULL );
+  GlyphAtlas* bestResizable( NULL );
+  AtlasRanking bestResizableRank( text.size() );
 
   for( std::size_t i = 0, atlasCount = mAtlasList.Size() ; i < atlasCount ; ++i )
   {
@@ -176,19 +183,45 @@ GlyphAtlas* GlyphAtlasManager::FindAtlas( const TextArray& text ,  const TextFor
 
     AtlasRanking rank =  atlas.GetRanking( searchText , fontId );
 
-    if( bestRank.HigherRanked( rank ) == false)
+    if( rank.TextFits() )
     {
-      bestMatch = &atlas;
-      bestRank = rank;
+      if( bestRank.HigherRanked( rank ) == false)
+      {
+        bestMatch = &atlas;
+        bestRank = rank;
+      }
+
+      if( rank.AllCharactersMatched() )
+      {
+        // break if an atlas is found which has all the glyphs loaded
+        break;
+      }
     }
-
-    if( rank.AllCharactersMatched() )
+    else if( rank.GetSpaceStatus() == AtlasRanking::FULL_CAN_BE_RESIZED )
     {
-      // break if an atlas is found which has all the glyphs loaded
-      break;
+      if( bestResizableRank.HigherRanked( rank ) == false )
+      {
+        bestResizable = &atlas;
+        bestResizableRank = rank;
+      }
     }
   }
-  return bestMatch;
+
+  if( bestMatch )
+  {
+    return bestMatch;
+  }
+
+  if( bestResizable )
+  {
+    bestRank = bestResizableRank;
+    return bestResizable;
+  }
+
+  // every atlas is full and has reached the page size, so add another page
+  DALI_LOG_INFO(gTextAtlasLogFilter, Debug::General, "GlyphAtlasManager::FindAtlas() adding atlas page %u\n", static_cast<unsigned int>( mAtlasList.Count() + 1 ) );
+
+  return CreateAtlas( GlyphAtlasSize::GetInitialSize( searchText.size() ) );
 }
 
 void GlyphAtlasManager::AddAtlas( GlyphAtlas* atlas)
@@ -242,16 +275,18 @@ GlyphAtlas& GlyphAtlasManager::GetAtlas( unsigned int textureId ) const
   DALI_ASSERT_ALWAYS( 0 && "Atlas not found");
 }
 
-GlyphAtlas* GlyphAtlasManager::CreateLargerAtlas( GlyphAtlas* atlas )
+GlyphAtlas* GlyphAtlasManager::CreateLargerAtlas( GlyphAtlas* atlas, unsigned int characterCount )
 {
-  if( atlas->GetSize() ==  GlyphAtlasSize::GetMaxSize() )
-  {
-    // @todo implement atlas splitting
-    DALI_ASSERT_ALWAYS(0 && "Atlas reached max size");
-  }
+  // atlases at the page size are never resized, see FindAtlas()
+  DALI_ASSERT_DEBUG( atlas->GetSize() < GlyphAtlasSize::GetMaxPageSize() );
 
-  // Create a new bigger atlas
+  // Create a new bigger atlas, growing it by as many steps as the text needs
   unsigned int biggerSize = GlyphAtlasSize::GetNextSize( atlas->GetSize() );
+  while( ( GlyphAtlasSize::GetAtlasCharacterCount( biggerSize ) < characterCount ) &&
+         ( biggerSize < GlyphAtlasSize::GetMaxPageSize() ) )
+  {
+    biggerSize = GlyphAtlasSize::GetNextSize( biggerSize );
+  }
 
   GlyphAtlas* newAtlas = GlyphAtlas::New( biggerSize );
 
@@ -269,6 +304,39 @@ GlyphAtlas* GlyphAtlasManager::CreateLargerAtlas( GlyphAtlas* atlas )
   return newAtlas;
 }
 
+void GlyphAtlasManager::ReleaseUnusedAtlases()
+{
+  // One unused atlas is kept, as its dead characters may be used again, and
+  // to avoid creating a texture for each new string.
+  bool unusedAtlasKept( false );
+
+  std::size_t i = 0;
+  while( i < mAtlasList.Size() )
+  {
+    GlyphAtlas* atlas( mAtlasList[i] );
+
+    if( atlas->IsUnused() &&
+        !atlas->HasPendingRequests() &&
+        atlas->GetTextureState() == GlyphResourceObserver::NO_CHANGE )
+    {
+      if( unusedAtlasKept )
+      {
+        DALI_LOG_INFO(gTextAtlasLogFilter, Debug::General, "GlyphAtlasManager::ReleaseUnusedAtlases() texture %d\n", atlas->GetTextureId() );
+
+        unsigned int textureId = atlas->GetTextureId();
+
+        // the atlas is deleted
+        RemoveAtlas( atlas );
+
+        mGlyphResourceManager.DeleteTexture( textureId );
+        continue;
+      }
+      unusedAtlasKept = true;
+    }
+    ++i;
+  }
+}
+
 void GlyphAtlasManager::NotifyAtlasObservers()
 {
   DALI_LOG_INFO(gTextAtlasLogFilter, Debug::General, "GlyphAtlasManager::NotifyAtlasObservers()\n");
@@ -277,9 +345,10 @@ void GlyphAtlasManager::NotifyAtlasObservers()
   {
     GlyphAtlas& atlas( *mAtlasList[i] );
 
-    Integration::ResourceId newTexture;
-    TextureIdList oldTextures;
-    atlas.GetNewTextureId( oldTextures, newTexture );
+    // the replaced textures are only deleted once the glyphs have been loaded in to the new texture,
+    // by GlyphResourceManager::DeleteOldTextures(), so they are not cleared from the atlas here
+    Integration::ResourceId newTexture = atlas.GetTextureId();
+    TextureIdList oldTextures = atlas.GetTextureIdOfReplacedAtlas();
 
     // copy this list so, the observers can remove themselves during the call back
     TextureObserverList observerList( mTextureObservers );
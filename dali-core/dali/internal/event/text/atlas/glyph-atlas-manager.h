@@ -36,9 +36,14 @@ namespace Internal
  *
  * Glyph atlas manager does the following:
  * - Creates Atlases
- * - Resizes Atlases
+ * - Resizes Atlases, up to GlyphAtlasSize::GetMaxPageSize()
+ * - Adds Atlas pages, when every atlas is full and has reached the page size
+ * - Releases the textures of Atlas pages, which are no longer used by any text
  * - Finds the best atlas given a string of text
  *
+ * Within an atlas, characters with a ref count of zero are replaced
+ * oldest first, by uploading the new character to the same position in the texture.
+ *
  * GlyphAtlasManagerInterface provides:
  *
  * - Text Vertex creation from a string of text
@@ -134,7 +139,8 @@ private:
   GlyphAtlas* CreateAtlas( unsigned int size );
 
   /**
-   * Find the most suitable atlas for a string of text
+   * Find the most suitable atlas for a string of text.
+   * If the text does not fit in any atlas, and no atlas can be resized, a new atlas page is created.
    * @param[in] text text array
    * @param[in] format text format
    * @param[in] font id
@@ -166,12 +172,20 @@ private:
   GlyphAtlas& GetAtlas( unsigned int textureId ) const;
 
   /**
-   * Takes an atlas and returns a bigger version.
+   * Takes an atlas and returns a bigger version, which holds at least the given number of characters.
    * The old atlas is deleted.
+   * @pre the atlas is smaller than GlyphAtlasSize::GetMaxPageSize()
    * @param atlas the atlas to make bigger
+   * @param characterCount the number of characters the atlas has to hold, up to the page size
    * @returns a bigger atlas
    */
-  GlyphAtlas* CreateLargerAtlas( GlyphAtlas* atlas );
+  GlyphAtlas* CreateLargerAtlas( GlyphAtlas* atlas, unsigned int characterCount );
+
+  /**
+   * Delete atlases, and their textures, which hold no referenced characters.
+   * This keeps the texture memory used by text proportional to the text in use.
+   */
+  void ReleaseUnusedAtlases();
 
   /**
    * Notify atlas observers that the texture has changed. Note, this no longer means
@@ -121,6 +121,21 @@ bool GlyphAtlas::IsTextLoaded( const TextArray& text, const TextFormat &format,
   return mGlyphContainer.IsTextLoaded( text, fontId );
 }
 
+unsigned int GlyphAtlas::GetRequiredCharacterCount( const TextArray& text, const TextFormat &format, FontId fontId ) const
+{
+  TextArray searchText( text );
+  if( format.IsUnderLined() )
+  {
+    searchText.push_back( format.GetUnderLineCharacter() );
+  }
+
+  unsigned int charsNotLoaded( 0 );
+  bool fitsInContainer( false );
+  mGlyphContainer.GetTextStatus( searchText, fontId, charsNotLoaded, fitsInContainer );
+
+  return mGlyphContainer.GetNumberOfReferencedCharacters() + charsNotLoaded;
+}
+
 void GlyphAtlas::CloneContents( GlyphAtlas* oldAtlas)
 {
   // ensure this atlas is empty
@@ -184,6 +199,11 @@ void GlyphAtlas::Clear()
   mGlyphContainer.ClearContents();
 }
 
+bool GlyphAtlas::IsUnused() const
+{
+  return mGlyphContainer.Empty();
+}
+
 bool GlyphAtlas::HasReplacedTexture( unsigned int textureId )
 {
   for( std::size_t i = 0, count = mTextureIdOfReplacedAtlases.size(); i < count; ++i )
@@ -387,7 +407,8 @@ GlyphResourceRequest& GlyphAtlas::GetResourceRequest( FontId fontId, GlyphResour
 
 bool GlyphAtlas::Resizable() const
 {
-  return (GetSize() <  GlyphAtlasSize::GetMaxSize() );
+  // beyond the page size, additional atlas pages are created instead
+  return (GetSize() <  GlyphAtlasSize::GetMaxPageSize() );
 }
 
 TextureIdList GlyphAtlas::GetTextureIdOfReplacedAtlas()
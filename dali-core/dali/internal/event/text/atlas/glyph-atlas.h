@@ -143,6 +143,16 @@ public:
    */
   bool IsTextLoaded( const TextArray& text, const TextFormat &format, FontId fontId) const;
 
+  /**
+   * Get the number of characters the atlas has to hold, to store the text
+   * as well as the characters which are already referenced.
+   * @param[in] text the text
+   * @param[in] format the text format
+   * @param[in] fontId the font id
+   * @return the number of characters
+   */
+  unsigned int GetRequiredCharacterCount( const TextArray& text, const TextFormat &format, FontId fontId ) const;
+
   /**
    * Clone the contents of the atlas into this atlas
    * @param clone the atlas to clone
@@ -159,6 +169,22 @@ public:
    */
   void Clear();
 
+  /**
+   * Check whether any text is using the atlas.
+   * Characters with a ref count of zero are still cached in the texture, but are not in use.
+   * @return true if no characters are referenced
+   */
+  bool IsUnused() const;
+
+  /**
+   * Get a list of texture id's of Atlases this Atlas has replaced.
+   * It is possible an atlas can be resized multiple times in a single event cycle.
+   * So atlas 5, can be replaced by atlas 6, which is then replaced by atlas 7.
+   * Any text-attachments using atlas 5 & 6, need to know they should use atlas 7 now.
+   * @return texture id list
+   */
+  TextureIdList GetTextureIdOfReplacedAtlas();
+
   /**
    * Checks if this atlas has replaced a previous atlas with
    * a certain texture id.
@@ -252,15 +278,6 @@ private:
    */
   bool Resizable() const;
 
-  /**
-   * Get a list of texture id's of Atlases this Atlas has replaced.
-   * It is possible an atlas can be resized multiple times in a single event cycle.
-   * So atlas 5, can be replaced by atlas 6, which is then replaced by atlas 7.
-   * Any text-attachments using atlas 5 & 6, need to know they should use atlas 7 now.
-   * @return texture id list
-   */
-  TextureIdList GetTextureIdOfReplacedAtlas();
-
   /**
    * Private constructor, use GlyphAtlas::New()
    * @param[in] size used to define the width / height of the atlas
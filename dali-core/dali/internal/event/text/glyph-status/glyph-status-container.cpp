@@ -247,6 +247,14 @@ void GlyphStatusContainer::GetTextStatus( const TextArray& text,
   }
 }
 
+bool GlyphStatusContainer::ContainsFont( FontId fontId ) const
+{
+  // the lookup is sorted by font id, then character code; so find the first character of the font
+  StatusSet::const_iterator iter = mCharacterLookup.lower_bound( GlyphStatus( 0, fontId ) );
+
+  return ( iter != mCharacterLookup.end() ) && ( (*iter).GetFontId() == fontId );
+}
+
 void GlyphStatusContainer::CloneContents( const GlyphStatusContainer& clone )
 {
   // copy the lookup
@@ -311,6 +319,11 @@ unsigned int GlyphStatusContainer::GetSize() const
   return mContainerSize;
 }
 
+unsigned int GlyphStatusContainer::GetNumberOfReferencedCharacters() const
+{
+  return ( mContainerSize - TotalAvailableSpace() );
+}
+
 void GlyphStatusContainer::ClearContents()
 {
   mCharacterLookup.clear();
@@ -147,6 +147,13 @@ public:
                       unsigned int& charsNotLoaded,
                       bool& fitsInContainer ) const;
 
+  /**
+   * Check if the container holds any characters of a font, including dead characters.
+   * @param[in] fontId font id
+   * @return true if a character of the font is found
+   */
+  bool ContainsFont( FontId fontId ) const;
+
   /**
    * Clone the contents of one container, into this container
    * @param[in] clone the container to clone
@@ -175,6 +182,12 @@ public:
    */
   unsigned int GetSize() const;
 
+  /**
+   * Get the number of characters which have a ref count above zero.
+   * @return the number of referenced characters
+   */
+  unsigned int GetNumberOfReferencedCharacters() const;
+
   /**
    * Clear the container contents.
    */
@@ -74,6 +74,11 @@ unsigned int GlyphResourceManager::CreateTexture(unsigned int size )
   return ticket->GetId();
 }
 
+void GlyphResourceManager::DeleteTexture( unsigned int textureId )
+{
+  DeleteTextureTicket( textureId );
+}
+
 void GlyphResourceManager::AddObserver( GlyphResourceObserver& observer)
 {
   DALI_ASSERT_DEBUG( ( mObservers.find( &observer ) == mObservers.end() ) && "Observer already exists");
@@ -387,7 +392,7 @@ GlyphResourceObserver* GlyphResourceManager::GetObserver( Integration::ResourceI
 
 void GlyphResourceManager::DeleteTextureTicket(unsigned int id )
 {
-  TextureTickets::iterator endIter;
+  TextureTickets::iterator endIter = mTextureTickets.end();
 
   for( TextureTickets::iterator iter = mTextureTickets.begin();  iter != endIter; ++iter )
   {
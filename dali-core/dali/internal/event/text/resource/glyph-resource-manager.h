@@ -74,6 +74,13 @@ public:
    */
  unsigned int CreateTexture(unsigned int size );
 
+  /**
+   * Release a texture created with CreateTexture().
+   * The texture is discarded once it is no longer referenced.
+   * @param[in] textureId texture resource id
+   */
+  void DeleteTexture( unsigned int textureId );
+
   /**
    * Add a glyph resource observer
    * @param[in] observer The observer to add.
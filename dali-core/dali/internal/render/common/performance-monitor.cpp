@@ -28,6 +28,35 @@
 #include <dali/integration-api/platform-abstraction.h>
 
 
+namespace Dali
+{
+
+namespace Internal
+{
+
+const char* PerformanceMonitor::GetTraceName( Metric metricId )
+{
+  switch( metricId )
+  {
+    case FRAME_RATE:              return "Frame";
+    case UPDATE:                  return "Update";
+    case RESET_PROPERTIES:        return "ResetProperties";
+    case PROCESS_MESSAGES:        return "ProcessMessages";
+    case ANIMATE_NODES:           return "AnimateNodes";
+    case APPLY_CONSTRAINTS:       return "ApplyConstraints";
+    case UPDATE_NODES:            return "UpdateNodes";
+    case PREPARE_RENDERABLES:     return "PrepareRenderables";
+    case PROCESS_RENDER_TASKS:    return "ProcessRenderTasks";
+    case DRAW_NODES:              return "DrawNodes";
+    case UPDATE_DYNAMICS:         return "UpdateDynamics";
+    default:                      return "Unknown";
+  }
+}
+
+} // namespace Internal
+
+} // namespace Dali
+
 #if defined(PRINT_TIMERS) || defined(PRINT_COUNTERS) || defined(PRINT_DRAW_CALLS) || defined(PRINT_MATH_COUNTERS)
 
 namespace Dali
@@ -322,6 +351,8 @@ const MetricInfo MetricTable[] = {
   {  "NODE_COUNT            ",   PerformanceMonitor::NODE_COUNT,            PerformanceMetric::COUNTER },
   {  "NODES_DRAWN           ",   PerformanceMonitor::NODES_DRAWN,           PerformanceMetric::COUNTER },
   {  "MESSAGE_COUNT         ",   PerformanceMonitor::MESSAGE_COUNT,         PerformanceMetric::COUNTER },
+  {  "NODES_CULLED          ",   PerformanceMonitor::NODES_CULLED,          PerformanceMetric::INC_COUNTER },
+  {  "NODES_BATCHED         ",   PerformanceMonitor::NODES_BATCHED,         PerformanceMetric::INC_COUNTER },
   {  "NODES_ADDED           ",   PerformanceMonitor::NODES_ADDED,           PerformanceMetric::INC_COUNTER },
   {  "NODES_REMOVED         ",   PerformanceMonitor::NODES_REMOVED,         PerformanceMetric::INC_COUNTER },
   {  "ANIMATORS_APPLIED     ",   PerformanceMonitor::ANIMATORS_APPLIED,     PerformanceMetric::INC_COUNTER },
@@ -329,6 +360,8 @@ const MetricInfo MetricTable[] = {
   {  "CONSTRAINTS_SKIPPED   ",   PerformanceMonitor::CONSTRAINTS_SKIPPED,   PerformanceMetric::INC_COUNTER },
   {  "TEXTURE_STATE_CHANGES ",   PerformanceMonitor::TEXTURE_STATE_CHANGES, PerformanceMetric::INC_COUNTER },
   {  "SHADER_STATE_CHANGES  ",   PerformanceMonitor::SHADER_STATE_CHANGES,  PerformanceMetric::INC_COUNTER },
+  {  "SHADER_BINARY_HITS    ",   PerformanceMonitor::SHADER_BINARY_CACHE_HITS,   PerformanceMetric::INC_COUNTER },
+  {  "SHADER_BINARY_MISSES  ",   PerformanceMonitor::SHADER_BINARY_CACHE_MISSES, PerformanceMetric::INC_COUNTER },
   {  "BLEND_MODE_CHANGES    ",   PerformanceMonitor::BLEND_MODE_CHANGES,    PerformanceMetric::INC_COUNTER },
   {  "INDICIES              ",   PerformanceMonitor::INDICIE_COUNT,         PerformanceMetric::INC_COUNTER },
   {  "GL_DRAW_CALLS         ",   PerformanceMonitor::GL_DRAW_CALLS,         PerformanceMetric::INC_COUNTER },
@@ -19,6 +19,7 @@
 
 // INTERNAL INCLUDES
 #include <dali/public-api/common/map-wrapper.h>
+#include <dali/integration-api/trace.h>
 
 namespace Dali
 {
@@ -69,6 +70,8 @@ public:
     FRAME_RATE,
     NODE_COUNT,
     NODES_DRAWN,
+    NODES_CULLED,
+    NODES_BATCHED,
     NODES_ADDED,
     NODES_REMOVED,
     MESSAGE_COUNT,
@@ -77,6 +80,8 @@ public:
     FLOAT_POINT_MULTIPLY,
     TEXTURE_STATE_CHANGES,
     SHADER_STATE_CHANGES,
+    SHADER_BINARY_CACHE_HITS,
+    SHADER_BINARY_CACHE_MISSES,
     BLEND_MODE_CHANGES,
     GL_DRAW_CALLS,
     GL_DRAW_ELEMENTS,
@@ -114,6 +119,14 @@ public:
   void Set(Metric metricId, float Value);
   static PerformanceMonitor *Get();
 
+  /**
+   * Gets the name under which a timer is traced; timers are traced even if the performance monitor is disabled.
+   * @see Integration::Trace
+   * @param[in] metricId The timer
+   * @return The name of the timer
+   */
+  static const char* GetTraceName( Metric metricId );
+
 private:
 
   /**
@@ -143,11 +156,11 @@ private:
 #endif
 
 #ifdef PRINT_TIMERS
-#define PERF_MONITOR_START(x)  PerformanceMonitor::Get()->StartTimer(x)
-#define PERF_MONITOR_END(x)    PerformanceMonitor::Get()->EndTimer(x)
+#define PERF_MONITOR_START(x)  ( PerformanceMonitor::Get()->StartTimer(x), Integration::Trace::Start( PerformanceMonitor::GetTraceName(x) ) )
+#define PERF_MONITOR_END(x)    ( PerformanceMonitor::Get()->EndTimer(x), Integration::Trace::End( PerformanceMonitor::GetTraceName(x) ) )
 #else
-#define PERF_MONITOR_START(x)
-#define PERF_MONITOR_END(x)
+#define PERF_MONITOR_START(x)  Integration::Trace::Start( PerformanceMonitor::GetTraceName(x) )
+#define PERF_MONITOR_END(x)    Integration::Trace::End( PerformanceMonitor::GetTraceName(x) )
 #endif
 
 #ifdef PRINT_COUNTERS
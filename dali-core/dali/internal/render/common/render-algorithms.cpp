@@ -17,7 +17,11 @@
 // CLASS HEADER
 #include <dali/internal/render/common/render-algorithms.h>
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+
 // INTERNAL INCLUDES
+#include <dali/internal/render/common/performance-monitor.h>
 #include <dali/internal/render/common/render-debug.h>
 #include <dali/internal/render/common/render-list.h>
 #include <dali/internal/render/common/render-instruction.h>
@@ -46,13 +50,15 @@ namespace Render
  * @param[in] frameTime The elapsed time between the last two updates.
  * @param[in] viewMatrix The view matrix from the appropriate camera.
  * @param[in] projectionMatrix The projection matrix from the appropriate camera.
+ * @param[in] damagedArea The area being redrawn, or NULL if the whole surface is redrawn.
  */
 inline void ProcessRenderList( const RenderList& renderList,
                                Context& context,
                                BufferIndex bufferIndex,
                                float frameTime,
                                const Matrix& viewMatrix,
-                               const Matrix& projectionMatrix )
+                               const Matrix& projectionMatrix,
+                               const Rect<int>* damagedArea )
 {
   DALI_PRINT_RENDER_LIST( renderList );
 
@@ -62,7 +68,24 @@ inline void ProcessRenderList( const RenderList& renderList,
     context.SetScissorTest( true );
 
     const Dali::ClippingBox& clip = renderList.GetClippingBox();
-    context.Scissor(clip.x, clip.y, clip.width, clip.height);
+    if( NULL != damagedArea )
+    {
+      // Draw inside both the clipping box and the damaged area
+      const int left   = std::max( clip.x, damagedArea->x );
+      const int bottom = std::max( clip.y, damagedArea->y );
+      const int right  = std::min( clip.x + clip.width, damagedArea->x + damagedArea->width );
+      const int top    = std::min( clip.y + clip.height, damagedArea->y + damagedArea->height );
+      context.Scissor( left, bottom, std::max( right - left, 0 ), std::max( top - bottom, 0 ) );
+    }
+    else
+    {
+      context.Scissor(clip.x, clip.y, clip.width, clip.height);
+    }
+  }
+  else if( NULL != damagedArea )
+  {
+    context.SetScissorTest( true );
+    context.Scissor( damagedArea->x, damagedArea->y, damagedArea->width, damagedArea->height );
   }
   else
   {
@@ -104,23 +127,46 @@ inline void ProcessRenderList( const RenderList& renderList,
   }
 
   size_t count = renderList.Count();
-  for ( size_t index = 0; index < count; ++index )
+  size_t index = 0;
+  while( index < count )
   {
     const RenderItem& item = renderList.GetItem( index );
 
     DALI_PRINT_RENDER_ITEM( item );
 
     SceneGraph::Renderer* renderer = const_cast< SceneGraph::Renderer* >( item.GetRenderer() );
-    const Matrix& modelViewMatrix = item.GetModelViewMatrix();
 
-    renderer->Render( bufferIndex, modelViewMatrix, viewMatrix, projectionMatrix, frameTime );
+    // Consecutive items which share the same texture & GL state are drawn together.
+    // Only adjacent items are merged, so the sorted draw order is preserved.
+    size_t batchEnd = index + 1;
+    while( ( batchEnd < count ) &&
+           renderer->CanBatchWith( bufferIndex, *renderList.GetRenderer( batchEnd ) ) )
+    {
+      DALI_PRINT_RENDER_ITEM( renderList.GetItem( batchEnd ) );
+      INCREASE_COUNTER( PerformanceMonitor::NODES_BATCHED );
+      ++batchEnd;
+    }
+
+    if( batchEnd - index > 1 )
+    {
+      renderer->RenderBatch( bufferIndex, renderList, index, batchEnd - index, viewMatrix, projectionMatrix, frameTime );
+    }
+    else
+    {
+      const Matrix& modelViewMatrix = item.GetModelViewMatrix();
+
+      renderer->Render( bufferIndex, modelViewMatrix, viewMatrix, projectionMatrix, frameTime );
+    }
+
+    index = batchEnd;
   }
 }
 
 void ProcessRenderInstruction( const RenderInstruction& instruction,
                                Context& context,
                                BufferIndex bufferIndex,
-                               float frameTime )
+                               float frameTime,
+                               const Rect<int>* damagedArea )
 {
   DALI_PRINT_RENDER_INSTRUCTION( instruction );
 
@@ -141,7 +187,7 @@ void ProcessRenderInstruction( const RenderInstruction& instruction,
       if(  renderList &&
           !renderList->IsEmpty() )
       {
-        ProcessRenderList( *renderList, context, bufferIndex, frameTime, *viewMatrix, *projectionMatrix );
+        ProcessRenderList( *renderList, context, bufferIndex, frameTime, *viewMatrix, *projectionMatrix, damagedArea );
       }
     }
   }
@@ -18,6 +18,7 @@
 //
 
 // INTERNAL INCLUDES
+#include <dali/public-api/math/rect.h>
 #include <dali/internal/common/buffer-index.h>
 
 namespace Dali
@@ -42,11 +43,13 @@ namespace Render
  * @param[in] context The GL context.
  * @param[in] buffer The current render buffer index (previous update buffer)
  * @param[in] frameTime The elapsed time between the last two updates.
+ * @param[in] damagedArea The area being redrawn in GL window coordinates, or NULL if the whole surface is redrawn.
  */
 void ProcessRenderInstruction( const SceneGraph::RenderInstruction& instruction,
                                Context& context,
                                BufferIndex bufferIndex,
-                               float frameTime );
+                               float frameTime,
+                               const Rect<int>* damagedArea );
 
 } // namespace Render
 
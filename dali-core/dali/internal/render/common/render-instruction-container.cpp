@@ -30,10 +30,15 @@ namespace SceneGraph
 {
 
 RenderInstructionContainer::RenderInstructionContainer()
+: mNextUpdateCount( 1u )
 {
   // array initialisation in ctor initializer list not supported until C++ 11
-  mIndex[ 0 ] = 0u;
-  mIndex[ 1 ] = 0u;
+  for( unsigned int i = 0; i < NUM_SCENE_GRAPH_BUFFERS; ++i )
+  {
+    mIndex[ i ] = 0u;
+    mUpdateCount[ i ] = 0u;
+    mInstructionsPrepared[ i ] = true;
+  }
 }
 
 RenderInstructionContainer::~RenderInstructionContainer()
@@ -79,6 +84,21 @@ RenderInstruction& RenderInstructionContainer::At( BufferIndex bufferIndex, size
   return *mInstructions[ bufferIndex ][ index ];
 }
 
+void RenderInstructionContainer::UpdateCompleted( BufferIndex bufferIndex, bool instructionsPrepared )
+{
+  mUpdateCount[ bufferIndex ] = mNextUpdateCount++;
+  mInstructionsPrepared[ bufferIndex ] = instructionsPrepared;
+}
+
+unsigned int RenderInstructionContainer::GetUpdateCount( BufferIndex bufferIndex ) const
+{
+  return mUpdateCount[ bufferIndex ];
+}
+
+bool RenderInstructionContainer::WereInstructionsPrepared( BufferIndex bufferIndex ) const
+{
+  return mInstructionsPrepared[ bufferIndex ];
+}
 
 } // namespace SceneGraph
 
@@ -32,7 +32,7 @@ namespace SceneGraph
 class RenderInstruction;
 
 /**
- * Class to encapsulate double buffered render instruction data
+ * Class to encapsulate double (or triple) buffered render instruction data
  */
 class RenderInstructionContainer
 {
@@ -75,11 +75,36 @@ public:
    */
   RenderInstruction& At( BufferIndex bufferIndex, size_t index );
 
+  /**
+   * Called by the UpdateManager at the end of every update, to number the frames written to each buffer.
+   * @param bufferIndex which was written
+   * @param instructionsPrepared false if the update skipped preparing the instructions, as nothing
+   * changed since the previous frame; the buffer then holds instructions identical to those rendered last
+   */
+  void UpdateCompleted( BufferIndex bufferIndex, bool instructionsPrepared );
+
+  /**
+   * Get the number of the update which last wrote to a buffer
+   * @param bufferIndex to use
+   * @return the update count, incremented once per update
+   */
+  unsigned int GetUpdateCount( BufferIndex bufferIndex ) const;
+
+  /**
+   * Query whether the instructions of a buffer were prepared by the update which last wrote to it
+   * @param bufferIndex to use
+   * @return false if the instructions are identical to those of the previous frame
+   */
+  bool WereInstructionsPrepared( BufferIndex bufferIndex ) const;
+
 private:
 
-  unsigned int mIndex[ 2 ]; ///< count of the elements that have been added
+  unsigned int mIndex[ NUM_SCENE_GRAPH_BUFFERS ]; ///< count of the elements that have been added
+  unsigned int mUpdateCount[ NUM_SCENE_GRAPH_BUFFERS ]; ///< the number of the update which last wrote to each buffer
+  bool mInstructionsPrepared[ NUM_SCENE_GRAPH_BUFFERS ]; ///< whether that update prepared the instructions
+  unsigned int mNextUpdateCount; ///< the number given to the next update
   typedef OwnerContainer< RenderInstruction* > InstructionContainer;
-  InstructionContainer mInstructions[ 2 ]; /// Double buffered instruction lists
+  InstructionContainer mInstructions[ NUM_SCENE_GRAPH_BUFFERS ]; /// Buffered instruction lists
 
 };
 
@@ -38,6 +38,9 @@ RenderInstruction::RenderInstruction()
   mIsViewportSet( false ),
   mIsClearColorSet( false ),
   mOffscreenTextureId( 0 ),
+  mDamagedArea(),
+  mDamageTrackerId( 0 ),
+  mIsFullyDamaged( true ),
   mNextFreeRenderList( 0 )
 {
   // reserve 6 lists, which is enough for three layers with opaque and transparent things on
@@ -110,6 +113,9 @@ void RenderInstruction::Reset( const Matrix*   viewMatrix,
   mIsClearColorSet = NULL != clearColor;
   mOffscreenTextureId = offscreenTextureId;
   mRenderTracker = NULL;
+  mDamagedArea = Rect<float>();
+  mDamageTrackerId = 0;
+  mIsFullyDamaged = true;
   mNextFreeRenderList = 0;
 
   RenderListContainer::Iterator iter = mRenderLists.Begin();
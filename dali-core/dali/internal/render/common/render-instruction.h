@@ -19,6 +19,7 @@
 
 // INTERNAL INCLUDES
 #include <dali/public-api/math/matrix.h>
+#include <dali/public-api/math/rect.h>
 #include <dali/public-api/math/viewport.h>
 #include <dali/internal/render/common/render-list.h>
 
@@ -117,6 +118,10 @@ public: // Data, TODO hide these
 
   unsigned int mOffscreenTextureId;     ///< Optional offscreen target
 
+  Rect<float>  mDamagedArea;            ///< The area which changed since the previous frame, in normalized device coordinates
+  unsigned int mDamageTrackerId;        ///< Identifies the render-task which tracked the damage, or 0 if the damage is not tracked
+  bool         mIsFullyDamaged:1;       ///< True if everything has to be redrawn; mDamagedArea is ignored
+
 private: // Data
 
   RenderListContainer mRenderLists;     ///< container of all render lists
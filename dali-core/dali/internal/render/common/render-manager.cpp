@@ -17,6 +17,10 @@
 // CLASS HEADER
 #include <dali/internal/render/common/render-manager.h>
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cmath>
+
 // INTERNAL INCLUDES
 #include <dali/internal/common/owner-pointer.h>
 #include <dali/internal/render/queue/render-queue.h>
@@ -67,6 +71,12 @@ namespace Internal
 namespace SceneGraph
 {
 
+namespace
+{
+const unsigned int DAMAGE_HISTORY_SIZE = 3u; ///< The number of previous frames whose damage is kept; back buffers up to one older can be partially redrawn
+const int DAMAGE_MARGIN = 1;                 ///< Pixels added around damaged areas, for the filtering of edges at sub-pixel positions
+} // unnamed namespace
+
 typedef OwnerContainer< Renderer* >       RendererOwnerContainer;
 typedef RendererOwnerContainer::Iterator  RendererOwnerIter;
 
@@ -98,7 +108,11 @@ struct RenderManager::Impl
     mDefaultSurfaceRect(),
     mRendererContainer(),
     mMaterials(),
-    mRenderersAdded( false )
+    mRenderersAdded( false ),
+    backBufferAge( 0u ),
+    lastUpdateCount( 0u ),
+    damageHistoryCount( 0u ),
+    programsPending( false )
   {
   }
 
@@ -133,6 +147,164 @@ struct RenderManager::Impl
     }
   }
 
+  /**
+   * Calculates the viewport of an on-screen render-instruction, in GL window coordinates.
+   * @param[in] instruction The render-instruction.
+   * @param[out] viewportRect The viewport.
+   */
+  void GetOnScreenViewport( const RenderInstruction& instruction, Rect<int>& viewportRect )
+  {
+    // Check whether a viewport is specified, otherwise the full surface size is used
+    if ( instruction.mIsViewportSet )
+    {
+      // For glViewport the lower-left corner is (0,0)
+      const int y = ( mDefaultSurfaceRect.height - instruction.mViewport.height ) - instruction.mViewport.y;
+      viewportRect.Set( instruction.mViewport.x,  y, instruction.mViewport.width, instruction.mViewport.height );
+    }
+    else
+    {
+      viewportRect = mDefaultSurfaceRect;
+    }
+  }
+
+  /**
+   * Works out the area of the surface which changed since the previous frame.
+   * @param[in] messagesProcessed Whether any render messages were processed for this frame.
+   * @param[out] damage The changed area in GL window coordinates.
+   * @return true if the whole surface changed, in which case damage is not set.
+   */
+  bool CalculateFrameDamage( bool messagesProcessed, Rect<int>& damage )
+  {
+    // Anything which changes the renderers, textures or programs, or which isn't tracked by the update, damages everything
+    const unsigned int updateCount = instructions.GetUpdateCount( renderBufferIndex );
+    bool fullyDamaged = messagesProcessed ||
+                        programsPending ||
+                        dynamicsDebugRenderer ||
+                        textureCache.HasNativeImages() ||
+                        ( updateCount != lastUpdateCount + 1u );
+    lastUpdateCount = updateCount;
+
+    // If the update skipped preparing the instructions, they are identical to those of the previous frame
+    const bool instructionsPrepared = instructions.WereInstructionsPrepared( renderBufferIndex );
+
+    damageTrackerIds.clear();
+    int left = 0, bottom = 0, right = 0, top = 0;
+    bool damaged = false;
+
+    const size_t count = instructions.Count( renderBufferIndex );
+    for ( size_t i = 0; i < count; ++i )
+    {
+      const RenderInstruction& instruction = instructions.At( renderBufferIndex, i );
+
+      if( 0 != instruction.mOffscreenTextureId )
+      {
+        // The result of an off-screen render-task may be drawn anywhere
+        fullyDamaged = true;
+        continue;
+      }
+
+      damageTrackerIds.push_back( instruction.mDamageTrackerId );
+
+      if( instructionsPrepared && !fullyDamaged )
+      {
+        if( instruction.mIsFullyDamaged )
+        {
+          fullyDamaged = true;
+        }
+        else if( instruction.mDamagedArea.width > 0.0f && instruction.mDamagedArea.height > 0.0f )
+        {
+          // Convert from normalized device coordinates, and clip to the viewport
+          Rect<int> viewportRect;
+          GetOnScreenViewport( instruction, viewportRect );
+
+          const float halfWidth = viewportRect.width * 0.5f;
+          const float halfHeight = viewportRect.height * 0.5f;
+          const int areaLeft   = std::max( static_cast<int>( floorf( ( instruction.mDamagedArea.x + 1.0f ) * halfWidth ) ) - DAMAGE_MARGIN, 0 ) + viewportRect.x;
+          const int areaBottom = std::max( static_cast<int>( floorf( ( instruction.mDamagedArea.y + 1.0f ) * halfHeight ) ) - DAMAGE_MARGIN, 0 ) + viewportRect.y;
+          const int areaRight  = std::min( static_cast<int>( ceilf( ( instruction.mDamagedArea.x + instruction.mDamagedArea.width + 1.0f ) * halfWidth ) ) + DAMAGE_MARGIN, viewportRect.width ) + viewportRect.x;
+          const int areaTop    = std::min( static_cast<int>( ceilf( ( instruction.mDamagedArea.y + instruction.mDamagedArea.height + 1.0f ) * halfHeight ) ) + DAMAGE_MARGIN, viewportRect.height ) + viewportRect.y;
+
+          if( areaLeft < areaRight && areaBottom < areaTop )
+          {
+            left   = damaged ? std::min( left, areaLeft ) : areaLeft;
+            bottom = damaged ? std::min( bottom, areaBottom ) : areaBottom;
+            right  = damaged ? std::max( right, areaRight ) : areaRight;
+            top    = damaged ? std::max( top, areaTop ) : areaTop;
+            damaged = true;
+          }
+        }
+      }
+    }
+
+    // The area of render-tasks which started or stopped drawing is unknown
+    if( damageTrackerIds != lastDamageTrackerIds )
+    {
+      fullyDamaged = true;
+    }
+    damageTrackerIds.swap( lastDamageTrackerIds );
+
+    damage.Set( left, bottom, right - left, top - bottom );
+    return fullyDamaged;
+  }
+
+  /**
+   * Works out the area of the back buffer which has to be redrawn, from its age and the damage of the previous frames.
+   * @param[in] frameDamage The area which changed since the previous frame.
+   * @param[in] fullyDamaged Whether the whole surface changed since the previous frame.
+   * @param[out] redrawArea The area to redraw in GL window coordinates.
+   * @return true if the whole surface has to be redrawn, in which case redrawArea is not set.
+   */
+  bool CalculateRedrawArea( const Rect<int>& frameDamage, bool fullyDamaged, Rect<int>& redrawArea )
+  {
+    // A buffer with age N holds the frame drawn N frames ago; the damage of the last N-1 frames must be known
+    if( fullyDamaged ||
+        0u == backBufferAge ||
+        backBufferAge - 1u > damageHistoryCount )
+    {
+      return true;
+    }
+
+    int left = frameDamage.x;
+    int bottom = frameDamage.y;
+    int right = frameDamage.x + frameDamage.width;
+    int top = frameDamage.y + frameDamage.height;
+    bool damaged = !frameDamage.IsEmpty();
+    for( unsigned int i = 0u; i < backBufferAge - 1u; ++i )
+    {
+      const Rect<int>& previous = damageHistory[ i ];
+      if( !previous.IsEmpty() )
+      {
+        left   = damaged ? std::min( left, previous.x ) : previous.x;
+        bottom = damaged ? std::min( bottom, previous.y ) : previous.y;
+        right  = damaged ? std::max( right, previous.x + previous.width ) : previous.x + previous.width;
+        top    = damaged ? std::max( top, previous.y + previous.height ) : previous.y + previous.height;
+        damaged = true;
+      }
+    }
+
+    redrawArea.Set( left, bottom, right - left, top - bottom );
+    if( !damaged )
+    {
+      redrawArea = Rect<int>();
+    }
+    return false;
+  }
+
+  /**
+   * Records the damage of a frame which is about to be posted.
+   * @param[in] frameDamage The area which changed since the previous frame.
+   * @param[in] fullyDamaged Whether the whole surface changed since the previous frame.
+   */
+  void AddDamageHistory( const Rect<int>& frameDamage, bool fullyDamaged )
+  {
+    for( unsigned int i = DAMAGE_HISTORY_SIZE - 1u; i > 0u; --i )
+    {
+      damageHistory[ i ] = damageHistory[ i - 1u ];
+    }
+    damageHistory[ 0 ] = fullyDamaged ? mDefaultSurfaceRect : frameDamage;
+    damageHistoryCount = std::min( damageHistoryCount + 1u, DAMAGE_HISTORY_SIZE );
+  }
+
   // the order is important for destruction,
   // programs, textures and gpubuffers are context observers so delete context last
   // programs are owned by context at the moment. renderers have to be deleted
@@ -155,7 +327,7 @@ struct RenderManager::Impl
   OwnerPointer<DynamicsDebugRenderer> dynamicsDebugRenderer;
 
   unsigned int                        frameCount;          ///< The current frame count
-  BufferIndex                         renderBufferIndex;   ///< The index of the buffer to read from; this is opposite of the "update" buffer
+  BufferIndex                         renderBufferIndex;   ///< The index of the buffer to read from; this was written by a previous update
 
   Rect<int>                           mDefaultSurfaceRect; ///< Rectangle for the default surface we are rendering to
 
@@ -165,6 +337,14 @@ struct RenderManager::Impl
   bool                                mRenderersAdded;
 
   RenderTrackerContainer              mRenderTrackers;     ///< List of render trackers
+
+  unsigned int                        backBufferAge;       ///< The age of the back buffer, or 0 if its contents are undefined
+  unsigned int                        lastUpdateCount;     ///< The number of the update rendered in the previous frame
+  std::vector< unsigned int >         damageTrackerIds;    ///< The damage trackers of the on-screen instructions of this frame
+  std::vector< unsigned int >         lastDamageTrackerIds; ///< The damage trackers of the on-screen instructions of the previous frame
+  Rect<int>                           damageHistory[ DAMAGE_HISTORY_SIZE ]; ///< The damage of the previously posted frames, most recent first
+  unsigned int                        damageHistoryCount;  ///< The number of valid entries in damageHistory
+  bool                                programsPending;     ///< Whether programs were still being compiled after the previous frame
 };
 
 RenderManager* RenderManager::New( Integration::GlAbstraction& glAbstraction, ResourcePostProcessList& resourcePostProcessQ )
@@ -203,6 +383,10 @@ void RenderManager::ContextCreated()
 {
   // TODO inform renderers etc directly rather than through context observer
   mImpl->context.GlContextCreated();
+
+  // Nothing drawn with the previous context can be kept
+  mImpl->damageHistoryCount = 0u;
+  mImpl->lastUpdateCount = 0u;
 }
 
 void RenderManager::ContextToBeDestroyed()
@@ -245,6 +429,11 @@ void RenderManager::SetDefaultSurfaceRect(const Rect<int>& rect)
   mImpl->mDefaultSurfaceRect = rect;
 }
 
+void RenderManager::SetBackBufferAge( unsigned int age )
+{
+  mImpl->backBufferAge = age;
+}
+
 void RenderManager::AddRenderer( Renderer* renderer )
 {
   // Initialize the renderer as we are now in render thread
@@ -317,6 +506,7 @@ bool RenderManager::Render( Integration::RenderStatus& status )
   DALI_PRINT_RENDER_START( mImpl->renderBufferIndex );
 
   status.SetHasRendered( false );
+  status.SetDamagedArea( Rect<int>() );
 
   // Increment the frame count at the beginning of each frame
   ++(mImpl->frameCount);
@@ -326,60 +516,96 @@ bool RenderManager::Render( Integration::RenderStatus& status )
   SET_SNAPSHOT_FRAME_LOG_LEVEL;
 
   // Process messages queued during previous update
-  mImpl->renderQueue.ProcessMessages( mImpl->renderBufferIndex );
+  const bool messagesProcessed = mImpl->renderQueue.ProcessMessages( mImpl->renderBufferIndex );
 
   //No need to make any gl calls if we don't have any renderers to render during startup.
   if(mImpl->mRenderersAdded)
   {
-    // switch rendering to adaptor provided (default) buffer
-    mImpl->context.BindFramebuffer( GL_FRAMEBUFFER, 0 );
+    // Work out which part of the back buffer is out of date
+    Rect<int> frameDamage;
+    const bool fullyDamaged = mImpl->CalculateFrameDamage( messagesProcessed, frameDamage );
 
-    mImpl->context.Viewport( mImpl->mDefaultSurfaceRect.x,
-                             mImpl->mDefaultSurfaceRect.y,
-                             mImpl->mDefaultSurfaceRect.width,
-                             mImpl->mDefaultSurfaceRect.height );
+    Rect<int> redrawArea;
+    const bool fullRedraw = mImpl->CalculateRedrawArea( frameDamage, fullyDamaged, redrawArea );
 
-    mImpl->context.ClearColor( mImpl->backgroundColor.r,
-                               mImpl->backgroundColor.g,
-                               mImpl->backgroundColor.b,
-                               mImpl->backgroundColor.a );
+    // The back buffer is up to date if nothing changed; it is not posted again
+    if( fullRedraw || !redrawArea.IsEmpty() )
+    {
+      const Rect<int>* damagedArea = fullRedraw ? NULL : &redrawArea;
 
-    mImpl->context.ClearStencil( 0 );
+      // switch rendering to adaptor provided (default) buffer
+      mImpl->context.BindFramebuffer( GL_FRAMEBUFFER, 0 );
 
-    // Clear the entire color, depth and stencil buffers for the default framebuffer.
-    // It is important to clear all 3 buffers, for performance on deferred renderers like Mali
-    // e.g. previously when the depth & stencil buffers were NOT cleared, it caused the DDK to exceed a "vertex count limit",
-    // and then stall. That problem is only noticeable when rendering a large number of vertices per frame.
-    mImpl->context.SetScissorTest( false );
-    mImpl->context.ColorMask( true );
-    mImpl->context.DepthMask( true );
-    mImpl->context.StencilMask( 0xFF ); // 8 bit stencil mask, all 1's
-    mImpl->context.Clear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT );
+      mImpl->context.Viewport( mImpl->mDefaultSurfaceRect.x,
+                               mImpl->mDefaultSurfaceRect.y,
+                               mImpl->mDefaultSurfaceRect.width,
+                               mImpl->mDefaultSurfaceRect.height );
 
-    size_t count = mImpl->instructions.Count( mImpl->renderBufferIndex );
-    for ( size_t i = 0; i < count; ++i )
-    {
-      RenderInstruction& instruction = mImpl->instructions.At( mImpl->renderBufferIndex, i );
+      mImpl->context.ClearColor( mImpl->backgroundColor.r,
+                                 mImpl->backgroundColor.g,
+                                 mImpl->backgroundColor.b,
+                                 mImpl->backgroundColor.a );
 
-      DoRender( instruction, mImpl->lastFrameTime );
+      mImpl->context.ClearStencil( 0 );
 
-      const RenderListContainer::SizeType countRenderList = instruction.RenderListCount();
-      if ( countRenderList > 0 )
+      // Clear the entire color, depth and stencil buffers for the default framebuffer.
+      // It is important to clear all 3 buffers, for performance on deferred renderers like Mali
+      // e.g. previously when the depth & stencil buffers were NOT cleared, it caused the DDK to exceed a "vertex count limit",
+      // and then stall. That problem is only noticeable when rendering a large number of vertices per frame.
+      // When the rest of the back buffer is kept, only the damaged area is cleared and drawn.
+      if( damagedArea )
       {
-        status.SetHasRendered( true );
+        mImpl->context.SetScissorTest( true );
+        mImpl->context.Scissor( damagedArea->x, damagedArea->y, damagedArea->width, damagedArea->height );
       }
-    }
+      else
+      {
+        mImpl->context.SetScissorTest( false );
+      }
+      mImpl->context.ColorMask( true );
+      mImpl->context.DepthMask( true );
+      mImpl->context.StencilMask( 0xFF ); // 8 bit stencil mask, all 1's
+      mImpl->context.Clear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT );
 
-    if( mImpl->dynamicsDebugRenderer )
-    {
-      mImpl->dynamicsDebugRenderer->Render();
-    }
+      size_t count = mImpl->instructions.Count( mImpl->renderBufferIndex );
+      for ( size_t i = 0; i < count; ++i )
+      {
+        RenderInstruction& instruction = mImpl->instructions.At( mImpl->renderBufferIndex, i );
 
-    GLenum attachments[] = { GL_DEPTH, GL_STENCIL };
-    mImpl->context.InvalidateFramebuffer(GL_FRAMEBUFFER, 2, attachments);
+        DoRender( instruction, mImpl->lastFrameTime, damagedArea );
+
+        const RenderListContainer::SizeType countRenderList = instruction.RenderListCount();
+        if ( countRenderList > 0 )
+        {
+          status.SetHasRendered( true );
+        }
+      }
+
+      if( mImpl->dynamicsDebugRenderer )
+      {
+        mImpl->dynamicsDebugRenderer->Render();
+      }
+
+      GLenum attachments[] = { GL_DEPTH, GL_STENCIL };
+      mImpl->context.InvalidateFramebuffer(GL_FRAMEBUFFER, 2, attachments);
+
+      if( status.HasRendered() )
+      {
+        mImpl->AddDamageHistory( frameDamage, fullyDamaged );
+        status.SetDamagedArea( fullRedraw ? Rect<int>() : redrawArea );
+      }
+    }
 
     mImpl->UpdateTrackers();
   }
+  else
+  {
+    mImpl->damageHistoryCount = 0u;
+  }
+
+  // Finish the programs compiled and linked since the last frame; the driver had the draw calls above to work on them
+  bool programsPending = mImpl->context.LinkPendingPrograms();
+  mImpl->programsPending = programsPending;
 
   PERF_MONITOR_END(PerformanceMonitor::DRAW_NODES);
 
@@ -387,21 +613,22 @@ bool RenderManager::Render( Integration::RenderStatus& status )
   mImpl->lastFrameTime = mImpl->frameTime;
 
   // check if anything has been posted to the update thread
-  bool updateRequired = !mImpl->resourcePostProcessQueue[ mImpl->renderBufferIndex ].empty();
+  // or if renderers are waiting for their programs
+  bool updateRequired = !mImpl->resourcePostProcessQueue[ mImpl->renderBufferIndex ].empty() || programsPending;
 
   /**
    * The rendering has finished; swap to the next buffer.
    * Ideally the update has just finished using this buffer; otherwise the render thread
    * should block until the update has finished.
    */
-  mImpl->renderBufferIndex = (0 != mImpl->renderBufferIndex) ? 0 : 1;
+  mImpl->renderBufferIndex = SceneGraphBuffers::GetNextBufferIndex( mImpl->renderBufferIndex );
 
   DALI_PRINT_RENDER_END();
 
   return updateRequired;
 }
 
-void RenderManager::DoRender( RenderInstruction& instruction, float elapsedTime )
+void RenderManager::DoRender( RenderInstruction& instruction, float elapsedTime, const Rect<int>* damagedArea )
 {
   Rect<int> viewportRect;
   Vector4   clearColor;
@@ -448,17 +675,13 @@ void RenderManager::DoRender( RenderInstruction& instruction, float elapsedTime
     // switch rendering to adaptor provided (default) buffer
     mImpl->context.BindFramebuffer( GL_FRAMEBUFFER, 0 );
 
-    // Check whether a viewport is specified, otherwise the full surface size is used
-    if ( instruction.mIsViewportSet )
-    {
-      // For glViewport the lower-left corner is (0,0)
-      const int y = ( mImpl->mDefaultSurfaceRect.height - instruction.mViewport.height ) - instruction.mViewport.y;
-      viewportRect.Set( instruction.mViewport.x,  y, instruction.mViewport.width, instruction.mViewport.height );
-    }
-    else
-    {
-      viewportRect = mImpl->mDefaultSurfaceRect;
-    }
+    mImpl->GetOnScreenViewport( instruction, viewportRect );
+  }
+
+  // The damaged area only applies to the default surface
+  if( offscreen )
+  {
+    damagedArea = NULL;
   }
 
   mImpl->context.Viewport(viewportRect.x, viewportRect.y, viewportRect.width, viewportRect.height);
@@ -472,7 +695,18 @@ void RenderManager::DoRender( RenderInstruction& instruction, float elapsedTime
 
     // Clear the viewport area only
     mImpl->context.SetScissorTest( true );
-    mImpl->context.Scissor( viewportRect.x, viewportRect.y, viewportRect.width, viewportRect.height );
+    if( damagedArea )
+    {
+      const int left   = std::max( viewportRect.x, damagedArea->x );
+      const int bottom = std::max( viewportRect.y, damagedArea->y );
+      const int right  = std::min( viewportRect.x + viewportRect.width, damagedArea->x + damagedArea->width );
+      const int top    = std::min( viewportRect.y + viewportRect.height, damagedArea->y + damagedArea->height );
+      mImpl->context.Scissor( left, bottom, std::max( right - left, 0 ), std::max( top - bottom, 0 ) );
+    }
+    else
+    {
+      mImpl->context.Scissor( viewportRect.x, viewportRect.y, viewportRect.width, viewportRect.height );
+    }
     mImpl->context.ColorMask( true );
     mImpl->context.Clear( GL_COLOR_BUFFER_BIT );
     mImpl->context.SetScissorTest( false );
@@ -481,7 +715,8 @@ void RenderManager::DoRender( RenderInstruction& instruction, float elapsedTime
   Render::ProcessRenderInstruction( instruction,
                                     mImpl->context,
                                     mImpl->renderBufferIndex,
-                                    elapsedTime );
+                                    elapsedTime,
+                                    damagedArea );
 
   if(instruction.mOffscreenTextureId != 0)
   {
@@ -184,6 +184,13 @@ public:
    */
   void RemoveRenderTracker( RenderTracker* renderTracker );
 
+  // These methods should be called from the render thread
+
+  /**
+   * @copydoc Dali::Integration::Core::SetBackBufferAge()
+   */
+  void SetBackBufferAge( unsigned int age );
+
   // This method should be called from Core::Render()
 
   /**
@@ -198,8 +205,10 @@ private:
   /**
    * Helper to process a single RenderInstruction.
    * @param[in] instruction A description of the rendering operation.
+   * @param[in] elapsedTime The elapsed time between the last two updates.
+   * @param[in] damagedArea The area of the default surface being redrawn, or NULL if it is redrawn completely.
    */
-  void DoRender( RenderInstruction& instruction, float elapsedTime );
+  void DoRender( RenderInstruction& instruction, float elapsedTime, const Rect<int>* damagedArea );
 
 private:
 
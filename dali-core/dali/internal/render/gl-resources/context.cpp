@@ -19,7 +19,9 @@
 
 // EXTERNAL INCLUDES
 #include <algorithm>
+#include <cstring>
 #include <limits>
+#include <boost/functional/hash.hpp>
 
 // INTERNAL INCLUDES
 #include <dali/public-api/common/constants.h>
@@ -40,6 +42,11 @@ namespace Internal
 namespace // unnamed namespace
 {
 
+/**
+ * The number of programs, compiled without GL_KHR_parallel_shader_compile, to wait for at the end of a frame
+ */
+const unsigned int MAX_PROGRAMS_LINKED_PER_FRAME = 1u;
+
 /**
  * GL error strings
  */
@@ -103,6 +110,8 @@ Context::Context(Integration::GlAbstraction& glAbstraction)
   mMaxTextureSize(0),
   mMaxTextureUnits(0),
   mClearColor(Color::WHITE),    // initial color, never used until it's been set by the user
+  mDriverHash(0),
+  mParallelShaderCompile(false),
   mCullFaceMode(CullNone),
   mViewPort( 0, 0, 0, 0 ),
   mCurrentProgram( NULL )
@@ -112,6 +121,7 @@ Context::Context(Integration::GlAbstraction& glAbstraction)
 Context::~Context()
 {
   // release the cached programs
+  mPendingPrograms.clear();
   std::for_each(mProgramCache.begin(), mProgramCache.end(), deletePrograms);
   mProgramCache.clear();
 
@@ -146,6 +156,9 @@ void Context::GlContextToBeDestroyed()
     (*it)->GlContextToBeDestroyed();
   }
 
+  // The programs were unloaded, they are compiled again when the context is created
+  mPendingPrograms.clear();
+
   mGlContextCreated = false;
 }
 
@@ -187,6 +200,45 @@ void Context::CacheProgram( std::size_t hash, Program* pointer )
   mProgramCache[ hash ] = pointer;
 }
 
+void Context::AddPendingProgram( Program* program )
+{
+  mPendingPrograms.push_back( program );
+}
+
+void Context::RemovePendingProgram( Program* program )
+{
+  mPendingPrograms.erase( std::remove( mPendingPrograms.begin(), mPendingPrograms.end(), program ), mPendingPrograms.end() );
+}
+
+bool Context::LinkPendingPrograms()
+{
+  // Programs the driver is still working on stay pending, until a later frame.
+  // Without GL_KHR_parallel_shader_compile, waiting for the driver is spread over several frames.
+  unsigned int programsLinked = 0u;
+
+  std::vector< Program* >::iterator iter = mPendingPrograms.begin();
+  while( iter != mPendingPrograms.end() )
+  {
+    if( (*iter)->IsReady() )
+    {
+      iter = mPendingPrograms.erase( iter );
+    }
+    else if( !mParallelShaderCompile && programsLinked < MAX_PROGRAMS_LINKED_PER_FRAME )
+    {
+      (*iter)->WaitUntilReady();
+      ++programsLinked;
+
+      iter = mPendingPrograms.erase( iter );
+    }
+    else
+    {
+      ++iter;
+    }
+  }
+
+  return !mPendingPrograms.empty();
+}
+
 const Rect< int >& Context::GetViewport()
 {
   return mViewPort;
@@ -360,6 +412,24 @@ void Context::ResetGlState()
     mGlAbstraction.GetIntegerv(GL_PROGRAM_BINARY_FORMATS_OES, &mProgramBinaryFormats[0]);
   }
 
+  // identify the driver, program binaries are only valid for the driver which created them
+  std::string driver;
+  const GLenum driverStrings[] = { GL_VENDOR, GL_RENDERER, GL_VERSION };
+  for( unsigned int i = 0; i < sizeof( driverStrings ) / sizeof( driverStrings[0] ); ++i )
+  {
+    const GLubyte* driverString = mGlAbstraction.GetString( driverStrings[ i ] );
+    if( driverString )
+    {
+      driver += reinterpret_cast< const char* >( driverString );
+    }
+    driver += '\n';
+  }
+  mDriverHash = boost::hash< std::string >()( driver );
+
+  // with GL_KHR_parallel_shader_compile, programs are compiled and linked without blocking the render thread
+  const GLubyte* extensions = mGlAbstraction.GetString( GL_EXTENSIONS );
+  mParallelShaderCompile = ( NULL != extensions ) && ( NULL != strstr( reinterpret_cast< const char* >( extensions ), "GL_KHR_parallel_shader_compile" ) );
+
   // reset viewport, this will be set to something useful when rendering
   mViewPort.x = mViewPort.y = mViewPort.width = mViewPort.height = 0;
 
@@ -1646,6 +1646,24 @@ public:
     return mProgramBinaryFormats[ formatIndex ];
   }
 
+  /**
+   * Get a hash identifying the GL driver. This value is cached when the context is created
+   * @return A hash of the GL vendor, renderer and version strings
+   */
+  std::size_t CachedDriverHash() const
+  {
+    return mDriverHash;
+  }
+
+  /**
+   * Query whether the driver supports GL_KHR_parallel_shader_compile. This value is cached when the context is created
+   * @return true if the completion of compiling and linking can be queried without waiting for the driver
+   */
+  bool IsParallelShaderCompileSupported() const
+  {
+    return mParallelShaderCompile;
+  }
+
   /**
    * @return current program
    */
@@ -1677,6 +1695,27 @@ public:
    */
   void CacheProgram( std::size_t hash, Program* pointer );
 
+  /**
+   * Adds a program whose compilation and linking have been issued, but not finished
+   * @param [in] program The program
+   */
+  void AddPendingProgram( Program* program );
+
+  /**
+   * Removes a program from the pending programs, when it is destroyed
+   * @param [in] program The program
+   */
+  void RemovePendingProgram( Program* program );
+
+  /**
+   * Finishes loading the pending programs the driver has compiled and linked.
+   * Called at the end of each frame, after the draw calls have been issued. Without
+   * GL_KHR_parallel_shader_compile, this waits for the driver to finish a limited number of
+   * the pending programs per frame, oldest first; the others stay pending until later frames.
+   * @return true if some programs are still being compiled or linked
+   */
+  bool LinkPendingPrograms();
+
   /**
    * Get the current viewport.
    * @return Viewport rectangle.
@@ -1762,6 +1801,8 @@ private: // Data
   Vector4 mClearColor;        ///< clear color
 
   std::vector<GLint>  mProgramBinaryFormats; ///< array of supported program binary formats
+  std::size_t         mDriverHash;           ///< hash of the GL vendor, renderer and version strings
+  bool                mParallelShaderCompile; ///< whether GL_KHR_parallel_shader_compile is supported
 
   // Face culling mode
   CullFaceMode mCullFaceMode;
@@ -1777,6 +1818,7 @@ private: // Data
 
   Program* mCurrentProgram;
   std::map< std::size_t, Program* > mProgramCache; /// program cache
+  std::vector< Program* > mPendingPrograms;        /// programs being compiled and linked by the driver, owned by mProgramCache
 
 };
 
@@ -16,6 +16,8 @@
 
 #include <dali/internal/render/gl-resources/texture-cache.h>
 
+#include <algorithm>
+
 #include <dali/integration-api/bitmap.h>
 
 #include <dali/internal/update/resources/resource-manager-declarations.h>
@@ -86,6 +88,7 @@ void TextureCache::AddNativeImage(ResourceId id, NativeImagePtr nativeImage)
   /// TODO - currently a new Texture is created even if we reuse the same NativeImage
   Texture* texture = TextureFactory::NewNativeImageTexture(*nativeImage, mContext);
   mTextures.insert(TexturePair(id, texture));
+  mNativeImages.push_back( id );
 }
 
 void TextureCache::AddFrameBuffer( ResourceId id, unsigned int width, unsigned int height, Pixel::Format pixelFormat )
@@ -201,6 +204,12 @@ void TextureCache::DiscardTexture( ResourceId id )
       }
       mTextures.erase(iter);
       deleted = true;
+
+      std::vector< ResourceId >::iterator nativeImageIter = std::find( mNativeImages.begin(), mNativeImages.end(), id );
+      if( nativeImageIter != mNativeImages.end() )
+      {
+        mNativeImages.erase( nativeImageIter );
+      }
     }
   }
 
@@ -309,6 +318,11 @@ FrameBufferTexture* TextureCache::GetFramebuffer(ResourceId id)
   return offscreen;
 }
 
+bool TextureCache::HasNativeImages() const
+{
+  return !mNativeImages.empty();
+}
+
 void TextureCache::AddObserver( ResourceId id, TextureObserver* observer )
 {
   TextureResourceObserversIter observersIter = mObservers.find(id);
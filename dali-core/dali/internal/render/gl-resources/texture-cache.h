@@ -194,6 +194,14 @@ public:
    */
   FrameBufferTexture* GetFramebuffer(ResourceId id);
 
+  /**
+   * Query whether any textures are created from native images.
+   * The content of native images may change without the texture cache being told,
+   * so the area they cover can't be tracked between frames.
+   * @return true if there are native image textures
+   */
+  bool HasNativeImages() const;
+
   /**
    * Add a texture observer. Should be called in render thread
    * @param[in] id The resource id to watch
@@ -270,6 +278,7 @@ private:
   Context&         mContext;
   TextureContainer mTextures;
   TextureContainer mFramebufferTextures;
+  std::vector< ResourceId > mNativeImages; ///< The ids of the textures created from native images
 
   typedef std::vector< TextureObserver* > TextureObservers;
   typedef TextureObservers::iterator      TextureObserversIter;
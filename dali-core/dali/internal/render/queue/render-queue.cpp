@@ -38,39 +38,29 @@ namespace SceneGraph
 {
 
 RenderQueue::RenderQueue()
-: container0( NULL ),
-  container1( NULL )
 {
-  container0 = new MessageBuffer( INITIAL_BUFFER_SIZE );
-  container1 = new MessageBuffer( INITIAL_BUFFER_SIZE );
+  for( unsigned int i = 0; i < NUM_SCENE_GRAPH_BUFFERS; ++i )
+  {
+    containers[ i ] = new MessageBuffer( INITIAL_BUFFER_SIZE );
+  }
 }
 
 RenderQueue::~RenderQueue()
 {
-  if( container0 )
+  for( unsigned int i = 0; i < NUM_SCENE_GRAPH_BUFFERS; ++i )
   {
-    for( MessageBuffer::Iterator iter = container0->Begin(); iter.IsValid(); iter.Next() )
+    if( containers[ i ] )
     {
-      MessageBase* message = reinterpret_cast< MessageBase* >( iter.Get() );
-
-      // Call virtual destructor explictly; since delete will not be called after placement new
-      message->~MessageBase();
-    }
-
-    delete container0;
-  }
+      for( MessageBuffer::Iterator iter = containers[ i ]->Begin(); iter.IsValid(); iter.Next() )
+      {
+        MessageBase* message = reinterpret_cast< MessageBase* >( iter.Get() );
 
-  if( container1 )
-  {
-    for( MessageBuffer::Iterator iter = container1->Begin(); iter.IsValid(); iter.Next() )
-    {
-      MessageBase* message = reinterpret_cast< MessageBase* >( iter.Get() );
+        // Call virtual destructor explictly; since delete will not be called after placement new
+        message->~MessageBase();
+      }
 
-      // Call virtual destructor explictly; since delete will not be called after placement new
-      message->~MessageBase();
+      delete containers[ i ];
     }
-
-    delete container1;
   }
 }
 
@@ -81,10 +71,11 @@ unsigned int* RenderQueue::ReserveMessageSlot( BufferIndex updateBufferIndex, st
   return container->ReserveMessageSlot( size );
 }
 
-void RenderQueue::ProcessMessages( BufferIndex bufferIndex )
+bool RenderQueue::ProcessMessages( BufferIndex bufferIndex )
 {
   MessageBuffer* container = GetCurrentContainer( bufferIndex );
 
+  bool processed = false;
   for( MessageBuffer::Iterator iter = container->Begin(); iter.IsValid(); iter.Next() )
   {
     MessageBase* message = reinterpret_cast< MessageBase* >( iter.Get() );
@@ -93,52 +84,33 @@ void RenderQueue::ProcessMessages( BufferIndex bufferIndex )
 
     // Call virtual destructor explictly; since delete will not be called after placement new
     message->~MessageBase();
+
+    processed = true;
   }
 
   container->Reset();
 
   LimitBufferCapacity( bufferIndex );
+
+  return processed;
 }
 
 MessageBuffer* RenderQueue::GetCurrentContainer( BufferIndex bufferIndex )
 {
-  MessageBuffer* container( NULL );
-
   /**
    * The update-thread queues messages with one container,
-   * whilst the render-thread is processing the other.
+   * whilst the render-thread is processing another.
    */
-  if ( !bufferIndex )
-  {
-    container = container0;
-  }
-  else
-  {
-    container = container1;
-  }
-
-  return container;
+  return containers[ bufferIndex ];
 }
 
 void RenderQueue::LimitBufferCapacity( BufferIndex bufferIndex )
 {
-  if ( !bufferIndex )
+  if( MAX_BUFFER_SIZE < containers[ bufferIndex ]->GetCapacity() )
   {
-    if( MAX_BUFFER_SIZE < container0->GetCapacity() )
-    {
-      delete container0;
-      container0 = NULL;
-      container0 = new MessageBuffer( INITIAL_BUFFER_SIZE );
-    }
-  }
-  else
-  {
-    if( MAX_BUFFER_SIZE < container1->GetCapacity() )
-    {
-      delete container1;
-      container1 = NULL;
-      container1 = new MessageBuffer( INITIAL_BUFFER_SIZE );
-    }
+    delete containers[ bufferIndex ];
+    containers[ bufferIndex ] = NULL;
+    containers[ bufferIndex ] = new MessageBuffer( INITIAL_BUFFER_SIZE );
   }
 }
 
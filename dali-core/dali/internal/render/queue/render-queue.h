@@ -63,14 +63,15 @@ public:
    * Process the batch of messages, which were queued in the previous update.
    * @pre This message should only be called by RenderManager from within the render-thread.
    * @param[in] bufferIndex The previous update buffer index.
+   * @return true if any messages were processed.
    */
-  void ProcessMessages( BufferIndex bufferIndex );
+  bool ProcessMessages( BufferIndex bufferIndex );
 
 private:
 
   /**
    * Helper to retrieve the current container.
-   * The update-thread queues messages with one container, whilst the render-thread is processing the other.
+   * The update-thread queues messages with one container, whilst the render-thread is processing another.
    * @param[in] bufferIndex The current buffer index.
    * @return The container.
    */
@@ -90,8 +91,7 @@ private:
 
 private:
 
-  MessageBuffer* container0; ///< Messages are queued here when the update buffer index == 0
-  MessageBuffer* container1; ///< Messages are queued here when the update buffer index == 1
+  MessageBuffer* containers[ NUM_SCENE_GRAPH_BUFFERS ]; ///< Messages are queued in the container of the update buffer index
 };
 
 } // namespace SceneGraph
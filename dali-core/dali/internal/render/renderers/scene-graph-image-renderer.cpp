@@ -21,6 +21,7 @@
 #include <dali/public-api/common/dali-common.h>
 #include <dali/internal/common/internal-constants.h>
 #include <dali/internal/render/common/performance-monitor.h>
+#include <dali/internal/render/common/render-list.h>
 #include <dali/internal/render/common/vertex.h>
 #include <dali/internal/render/gl-resources/gpu-buffer.h>
 #include <dali/internal/render/gl-resources/texture.h>
@@ -33,6 +34,9 @@ using namespace std;
 
 namespace
 {
+
+const unsigned int VERTICES_PER_BATCHED_QUAD = 6u; ///< A batched quad is drawn as two separate triangles
+
 /**
  * VertexToTextureCoord
  * Represents a mapping between a 1 dimensional vertex coordinate
@@ -176,6 +180,11 @@ void ImageRenderer::GlCleanup()
   {
     mIndexBuffer.Reset();
   }
+
+  if (mBatchVertexBuffer)
+  {
+    mBatchVertexBuffer.Reset();
+  }
 }
 
 bool ImageRenderer::RequiresDepthTest() const
@@ -312,6 +321,100 @@ void ImageRenderer::DoRender( BufferIndex bufferIndex, const Matrix& modelViewMa
   }
 }
 
+Integration::ResourceId ImageRenderer::GetBatchTextureId() const
+{
+  // Only quads drawn with the default shader are batched; custom effects may depend on per-actor uniforms
+  if( ( QUAD == mMeshType ) && mShader->IsDefault() )
+  {
+    return mTextureId;
+  }
+
+  return 0;
+}
+
+void ImageRenderer::DoRenderBatch( BufferIndex bufferIndex, const RenderList& renderList, size_t first, size_t count, const Matrix& viewMatrix, const Matrix& projectionMatrix, const Vector4& color )
+{
+  DALI_ASSERT_DEBUG( 0 != mTextureId && "ImageRenderer::DoRenderBatch. mTextureId == 0." );
+  DALI_ASSERT_DEBUG( NULL != mTexture && "ImageRenderer::DoRenderBatch. mTexture == NULL." );
+
+  mBatchVertices.Clear();
+  mBatchVertices.Reserve( count * VERTICES_PER_BATCHED_QUAD );
+
+  const size_t end = first + count;
+  for( size_t index = first; index < end; ++index )
+  {
+    const RenderItem& item = renderList.GetItem( index );
+
+    // Only ImageRenderers return a batch texture, so every renderer in the batch is an ImageRenderer
+    ImageRenderer& renderer = static_cast< ImageRenderer& >( const_cast< Renderer& >( *item.GetRenderer() ) );
+
+    if( !renderer.CheckResources() )
+    {
+      continue;
+    }
+
+    if( !renderer.mIsMeshGenerated )
+    {
+      renderer.GenerateMeshData( renderer.mTexture );
+    }
+
+    AddBatchedQuad( renderer.mQuadVertices, item.GetModelViewMatrix() );
+  }
+
+  const GLsizei vertexCount = mBatchVertices.Count();
+  if( 0 == vertexCount )
+  {
+    return;
+  }
+
+  if( !mBatchVertexBuffer )
+  {
+    mBatchVertexBuffer = new GpuBuffer( *mContext, GL_ARRAY_BUFFER, GL_STREAM_DRAW );
+  }
+  mBatchVertexBuffer->UpdateDataBuffer( vertexCount * sizeof(Vertex3D), &mBatchVertices[0] );
+
+  mTextureCache->BindTexture( mTexture, mTextureId,  GL_TEXTURE_2D, GL_TEXTURE0 );
+
+  mBatchVertexBuffer->Bind();
+
+  // The vertices are already in view space, so the model-view matrix is the identity
+  Program& program = mShader->Apply( *mContext, bufferIndex, GEOMETRY_TYPE_IMAGE, Matrix::IDENTITY, viewMatrix, Matrix::IDENTITY, projectionMatrix, color, SHADER_DEFAULT );
+
+  GLint samplerLoc = program.GetUniformLocation( Program::UNIFORM_SAMPLER );
+  if( -1 != samplerLoc )
+  {
+    program.SetUniform1i( samplerLoc, 0 );
+  }
+
+  const GLint positionLoc = program.GetAttribLocation( Program::ATTRIB_POSITION );
+  const GLint texCoordLoc = program.GetAttribLocation( Program::ATTRIB_TEXCOORD );
+
+  if ( positionLoc != -1 )
+  {
+    mContext->EnableVertexAttributeArray( positionLoc );
+    mContext->VertexAttribPointer( positionLoc, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex3D), 0 );
+  }
+
+  if ( texCoordLoc != -1 )
+  {
+    mContext->EnableVertexAttributeArray( texCoordLoc );
+    mContext->VertexAttribPointer( texCoordLoc, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex3D), (const void*) (sizeof(float)*3) );
+  }
+
+  mContext->DrawArrays( GL_TRIANGLES, 0, vertexCount );
+  DRAW_ARRAY_RECORD( vertexCount );
+
+  if ( positionLoc != -1 )
+  {
+    mContext->DisableVertexAttributeArray( positionLoc );
+  }
+
+  if ( texCoordLoc != -1 )
+  {
+    mContext->DisableVertexAttributeArray( texCoordLoc );
+  }
+}
+
 void ImageRenderer::UpdateVertexBuffer( GLsizeiptr size, const GLvoid *data )
 {
   // create/destroy if needed/not needed.
@@ -428,10 +531,39 @@ void ImageRenderer::SetQuadMeshData( Texture* texture, const Vector2& size, cons
 
   texture->MapUV( sizeof(verts)/sizeof(Vertex2D), verts, pixelArea );
 
+  // Keep a copy, in case the quad is drawn as part of a batch
+  for( unsigned int i = 0u; i < 4u; ++i )
+  {
+    mQuadVertices[ i ] = verts[ i ];
+  }
+
   UpdateVertexBuffer( sizeof(verts), verts );
   UpdateIndexBuffer( 0, NULL );
 }
 
+void ImageRenderer::AddBatchedQuad( const Vertex2D* quadVertices, const Matrix& modelViewMatrix )
+{
+  // Triangles 0,1,2 and 2,1,3 have the same winding as the triangle-strip
+  static const unsigned int QUAD_TRIANGLE_INDICES[ VERTICES_PER_BATCHED_QUAD ] = { 0u, 1u, 2u, 2u, 1u, 3u };
+
+  const float* m = modelViewMatrix.AsFloat();
+
+  for( unsigned int i = 0u; i < VERTICES_PER_BATCHED_QUAD; ++i )
+  {
+    const Vertex2D& in = quadVertices[ QUAD_TRIANGLE_INDICES[ i ] ];
+
+    // Matrix is column-major; the quad lies in the z = 0 plane of the model
+    Vertex3D out;
+    out.mX = m[0] * in.mX + m[4] * in.mY + m[12];
+    out.mY = m[1] * in.mX + m[5] * in.mY + m[13];
+    out.mZ = m[2] * in.mX + m[6] * in.mY + m[14];
+    out.mU = in.mU;
+    out.mV = in.mV;
+
+    mBatchVertices.PushBack( out );
+  }
+}
+
 void ImageRenderer::SetNinePatchMeshData( Texture* texture, const Vector2& size, const Vector4& border, bool borderInPixels, const PixelArea* pixelArea )
 {
   DALI_ASSERT_ALWAYS( mTexture->GetWidth()  > 0.0f && "Invalid Texture width" );
@@ -791,7 +923,8 @@ ImageRenderer::ImageRenderer( RenderDataProvider& dataprovider )
   mGeometrySize(),
   mBorder( 0.45, 0.45, 0.1, 0.1 ),
   mTextureId( 0 ),
-  mTexture( NULL )
+  mTexture( NULL ),
+  mQuadVertices()
 {
 }
 
@@ -19,8 +19,10 @@
 
 // INTERNAL INCLUDES
 #include <dali/public-api/actors/image-actor.h>
+#include <dali/public-api/common/dali-vector.h>
 #include <dali/internal/common/owner-pointer.h>
 #include <dali/internal/update/resources/resource-manager-declarations.h>
+#include <dali/internal/render/common/vertex.h>
 #include <dali/internal/render/gl-resources/context.h>
 #include <dali/internal/render/gl-resources/texture-observer.h>
 #include <dali/internal/render/renderers/scene-graph-renderer.h>
@@ -112,6 +114,16 @@ public:
    */
   virtual void DoRender( BufferIndex bufferIndex, const Matrix& modelViewMatrix, const Matrix& modelMatrix, const Matrix& viewMatrix, const Matrix& projectionMatrix, const Vector4& color );
 
+  /**
+   * @copydoc Dali::Internal::SceneGraph::Renderer::GetBatchTextureId()
+   */
+  virtual Integration::ResourceId GetBatchTextureId() const;
+
+  /**
+   * @copydoc Dali::Internal::SceneGraph::Renderer::DoRenderBatch()
+   */
+  virtual void DoRenderBatch( BufferIndex bufferIndex, const RenderList& renderList, size_t first, size_t count, const Matrix& viewMatrix, const Matrix& projectionMatrix, const Vector4& color );
+
 protected: // TextureObserver implementation
 
   /**
@@ -146,6 +158,14 @@ private:
    */
   void SetQuadMeshData( Texture* texture, const Vector2& size, const PixelArea* pixelArea );
 
+  /**
+   * Helper to append the quad vertices of a batched render-item, transformed into view space.
+   * The quad is added as two separate triangles, so that consecutive quads are not connected.
+   * @param[in] quadVertices The four vertices of the quad, in triangle-strip order.
+   * @param[in] modelViewMatrix The model-view matrix of the render-item.
+   */
+  void AddBatchedQuad( const Vertex2D* quadVertices, const Matrix& modelViewMatrix );
+
   /**
    * Helper to fill vertex/index buffers with nine-patch data.
    * (9-Patches are simple meshes, and thus have a specialised mesh generation method)
@@ -206,6 +226,10 @@ private:
   OwnerPointer< GpuBuffer > mVertexBuffer;
   OwnerPointer< GpuBuffer > mIndexBuffer;
 
+  Vertex2D mQuadVertices[ 4 ];          ///< A copy of the quad vertices, used when this renderer is part of a batch
+  Dali::Vector< Vertex3D > mBatchVertices; ///< The view-space vertices of a batch, when this renderer draws a batch
+  OwnerPointer< GpuBuffer > mBatchVertexBuffer;
+
 };
 
 } // namespace SceneGraph
@@ -140,7 +140,7 @@ private:
 
 private:
 
-  MeshInfo         mMeshInfo[2];          ///< Double-buffered for update/render in separate threads.
+  MeshInfo         mMeshInfo[NUM_SCENE_GRAPH_BUFFERS]; ///< Double (or triple) buffered for update/render in separate threads.
   LightController* mLightController;      ///< required to get the lights from the scene.
   bool             mAffectedByLighting;   ///< Whether the scene lights should be used
   GeometryType     mGeometryType;         ///< Records last geometry type
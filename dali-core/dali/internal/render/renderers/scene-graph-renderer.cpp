@@ -85,6 +85,84 @@ void Renderer::Render( BufferIndex bufferIndex,
     return;
   }
 
+  if( !mShader->AreProgramsReady() )
+  {
+    // The driver is still compiling or linking the programs; skip drawing rather than wait for it.
+    return;
+  }
+
+  SetGlState();
+
+  mShader->SetFrameTime( frametime );
+
+  const Matrix& modelMatrix = mDataProvider.GetModelMatrix( bufferIndex );
+  const Vector4& color = mDataProvider.GetRenderColor( bufferIndex );
+
+  // Call to over ridden method in the child class
+  // TODO, once MeshRenderer is fixed to render only one mesh, move mShader.Apply here
+  // and we can greatly reduce these parameters. Also then derived renderers can be passed the Program&
+  DoRender( bufferIndex, modelViewMatrix, modelMatrix, viewMatrix, projectionMatrix, color );
+}
+
+bool Renderer::CanBatchWith( BufferIndex bufferIndex, const Renderer& other ) const
+{
+  const Integration::ResourceId textureId = GetBatchTextureId();
+  if( 0 == textureId ||
+      this == &other ||
+      textureId != other.GetBatchTextureId() ||
+      mShader != other.mShader ||
+      mUseBlend != other.mUseBlend ||
+      mCullFaceMode != other.mCullFaceMode ||
+      mBlendingOptions.GetBitmask() != other.mBlendingOptions.GetBitmask() )
+  {
+    return false;
+  }
+
+  const Vector4* const customColor = mBlendingOptions.GetBlendColor();
+  const Vector4* const otherCustomColor = other.mBlendingOptions.GetBlendColor();
+  if( ( customColor != otherCustomColor ) &&
+      ( !customColor || !otherCustomColor || *customColor != *otherCustomColor ) )
+  {
+    return false;
+  }
+
+  // The color is a per-draw uniform
+  return mDataProvider.GetRenderColor( bufferIndex ) == other.mDataProvider.GetRenderColor( bufferIndex );
+}
+
+void Renderer::RenderBatch( BufferIndex bufferIndex,
+                            const RenderList& renderList,
+                            size_t first,
+                            size_t count,
+                            const Matrix& viewMatrix,
+                            const Matrix& projectionMatrix,
+                            float frametime )
+{
+  DALI_ASSERT_DEBUG( mContext && "Renderer::RenderBatch. Renderer not initialised!! (mContext == NULL)." );
+  DALI_ASSERT_DEBUG( mShader && "Renderer::RenderBatch. Shader not set!!" );
+
+  if( !CheckResources() || !mShader->AreProgramsReady() )
+  {
+    return;
+  }
+
+  SetGlState();
+
+  mShader->SetFrameTime( frametime );
+
+  const Vector4& color = mDataProvider.GetRenderColor( bufferIndex );
+
+  DoRenderBatch( bufferIndex, renderList, first, count, viewMatrix, projectionMatrix, color );
+}
+
+Integration::ResourceId Renderer::GetBatchTextureId() const
+{
+  // Batching is not supported by default
+  return 0;
+}
+
+void Renderer::SetGlState()
+{
   // Enables/disables blending mode.
   mContext->SetBlend( mUseBlend );
 
@@ -111,16 +189,11 @@ void Renderer::Render( BufferIndex bufferIndex,
   // Set blend equations
   mContext->BlendEquationSeparate( mBlendingOptions.GetBlendEquationRgb(),
                                    mBlendingOptions.GetBlendEquationAlpha() );
+}
 
-  mShader->SetFrameTime( frametime );
-
-  const Matrix& modelMatrix = mDataProvider.GetModelMatrix( bufferIndex );
-  const Vector4& color = mDataProvider.GetRenderColor( bufferIndex );
-
-  // Call to over ridden method in the child class
-  // TODO, once MeshRenderer is fixed to render only one mesh, move mShader.Apply here
-  // and we can greatly reduce these parameters. Also then derived renderers can be passed the Program&
-  DoRender( bufferIndex, modelViewMatrix, modelMatrix, viewMatrix, projectionMatrix, color );
+void Renderer::DoRenderBatch( BufferIndex bufferIndex, const RenderList& renderList, size_t first, size_t count, const Matrix& viewMatrix, const Matrix& projectionMatrix, const Vector4& color )
+{
+  DALI_ASSERT_DEBUG( false && "Renderer::DoRenderBatch. Renderer does not support batching." );
 }
 
 Renderer::Renderer( RenderDataProvider& dataprovider )
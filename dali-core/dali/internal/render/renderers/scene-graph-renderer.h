@@ -26,6 +26,7 @@
 #include <dali/internal/update/common/double-buffered.h>
 #include <dali/internal/render/renderers/scene-graph-renderer-declarations.h>
 #include <dali/integration-api/debug.h>
+#include <dali/integration-api/resource-declarations.h>
 #include <dali/internal/common/type-abstraction-enums.h>
 
 namespace Dali
@@ -42,6 +43,7 @@ class SceneController;
 class Shader;
 class TextureCache;
 class RenderDataProvider;
+class RenderList;
 
 /**
  * Renderers are used to render images, text, & meshes etc.
@@ -115,6 +117,34 @@ public:
                const Matrix& projectionMatrix,
                float frametime );
 
+  /**
+   * Query whether this renderer can be drawn in the same draw call as another renderer.
+   * Both renderers must share the shader, blending & face-culling state, color and texture.
+   * @param[in] bufferIndex The index of the previous update buffer.
+   * @param[in] other The renderer of the following render-item.
+   * @return True if the two renderers can be batched together.
+   */
+  bool CanBatchWith( BufferIndex bufferIndex, const Renderer& other ) const;
+
+  /**
+   * Called to render a batch of consecutive render-items with a single draw call, during RenderManager::Render().
+   * @pre The first item uses this renderer, and CanBatchWith() is true for the renderers of the other items.
+   * @param[in] bufferIndex The index of the previous update buffer.
+   * @param[in] renderList The render-list containing the batch.
+   * @param[in] first The index of the first render-item in the batch.
+   * @param[in] count The number of render-items in the batch.
+   * @param[in] viewMatrix The view matrix.
+   * @param[in] projectionMatrix The projection matrix.
+   * @param[in] frametime The elapsed time between the last two updates.
+   */
+  void RenderBatch( BufferIndex bufferIndex,
+                    const RenderList& renderList,
+                    size_t first,
+                    size_t count,
+                    const Matrix& viewMatrix,
+                    const Matrix& projectionMatrix,
+                    float frametime );
+
 protected:
 
   /**
@@ -138,6 +168,18 @@ private:
    */
   virtual bool CheckResources() = 0;
 
+  /**
+   * Retrieve the texture shared by renderers which can be batched together.
+   * Derived renderers which support DoRenderBatch() should override this.
+   * @return The texture ID, or zero if the renderer cannot be batched.
+   */
+  virtual Integration::ResourceId GetBatchTextureId() const;
+
+  /**
+   * Sets the blending & face-culling state of the GL context, prior to drawing.
+   */
+  void SetGlState();
+
   /**
    * Called from Render; implemented in derived classes.
    * @param[in] bufferIndex The index of the previous update buffer.
@@ -149,6 +191,18 @@ private:
    */
   virtual void DoRender( BufferIndex bufferIndex, const Matrix& modelViewMatrix, const Matrix& modelMatrix, const Matrix& viewMatrix, const Matrix& projectionMatrix, const Vector4& color ) = 0;
 
+  /**
+   * Called from RenderBatch; implemented in derived classes which return a batch texture.
+   * @param[in] bufferIndex The index of the previous update buffer.
+   * @param[in] renderList The render-list containing the batch.
+   * @param[in] first The index of the first render-item in the batch.
+   * @param[in] count The number of render-items in the batch.
+   * @param[in] viewMatrix The view matrix.
+   * @param[in] projectionMatrix The projection matrix.
+   * @param[in] color to use
+   */
+  virtual void DoRenderBatch( BufferIndex bufferIndex, const RenderList& renderList, size_t first, size_t count, const Matrix& viewMatrix, const Matrix& projectionMatrix, const Vector4& color );
+
 protected:
 
   RenderDataProvider& mDataProvider;
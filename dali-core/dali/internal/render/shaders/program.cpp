@@ -19,12 +19,16 @@
 
 // EXTERNAL INCLUDES
 #include <dali/public-api/common/vector-wrapper.h>
+#include <algorithm>
 #include <iomanip>
 
 // INTERNAL INCLUDES
 #include <dali/public-api/common/dali-common.h>
 #include <dali/public-api/common/constants.h>
 #include <dali/internal/render/common/performance-monitor.h>
+#include <dali/internal/render/common/post-process-resource-dispatcher.h>
+#include <dali/internal/render/shaders/shader.h>
+#include <dali/internal/update/resources/resource-manager-declarations.h>
 #include <dali/integration-api/debug.h>
 #include <dali/integration-api/shader-data.h>
 
@@ -113,11 +117,26 @@ const char* gStdUniforms[ Program::UNIFORM_TYPE_LAST ] =
   "uInvTextSize"          // UNIFORM_INVERSE_TEXT_SIZE
 };
 
+const unsigned int PROGRAM_BINARY_MAGIC   = 0x4442494e; ///< "DBIN"
+const unsigned int PROGRAM_BINARY_VERSION = 1;          ///< Increase when the layout of cached binaries changes
+
+/**
+ * Cached program binaries start with this header, so a binary is only handed to the driver which created it.
+ */
+struct ProgramBinaryHeader
+{
+  unsigned int magic;      ///< PROGRAM_BINARY_MAGIC
+  unsigned int version;    ///< PROGRAM_BINARY_VERSION
+  unsigned int driverHash; ///< Context::CachedDriverHash() of the driver which created the binary
+  unsigned int format;     ///< The format of the binary, returned by the driver
+};
+
 }  // <unnamed> namespace
 
 // IMPLEMENTATION
 
-Program* Program::New( const Integration::ResourceId& resourceId, Integration::ShaderData* shaderData, Context& context )
+Program* Program::New( const Integration::ResourceId& resourceId, Integration::ShaderData* shaderData, Context& context,
+                       SceneGraph::PostProcessResourceDispatcher* postProcessDispatcher )
 {
   size_t shaderHash = shaderData->GetHashValue();
   Program* program = context.GetCachedProgram( shaderHash );
@@ -125,7 +144,7 @@ Program* Program::New( const Integration::ResourceId& resourceId, Integration::S
   if( NULL == program )
   {
     // program not found so create it
-    program = new Program( shaderData, context );
+    program = new Program( shaderData, resourceId, context, postProcessDispatcher );
 
     program->Load();
 
@@ -138,12 +157,14 @@ Program* Program::New( const Integration::ResourceId& resourceId, Integration::S
 
 void Program::Use()
 {
-  if ( !mLinked &&
+  if ( !mLinked && !mLinkPending &&
        mContext.IsGlContextCreated() )
   {
     Load();
   }
 
+  WaitUntilReady();
+
   if ( mLinked )
   {
     if ( this != mContext.GetCurrentProgram() )
@@ -162,6 +183,53 @@ bool Program::IsUsed()
   return ( this == mContext.GetCurrentProgram() );
 }
 
+bool Program::IsReady()
+{
+  if( mLinkPending )
+  {
+    if( !mContext.IsParallelShaderCompileSupported() )
+    {
+      // Querying the results would wait for the driver
+      return false;
+    }
+
+    GLint completed = GL_FALSE;
+    CHECK_GL( mContext, mGlAbstraction.GetProgramiv( mProgramId, GL_COMPLETION_STATUS_KHR, &completed ) );
+    if( GL_FALSE == completed )
+    {
+      return false;
+    }
+
+    FinishLoad();
+  }
+
+  return true;
+}
+
+void Program::WaitUntilReady()
+{
+  if( mLinkPending )
+  {
+    // Wait for the driver
+    FinishLoad();
+  }
+}
+
+void Program::AddWaitingShader( SceneGraph::Shader& shader )
+{
+  mWaitingShaders.push_back( &shader );
+}
+
+void Program::RemoveWaitingShader( SceneGraph::Shader& shader )
+{
+  mWaitingShaders.erase( std::remove( mWaitingShaders.begin(), mWaitingShaders.end(), &shader ), mWaitingShaders.end() );
+}
+
+bool Program::IsLoadedFromBinary() const
+{
+  return mLoadedFromBinary;
+}
+
 GLint Program::GetAttribLocation( AttribType type )
 {
   DALI_ASSERT_DEBUG(type != ATTRIB_UNKNOWN);
@@ -430,14 +498,18 @@ void Program::GlContextToBeDestroyed()
   ResetAttribsUniforms();
 }
 
-Program::Program(Integration::ShaderData* shaderData, Context& context )
+Program::Program(Integration::ShaderData* shaderData, Integration::ResourceId resourceId, Context& context, SceneGraph::PostProcessResourceDispatcher* postProcessDispatcher )
 : mContext( context ),
   mGlAbstraction( context.GetAbstraction() ),
   mLinked( false ),
+  mLoadedFromBinary( false ),
+  mLinkPending( false ),
   mVertexShaderId( 0 ),
   mFragmentShaderId( 0 ),
   mProgramId( 0 ),
-  mProgramData(shaderData)
+  mProgramData(shaderData),
+  mResourceId( resourceId ),
+  mPostProcessDispatcher( postProcessDispatcher )
 {
   // reserve space for standard uniforms
   mUniformLocations.reserve( UNIFORM_TYPE_LAST );
@@ -455,6 +527,10 @@ Program::Program(Integration::ShaderData* shaderData, Context& context )
 Program::~Program()
 {
   mContext.RemoveObserver( *this );
+  mContext.RemovePendingProgram( this );
+
+  // The shaders are not told; they are discarded before the context deletes its programs
+  mWaitingShaders.clear();
 
   Unload(); // Resets gCurrentProgram
 }
@@ -469,13 +545,27 @@ void Program::Load()
   mProgramId = CHECK_GL( mContext, mGlAbstraction.CreateProgram() );
 
   GLint linked = GL_FALSE;
+  mLoadedFromBinary = false;
+
+  // ShaderData contains compiled bytecode, created by this driver?
+  const ProgramBinaryHeader* header = NULL;
+  if( 0 != mContext.CachedNumberOfProgramBinaryFormats() && mProgramData->buffer.size() > sizeof( ProgramBinaryHeader ) )
+  {
+    header = reinterpret_cast< const ProgramBinaryHeader* >( mProgramData->buffer.data() );
+    if( header->magic != PROGRAM_BINARY_MAGIC ||
+        header->version != PROGRAM_BINARY_VERSION ||
+        header->driverHash != static_cast< unsigned int >( mContext.CachedDriverHash() ) )
+    {
+      DALI_LOG_INFO(Debug::Filter::gShader, Debug::General, "Program::Load() - Ignoring Compiled Shader of another driver or version\n");
+      header = NULL;
+    }
+  }
 
-  // ShaderData contains compiled bytecode?
-  if( 0 != mContext.CachedNumberOfProgramBinaryFormats() && mProgramData->HasBinary() )
+  if( header )
   {
     DALI_LOG_INFO(Debug::Filter::gShader, Debug::General, "Program::Load() - Using Compiled Shader, Size = %d\n", mProgramData->buffer.size());
 
-    CHECK_GL( mContext, mGlAbstraction.ProgramBinary(mProgramId, mContext.CachedProgramBinaryFormat(), mProgramData->buffer.data(), mProgramData->buffer.size()) );
+    CHECK_GL( mContext, mGlAbstraction.ProgramBinary(mProgramId, header->format, mProgramData->buffer.data() + sizeof( ProgramBinaryHeader ), mProgramData->buffer.size() - sizeof( ProgramBinaryHeader )) );
 
     CHECK_GL( mContext, mGlAbstraction.ValidateProgram(mProgramId) );
 
@@ -505,6 +595,8 @@ void Program::Load()
     else
     {
       mLinked = true;
+      mLoadedFromBinary = true;
+      INCREASE_COUNTER(PerformanceMonitor::SHADER_BINARY_CACHE_HITS);
     }
   }
 
@@ -512,24 +604,61 @@ void Program::Load()
   if( GL_FALSE == linked )
   {
     DALI_LOG_INFO(Debug::Filter::gShader, Debug::General, "Program::Load() - Runtime compilation\n");
-    if( CompileShader( GL_VERTEX_SHADER, mVertexShaderId, mProgramData->vertexShader.c_str() ) )
-    {
-      if( CompileShader( GL_FRAGMENT_SHADER, mFragmentShaderId, mProgramData->fragmentShader.c_str() ) )
-      {
-        Link();
+    INCREASE_COUNTER(PerformanceMonitor::SHADER_BINARY_CACHE_MISSES);
 
-        if( mLinked )
-        {
-          GLint  binaryLength = 0;
-          GLenum binaryFormat;
+    // Any binary is stale, it is replaced by the one created in FinishLoad()
+    std::vector< unsigned char >().swap( mProgramData->buffer );
 
-          CHECK_GL( mContext, mGlAbstraction.GetProgramiv(mProgramId, GL_PROGRAM_BINARY_LENGTH_OES, &binaryLength) );
-          DALI_LOG_INFO(Debug::Filter::gShader, Debug::General, "Program::Load() - GL_PROGRAM_BINARY_LENGTH_OES: %d\n", binaryLength);
+    // Querying the results would wait for the driver, so that is left until the program is needed
+    CompileShader( GL_VERTEX_SHADER, mVertexShaderId, mProgramData->vertexShader.c_str() );
+    CompileShader( GL_FRAGMENT_SHADER, mFragmentShaderId, mProgramData->fragmentShader.c_str() );
+    Link();
+
+    mLinkPending = true;
+    mContext.AddPendingProgram( this );
+  }
+  else
+  {
+    // No longer needed
+    FreeShaders();
+  }
+}
+
+void Program::FinishLoad()
+{
+  mLinkPending = false;
+
+  if( CheckCompiled( mVertexShaderId, mProgramData->vertexShader.c_str() ) &&
+      CheckCompiled( mFragmentShaderId, mProgramData->fragmentShader.c_str() ) )
+  {
+    CheckLinked();
 
-          // Allocate space for the bytecode in ShaderData
-          mProgramData->AllocateBuffer(binaryLength);
-          // Copy the bytecode to ShaderData
-          CHECK_GL( mContext, mGlAbstraction.GetProgramBinary(mProgramId, binaryLength, NULL, &binaryFormat, mProgramData->buffer.data()) );
+    if( mLinked )
+    {
+      GLint  binaryLength = 0;
+      GLenum binaryFormat;
+
+      CHECK_GL( mContext, mGlAbstraction.GetProgramiv(mProgramId, GL_PROGRAM_BINARY_LENGTH_OES, &binaryLength) );
+      DALI_LOG_INFO(Debug::Filter::gShader, Debug::General, "Program::FinishLoad() - GL_PROGRAM_BINARY_LENGTH_OES: %d\n", binaryLength);
+
+      if( binaryLength > 0 )
+      {
+        // Allocate space for the header and bytecode in ShaderData
+        mProgramData->AllocateBuffer( sizeof( ProgramBinaryHeader ) + binaryLength );
+        // Copy the bytecode to ShaderData
+        CHECK_GL( mContext, mGlAbstraction.GetProgramBinary(mProgramId, binaryLength, NULL, &binaryFormat, mProgramData->buffer.data() + sizeof( ProgramBinaryHeader )) );
+
+        ProgramBinaryHeader* header = reinterpret_cast< ProgramBinaryHeader* >( mProgramData->buffer.data() );
+        header->magic = PROGRAM_BINARY_MAGIC;
+        header->version = PROGRAM_BINARY_VERSION;
+        header->driverHash = static_cast< unsigned int >( mContext.CachedDriverHash() );
+        header->format = binaryFormat;
+
+        // Save the binary; this also replaces a cached binary which was created by another driver.
+        if( mPostProcessDispatcher )
+        {
+          ResourcePostProcessRequest request( mResourceId, ResourcePostProcessRequest::SAVE );
+          mPostProcessDispatcher->DispatchPostProcessRequest( request );
         }
       }
     }
@@ -538,12 +667,16 @@ void Program::Load()
   // No longer needed
   FreeShaders();
 
+  NotifyWaitingShaders();
 }
 
 void Program::Unload()
 {
   FreeShaders();
 
+  // The shaders need not wait for an unloaded program; it is loaded again when used
+  NotifyWaitingShaders();
+
   if( this == mContext.GetCurrentProgram() )
   {
     CHECK_GL( mContext, mGlAbstraction.UseProgram(0) );
@@ -559,10 +692,11 @@ void Program::Unload()
   }
 
   mLinked = false;
+  mLinkPending = false;
 
 }
 
-bool Program::CompileShader( GLenum shaderType, GLuint& shaderId, const char* src )
+void Program::CompileShader( GLenum shaderType, GLuint& shaderId, const char* src )
 {
   if (!shaderId)
   {
@@ -577,7 +711,10 @@ bool Program::CompileShader( GLenum shaderType, GLuint& shaderId, const char* sr
 
   LOG_GL( "CompileShader(%d)\n", shaderId );
   CHECK_GL( mContext, mGlAbstraction.CompileShader( shaderId ) );
+}
 
+bool Program::CheckCompiled( GLuint shaderId, const char* src )
+{
   GLint compiled;
   LOG_GL( "GetShaderiv(%d)\n", shaderId );
   CHECK_GL( mContext, mGlAbstraction.GetShaderiv( shaderId, GL_COMPILE_STATUS, &compiled ) );
@@ -607,7 +744,10 @@ void Program::Link()
 {
   LOG_GL( "LinkProgram(%d)\n", mProgramId );
   CHECK_GL( mContext, mGlAbstraction.LinkProgram( mProgramId ) );
+}
 
+void Program::CheckLinked()
+{
   GLint linked;
   LOG_GL( "GetProgramiv(%d)\n", mProgramId );
   CHECK_GL( mContext, mGlAbstraction.GetProgramiv( mProgramId, GL_LINK_STATUS, &linked ) );
@@ -652,6 +792,18 @@ void Program::FreeShaders()
   }
 }
 
+void Program::NotifyWaitingShaders()
+{
+  // A shader may wait for this program again, while it is being told
+  std::vector< SceneGraph::Shader* > waitingShaders;
+  waitingShaders.swap( mWaitingShaders );
+
+  for( std::vector< SceneGraph::Shader* >::iterator iter = waitingShaders.begin(); iter != waitingShaders.end(); ++iter )
+  {
+    (*iter)->ProgramFinished( *this );
+  }
+}
+
 void Program::ResetAttribsUniforms()
 {
   // reset attribute locations
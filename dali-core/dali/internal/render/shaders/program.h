@@ -43,6 +43,12 @@ namespace Internal
 
 class Context;
 
+namespace SceneGraph
+{
+class PostProcessResourceDispatcher;
+class Shader;
+}
+
 /*
  * A program contains a vertex & fragment shader.
  *
@@ -133,23 +139,57 @@ public:
    * @param [in] resourceId ResourceManager resourceId for the shader source and binary.
    *                        Used as a lookup key in the program cache
    * @param[in] shaderData  A pointer to a data structure containing the program source
-   *                        and optionally precompiled binary. If the binary is empty the program bytecode
-   *                        is copied into it after compilation and linking)
+   *                        and optionally precompiled binary. If the binary is empty or was created by
+   *                        another driver, the program bytecode is copied into it after compilation and linking
    * @param [in] context    GL context
+   * @param [in] postProcessDispatcher Used to save the binary once a program compiled from source has linked, may be NULL
    * @return pointer to the program
    */
-  static Program* New( const Integration::ResourceId& resourceId, Integration::ShaderData* shaderData, Context& context );
+  static Program* New( const Integration::ResourceId& resourceId, Integration::ShaderData* shaderData, Context& context,
+                       SceneGraph::PostProcessResourceDispatcher* postProcessDispatcher = NULL );
 
   /**
-   * Takes this program into use
+   * Takes this program into use.
+   * Waits for the driver to finish compiling and linking the program, if it hasn't yet.
    */
   void Use();
 
+  /**
+   * Checks whether the program can be used without waiting for the driver; this never blocks.
+   * When the driver supports GL_KHR_parallel_shader_compile, a program it has finished compiling and linking
+   * in the background finishes loading here. Otherwise the program stays pending until WaitUntilReady().
+   * @return true if the program has finished loading, false while the driver may still be compiling or linking it
+   */
+  bool IsReady();
+
+  /**
+   * Waits for the driver to finish compiling and linking the program, if it hasn't yet,
+   * and finishes loading the program.
+   */
+  void WaitUntilReady();
+
+  /**
+   * Tells a shader once the program has finished loading, or has been unloaded.
+   * @param[in] shader The shader, which isn't drawn until its programs are ready
+   */
+  void AddWaitingShader( SceneGraph::Shader& shader );
+
+  /**
+   * Stops telling a shader when the program has finished loading.
+   * @param[in] shader The shader, which is being discarded
+   */
+  void RemoveWaitingShader( SceneGraph::Shader& shader );
+
   /**
    * @return true if this program is used currently
    */
   bool IsUsed();
 
+  /**
+   * @return true if the program was loaded from a compiled binary, false if it was compiled from source
+   */
+  bool IsLoadedFromBinary() const;
+
   /**
    * @param [in] type of the attribute
    * @return the index of the attribute
@@ -257,9 +297,11 @@ private: // Implementation
   /**
    * Constructor, private so no direct instantiation
    * @param[in] shaderData A pointer to a data structure containing the program source and binary
+   * @param[in] resourceId The resource id of the shader data
    * @param[in] context    The GL context state cache.
+   * @param[in] postProcessDispatcher Used to save the binary, may be NULL
    */
-  Program( Integration::ShaderData* shaderData, Context& context );
+  Program( Integration::ShaderData* shaderData, Integration::ResourceId resourceId, Context& context, SceneGraph::PostProcessResourceDispatcher* postProcessDispatcher );
 
 public:
 
@@ -276,34 +318,59 @@ private:
   Program& operator=( const Program& );
 
   /**
-   * Load the shader, from a precompiled binary if available, else from source code
+   * Load the shader, from a precompiled binary if available, else from source code.
+   * Binaries created by another driver, or by an older version of Dali, are ignored.
+   * When compiled from source, the compilation and linking are only issued here; FinishLoad() queries the results.
    */
   void Load();
 
+  /**
+   * Finishes loading a program compiled from source; checks the compilation and linking,
+   * and copies the binary into the program data so it can be saved.
+   */
+  void FinishLoad();
+
   /**
    * Unload the shader
    */
   void Unload();
 
   /**
-   * Compile the shader
+   * Compile the shader. The result is checked by CheckCompiled()
    * @param shaderType vertex or fragment shader
    * @param shaderId of the shader, returned
    * @param src of the shader
+   */
+  void CompileShader(GLenum shaderType, GLuint& shaderId, const char* src);
+
+  /**
+   * Checks whether the shader compiled, throws if it didn't
+   * @param shaderId of the shader
+   * @param src of the shader
    * @return true if the compilation succeeded
    */
-  bool CompileShader(GLenum shaderType, GLuint& shaderId, const char* src);
+  bool CheckCompiled(GLuint shaderId, const char* src);
 
   /**
-   * Links the shaders together to create program
+   * Links the shaders together to create program. The result is checked by CheckLinked()
    */
   void Link();
 
+  /**
+   * Checks whether the program linked
+   */
+  void CheckLinked();
+
   /**
    * Frees the shader programs
    */
   void FreeShaders();
 
+  /**
+   * Tells the waiting shaders that they need not wait for this program anymore
+   */
+  void NotifyWaitingShaders();
+
   /**
    * Resets caches
    */
@@ -314,10 +381,15 @@ private:  // Data
   Context& mContext;                          ///< The GL context state cache
   Integration::GlAbstraction& mGlAbstraction; ///< The OpenGL Abstraction layer
   bool mLinked;                               ///< whether the program is linked
+  bool mLoadedFromBinary;                     ///< whether the program was loaded from a compiled binary
+  bool mLinkPending;                          ///< whether compilation and linking were issued, but their results not queried yet
   GLuint mVertexShaderId;                     ///< GL identifier for vertex shader
   GLuint mFragmentShaderId;                   ///< GL identifier for fragment shader
   GLuint mProgramId;                          ///< GL identifier for program
   Integration::ShaderData* mProgramData;      ///< Shader program source and binary (when compiled & linked or loaded)
+  Integration::ResourceId mResourceId;        ///< The resource id of the program data
+  SceneGraph::PostProcessResourceDispatcher* mPostProcessDispatcher; ///< Used for saving the binary, may be NULL
+  std::vector< SceneGraph::Shader* > mWaitingShaders; ///< The shaders waiting for the program to finish loading
 
   // location caches
   GLint mAttribLocations[ ATTRIB_TYPE_LAST ]; ///< attribute location cache
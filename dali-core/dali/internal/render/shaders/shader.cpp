@@ -17,6 +17,9 @@
 // CLASS HEADER
 #include <dali/internal/render/shaders/shader.h>
 
+// EXTERNAL INCLUDES
+#include <algorithm>
+
 // INTERNAL INCLUDES
 #include <dali/public-api/common/dali-common.h>
 #include <dali/public-api/common/stage.h>
@@ -106,13 +109,16 @@ unsigned int GetGeometryTypeIndex(GeometryType type)
 
 Shader::Shader( Dali::ShaderEffect::GeometryHints& hints )
 : mGeometryHints( hints ),
+  mIsDefault( false ),
   mGridDensity( Dali::ShaderEffect::DEFAULT_GRID_DENSITY ),
   mTexture( NULL ),
   mRenderTextureId( 0 ),
   mUpdateTextureId( 0 ),
   mModelViewProjection( false ), // Don't initialize.
   mRenderQueue(NULL),
+  mPendingPrograms(0),
   mPostProcessDispatcher(NULL),
+  mWaitingPrograms(),
   mTextureCache(NULL),
   mFrametime(0.f)
 {
@@ -157,6 +163,16 @@ Integration::ResourceId Shader::GetEffectTextureResourceId()
   return mUpdateTextureId;
 }
 
+void Shader::SetProgramPending()
+{
+  (void)__sync_add_and_fetch( &mPendingPrograms, 1 );
+}
+
+bool Shader::HasPendingPrograms()
+{
+  return 0 != __sync_fetch_and_add( &mPendingPrograms, 0 );
+}
+
 void Shader::ForwardUniformMeta( BufferIndex updateBufferIndex, UniformMeta* meta )
 {
   // Defer setting uniform metadata until the next Render
@@ -234,9 +250,8 @@ void Shader::SetProgram( GeometryType geometryType,
 {
   DALI_LOG_TRACE_METHOD_FMT(Debug::Filter::gShader, "%d %d\n", (int)geometryType, resourceId);
 
-  bool precompiledBinary = shaderData->HasBinary();
-
-  Program* program = Program::New( resourceId, shaderData.Get(), *context );
+  // The program binary is saved once the program has linked
+  Program* program = Program::New( resourceId, shaderData.Get(), *context, mPostProcessDispatcher );
 
   ShaderSubTypes theSubType = subType;
   if( subType == SHADER_SUBTYPE_ALL )
@@ -256,15 +271,33 @@ void Shader::SetProgram( GeometryType geometryType,
     mPrograms[GetGeometryTypeIndex(geometryType)].mUseDefaultForAllSubtypes = false;
   }
 
-  if( !precompiledBinary )
+  if( program->IsReady() )
   {
-    // The binary will have been compiled/linked during Program::New(), so save it
-    if( shaderData->HasBinary() )
-    {
-      DALI_ASSERT_DEBUG( mPostProcessDispatcher != NULL );
-      ResourcePostProcessRequest request( resourceId, ResourcePostProcessRequest::SAVE );
-      mPostProcessDispatcher->DispatchPostProcessRequest( request );
-    }
+    // Tell the update thread
+    (void)__sync_sub_and_fetch( &mPendingPrograms, 1 );
+  }
+  else
+  {
+    // The context finishes loading the program after drawing a frame; see Context::LinkPendingPrograms()
+    mWaitingPrograms.PushBack( program );
+    program->AddWaitingShader( *this );
+  }
+}
+
+bool Shader::AreProgramsReady()
+{
+  return 0u == mWaitingPrograms.Count();
+}
+
+void Shader::ProgramFinished( Program& program )
+{
+  Dali::Vector<Program*>::Iterator iter = std::find( mWaitingPrograms.Begin(), mWaitingPrograms.End(), &program );
+  if( iter != mWaitingPrograms.End() )
+  {
+    mWaitingPrograms.Erase( iter );
+
+    // Tell the update thread
+    (void)__sync_sub_and_fetch( &mPendingPrograms, 1 );
   }
 }
 
@@ -278,6 +311,12 @@ bool Shader::AreSubtypesRequired(GeometryType geometryType)
 
 void Shader::GlCleanup()
 {
+  for( Dali::Vector<Program*>::Iterator iter = mWaitingPrograms.Begin(); iter != mWaitingPrograms.End(); ++iter )
+  {
+    (*iter)->RemoveWaitingShader( *this );
+  }
+  mWaitingPrograms.Clear();
+
   mPrograms.clear();
 }
 
@@ -167,6 +167,25 @@ public:
     mGeometryHints = hints;
   }
 
+  /**
+   * Mark this shader as the default shader.
+   * @pre This should be called before the shader is used by any renderer.
+   */
+  void SetDefault()
+  {
+    mIsDefault = true;
+  }
+
+  /**
+   * Query whether this is the default shader.
+   * The default programs only use the standard uniforms, so renderers using the default shader may be batched.
+   * @return True if this is the default shader.
+   */
+  bool IsDefault() const
+  {
+    return mIsDefault;
+  }
+
   /**
    * @copydoc Dali::Internal::SceneGraph::PropertyOwner::ResetDefaultProperties
    */
@@ -190,6 +209,21 @@ public:
    */
   Integration::ResourceId GetEffectTextureResourceId();
 
+  /**
+   * Called when a program is sent to the render thread; the shader has pending programs
+   * until the render thread has finished compiling and linking them.
+   * @pre This method should only be called from the update thread.
+   */
+  void SetProgramPending();
+
+  /**
+   * Query whether the programs sent to the render thread are still being compiled or linked.
+   * Renderers using the shader skip drawing until they have finished.
+   * @pre This method should only be called from the update thread.
+   * @return true if some programs are pending.
+   */
+  bool HasPendingPrograms();
+
   /**
    * Forwards the meta data from the update thread to the render thread for actual
    * installation. (Installation is to a std::vector, which is not thread safe)
@@ -275,6 +309,21 @@ public:
    */
   bool AreSubtypesRequired(GeometryType geometryType);
 
+  /**
+   * Query whether every program of the shader can be used without waiting for the driver.
+   * @pre This method should only be called from the render thread.
+   * @return true if the programs have finished loading.
+   */
+  bool AreProgramsReady();
+
+  /**
+   * Called by a program set with SetProgram(), once it has finished loading or has been unloaded.
+   * Tells the update thread that the program is no longer pending.
+   * @pre This method should only be called from the render thread.
+   * @param[in] program The program.
+   */
+  void ProgramFinished( Program& program );
+
   /**
    * This is called within RenderManager::Render, after the shader is detached from the scene-graph.
    * @post The base class resets the program references in mPrograms
@@ -318,6 +367,7 @@ private: // Data
   typedef OwnerContainer< UniformMeta* > UniformMetaContainer;
 
   int                            mGeometryHints;    ///< shader geometry hints for building the geometry
+  bool                           mIsDefault;        ///< True if this is the default shader
   float                          mGridDensity;      ///< grid density
   Texture*                       mTexture;          ///< Raw Pointer to Texture
   Integration::ResourceId        mRenderTextureId;  ///< Copy of the texture ID for the render thread
@@ -331,8 +381,11 @@ private: // Data
   // These members are only safe to access during UpdateManager::Update()
   RenderQueue*                   mRenderQueue;                   ///< Used for queuing a message for the next Render
 
+  volatile int                   mPendingPrograms;  ///< Programs set by the update thread, which the render thread hasn't finished yet
+
   // These members are only safe to access in render thread
   PostProcessResourceDispatcher* mPostProcessDispatcher; ///< Used for saving shaders through the resource manager
+  Dali::Vector<Program*>         mWaitingPrograms;       ///< Programs set by SetProgram(), which haven't finished loading yet
   TextureCache*                  mTextureCache; // Used for retrieving textures in the render thread
   float                          mFrametime;   ///< Used for setting the frametime delta shader uniform.
 };
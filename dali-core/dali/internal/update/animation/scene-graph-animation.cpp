@@ -19,6 +19,9 @@
 
 // EXTERNAL INCLUDES
 #include <cmath> // fmod
+#include <algorithm>
+#include <utility>
+#include <vector>
 
 // INTERNAL INCLUDES
 #include <dali/internal/render/common/performance-monitor.h>
@@ -34,6 +37,22 @@ namespace Internal
 namespace SceneGraph
 {
 
+namespace
+{
+
+/**
+ * Orders animators by batch only, for std::stable_sort
+ */
+struct CompareBatches
+{
+  bool operator()( const std::pair< unsigned int, AnimatorBase* >& lhs, const std::pair< unsigned int, AnimatorBase* >& rhs ) const
+  {
+    return lhs.first < rhs.first;
+  }
+};
+
+} // unnamed namespace
+
 float DefaultAlphaFunc(float progress)
 {
   return progress; // linear
@@ -46,7 +65,9 @@ Animation::Animation(float durationSeconds, bool isLooping, Dali::Animation::End
   mDestroyAction(destroyAction),
   mState(Stopped),
   mElapsedSeconds(0.0f),
-  mPlayCount(0)
+  mPlayCount(0),
+  mAnimatorsGrouped(true),
+  mFinishing(false)
 {
 }
 
@@ -130,10 +151,23 @@ void Animation::AddAnimator( AnimatorBase* animator, PropertyOwner* propertyOwne
   animator->Attach( propertyOwner );
 
   mAnimators.PushBack( animator );
+  mAnimatorsGrouped = false;
 }
 
 bool Animation::Update(BufferIndex bufferIndex, float elapsedSeconds)
 {
+  if( !Advance(elapsedSeconds) )
+  {
+    return false;
+  }
+
+  return CompleteUpdate( ApplyAnimators(bufferIndex, IsBaking()) );
+}
+
+bool Animation::Advance(float elapsedSeconds)
+{
+  mFinishing = false;
+
   if (mState == Stopped || mState == Destroyed)
   {
     // Short circuit when animation isn't running
@@ -154,10 +188,26 @@ bool Animation::Update(BufferIndex bufferIndex, float elapsedSeconds)
     }
   }
 
-  const bool animationFinished(mState == Playing && mElapsedSeconds > mDurationSeconds);
+  mFinishing = (mState == Playing && mElapsedSeconds > mDurationSeconds);
 
-  UpdateAnimators(bufferIndex, animationFinished && (mEndAction == Dali::Animation::Bake));
+  return true;
+}
 
+const AnimatorContainer& Animation::GetGroupedAnimators()
+{
+  if( !mAnimatorsGrouped )
+  {
+    GroupAnimators();
+  }
+
+  return mAnimators;
+}
+
+bool Animation::CompleteUpdate(unsigned int appliedCount)
+{
+  RemoveOrphanedAnimators( appliedCount );
+
+  const bool animationFinished( mFinishing );
   if (animationFinished)
   {
     // The animation has now been played to completion
@@ -166,43 +216,125 @@ bool Animation::Update(BufferIndex bufferIndex, float elapsedSeconds)
     mElapsedSeconds = 0.0f;
     mState = Stopped;
   }
+  mFinishing = false;
 
   return animationFinished;
 }
 
 void Animation::UpdateAnimators(BufferIndex bufferIndex, bool bake)
 {
-  for ( AnimatorIter iter = mAnimators.Begin(); iter != mAnimators.End(); )
+  RemoveOrphanedAnimators( ApplyAnimators(bufferIndex, bake) );
+}
+
+unsigned int Animation::ApplyAnimators(BufferIndex bufferIndex, bool bake)
+{
+  if( !mAnimatorsGrouped )
+  {
+    GroupAnimators();
+  }
+
+  AnimatorBase* const* animators = mAnimators.Begin();
+  const unsigned int count = mAnimators.Count();
+
+  // Update each batch of adjacent animators with the same type and alpha function
+  unsigned int applied(0u);
+  for( unsigned int begin = 0u; begin < count; )
   {
-    // If an animator is not successfully applied, then it has been orphaned
-    bool applied(true);
+    const AnimatorBase& first = *animators[begin];
+
+    unsigned int end = begin + 1u;
+    while( end < count && animators[end]->IsBatchedWith( first ) )
+    {
+      ++end;
+    }
 
-    AnimatorBase *animator = *iter;
-    const float initialDelay(animator->GetInitialDelay());
+    applied += first.GetUpdateFunction()( animators + begin, end - begin, bufferIndex, mElapsedSeconds, bake );
+    begin = end;
+  }
 
-    if (mElapsedSeconds >= initialDelay)
+  return applied;
+}
+
+void Animation::RemoveOrphanedAnimators(unsigned int appliedCount)
+{
+  if( appliedCount < mAnimators.Count() )
+  {
+    // Animators are automatically removed, when orphaned from animatable scene objects.
+    for ( AnimatorIter iter = mAnimators.Begin(); iter != mAnimators.End(); )
     {
-      // Calculate a progress specific to each individual animator
-      float progress(1.0f);
-      const float animatorDuration = animator->GetDuration();
-      if (animatorDuration > 0.0f) // animators can be "immediate"
+      if( !(*iter)->IsAttached() )
+      {
+        iter = mAnimators.Erase(iter);
+      }
+      else
       {
-        progress = min(1.0f, (mElapsedSeconds - initialDelay) / animatorDuration);
+        ++iter;
       }
+    }
+  }
+
+  INCREASE_BY(PerformanceMonitor::ANIMATORS_APPLIED, appliedCount);
+}
 
-      applied = animator->Update(bufferIndex, progress, bake);
+void Animation::GroupAnimators()
+{
+  mAnimatorsGrouped = true;
+
+  const unsigned int count = mAnimators.Count();
+  if( count < 2u )
+  {
+    return;
+  }
+
+  // When a property has animators of different batches, their order matters e.g. when
+  // one animator starts from the value where the previous one stopped; keep the order then
+  typedef std::pair< const PropertyBase*, AnimatorBase* > PropertyAnimator;
+  std::vector< PropertyAnimator > propertyAnimators;
+  propertyAnimators.reserve( count );
+  for( unsigned int i = 0u; i < count; ++i )
+  {
+    propertyAnimators.push_back( PropertyAnimator( mAnimators[i]->GetProperty(), mAnimators[i] ) );
+  }
+  std::sort( propertyAnimators.begin(), propertyAnimators.end() );
+
+  for( unsigned int i = 1u; i < count; ++i )
+  {
+    if( propertyAnimators[i].first == propertyAnimators[i - 1u].first &&
+        !propertyAnimators[i].second->IsBatchedWith( *propertyAnimators[i - 1u].second ) )
+    {
+      return;
     }
+  }
 
-    // Animators are automatically removed, when orphaned from animatable scene objects.
-    if (!applied)
+  // Order the batches by their first animator, and the animators of a batch by when they were added
+  typedef std::pair< unsigned int, AnimatorBase* > BatchAnimator;
+  std::vector< BatchAnimator > batchAnimators;
+  std::vector< const AnimatorBase* > batches;
+  batchAnimators.reserve( count );
+  for( unsigned int i = 0u; i < count; ++i )
+  {
+    AnimatorBase* animator = mAnimators[i];
+
+    unsigned int batch = 0u;
+    while( batch < batches.size() && !animator->IsBatchedWith( *batches[batch] ) )
     {
-      iter = mAnimators.Erase(iter);
+      ++batch;
     }
-    else
+    if( batch == batches.size() )
     {
-      ++iter;
+      batches.push_back( animator );
+    }
+
+    batchAnimators.push_back( BatchAnimator( batch, animator ) );
+  }
+
+  if( batches.size() > 1u )
+  {
+    std::stable_sort( batchAnimators.begin(), batchAnimators.end(), CompareBatches() );
 
-      INCREASE_COUNTER(PerformanceMonitor::ANIMATORS_APPLIED);
+    for( unsigned int i = 0u; i < count; ++i )
+    {
+      mAnimators[i] = batchAnimators[i].second;
     }
   }
 }
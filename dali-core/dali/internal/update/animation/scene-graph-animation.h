@@ -185,6 +185,8 @@ public:
   /**
    * Add a newly created animator.
    * Animators are automatically removed, when orphaned from an animatable scene object.
+   * Animators with the same concrete type and alpha function are updated in batches;
+   * the animators of a property are still applied in the order they were added.
    * @param[in] animator The animator to add.
    * @param[in] propertyOwner The scene-object that owns the animatable property.
    * @post The animator is owned by this animation.
@@ -209,6 +211,46 @@ public:
    */
   bool Update(BufferIndex bufferIndex, float elapsedSeconds);
 
+  /**
+   * The first part of Update(); this advances the time of the animation, without applying the animators.
+   * This allows the animators of several animations to be applied in parallel, before CompleteUpdate() is called.
+   * @param[in] elapsedSeconds The time elapsed since the previous frame.
+   * @return True if the animators should be applied; these are retrieved with GetGroupedAnimators().
+   */
+  bool Advance(float elapsedSeconds);
+
+  /**
+   * Retrieve the animators, ordered so that those which can be updated in the same batch are adjacent.
+   * @return The container of animators.
+   */
+  const AnimatorContainer& GetGroupedAnimators();
+
+  /**
+   * Retrieve the time elapsed since the start of the animation, to apply the animators with.
+   * @return The time in seconds.
+   */
+  float GetElapsedSeconds() const
+  {
+    return mElapsedSeconds;
+  }
+
+  /**
+   * Query whether the animators should bake their final result, during the current update.
+   * @pre Advance() was called in the current update.
+   * @return True if the animators should bake.
+   */
+  bool IsBaking() const
+  {
+    return mFinishing && ( mEndAction == Dali::Animation::Bake );
+  }
+
+  /**
+   * The last part of Update(), after Advance() and once the animators have been applied.
+   * @param[in] appliedCount The number of animators which were applied; the others are removed if orphaned.
+   * @return True if the animation has finished.
+   */
+  bool CompleteUpdate(unsigned int appliedCount);
+
 
 protected:
 
@@ -227,6 +269,27 @@ private:
    */
   void UpdateAnimators(BufferIndex bufferIndex, bool bake);
 
+  /**
+   * Helper for UpdateAnimators, applies each batch of animators.
+   * @param[in] bufferIndex The buffer to update.
+   * @param[in] bake True if the final result should be baked.
+   * @return The number of animators which were applied.
+   */
+  unsigned int ApplyAnimators(BufferIndex bufferIndex, bool bake);
+
+  /**
+   * Helper for UpdateAnimators, removes the animators which are orphaned from animatable scene objects.
+   * @param[in] appliedCount The number of animators which were applied.
+   */
+  void RemoveOrphanedAnimators(unsigned int appliedCount);
+
+  /**
+   * Helper for UpdateAnimators, reorders the animators so that those which can be updated
+   * in the same batch are adjacent, unless this would change the order in which the
+   * animators of a property are applied.
+   */
+  void GroupAnimators();
+
   // Undefined
   Animation(const Animation&);
 
@@ -245,6 +308,8 @@ protected:
   int mPlayCount;
 
   AnimatorContainer mAnimators;
+  bool mAnimatorsGrouped; ///< Whether GroupAnimators() has been called since an animator was added
+  bool mFinishing;        ///< Set by Advance(), when the animation finishes during the current update
 };
 
 }; //namespace SceneGraph
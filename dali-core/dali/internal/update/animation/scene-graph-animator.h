@@ -18,6 +18,7 @@
 //
 
 // EXTERNAL INCLUDES
+#include <algorithm>
 #include <boost/function.hpp>
 
 // INTERNAL INCLUDES
@@ -48,9 +49,20 @@ typedef OwnerContainer< AnimatorBase* > AnimatorContainer;
 typedef AnimatorContainer::Iterator AnimatorIter;
 typedef AnimatorContainer::ConstIterator AnimatorConstIter;
 
+/**
+ * Creates the animators which call the common animator functions of a property type inline.
+ * Specialized for each property type, after the animator functions are defined.
+ */
+template < typename PropertyType >
+struct AnimatorFunctions;
+
 /**
  * An abstract base class for Animators, which can be added to scene graph animations.
  * Each animator changes a single property of an object in the scene graph.
+ *
+ * Animators are not updated one at a time through a virtual call; the animation updates
+ * batches of animators with the same concrete type and alpha function, through the update
+ * function of that type, which calls the alpha and animator functions in a tight loop.
  */
 class AnimatorBase
 {
@@ -58,11 +70,27 @@ public:
 
   typedef float (*AlphaFunc)(float progress); ///< Definition of an alpha function
 
+  /**
+   * Definition of the function updating a batch of animators.
+   * @param[in] animators The animators; these all have the same update function and alpha function.
+   * @param[in] count The number of animators.
+   * @param[in] bufferIndex The buffer to animate.
+   * @param[in] elapsedSeconds The time elapsed since the start of the animation.
+   * @param[in] bake Bake.
+   * @return The number of animators which were applied.
+   */
+  typedef unsigned int (*UpdateFunction)( AnimatorBase* const* animators, unsigned int count, BufferIndex bufferIndex, float elapsedSeconds, bool bake );
+
   /**
    * Constructor.
+   * @param[in] updateFunction The function updating a batch of animators of the derived type.
+   * @param[in] property The animatable property.
    */
-  AnimatorBase()
-  : mDurationSeconds(1.0f),
+  AnimatorBase( UpdateFunction updateFunction, const PropertyBase* property )
+  : mUpdateFunction(updateFunction),
+    mPropertyOwner(NULL),
+    mProperty(property),
+    mDurationSeconds(1.0f),
     mInitialDelaySeconds(0.0f),
     mAlphaFunc(AlphaFunctions::Linear),
     mRelative(false)
@@ -134,6 +162,35 @@ public:
     return mAlphaFunc;
   }
 
+  /**
+   * Retrieve the function updating a batch of animators of the same type as this one.
+   * @return The function.
+   */
+  UpdateFunction GetUpdateFunction() const
+  {
+    return mUpdateFunction;
+  }
+
+  /**
+   * Query whether an animator can be updated in the same batch as this one.
+   * @param[in] animator The other animator.
+   * @return True if both animators have the same concrete type and alpha function.
+   */
+  bool IsBatchedWith( const AnimatorBase& animator ) const
+  {
+    return mUpdateFunction == animator.mUpdateFunction &&
+           mAlphaFunc == animator.mAlphaFunc;
+  }
+
+  /**
+   * Retrieve the animated property; only valid while the animator is attached.
+   * @return The property.
+   */
+  const PropertyBase* GetProperty() const
+  {
+    return mProperty;
+  }
+
   /**
    * This must be called when the animator is attached to the scene-graph.
    * @pre The animatable scene object must also be attached to the scene-graph.
@@ -141,24 +198,40 @@ public:
    */
   virtual void Attach( PropertyOwner* propertyOwner ) = 0;
 
-  /**
-   * Update the scene object attached to the animator.
-   * @param[in] bufferIndex The buffer to animate.
-   * @param[in] progress A value from 0 to 1, where 0 is the start of the animation, and 1 is the end point.
-   * @param[in] bake Bake.
-   * @return True if the update was applied, false if the animator has been orphaned.
-   */
-  virtual bool Update(BufferIndex bufferIndex, float progress, bool bake) = 0;
-
   /**
    * Query whether the animator is still attached to a scene object.
    * The attachment will be automatically severed, when the object is destroyed.
    * @return True if the animator is attached.
    */
-  virtual bool IsAttached() const = 0;
+  bool IsAttached() const
+  {
+    return NULL != mPropertyOwner;
+  }
+
+protected:
+
+  /**
+   * Calculate the progress of the animator.
+   * @pre elapsedSeconds is not less than the initial delay.
+   * @param[in] elapsedSeconds The time elapsed since the start of the animation.
+   * @return A value from 0 to 1, where 0 is the start of the animator, and 1 is the end point.
+   */
+  float GetProgress( float elapsedSeconds ) const
+  {
+    float progress(1.0f);
+    if (mDurationSeconds > 0.0f) // animators can be "immediate"
+    {
+      progress = std::min(1.0f, (elapsedSeconds - mInitialDelaySeconds) / mDurationSeconds);
+    }
+    return progress;
+  }
 
 protected:
 
+  UpdateFunction mUpdateFunction;
+  PropertyOwner* mPropertyOwner;
+  const PropertyBase* mProperty;
+
   float mDurationSeconds;
   float mInitialDelaySeconds;
 
@@ -169,8 +242,10 @@ protected:
 
 /**
  * An animator for a specific property type PropertyType.
+ * AnimatorFunctionType is the type of the function used to animate the property;
+ * a boost::function for custom functions, or one of the common functions below, which are called inline.
  */
-template < typename PropertyType, typename PropertyAccessorType >
+template < typename PropertyType, typename PropertyAccessorType, typename AnimatorFunctionType = boost::function< PropertyType (float, const PropertyType&) > >
 class Animator : public AnimatorBase, public PropertyOwner::Observer
 {
 public:
@@ -179,6 +254,7 @@ public:
 
   /**
    * Construct a new property animator.
+   * The animator function is unwrapped from the boost::function when it is one of the common functions.
    * @param[in] property The animatable property; only valid while the Animator is attached.
    * @param[in] animatorFunction The function used to animate the property.
    * @param[in] alphaFunction The alpha function to apply.
@@ -190,11 +266,14 @@ public:
                             AlphaFunction alphaFunction,
                             const TimePeriod& timePeriod )
   {
-    typedef Animator< PropertyType, PropertyAccessorType > AnimatorType;
-
     // The property was const in the actor-thread, but animators are used in the scene-graph thread.
-    AnimatorType* animator = new AnimatorType( const_cast<PropertyBase*>( &property ),
-                                               animatorFunction );
+    PropertyBase* sceneProperty = const_cast<PropertyBase*>( &property );
+
+    AnimatorBase* animator = AnimatorFunctions< PropertyType >::template New< PropertyAccessorType >( sceneProperty, animatorFunction );
+    if( !animator )
+    {
+      animator = Animator< PropertyType, PropertyAccessorType >::NewUnwrapped( sceneProperty, animatorFunction );
+    }
 
     animator->SetAlphaFunc( alphaFunction );
     animator->SetInitialDelay( timePeriod.delaySeconds );
@@ -203,6 +282,18 @@ public:
     return animator;
   }
 
+  /**
+   * Construct a new property animator, with the default alpha function and time period.
+   * @param[in] property The animatable property; only valid while the Animator is attached.
+   * @param[in] animatorFunction The function used to animate the property.
+   * @return A newly allocated animator.
+   */
+  static AnimatorBase* NewUnwrapped( PropertyBase* property,
+                                     const AnimatorFunctionType& animatorFunction )
+  {
+    return new Animator( property, animatorFunction );
+  }
+
   /**
    * Virtual destructor.
    */
@@ -229,38 +320,30 @@ public:
   }
 
   /**
-   * From AnimatorBase.
+   * Update a batch of animators of this type; see AnimatorBase::UpdateFunction.
    */
-  virtual bool Update( BufferIndex bufferIndex, float progress, bool bake )
+  static unsigned int UpdateBatch( AnimatorBase* const* animators, unsigned int count, BufferIndex bufferIndex, float elapsedSeconds, bool bake )
   {
-    // If the object dies, the animator has no effect
-    if ( mPropertyOwner )
-    {
-      float alpha = mAlphaFunc( progress );
+    // The animators of a batch share the alpha function; the linear one is applied inline
+    const AlphaFunc alphaFunc = animators[0]->GetAlphaFunc();
+    const bool linear = ( alphaFunc == AlphaFunctions::Linear || alphaFunc == AlphaFunctions::Default );
 
-      const PropertyType& current = mPropertyAccessor.Get( bufferIndex );
-
-      const PropertyType result = mAnimatorFunction( alpha, current );
+    unsigned int applied(0u);
+    for( unsigned int i = 0u; i < count; ++i )
+    {
+      Animator& animator = static_cast< Animator& >( *animators[i] );
 
-      if ( bake )
+      // If the object dies, the animator has no effect
+      if( animator.mPropertyOwner && elapsedSeconds >= animator.mInitialDelaySeconds )
       {
-        mPropertyAccessor.Bake( bufferIndex, result );
-      }
-      else
-      {
-        mPropertyAccessor.Set( bufferIndex, result );
+        const float progress = animator.GetProgress( elapsedSeconds );
+
+        animator.Update( bufferIndex, linear ? progress : alphaFunc( progress ), bake );
+        ++applied;
       }
     }
 
-    return IsAttached(); // return false if orphaned
-  }
-
-  /**
-   * From AnimatorBase.
-   */
-  virtual bool IsAttached() const
-  {
-    return NULL != mPropertyOwner;
+    return applied;
   }
 
   /**
@@ -278,13 +361,35 @@ private:
    * Private constructor; see also Animator::New().
    */
   Animator( PropertyBase* property,
-            AnimatorFunction animatorFunction )
-  : mPropertyOwner( NULL ),
+            const AnimatorFunctionType& animatorFunction )
+  : AnimatorBase( &Animator::UpdateBatch, property ),
     mPropertyAccessor( property ),
     mAnimatorFunction( animatorFunction )
   {
   }
 
+  /**
+   * Update the scene object attached to the animator.
+   * @param[in] bufferIndex The buffer to animate.
+   * @param[in] alpha The progress of the animator, after applying the alpha function.
+   * @param[in] bake Bake.
+   */
+  void Update( BufferIndex bufferIndex, float alpha, bool bake )
+  {
+    const PropertyType& current = mPropertyAccessor.Get( bufferIndex );
+
+    const PropertyType result = mAnimatorFunction( alpha, current );
+
+    if ( bake )
+    {
+      mPropertyAccessor.Bake( bufferIndex, result );
+    }
+    else
+    {
+      mPropertyAccessor.Set( bufferIndex, result );
+    }
+  }
+
   // Undefined
   Animator( const Animator& );
 
@@ -293,10 +398,9 @@ private:
 
 protected:
 
-  PropertyOwner* mPropertyOwner;
   PropertyAccessorType mPropertyAccessor;
 
-  AnimatorFunction mAnimatorFunction;
+  AnimatorFunctionType mAnimatorFunction;
 };
 
 } // namespace SceneGraph
@@ -646,7 +750,151 @@ struct KeyFrameQuaternionFunctor
 };
 
 
+namespace SceneGraph
+{
+
+/**
+ * Create an animator which calls a common animator function inline.
+ * @param[in] property The animatable property.
+ * @param[in] animatorFunction The function used to animate the property.
+ * @return The animator, or NULL if the function wrapped by animatorFunction is not an AnimatorFunctionType.
+ */
+template < typename PropertyType, typename PropertyAccessorType, typename AnimatorFunctionType >
+AnimatorBase* NewUnwrappedAnimator( PropertyBase* property,
+                                    const boost::function< PropertyType (float, const PropertyType&) >& animatorFunction )
+{
+  const AnimatorFunctionType* function = animatorFunction.template target< AnimatorFunctionType >();
+  if( function )
+  {
+    return Animator< PropertyType, PropertyAccessorType, AnimatorFunctionType >::NewUnwrapped( property, *function );
+  }
+
+  return NULL;
+}
+
+template <>
+struct AnimatorFunctions< bool >
+{
+  template < typename PropertyAccessorType >
+  static AnimatorBase* New( PropertyBase* property, const boost::function< bool (float, const bool&) >& animatorFunction )
+  {
+    AnimatorBase* animator = NewUnwrappedAnimator< bool, PropertyAccessorType, AnimateToBoolean >( property, animatorFunction );
+    if( !animator )
+    {
+      animator = NewUnwrappedAnimator< bool, PropertyAccessorType, AnimateByBoolean >( property, animatorFunction );
+    }
+    if( !animator )
+    {
+      animator = NewUnwrappedAnimator< bool, PropertyAccessorType, KeyFrameBooleanFunctor >( property, animatorFunction );
+    }
+    return animator;
+  }
+};
+
+template <>
+struct AnimatorFunctions< float >
+{
+  template < typename PropertyAccessorType >
+  static AnimatorBase* New( PropertyBase* property, const boost::function< float (float, const float&) >& animatorFunction )
+  {
+    AnimatorBase* animator = NewUnwrappedAnimator< float, PropertyAccessorType, AnimateToFloat >( property, animatorFunction );
+    if( !animator )
+    {
+      animator = NewUnwrappedAnimator< float, PropertyAccessorType, AnimateByFloat >( property, animatorFunction );
+    }
+    if( !animator )
+    {
+      animator = NewUnwrappedAnimator< float, PropertyAccessorType, KeyFrameNumberFunctor >( property, animatorFunction );
+    }
+    return animator;
+  }
+};
 
+template <>
+struct AnimatorFunctions< Vector2 >
+{
+  template < typename PropertyAccessorType >
+  static AnimatorBase* New( PropertyBase* property, const boost::function< Vector2 (float, const Vector2&) >& animatorFunction )
+  {
+    AnimatorBase* animator = NewUnwrappedAnimator< Vector2, PropertyAccessorType, AnimateToVector2 >( property, animatorFunction );
+    if( !animator )
+    {
+      animator = NewUnwrappedAnimator< Vector2, PropertyAccessorType, AnimateByVector2 >( property, animatorFunction );
+    }
+    if( !animator )
+    {
+      animator = NewUnwrappedAnimator< Vector2, PropertyAccessorType, KeyFrameVector2Functor >( property, animatorFunction );
+    }
+    return animator;
+  }
+};
+
+template <>
+struct AnimatorFunctions< Vector3 >
+{
+  template < typename PropertyAccessorType >
+  static AnimatorBase* New( PropertyBase* property, const boost::function< Vector3 (float, const Vector3&) >& animatorFunction )
+  {
+    AnimatorBase* animator = NewUnwrappedAnimator< Vector3, PropertyAccessorType, AnimateToVector3 >( property, animatorFunction );
+    if( !animator )
+    {
+      animator = NewUnwrappedAnimator< Vector3, PropertyAccessorType, AnimateByVector3 >( property, animatorFunction );
+    }
+    if( !animator )
+    {
+      animator = NewUnwrappedAnimator< Vector3, PropertyAccessorType, KeyFrameVector3Functor >( property, animatorFunction );
+    }
+    return animator;
+  }
+};
+
+template <>
+struct AnimatorFunctions< Vector4 >
+{
+  template < typename PropertyAccessorType >
+  static AnimatorBase* New( PropertyBase* property, const boost::function< Vector4 (float, const Vector4&) >& animatorFunction )
+  {
+    AnimatorBase* animator = NewUnwrappedAnimator< Vector4, PropertyAccessorType, AnimateToVector4 >( property, animatorFunction );
+    if( !animator )
+    {
+      animator = NewUnwrappedAnimator< Vector4, PropertyAccessorType, AnimateByVector4 >( property, animatorFunction );
+    }
+    if( !animator )
+    {
+      animator = NewUnwrappedAnimator< Vector4, PropertyAccessorType, AnimateToOpacity >( property, animatorFunction );
+    }
+    if( !animator )
+    {
+      animator = NewUnwrappedAnimator< Vector4, PropertyAccessorType, AnimateByOpacity >( property, animatorFunction );
+    }
+    if( !animator )
+    {
+      animator = NewUnwrappedAnimator< Vector4, PropertyAccessorType, KeyFrameVector4Functor >( property, animatorFunction );
+    }
+    return animator;
+  }
+};
+
+template <>
+struct AnimatorFunctions< Quaternion >
+{
+  template < typename PropertyAccessorType >
+  static AnimatorBase* New( PropertyBase* property, const boost::function< Quaternion (float, const Quaternion&) >& animatorFunction )
+  {
+    AnimatorBase* animator = NewUnwrappedAnimator< Quaternion, PropertyAccessorType, RotateToQuaternion >( property, animatorFunction );
+    if( !animator )
+    {
+      animator = NewUnwrappedAnimator< Quaternion, PropertyAccessorType, RotateByAngleAxis >( property, animatorFunction );
+    }
+    if( !animator )
+    {
+      animator = NewUnwrappedAnimator< Quaternion, PropertyAccessorType, KeyFrameQuaternionFunctor >( property, animatorFunction );
+    }
+    return animator;
+  }
+};
+
+} // namespace SceneGraph
 
 } // namespace Internal
 
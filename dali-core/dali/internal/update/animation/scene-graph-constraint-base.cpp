@@ -48,6 +48,7 @@ ConstraintBase::~ConstraintBase()
 // TODO - Override new & delete to provide this for everything
 #ifdef DEBUG_ENABLED
   // Fill with garbage pattern to help detect invalid memory access
+  mWeight.CancelReset();
   memset ( &mWeight, 0xFA, sizeof(mWeight) );
 #endif
 }
@@ -0,0 +1,126 @@
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// CLASS HEADER
+#include <dali/internal/update/common/animatable-property.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+namespace
+{
+
+/**
+ * The touched list of the calling thread; it is owned by the UpdateManager which is updating in this thread.
+ * Entries are set to NULL when a property is destroyed; these are removed by ResetTouchedProperties().
+ * A plain __thread pointer is used, since it is read whenever a property is first Set or Baked in a frame.
+ */
+__thread TouchedPropertyContainer* gTouchedProperties = NULL;
+
+} // unnamed namespace
+
+TouchedPropertyContainer* AnimatablePropertyBase::SetTouchedProperties( TouchedPropertyContainer* touchedProperties )
+{
+  TouchedPropertyContainer* previous = gTouchedProperties;
+  gTouchedProperties = touchedProperties;
+
+  return previous;
+}
+
+void AnimatablePropertyBase::ResetTouchedProperties( TouchedPropertyContainer& touchedProperties, BufferIndex updateBufferIndex )
+{
+  DALI_ASSERT_DEBUG( &touchedProperties == gTouchedProperties );
+
+  const unsigned int count = touchedProperties.Count();
+  unsigned int remaining = 0u;
+
+  for( unsigned int index = 0u; index < count; ++index )
+  {
+    AnimatablePropertyBase* property = touchedProperties[ index ];
+
+    if( NULL != property )
+    {
+      // Removed from the list before resetting, otherwise ResetToBaseValue() would do nothing
+      property->mTouchedIndex = INVALID_TOUCHED_INDEX;
+      property->ResetToBaseValue( updateBufferIndex );
+
+      // A property which was Set (not Baked) must also be reset in the next frame
+      if( !property->IsClean() )
+      {
+        property->mTouchedIndex = remaining;
+        touchedProperties[ remaining ] = property;
+        ++remaining;
+      }
+    }
+  }
+
+  if( remaining < count )
+  {
+    touchedProperties.Resize( remaining );
+  }
+}
+
+void AnimatablePropertyBase::MergeTouchedProperties( TouchedPropertyContainer& touchedProperties, TouchedPropertyContainer& jobTouchedProperties )
+{
+  const unsigned int count = jobTouchedProperties.Count();
+  for( unsigned int index = 0u; index < count; ++index )
+  {
+    AnimatablePropertyBase* property = jobTouchedProperties[ index ];
+
+    if( NULL != property )
+    {
+      property->mTouchedIndex = touchedProperties.Count();
+      touchedProperties.PushBack( property );
+    }
+  }
+
+  jobTouchedProperties.Clear();
+}
+
+void AnimatablePropertyBase::AddTouched()
+{
+  DALI_ASSERT_DEBUG( NULL != gTouchedProperties && "Property modified outside of an update" );
+
+  if( NULL != gTouchedProperties )
+  {
+    mTouchedIndex = gTouchedProperties->Count();
+    gTouchedProperties->PushBack( this );
+  }
+}
+
+void AnimatablePropertyBase::RemoveTouched()
+{
+  // The index is checked, since the owner may have overwritten the property with a garbage pattern (see CancelReset)
+  if( NULL != gTouchedProperties &&
+      mTouchedIndex < gTouchedProperties->Count() &&
+      this == (*gTouchedProperties)[ mTouchedIndex ] )
+  {
+    (*gTouchedProperties)[ mTouchedIndex ] = NULL;
+  }
+  mTouchedIndex = INVALID_TOUCHED_INDEX;
+}
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
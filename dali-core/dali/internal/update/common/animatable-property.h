@@ -22,6 +22,7 @@
 
 // INTERNAL INCLUDES
 #include <dali/public-api/common/dali-common.h>
+#include <dali/public-api/common/dali-vector.h>
 #include <dali/public-api/object/property.h>
 #include <dali/public-api/object/property-input.h>
 #include <dali/public-api/object/property-types.h>
@@ -50,6 +51,8 @@ namespace SceneGraph
  *
  * However if the property was only "Set" (and not "Baked"), then typically the base value and previous value will not match.
  * In this case the reset operation is equivalent to a "Bake", and the value is considered "dirty" for an additional frame.
+ *
+ * When the scene-graph is triple-buffered, the flags are shifted up by one; each value must be reset for an additional frame.
  */
 static const unsigned int CLEAN_FLAG = 0x00; ///< Indicates that the value did not change in this, or the previous frame
 static const unsigned int BAKED_FLAG = 0x01; ///< Indicates that the value was Baked during the previous frame
@@ -58,8 +61,17 @@ static const unsigned int SET_FLAG   = 0x02; ///< Indicates that the value was S
 template <class T>
 class AnimatableProperty;
 
+class AnimatablePropertyBase;
+
+typedef Dali::Vector< AnimatablePropertyBase* > TouchedPropertyContainer;
+
 /**
  * Base class to reduce code size from the templates.
+ *
+ * When an animatable property is Set or Baked, it is added to a list of "touched" properties.
+ * Only the touched properties are reset by ResetTouchedProperties(), rather than every property in the scene-graph.
+ * A property remains on the list until it is clean; properties are only modified by the update-thread.
+ * The list is owned by the UpdateManager, which makes it the touched list of its thread with SetTouchedProperties().
  */
 class AnimatablePropertyBase : public PropertyBase
 {
@@ -70,14 +82,45 @@ public:
    */
   AnimatablePropertyBase()
   : PropertyBase(),
-    mDirtyFlags( BAKED_FLAG )
+    mDirtyFlags( BAKED_FLAG ),
+    mTouchedIndex( INVALID_TOUCHED_INDEX )
   {}
 
   /**
    * Virtual destructor.
    */
   virtual ~AnimatablePropertyBase()
-  {}
+  {
+    if( IsTouched() )
+    {
+      RemoveTouched();
+    }
+  }
+
+  /**
+   * Set the list to which the properties Set or Baked by the calling thread are added.
+   * @param[in] touchedProperties The touched list, or NULL when the thread is not updating the scene-graph.
+   * @return The previous touched list of the calling thread.
+   */
+  static TouchedPropertyContainer* SetTouchedProperties( TouchedPropertyContainer* touchedProperties );
+
+  /**
+   * Reset each of the touched properties to its base value.
+   * Properties which are clean afterwards are removed from the touched list.
+   * This should be called by the update-thread, before any owner of the properties is reset with PropertyOwner::ResetToBaseValues().
+   * @pre touchedProperties is the touched list of the calling thread.
+   * @param[in] touchedProperties The touched list.
+   * @param[in] updateBufferIndex The current update buffer index.
+   */
+  static void ResetTouchedProperties( TouchedPropertyContainer& touchedProperties, BufferIndex updateBufferIndex );
+
+  /**
+   * Move the properties from the touched list of a worker job, to another touched list.
+   * This is used when animators are applied in parallel; each job has its own touched list, which is merged after the jobs have finished.
+   * @param[in] touchedProperties The touched list to add the properties to.
+   * @param[in] jobTouchedProperties The touched list of the job; this is cleared.
+   */
+  static void MergeTouchedProperties( TouchedPropertyContainer& touchedProperties, TouchedPropertyContainer& jobTouchedProperties );
 
 protected: // for derived classes
 
@@ -86,7 +129,8 @@ protected: // for derived classes
    */
   void OnSet()
   {
-    mDirtyFlags = SET_FLAG;
+    mDirtyFlags = SET_FLAG << ( NUM_SCENE_GRAPH_BUFFERS - 2u );
+    Touch();
   }
 
   /**
@@ -94,7 +138,18 @@ protected: // for derived classes
    */
   void OnBake()
   {
-    mDirtyFlags = BAKED_FLAG;
+    mDirtyFlags = BAKED_FLAG << ( NUM_SCENE_GRAPH_BUFFERS - 2u );
+    Touch();
+  }
+
+  /**
+   * Query whether the property is on the touched list.
+   * Touched properties are reset by ResetTouchedProperties(); ResetToBaseValue() should not reset them again.
+   * @return True if the property is on the touched list.
+   */
+  bool IsTouched() const
+  {
+    return INVALID_TOUCHED_INDEX != mTouchedIndex;
   }
 
 public: // From PropertyBase
@@ -107,6 +162,26 @@ public: // From PropertyBase
     return ( CLEAN_FLAG == mDirtyFlags );
   }
 
+  /**
+   * @copydoc Dali::Internal::SceneGraph::PropertyBase::RequestReset()
+   */
+  virtual void RequestReset()
+  {
+    Touch();
+  }
+
+  /**
+   * Remove the property from the touched list; it will not be reset by ResetTouchedProperties().
+   * This must be called before the memory of a property is overwritten, during destruction of its owner.
+   */
+  void CancelReset()
+  {
+    if( IsTouched() )
+    {
+      RemoveTouched();
+    }
+  }
+
   /**
    * @copydoc Dali::Internal::PropertyInputImpl::InputInitialized()
    */
@@ -115,10 +190,39 @@ public: // From PropertyBase
     return true; // Animatable properties are always valid
   }
 
+private:
+
+  /**
+   * Add the property to the touched list, if it is not already there.
+   */
+  void Touch()
+  {
+    if( !IsTouched() )
+    {
+      AddTouched();
+    }
+  }
+
+  /**
+   * Add the property to the touched list.
+   */
+  void AddTouched();
+
+  /**
+   * Remove the property from the touched list.
+   * This does nothing to the list, unless it is the touched list of the calling thread.
+   */
+  void RemoveTouched();
+
 protected: // so that ResetToBaseValue can set it directly
 
-  unsigned int mDirtyFlags; ///< Flag whether value changed during previous 2 frames
+  unsigned int mDirtyFlags; ///< Flag whether value changed during the previous 2 (or 3) frames
 
+private:
+
+  static const unsigned int INVALID_TOUCHED_INDEX = 0xFFFFFFFFu;
+
+  unsigned int mTouchedIndex; ///< The index of the property in the touched list, or INVALID_TOUCHED_INDEX
 };
 
 
@@ -160,7 +264,7 @@ public:
    */
   virtual void ResetToBaseValue(BufferIndex updateBufferIndex)
   {
-    if (CLEAN_FLAG != mDirtyFlags)
+    if ( CLEAN_FLAG != mDirtyFlags && !IsTouched() )
     {
       mValue[updateBufferIndex] = mBaseValue;
 
@@ -329,7 +433,7 @@ public:
    */
   virtual void ResetToBaseValue(BufferIndex updateBufferIndex)
   {
-    if (CLEAN_FLAG != mDirtyFlags)
+    if ( CLEAN_FLAG != mDirtyFlags && !IsTouched() )
     {
       mValue[updateBufferIndex] = mBaseValue;
 
@@ -433,26 +537,31 @@ public:
   }
 
   /**
-   * Sets both double-buffered values & the base value.
+   * Sets all of the buffered values & the base value.
    * This should only be used when the owning object has not been connected to the scene-graph.
    * @param[in] value The new property value.
    */
   void SetInitial(const float& value)
   {
-    mValue[0]  = value;
-    mValue[1]  = mValue[0];
-    mBaseValue = mValue[0];
+    for( unsigned int i = 0; i < NUM_SCENE_GRAPH_BUFFERS; ++i )
+    {
+      mValue[i] = value;
+    }
+    mBaseValue = value;
   }
 
   /**
-   * Change both double-buffered values & the base value by a relative amount.
+   * Change all of the buffered values & the base value by a relative amount.
    * This should only be used when the owning object has not been connected to the scene-graph.
    * @param[in] delta The property will change by this amount.
    */
   void SetInitialRelative(const float& delta)
   {
     mValue[0] = mValue[0] + delta;
-    mValue[1] = mValue[0];
+    for( unsigned int i = 1; i < NUM_SCENE_GRAPH_BUFFERS; ++i )
+    {
+      mValue[i] = mValue[0];
+    }
     mBaseValue = mValue[0];
   }
 
@@ -509,7 +618,7 @@ public:
    */
   virtual void ResetToBaseValue(BufferIndex updateBufferIndex)
   {
-    if (CLEAN_FLAG != mDirtyFlags)
+    if ( CLEAN_FLAG != mDirtyFlags && !IsTouched() )
     {
       mValue[updateBufferIndex] = mBaseValue;
 
@@ -665,7 +774,7 @@ public:
    */
   virtual void ResetToBaseValue(BufferIndex updateBufferIndex)
   {
-    if (CLEAN_FLAG != mDirtyFlags)
+    if ( CLEAN_FLAG != mDirtyFlags && !IsTouched() )
     {
       mValue[updateBufferIndex] = mBaseValue;
 
@@ -987,7 +1096,7 @@ public:
    */
   virtual void ResetToBaseValue(BufferIndex updateBufferIndex)
   {
-    if (CLEAN_FLAG != mDirtyFlags)
+    if ( CLEAN_FLAG != mDirtyFlags && !IsTouched() )
     {
       mValue[updateBufferIndex] = mBaseValue;
 
@@ -1295,15 +1404,17 @@ public:
   }
 
   /**
-   * Sets both double-buffered W values & the base W value.
+   * Sets all of the buffered W values & the base W value.
    * This should only be used when the owning object has not been connected to the scene-graph.
    * @param[in] value The new W value.
    */
   void SetWInitial(float value)
   {
-    mValue[0].w  = value;
-    mValue[1].w  = mValue[0].w;
-    mBaseValue.w = mValue[0].w;
+    for( unsigned int i = 0; i < NUM_SCENE_GRAPH_BUFFERS; ++i )
+    {
+      mValue[i].w = value;
+    }
+    mBaseValue.w = value;
   }
 
 private:
@@ -1358,7 +1469,7 @@ public:
    */
   virtual void ResetToBaseValue(BufferIndex updateBufferIndex)
   {
-    if (CLEAN_FLAG != mDirtyFlags)
+    if ( CLEAN_FLAG != mDirtyFlags && !IsTouched() )
     {
       mValue[updateBufferIndex] = mBaseValue;
 
@@ -1514,7 +1625,7 @@ public:
    */
   virtual void ResetToBaseValue(BufferIndex updateBufferIndex)
   {
-    if (CLEAN_FLAG != mDirtyFlags)
+    if ( CLEAN_FLAG != mDirtyFlags && !IsTouched() )
     {
       mValue[updateBufferIndex] = mBaseValue;
 
@@ -1674,7 +1785,7 @@ public:
    */
   virtual void ResetToBaseValue(BufferIndex updateBufferIndex)
   {
-    if (CLEAN_FLAG != mDirtyFlags)
+    if ( CLEAN_FLAG != mDirtyFlags && !IsTouched() )
     {
       mValue[updateBufferIndex] = mBaseValue;
 
@@ -67,15 +67,8 @@ void DiscardQueue::Add( BufferIndex updateBufferIndex, Node* node )
 
   // The GL resources will now be freed in frame N
   // The Update for frame N+1 may occur in parallel with the rendering of frame N
-  // Queue the node for destruction in frame N+2
-  if ( 0u == updateBufferIndex )
-  {
-    mNodeQueue0.PushBack( node );
-  }
-  else
-  {
-    mNodeQueue1.PushBack( node );
-  }
+  // Queue the node for destruction in frame N+2 (or N+3, when triple-buffered)
+  mNodeQueue[ updateBufferIndex ].PushBack( node );
 }
 
 void DiscardQueue::Add( BufferIndex updateBufferIndex, NodeAttachment* attachment )
@@ -84,15 +77,8 @@ void DiscardQueue::Add( BufferIndex updateBufferIndex, NodeAttachment* attachmen
 
   // The GL resources will now be freed in Render frame N
   // The Update for frame N+1 may occur in parallel with the rendering of frame N
-  // Queue the attachment for destruction in Update frame N+2
-  if ( 0u == updateBufferIndex )
-  {
-    mAttachmentQueue0.PushBack( attachment );
-  }
-  else
-  {
-    mAttachmentQueue1.PushBack( attachment );
-  }
+  // Queue the attachment for destruction in Update frame N+2 (or N+3, when triple-buffered)
+  mAttachmentQueue[ updateBufferIndex ].PushBack( attachment );
 }
 
 void DiscardQueue::Add( BufferIndex updateBufferIndex, RefObject& resource )
@@ -107,15 +93,8 @@ void DiscardQueue::Add( BufferIndex updateBufferIndex, RefObject& resource )
 
   // The GL resources will now be freed in frame N
   // The Update for frame N+1 may occur in parallel with the rendering of frame N
-  // Queue the node for destruction in frame N+2
-  if ( 0u == updateBufferIndex )
-  {
-    mResourceQueue0.push_back( DiscardQueue::ResourcePointer(&resource) );
-  }
-  else
-  {
-    mResourceQueue1.push_back( DiscardQueue::ResourcePointer(&resource) );
-  }
+  // Queue the node for destruction in frame N+2 (or N+3, when triple-buffered)
+  mResourceQueue[ updateBufferIndex ].push_back( DiscardQueue::ResourcePointer(&resource) );
 }
 
 void DiscardQueue::Add( BufferIndex updateBufferIndex, Mesh* mesh )
@@ -127,15 +106,8 @@ void DiscardQueue::Add( BufferIndex updateBufferIndex, Mesh* mesh )
 
   // The GL resources will now be freed in frame N
   // The Update for frame N+1 may occur in parallel with the rendering of frame N
-  // Queue the node for destruction in frame N+2
-  if ( 0u == updateBufferIndex )
-  {
-    mMeshQueue0.PushBack( mesh );
-  }
-  else
-  {
-    mMeshQueue1.PushBack( mesh );
-  }
+  // Queue the node for destruction in frame N+2 (or N+3, when triple-buffered)
+  mMeshQueue[ updateBufferIndex ].PushBack( mesh );
 }
 
 void DiscardQueue::Add( BufferIndex updateBufferIndex, Shader* shader )
@@ -147,37 +119,19 @@ void DiscardQueue::Add( BufferIndex updateBufferIndex, Shader* shader )
 
   // The GL resources will now be freed in frame N
   // The Update for frame N+1 may occur in parallel with the rendering of frame N
-  // Queue the node for destruction in frame N+2
-  if ( 0u == updateBufferIndex )
-  {
-    mShaderQueue0.PushBack( shader );
-  }
-  else
-  {
-    mShaderQueue1.PushBack( shader );
-  }
+  // Queue the node for destruction in frame N+2 (or N+3, when triple-buffered)
+  mShaderQueue[ updateBufferIndex ].PushBack( shader );
 }
 
 void DiscardQueue::Clear( BufferIndex updateBufferIndex )
 {
   // Destroy some discarded objects; these should no longer own any GL resources
 
-  if ( 0u == updateBufferIndex )
-  {
-    mNodeQueue0.Clear();
-    mAttachmentQueue0.Clear();
-    mResourceQueue0.clear();
-    mMeshQueue0.Clear();
-    mShaderQueue0.Clear();
-  }
-  else
-  {
-    mNodeQueue1.Clear();
-    mAttachmentQueue1.Clear();
-    mResourceQueue1.clear();
-    mMeshQueue1.Clear();
-    mShaderQueue1.Clear();
-  }
+  mNodeQueue[ updateBufferIndex ].Clear();
+  mAttachmentQueue[ updateBufferIndex ].Clear();
+  mResourceQueue[ updateBufferIndex ].clear();
+  mMeshQueue[ updateBufferIndex ].Clear();
+  mShaderQueue[ updateBufferIndex ].Clear();
 }
 
 } // namespace SceneGraph
@@ -47,6 +47,8 @@ class Shader;
  * When added, messages will be sent to clean-up GL resources in the next Render.
  * The Update for frame N+1 may occur in parallel with the rendering of frame N.
  * Therefore objects queued for destruction in frame N, are destroyed frame N+2.
+ * When the scene-graph is triple-buffered, the Update for frame N+2 may also occur in parallel with
+ * the rendering of frame N; the objects are destroyed in frame N+3.
  */
 class DiscardQueue
 {
@@ -114,7 +116,7 @@ public:
   void Add( BufferIndex bufferIndex, Shader* shader );
 
   /**
-   * Release the nodes which were queued in the frame N-2.
+   * Release the nodes which were queued in the frame N-2 (or N-3, when triple-buffered).
    * @pre This method should be called (once) at the beginning of every Update.
    * @param[in] updateBufferIndex The current update buffer index.
    */
@@ -132,19 +134,12 @@ private:
 
   RenderQueue& mRenderQueue; ///< Used to send GL clean-up messages for the next Render.
 
-  // Messages are queued here when the update buffer index == 0
-  NodeOwnerContainer           mNodeQueue0;
-  NodeAttachmentOwnerContainer mAttachmentQueue0;
-  ResourceQueue                mResourceQueue0;
-  MeshOwnerContainer           mMeshQueue0;
-  ShaderQueue                  mShaderQueue0;
-
-  // Messages are queued here when the update buffer index == 1
-  NodeOwnerContainer           mNodeQueue1;
-  NodeAttachmentOwnerContainer mAttachmentQueue1;
-  ResourceQueue                mResourceQueue1;
-  MeshOwnerContainer           mMeshQueue1;
-  ShaderQueue                  mShaderQueue1;
+  // Messages are queued in the containers of the update buffer index
+  NodeOwnerContainer           mNodeQueue[ NUM_SCENE_GRAPH_BUFFERS ];
+  NodeAttachmentOwnerContainer mAttachmentQueue[ NUM_SCENE_GRAPH_BUFFERS ];
+  ResourceQueue                mResourceQueue[ NUM_SCENE_GRAPH_BUFFERS ];
+  MeshOwnerContainer           mMeshQueue[ NUM_SCENE_GRAPH_BUFFERS ];
+  ShaderQueue                  mShaderQueue[ NUM_SCENE_GRAPH_BUFFERS ];
 };
 
 } // namespace SceneGraph
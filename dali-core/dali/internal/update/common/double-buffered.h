@@ -21,6 +21,7 @@
 #include <dali/public-api/math/matrix.h>
 #include <dali/public-api/math/quaternion.h>
 #include <dali/public-api/math/vector3.h>
+#include <dali/internal/common/buffer-index.h>
 
 namespace Dali
 {
@@ -28,9 +29,6 @@ namespace Dali
 namespace Internal
 {
 
-// The number of buffers per scene-graph property
-static const unsigned int NUM_SCENE_GRAPH_BUFFERS = 2;
-
 // Buffer index used when reading off-stage values
 static const unsigned int ARBITRARY_OFF_STAGE_BUFFER = 0;
 
@@ -40,6 +38,7 @@ namespace SceneGraph
 /**
  * Templated class for a double-buffered value.
  * This simplifies init code, and forces explicit initialization.
+ * Storage is allocated for NUM_SCENE_GRAPH_BUFFERS values; the third only when Dali is built with triple-buffering.
  */
 template <typename T>
 class DoubleBuffered
@@ -49,6 +48,9 @@ public:
   DoubleBuffered(const T& val)
   : mValue1(val),
     mValue2(val)
+#ifdef DALI_TRIPLE_BUFFERING_ENABLED
+    , mValue3(val)
+#endif
   {
   }
 
@@ -78,6 +80,9 @@ private:
 
   T mValue1;
   T mValue2;
+#ifdef DALI_TRIPLE_BUFFERING_ENABLED
+  T mValue3;
+#endif
 };
 
 /**
@@ -92,12 +97,18 @@ public:
   DoubleBuffered3(const T& val)
   : mValue1(val),
     mValue2(val)
+#ifdef DALI_TRIPLE_BUFFERING_ENABLED
+    , mValue3(val)
+#endif
   {
   }
 
   DoubleBuffered3(P val1, P val2, P val3)
   : mValue1(val1, val2, val3),
     mValue2(val1, val2, val3)
+#ifdef DALI_TRIPLE_BUFFERING_ENABLED
+    , mValue3(val1, val2, val3)
+#endif
   {
   }
 
@@ -127,6 +138,9 @@ private:
 
   T mValue1;
   T mValue2;
+#ifdef DALI_TRIPLE_BUFFERING_ENABLED
+  T mValue3;
+#endif
 };
 
 /**
@@ -141,12 +155,18 @@ public:
   DoubleBuffered4(const T& val)
   : mValue1(val),
     mValue2(val)
+#ifdef DALI_TRIPLE_BUFFERING_ENABLED
+    , mValue3(val)
+#endif
   {
   }
 
   DoubleBuffered4(P val1, P val2, P val3, P val4)
   : mValue1(val1, val2, val3, val4),
     mValue2(val1, val2, val3, val4)
+#ifdef DALI_TRIPLE_BUFFERING_ENABLED
+    , mValue3(val1, val2, val3, val4)
+#endif
   {
   }
 
@@ -176,6 +196,9 @@ private:
 
   T mValue1;
   T mValue2;
+#ifdef DALI_TRIPLE_BUFFERING_ENABLED
+  T mValue3;
+#endif
 };
 
 typedef DoubleBuffered<int>   DoubleBufferedInt;
@@ -54,7 +54,7 @@ public:
   InheritedProperty( const Vector3& initialValue )
   : mValue( initialValue ),
     mInheritedFlag( false ),
-    mReinheritedFlag( true )
+    mReinheritedCount( NUM_SCENE_GRAPH_BUFFERS - 1u )
   {
   }
 
@@ -75,15 +75,16 @@ public:
 
   /**
    * Called once per Update (only) if the property did not need to be re-inherited.
+   * The value is copied from the previous buffer, until every buffer holds the re-inherited value.
    * @param[in] updateBufferIndex The current update buffer index.
    */
   void CopyPrevious( BufferIndex updateBufferIndex )
   {
-    if ( mReinheritedFlag )
+    if ( 0u != mReinheritedCount )
     {
-      mValue[updateBufferIndex] = mValue[updateBufferIndex ? 0 : 1];
+      mValue[updateBufferIndex] = mValue[ SceneGraphBuffers::GetPreviousBufferIndex( updateBufferIndex ) ];
 
-      mReinheritedFlag = false;
+      --mReinheritedCount;
     }
   }
 
@@ -92,7 +93,7 @@ public:
    */
   virtual bool IsClean() const
   {
-    return ( false == mReinheritedFlag );
+    return ( 0u == mReinheritedCount );
   }
 
   /**
@@ -128,7 +129,7 @@ public:
   {
     // For inherited properties, constraints work with the value from the previous frame.
     // This is because constraints are applied to position etc, before world-position is calculated.
-    BufferIndex eventBufferIndex = bufferIndex ? 0u : 1u;
+    BufferIndex eventBufferIndex = SceneGraphBuffers::GetPreviousBufferIndex( bufferIndex );
 
     return mValue[ eventBufferIndex ];
   }
@@ -146,7 +147,7 @@ public:
     // The value has been inherited for the first time
     mInheritedFlag = true;
 
-    mReinheritedFlag = true;
+    mReinheritedCount = NUM_SCENE_GRAPH_BUFFERS - 1u;
   }
 
   /**
@@ -187,8 +188,8 @@ private:
 
   DoubleBuffered<Vector3> mValue; ///< The double-buffered property value
 
-  bool mInheritedFlag   :1; ///< Flag whether the value has ever been inherited
-  bool mReinheritedFlag :1; ///< Flag whether value was re-inherited in previous frame
+  bool         mInheritedFlag    :1; ///< Flag whether the value has ever been inherited
+  unsigned int mReinheritedCount :2; ///< The number of frames the re-inherited value must still be copied to the next buffer
 };
 
 /**
@@ -205,7 +206,7 @@ public:
   InheritedColor( const Vector4& initialValue )
   : mValue( initialValue ),
     mInheritedFlag( false ),
-    mReinheritedFlag( true )
+    mReinheritedCount( NUM_SCENE_GRAPH_BUFFERS - 1u )
   {
   }
 
@@ -226,15 +227,16 @@ public:
 
   /**
    * Called once per Update (only) if the property did not need to be re-inherited.
+   * The value is copied from the previous buffer, until every buffer holds the re-inherited value.
    * @param[in] updateBufferIndex The current update buffer index.
    */
   void CopyPrevious( BufferIndex updateBufferIndex )
   {
-    if ( mReinheritedFlag )
+    if ( 0u != mReinheritedCount )
     {
-      mValue[updateBufferIndex] = mValue[updateBufferIndex ? 0 : 1];
+      mValue[updateBufferIndex] = mValue[ SceneGraphBuffers::GetPreviousBufferIndex( updateBufferIndex ) ];
 
-      mReinheritedFlag = false;
+      --mReinheritedCount;
     }
   }
 
@@ -243,7 +245,7 @@ public:
    */
   virtual bool IsClean() const
   {
-    return ( false == mReinheritedFlag );
+    return ( 0u == mReinheritedCount );
   }
 
   /**
@@ -279,7 +281,7 @@ public:
   {
     // For inherited properties, constraints work with the value from the previous frame.
     // This is because constraints are applied to position etc, before world-position is calculated.
-    BufferIndex eventBufferIndex = bufferIndex ? 0u : 1u;
+    BufferIndex eventBufferIndex = SceneGraphBuffers::GetPreviousBufferIndex( bufferIndex );
 
     return mValue[ eventBufferIndex ];
   }
@@ -296,7 +298,7 @@ public:
 
     // The value has been inherited for the first time
     mInheritedFlag = true;
-    mReinheritedFlag = true;
+    mReinheritedCount = NUM_SCENE_GRAPH_BUFFERS - 1u;
   }
 
   /**
@@ -317,7 +319,7 @@ public:
 
     // The value has been inherited for the first time
     mInheritedFlag = true;
-    mReinheritedFlag = true;
+    mReinheritedCount = NUM_SCENE_GRAPH_BUFFERS - 1u;
   }
 
   /**
@@ -357,8 +359,8 @@ private:
 
   DoubleBuffered<Vector4> mValue; ///< The double-buffered property value
 
-  bool mInheritedFlag   :1; ///< Flag whether the value has ever been inherited
-  bool mReinheritedFlag :1; ///< Flag whether value was re-inherited in previous frame
+  bool         mInheritedFlag    :1; ///< Flag whether the value has ever been inherited
+  unsigned int mReinheritedCount :2; ///< The number of frames the re-inherited value must still be copied to the next buffer
 
 };
 
@@ -377,7 +379,7 @@ public:
   InheritedProperty( const Quaternion& initialValue )
   : mValue( initialValue ),
     mInheritedFlag( false ),
-    mReinheritedFlag( true )
+    mReinheritedCount( NUM_SCENE_GRAPH_BUFFERS - 1u )
   {
   }
 
@@ -398,15 +400,16 @@ public:
 
   /**
    * Called once per Update (only) if the property did not need to be re-inherited.
+   * The value is copied from the previous buffer, until every buffer holds the re-inherited value.
    * @param[in] updateBufferIndex The current update buffer index.
    */
   void CopyPrevious( BufferIndex updateBufferIndex )
   {
-    if ( mReinheritedFlag )
+    if ( 0u != mReinheritedCount )
     {
-      mValue[updateBufferIndex] = mValue[updateBufferIndex ? 0 : 1];
+      mValue[updateBufferIndex] = mValue[ SceneGraphBuffers::GetPreviousBufferIndex( updateBufferIndex ) ];
 
-      mReinheritedFlag = false;
+      --mReinheritedCount;
     }
   }
 
@@ -415,7 +418,7 @@ public:
    */
   virtual bool IsClean() const
   {
-    return ( false == mReinheritedFlag );
+    return ( 0u == mReinheritedCount );
   }
 
   /**
@@ -451,7 +454,7 @@ public:
   {
     // For inherited properties, constraints work with the value from the previous frame.
     // This is because constraints are applied to position etc, before world-position is calculated.
-    BufferIndex eventBufferIndex = bufferIndex ? 0u : 1u;
+    BufferIndex eventBufferIndex = SceneGraphBuffers::GetPreviousBufferIndex( bufferIndex );
 
     return mValue[ eventBufferIndex ];
   }
@@ -469,7 +472,7 @@ public:
     // The value has been inherited for the first time
     mInheritedFlag = true;
 
-    mReinheritedFlag = true;
+    mReinheritedCount = NUM_SCENE_GRAPH_BUFFERS - 1u;
   }
 
   /**
@@ -513,8 +516,8 @@ private:
 
   DoubleBuffered<Quaternion> mValue; ///< The double-buffered property value
 
-  bool mInheritedFlag   :1;   ///< Flag whether the value has ever been inherited
-  bool mReinheritedFlag :1;   ///< Flag whether value was re-inherited in previous frame
+  bool         mInheritedFlag    :1; ///< Flag whether the value has ever been inherited
+  unsigned int mReinheritedCount :2; ///< The number of frames the re-inherited value must still be copied to the next buffer
 };
 
 /**
@@ -532,7 +535,7 @@ public:
   InheritedProperty( const Matrix& initialValue )
   : mValue( initialValue ),
     mInheritedFlag( false ),
-    mReinheritedFlag( true )
+    mReinheritedCount( NUM_SCENE_GRAPH_BUFFERS - 1u )
   {
   }
 
@@ -553,15 +556,16 @@ public:
 
   /**
    * Called once per Update (only) if the property did not need to be re-inherited.
+   * The value is copied from the previous buffer, until every buffer holds the re-inherited value.
    * @param[in] updateBufferIndex The current update buffer index.
    */
   void CopyPrevious( BufferIndex updateBufferIndex )
   {
-    if ( mReinheritedFlag )
+    if ( 0u != mReinheritedCount )
     {
-      mValue[updateBufferIndex] = mValue[updateBufferIndex ? 0 : 1];
+      mValue[updateBufferIndex] = mValue[ SceneGraphBuffers::GetPreviousBufferIndex( updateBufferIndex ) ];
 
-      mReinheritedFlag = false;
+      --mReinheritedCount;
     }
   }
 
@@ -570,7 +574,7 @@ public:
    */
   virtual bool IsClean() const
   {
-    return ( false == mReinheritedFlag );
+    return ( 0u == mReinheritedCount );
   }
 
   /**
@@ -606,7 +610,7 @@ public:
   {
     // For inherited properties, constraints work with the value from the previous frame.
     // This is because constraints are applied to position etc, before world-position is calculated.
-    BufferIndex eventBufferIndex = bufferIndex ? 0u : 1u;
+    BufferIndex eventBufferIndex = SceneGraphBuffers::GetPreviousBufferIndex( bufferIndex );
 
     return mValue[ eventBufferIndex ];
   }
@@ -642,7 +646,7 @@ public:
     // The value has been inherited for the first time
     mInheritedFlag = true;
 
-    mReinheritedFlag = true;
+    mReinheritedCount = NUM_SCENE_GRAPH_BUFFERS - 1u;
   }
 
   /**
@@ -673,7 +677,7 @@ public:
 
   void SetDirty(size_t bufferIndex)
   {
-    mReinheritedFlag = true;
+    mReinheritedCount = NUM_SCENE_GRAPH_BUFFERS - 1u;
 
     // The value has been inherited for the first time
     mInheritedFlag = true;
@@ -694,8 +698,8 @@ private:
 
   DoubleBuffered<Matrix> mValue; ///< The double-buffered property value
 
-  bool mInheritedFlag   :1;   ///< Flag whether the value has ever been inherited
-  bool mReinheritedFlag :1;   ///< Flag whether value was re-inherited in previous frame
+  bool         mInheritedFlag    :1; ///< Flag whether the value has ever been inherited
+  unsigned int mReinheritedCount :2; ///< The number of frames the re-inherited value must still be copied to the next buffer
 
 };
 
@@ -0,0 +1,132 @@
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// CLASS HEADER
+#include <dali/internal/update/common/job-system.h>
+
+// EXTERNAL INCLUDES
+#include <boost/bind.hpp>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+JobSystem::JobSystem( unsigned int workerCount )
+: mJobs( NULL ),
+  mNextJob( 0u ),
+  mPendingJobs( 0u ),
+  mTerminate( false )
+{
+  mWorkers.reserve( workerCount );
+  for( unsigned int i = 0u; i < workerCount; ++i )
+  {
+    mWorkers.push_back( new boost::thread( boost::bind( &JobSystem::WorkerLoop, this ) ) );
+  }
+}
+
+JobSystem::~JobSystem()
+{
+  {
+    boost::unique_lock< boost::mutex > lock( mMutex );
+    mTerminate = true;
+  }
+  mJobsAvailable.notify_all();
+
+  for( std::vector< boost::thread* >::iterator iter = mWorkers.begin(); iter != mWorkers.end(); ++iter )
+  {
+    (*iter)->join();
+    delete *iter;
+  }
+}
+
+void JobSystem::Process( const JobContainer& jobs )
+{
+  const unsigned int count = jobs.Count();
+
+  if( mWorkers.empty() || count < 2u )
+  {
+    // Not worth waking the workers
+    for( unsigned int i = 0u; i < count; ++i )
+    {
+      jobs[ i ]->Process();
+    }
+    return;
+  }
+
+  boost::unique_lock< boost::mutex > lock( mMutex );
+
+  DALI_ASSERT_DEBUG( NULL == mJobs && "JobSystem::Process is not reentrant" );
+  mJobs = &jobs;
+  mNextJob = 0u;
+  mPendingJobs = count;
+
+  mJobsAvailable.notify_all();
+
+  // The update-thread helps, rather than waiting idle
+  ProcessJobs( lock );
+
+  while( mPendingJobs > 0u )
+  {
+    mJobsFinished.wait( lock );
+  }
+
+  mJobs = NULL;
+}
+
+void JobSystem::ProcessJobs( boost::unique_lock< boost::mutex >& lock )
+{
+  while( NULL != mJobs && mNextJob < mJobs->Count() )
+  {
+    Job* job = (*mJobs)[ mNextJob ];
+    ++mNextJob;
+
+    lock.unlock();
+    job->Process();
+    lock.lock();
+
+    --mPendingJobs;
+    if( 0u == mPendingJobs )
+    {
+      mJobsFinished.notify_all();
+    }
+  }
+}
+
+void JobSystem::WorkerLoop()
+{
+  boost::unique_lock< boost::mutex > lock( mMutex );
+
+  while( !mTerminate )
+  {
+    ProcessJobs( lock );
+
+    if( !mTerminate )
+    {
+      mJobsAvailable.wait( lock );
+    }
+  }
+}
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,135 @@
+#ifndef __DALI_INTERNAL_SCENE_GRAPH_JOB_SYSTEM_H__
+#define __DALI_INTERNAL_SCENE_GRAPH_JOB_SYSTEM_H__
+
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// EXTERNAL INCLUDES
+#include <boost/thread/condition_variable.hpp>
+#include <boost/thread/mutex.hpp>
+#include <boost/thread/thread.hpp>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-vector.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+/**
+ * JobSystem processes batches of independent jobs on a pool of worker threads, during UpdateManager::Update().
+ * The calling (update) thread also processes jobs, and Process() only returns when the whole batch is complete.
+ * With zero worker threads, the jobs are processed sequentially by the calling thread.
+ */
+class JobSystem
+{
+public:
+
+  /**
+   * A unit of work. Jobs in the same batch must not write to shared data.
+   */
+  class Job
+  {
+  public:
+
+    /**
+     * Virtual destructor.
+     */
+    virtual ~Job()
+    {
+    }
+
+    /**
+     * Called from a worker thread, or the update-thread, to process the job.
+     */
+    virtual void Process() = 0;
+  };
+
+  typedef Dali::Vector< Job* > JobContainer;
+
+  /**
+   * Create a JobSystem.
+   * @param[in] workerCount The number of worker threads to create, in addition to the update-thread.
+   */
+  JobSystem( unsigned int workerCount );
+
+  /**
+   * Non-virtual destructor; JobSystem is not suitable as a base class.
+   * The worker threads are stopped and joined.
+   */
+  ~JobSystem();
+
+  /**
+   * Query the number of worker threads.
+   * @return The number of worker threads.
+   */
+  unsigned int GetWorkerCount() const
+  {
+    return mWorkers.size();
+  }
+
+  /**
+   * Process a batch of jobs, and wait until they are complete.
+   * This should only be called from the update-thread.
+   * @param[in] jobs The jobs to process.
+   */
+  void Process( const JobContainer& jobs );
+
+private:
+
+  /**
+   * Process jobs from the current batch until there are none left.
+   * @param[in] lock A lock which holds mMutex.
+   */
+  void ProcessJobs( boost::unique_lock< boost::mutex >& lock );
+
+  /**
+   * The main loop of each worker thread.
+   */
+  void WorkerLoop();
+
+  // Undefined
+  JobSystem( const JobSystem& );
+
+  // Undefined
+  JobSystem& operator=( const JobSystem& rhs );
+
+private:
+
+  std::vector< boost::thread* > mWorkers;   ///< The worker threads (owned)
+
+  boost::mutex                  mMutex;          ///< Protects the members below
+  boost::condition_variable     mJobsAvailable;  ///< Signalled when a batch of jobs is started, or the workers should terminate
+  boost::condition_variable     mJobsFinished;   ///< Signalled when the last job of a batch is finished
+
+  const JobContainer*           mJobs;           ///< The current batch of jobs, or NULL
+  unsigned int                  mNextJob;        ///< The index of the next job to process
+  unsigned int                  mPendingJobs;    ///< The number of jobs which are not yet finished
+  bool                          mTerminate;      ///< Set when the worker threads should exit
+};
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_SCENE_GRAPH_JOB_SYSTEM_H__
@@ -58,6 +58,14 @@ public:
    */
   virtual void ResetToBaseValue(BufferIndex updateBufferIndex) = 0;
 
+  /**
+   * Request that the property is reset to a base value during the next update, even if it has not been modified.
+   * This is called by the update-thread, when the property is added to a scene-graph object.
+   */
+  virtual void RequestReset()
+  {
+  }
+
   /**
    * @copydoc Dali::Internal::PropertyInputImpl::InputChanged()
    */
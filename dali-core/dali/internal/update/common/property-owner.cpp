@@ -91,6 +91,9 @@ void PropertyOwner::InstallCustomProperty(PropertyBase* property)
   DALI_ASSERT_DEBUG( NULL != property );
 
   mCustomProperties.PushBack( property );
+
+  // The initial value is reset to the base value in the next update
+  property->RequestReset();
 }
 
 void PropertyOwner::ResetToBaseValues( BufferIndex updateBufferIndex )
@@ -122,6 +125,9 @@ void PropertyOwner::ApplyConstraint( ConstraintBase* constraint )
 {
   mConstraints.PushBack( constraint );
 
+  // The initial weight is reset to the base value in the next update
+  constraint->mWeight.RequestReset();
+
   constraint->OnConnect();
 }
 
@@ -143,6 +149,7 @@ void PropertyOwner::RemoveConstraint( ConstraintBase* constraint )
 }
 
 PropertyOwner::PropertyOwner()
+: mNewOwnerIndex( INVALID_NEW_OWNER_INDEX )
 {
 }
 
@@ -53,6 +53,8 @@ class PropertyOwner
 {
 public:
 
+  static const unsigned int INVALID_NEW_OWNER_INDEX = 0xFFFFFFFFu;
+
   class Observer
   {
   public:
@@ -126,6 +128,25 @@ public:
     return mCustomProperties;
   }
 
+  /**
+   * Set the index of the object in the UpdateManager's list of property owners awaiting an initial reset.
+   * This allows the object to be removed from the list in constant time.
+   * @param[in] index The index, or INVALID_NEW_OWNER_INDEX when the object is not in the list.
+   */
+  void SetNewOwnerIndex( unsigned int index )
+  {
+    mNewOwnerIndex = index;
+  }
+
+  /**
+   * Retrieve the index of the object in the UpdateManager's list of property owners awaiting an initial reset.
+   * @return The index, or INVALID_NEW_OWNER_INDEX when the object is not in the list.
+   */
+  unsigned int GetNewOwnerIndex() const
+  {
+    return mNewOwnerIndex;
+  }
+
   /**
    * Reset animatable properties to the corresponding base values.
    * @param[in] currentBufferIndex The buffer to reset.
@@ -188,6 +209,8 @@ private:
 
   ConstraintOwnerContainer mConstraints; ///< Container of owned constraints
 
+  unsigned int mNewOwnerIndex; ///< The index in the list of property owners awaiting an initial reset, or INVALID_NEW_OWNER_INDEX
+
 };
 
 } // namespace SceneGraph
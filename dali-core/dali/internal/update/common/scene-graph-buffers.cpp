@@ -17,6 +17,9 @@
 // CLASS HEADER
 #include <dali/internal/update/common/scene-graph-buffers.h>
 
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-common.h>
+
 namespace Dali
 {
 
@@ -41,7 +44,10 @@ SceneGraphBuffers::~SceneGraphBuffers()
 
 void SceneGraphBuffers::Swap()
 {
-  mUpdateBufferIndex = __sync_fetch_and_xor( &mEventBufferIndex, 1 );
+  const BufferIndex updatedBufferIndex = mUpdateBufferIndex;
+
+  mUpdateBufferIndex = GetNextBufferIndex( updatedBufferIndex );
+  __sync_lock_test_and_set( &mEventBufferIndex, updatedBufferIndex );
 }
 
 } // namespace SceneGraph
@@ -32,6 +32,10 @@ namespace SceneGraph
 /**
  * Node values (position etc.) are double-buffered.  A SceneGraphBuffers object
  * can be used to keep track of which buffers are being written or read.
+ *
+ * When Dali is built with --enable-triple-buffering, the values are triple-buffered; the update-thread
+ * can then write the values of a frame, while the render-thread is still reading the values of the two
+ * previous frames. The buffers are used in turn; update writes the buffer after the one read by the event-thread.
  */
 class SceneGraphBuffers
 {
@@ -40,6 +44,26 @@ public:
   static BufferIndex INITIAL_EVENT_BUFFER_INDEX;  // 0
   static BufferIndex INITIAL_UPDATE_BUFFER_INDEX; // 1
 
+  /**
+   * Retrieve the buffer which was written by the previous update.
+   * @param[in] bufferIndex The buffer written by the current update.
+   * @return The buffer index.
+   */
+  static BufferIndex GetPreviousBufferIndex( BufferIndex bufferIndex )
+  {
+    return bufferIndex ? bufferIndex - 1u : NUM_SCENE_GRAPH_BUFFERS - 1u;
+  }
+
+  /**
+   * Retrieve the buffer which will be written by the next update.
+   * @param[in] bufferIndex The buffer written by the current update.
+   * @return The buffer index.
+   */
+  static BufferIndex GetNextBufferIndex( BufferIndex bufferIndex )
+  {
+    return ( bufferIndex + 1u < NUM_SCENE_GRAPH_BUFFERS ) ? bufferIndex + 1u : 0u;
+  }
+
   /**
    * Create a SceneGraphBuffers object.
    */
@@ -64,6 +88,7 @@ public:
 
   /**
    * Swap the Event & Update buffer indices.
+   * The event-thread reads the buffer which has just been updated, and the next buffer is updated.
   */
   void Swap();
 
@@ -77,8 +102,8 @@ private:
 
 private:
 
-  BufferIndex mEventBufferIndex;  ///< 0 or 1 (opposite of mUpdateBufferIndex)
-  BufferIndex mUpdateBufferIndex; ///< 0 or 1 (opposite of mEventBufferIndex)
+  BufferIndex mEventBufferIndex;  ///< The buffer written by the previous update
+  BufferIndex mUpdateBufferIndex; ///< The buffer written by the current update
 };
 
 } // namespace SceneGraph
@@ -20,6 +20,7 @@
 // EXTERNAL INCLUDES
 
 // INTERNAL INCLUDES
+#include <dali/public-api/math/math-utils.h>
 
 namespace Dali
 {
@@ -35,6 +36,11 @@ namespace
 const unsigned int ARRAY_SIZE( 4u );
 } // unnamed namespace
 
+const PanGesture::PredictionMode PanGesture::DEFAULT_PREDICTION_MODE = PanGesture::PREDICTION_AVERAGE;
+const unsigned int PanGesture::DEFAULT_PREDICTION_AMOUNT( 0u );
+const float PanGesture::DEFAULT_SMOOTHING_AMOUNT( 0.25f );
+const unsigned int PanGesture::MAX_PREDICTION_INTERVAL( 50u );
+
 PanGesture* PanGesture::New()
 {
   return new PanGesture();
@@ -71,6 +77,22 @@ void PanGesture::UpdateProperties( unsigned int nextRenderTime )
       justStarted |= (currentGesture.state == Gesture::Started);
       justFinished |= (currentGesture.state == Gesture::Finished || currentGesture.state == Gesture::Cancelled);
 
+      // smooth the velocity (in pixels per millisecond) measured between consecutive gestures
+      if( currentGesture.state == Gesture::Started )
+      {
+        mLatestGesture.screen.velocity = currentGesture.screen.velocity;
+        mLatestGesture.local.velocity = currentGesture.local.velocity;
+      }
+      else if( currentGesture.time > mLatestGesture.time )
+      {
+        const float timeDelta( currentGesture.time - mLatestGesture.time );
+        const float weight( 1.0f - mSmoothingAmount );
+
+        mLatestGesture.screen.velocity = mLatestGesture.screen.velocity * mSmoothingAmount + currentGesture.screen.displacement * ( weight / timeDelta );
+        mLatestGesture.local.velocity = mLatestGesture.local.velocity * mSmoothingAmount + currentGesture.local.displacement * ( weight / timeDelta );
+      }
+      mLatestGesture.time = currentGesture.time;
+
       // use position values direct from gesture.
       mLatestGesture.screen.position = currentGesture.screen.position;
       mLatestGesture.local.position = currentGesture.local.position;
@@ -100,19 +122,38 @@ void PanGesture::UpdateProperties( unsigned int nextRenderTime )
   {
     PanInfo gesture(mLatestGesture);
 
-    if( !justStarted ) // only use previous frame if this is the continuing.
+    if( mPredictionMode == PREDICTION_AVERAGE )
+    {
+      if( !justStarted ) // only use previous frame if this is the continuing.
+      {
+        // If previous gesture exists, then produce position as 50/50 interpolated blend of these two points.
+        gesture.screen.position += mPreviousGesture.screen.position;
+        gesture.local.position += mPreviousGesture.local.position;
+        gesture.screen.position *= 0.5f;
+        gesture.local.position *= 0.5f;
+      }
+    }
+    else if( mPredictionMode == PREDICTION_LINEAR )
+    {
+      if( !justFinished ) // the gesture ends where the touch was lifted.
+      {
+        PredictGesture( gesture, nextRenderTime );
+      }
+    }
+
+    const Vector2 screenDisplacement( gesture.screen.displacement );
+    const Vector2 localDisplacement( gesture.local.displacement );
+
+    if( !justStarted )
     {
-      // If previous gesture exists, then produce position as 50/50 interpolated blend of these two points.
-      gesture.screen.position += mPreviousGesture.screen.position;
-      gesture.local.position += mPreviousGesture.local.position;
-      gesture.screen.position *= 0.5f;
-      gesture.local.position *= 0.5f;
       // make current displacement relative to previous update-frame now.
-      gesture.screen.displacement -= mPreviousGesture.screen.displacement;
-      gesture.local.displacement -= mPreviousGesture.local.displacement;
+      gesture.screen.displacement -= mPreviousScreenDisplacement;
+      gesture.local.displacement -= mPreviousLocalDisplacement;
     }
 
     mPreviousGesture = mLatestGesture;
+    mPreviousScreenDisplacement = screenDisplacement;
+    mPreviousLocalDisplacement = localDisplacement;
 
     mScreenPosition.Set( gesture.screen.position );
     mScreenDisplacement.Set( gesture.screen.displacement );
@@ -123,6 +164,21 @@ void PanGesture::UpdateProperties( unsigned int nextRenderTime )
   mInGesture &= ~justFinished;
 }
 
+void PanGesture::SetPredictionMode( PredictionMode mode )
+{
+  mPredictionMode = mode;
+}
+
+void PanGesture::SetPredictionAmount( unsigned int amount )
+{
+  mPredictionAmount = amount;
+}
+
+void PanGesture::SetSmoothingAmount( float amount )
+{
+  mSmoothingAmount = Clamp( amount, 0.0f, 1.0f );
+}
+
 const GesturePropertyVector2& PanGesture::GetScreenPositionProperty() const
 {
   return mScreenPosition;
@@ -151,11 +207,29 @@ void PanGesture::ResetDefaultProperties( BufferIndex updateBufferIndex )
   mLocalDisplacement.Reset();
 }
 
+void PanGesture::PredictGesture( PanInfo& gesture, unsigned int nextRenderTime ) const
+{
+  // The difference is taken as signed, so the times may wrap around
+  const int interval( static_cast<int>( nextRenderTime + mPredictionAmount - gesture.time ) );
+  const float predictionInterval( Clamp( interval, 0, static_cast<int>( MAX_PREDICTION_INTERVAL ) ) );
+
+  const Vector2 screenOffset( gesture.screen.velocity * predictionInterval );
+  const Vector2 localOffset( gesture.local.velocity * predictionInterval );
+
+  gesture.screen.position += screenOffset;
+  gesture.screen.displacement += screenOffset;
+  gesture.local.position += localOffset;
+  gesture.local.displacement += localOffset;
+}
+
 PanGesture::PanGesture()
 : mGestures(),
   mWritePosition( 0 ),
   mReadPosition( 0 ),
-  mInGesture( false )
+  mInGesture( false ),
+  mPredictionMode( DEFAULT_PREDICTION_MODE ),
+  mPredictionAmount( DEFAULT_PREDICTION_AMOUNT ),
+  mSmoothingAmount( DEFAULT_SMOOTHING_AMOUNT )
 {
 }
 
@@ -41,6 +41,22 @@ class PanGesture : public PropertyOwner
 {
 public:
 
+  /**
+   * How the gesture properties are worked out from the gestures received since the last update.
+   */
+  enum PredictionMode
+  {
+    PREDICTION_NONE = 0,   ///< The latest gesture is used as it is
+    PREDICTION_AVERAGE,    ///< The latest gesture is blended with the one used in the previous update (the default)
+    PREDICTION_LINEAR,     ///< The latest gesture is extrapolated to the next render time, using its smoothed velocity
+    PREDICTION_MODE_LAST = PREDICTION_LINEAR
+  };
+
+  static const PredictionMode DEFAULT_PREDICTION_MODE;   ///< PREDICTION_AVERAGE
+  static const unsigned int DEFAULT_PREDICTION_AMOUNT;   ///< No time is added to the next render time
+  static const float DEFAULT_SMOOTHING_AMOUNT;           ///< The weight of the previous velocity when smoothing
+  static const unsigned int MAX_PREDICTION_INTERVAL;     ///< The furthest a gesture is extrapolated, in milliseconds
+
   /**
    * Create a new PanGesture
    */
@@ -63,6 +79,26 @@ public:
    */
   virtual void UpdateProperties( unsigned int nextRenderTime );
 
+  /**
+   * Sets how the gesture properties are worked out.
+   * @param[in] mode The prediction mode
+   */
+  void SetPredictionMode( PredictionMode mode );
+
+  /**
+   * Sets the time added to the next render time when extrapolating the gesture with PREDICTION_LINEAR,
+   * to compensate for latency after the render, e.g. in the compositor.
+   * @param[in] amount The time added, in milliseconds
+   */
+  void SetPredictionAmount( unsigned int amount );
+
+  /**
+   * Sets how much the velocity used by PREDICTION_LINEAR is smoothed.
+   * Each new gesture updates the velocity to ( amount * previous velocity + ( 1 - amount ) * gesture velocity ).
+   * @param[in] amount The smoothing amount, between 0 (no smoothing) and 1
+   */
+  void SetSmoothingAmount( float amount );
+
   /**
    * Retrieves a reference to the screen position property.
    * @return The screen position property.
@@ -103,6 +139,16 @@ private:
   // PropertyOwner
   virtual void ResetDefaultProperties( BufferIndex updateBufferIndex );
 
+  struct PanInfo;
+
+  /**
+   * Extrapolates the positions and displacements of a gesture, along its velocity, to the next render time.
+   * The gesture is extrapolated by MAX_PREDICTION_INTERVAL at most.
+   * @param[in,out] gesture        The gesture to extrapolate
+   * @param[in]     nextRenderTime The estimated time of the next render (in milliseconds)
+   */
+  void PredictGesture( PanInfo& gesture, unsigned int nextRenderTime ) const;
+
 private:
 
   // Properties
@@ -223,7 +269,13 @@ private:
 
   PanInfo mLatestGesture;       ///< The latest gesture. (this update frame)
   PanInfo mPreviousGesture;     ///< The previous gesture. (one update frame ago)
+  Vector2 mPreviousScreenDisplacement; ///< The total screen displacement the properties were set with in the previous update frame
+  Vector2 mPreviousLocalDisplacement;  ///< The total local displacement the properties were set with in the previous update frame
   bool mInGesture;              ///< True if the gesture is currently being handled i.e. between Started <-> Finished/Cancelled
+
+  PredictionMode mPredictionMode;  ///< How the gesture properties are worked out
+  unsigned int mPredictionAmount;  ///< The time added to the next render time by PREDICTION_LINEAR, in milliseconds
+  float mSmoothingAmount;          ///< The weight of the previous velocity when smoothing
 };
 
 } // namespace SceneGraph
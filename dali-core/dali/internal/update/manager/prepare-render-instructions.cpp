@@ -502,6 +502,12 @@ void PrepareRenderInstruction( BufferIndex updateBufferIndex,
 
   instruction.mRenderTracker = renderTracker;
 
+  // Work out which part of the screen has changed, so the rest of the previous frame can be kept
+  if( 0 == instruction.mOffscreenTextureId )
+  {
+    renderTask.GetDamageTracker().CalculateDamage( updateBufferIndex, sortedLayers, instruction );
+  }
+
   // inform the render instruction that all renderers have been added and this frame is complete
   instruction.UpdateCompleted();
 }
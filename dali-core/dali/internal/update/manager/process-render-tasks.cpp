@@ -27,6 +27,7 @@
 #include <dali/internal/update/render-tasks/scene-graph-render-task-list.h>
 #include <dali/internal/update/node-attachments/scene-graph-renderable-attachment.h>
 #include <dali/internal/update/nodes/scene-graph-layer.h>
+#include <dali/internal/render/common/performance-monitor.h>
 #include <dali/internal/render/common/render-item.h>
 #include <dali/internal/render/common/render-tracker.h>
 #include <dali/internal/render/common/render-instruction.h>
@@ -93,9 +94,29 @@ static Layer* FindLayer( Node& node )
   return FindLayer( *parent );
 }
 
+/**
+ * Check whether the renderable of a node is at least partially inside the view-frustum of a render-task.
+ * @param[in] updateBufferIndex The current update buffer index.
+ * @param[in] node The node, whose bounding sphere was calculated during UpdateNodesAndAttachments().
+ * @param[in] renderTask The render-task providing the camera.
+ * @return False if the renderable is entirely outside the view-frustum.
+ */
+inline bool IsInsideViewFrustum( BufferIndex updateBufferIndex, const Node& node, const RenderTask& renderTask )
+{
+  const Vector4& boundingSphere = node.GetWorldBoundingSphere();
+  if( boundingSphere.w < 0.0f )
+  {
+    // The renderable is not bounded by the node size
+    return true;
+  }
+
+  return renderTask.IsSphereInsideFrustum( updateBufferIndex, Vector3( boundingSphere ), boundingSphere.w );
+}
+
 /**
  * Rebuild the Layer::opaqueRenderables, transparentRenderables and overlayRenderables members,
  * including only renderable-attachments which are included in the current render-task.
+ * Renderables outside the view-frustum of the render-task's camera are culled.
  * Returns true if all renderable attachments have finshed acquiring resources.
  */
 static bool AddRenderablesForTask( BufferIndex updateBufferIndex,
@@ -157,8 +178,13 @@ static bool AddRenderablesForTask( BufferIndex updateBufferIndex,
         {
           if( DrawMode::STENCIL == inheritedDrawMode )
           {
+            // Stencils are not culled, otherwise the renderables they clip would be drawn unclipped
             layer->stencilRenderables.push_back( renderable );
           }
+          else if( !IsInsideViewFrustum( updateBufferIndex, node, renderTask ) )
+          {
+            INCREASE_COUNTER( PerformanceMonitor::NODES_CULLED );
+          }
           else if( DrawMode::OVERLAY == inheritedDrawMode )
           {
             layer->overlayRenderables.push_back( renderable );
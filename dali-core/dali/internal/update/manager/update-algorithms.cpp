@@ -19,6 +19,7 @@
 
 // EXTERNAL INCLUDES
 #include <algorithm>
+#include <vector>
 
 // INTERNAL INCLUDES
 #include <dali/public-api/actors/draw-mode.h>
@@ -29,6 +30,7 @@
 #include <dali/internal/update/node-attachments/node-attachment.h>
 #include <dali/internal/update/node-attachments/scene-graph-renderable-attachment.h>
 #include <dali/internal/update/animation/scene-graph-constraint-base.h>
+#include <dali/internal/update/common/job-system.h>
 #include <dali/internal/update/nodes/scene-graph-layer.h>
 #include <dali/internal/render/shaders/shader.h>
 #include <dali/internal/render/renderers/scene-graph-renderer.h>
@@ -49,6 +51,15 @@ namespace SceneGraph
 Debug::Filter* gUpdateFilter = Debug::Filter::New(Debug::Concise, false, "LOG_UPDATE_ALGORITHMS");
 #endif
 
+namespace
+{
+
+const unsigned int MAX_EXPANDED_LEVELS = 4u;     ///< How deep the update-thread goes, looking for subtrees to inherit values in parallel
+const unsigned int SUBTREES_PER_THREAD = 8u;     ///< The number of subtrees looked for, per thread
+const unsigned int JOBS_PER_THREAD = 2u;         ///< The subtrees are divided into this many jobs per thread
+
+} // unnamed namespace
+
 /******************************************************************************
  *********************** Apply Constraints ************************************
  ******************************************************************************/
@@ -307,6 +318,28 @@ inline void UpdateNodeWorldMatrix( Node& node, RenderableAttachment& updatedRend
   }
 }
 
+/**
+ * Calculate the world-space bounding sphere of a node, for view-frustum culling.
+ * This must be called after the world matrix has been updated.
+ */
+inline void UpdateNodeBoundingSphere( Node& node, const RenderableAttachment& renderable, Shader* defaultShader, BufferIndex updateBufferIndex )
+{
+  // Custom shader effects may displace vertices beyond the node size, so only renderables
+  // drawn with the default shader are considered to be bounded by it
+  if( renderable.IsCullable() &&
+      node.GetInheritedShader() == defaultShader )
+  {
+    const Vector3 worldSize( node.GetSize( updateBufferIndex ) * node.GetWorldScale( updateBufferIndex ) );
+
+    node.SetWorldBoundingSphere( node.GetWorldMatrix( updateBufferIndex ).GetTranslation3(), worldSize.Length() * 0.5f );
+  }
+  else
+  {
+    // Never cull
+    node.SetWorldBoundingSphere( Vector3::ZERO, -1.0f );
+  }
+}
+
 /**
  * Update an attachment.
  * @return An updated renderable attachment if one was ready.
@@ -355,6 +388,187 @@ inline void AddRenderableToLayer( Layer& layer,
   layer.opaqueRenderables.push_back( &renderable );
 }
 
+/**
+ * Retrieve the dirty flags of a visible node, for the current update.
+ * The ShaderFlag is also stored in the node, when its shader has not been inherited yet.
+ * @param[in] node The node.
+ * @param[in] parentFlags The dirty flags of the parent.
+ * @param[in] updateBufferIndex The current update buffer index.
+ * @return The dirty flags.
+ */
+inline int GetNodeDirtyFlags( Node& node, int parentFlags, BufferIndex updateBufferIndex )
+{
+  // If the node was not previously visible
+  BufferIndex previousBuffer = SceneGraphBuffers::GetPreviousBufferIndex( updateBufferIndex );
+  if ( !node.IsVisible( previousBuffer ) )
+  {
+    // The node was skipped in the previous update; it must recalculate everything
+    node.SetAllDirtyFlags();
+  }
+
+  if ( node.GetInheritedShader() == NULL )
+  {
+    // Stored, since the shader may be inherited before the attachment is updated
+    node.SetDirtyFlag( ShaderFlag );
+  }
+
+  // Some dirty flags are inherited from parent
+  return node.GetDirtyFlags() | ( parentFlags & InheritedDirtyFlags );
+}
+
+/**
+ * Inherit the shader, color and transform values of a node from its parent.
+ * This only writes to the node itself, so it may be done for independent subtrees in parallel.
+ */
+inline void InheritNodeValues( Node& node, int nodeDirtyFlags, BufferIndex updateBufferIndex, Shader* defaultShader )
+{
+  UpdateNodeShader( node, nodeDirtyFlags, defaultShader );
+
+  UpdateNodeOpacity( node, nodeDirtyFlags, updateBufferIndex );
+
+  UpdateNodeTransformValues( node, nodeDirtyFlags, updateBufferIndex );
+}
+
+/**
+ * Recursively inherit the values of the visible nodes in a subtree.
+ * The dirty flags are not cleared; UpdateNodesAndAttachments() gets the same flags afterwards.
+ */
+void InheritSubtreeValues( Node& node, int parentFlags, BufferIndex updateBufferIndex, Shader* defaultShader )
+{
+  if ( !node.IsVisible( updateBufferIndex ) )
+  {
+    return;
+  }
+
+  const int nodeDirtyFlags = GetNodeDirtyFlags( node, parentFlags, updateBufferIndex );
+
+  InheritNodeValues( node, nodeDirtyFlags, updateBufferIndex, defaultShader );
+
+  NodeContainer& children = node.GetChildren();
+  const NodeIter endIter = children.End();
+  for ( NodeIter iter = children.Begin(); iter != endIter; ++iter )
+  {
+    InheritSubtreeValues( **iter, nodeDirtyFlags, updateBufferIndex, defaultShader );
+  }
+}
+
+/**
+ * A subtree whose values are inherited by a job, and the dirty flags of its parent.
+ */
+struct Subtree
+{
+  Subtree( Node* node, int parentFlags )
+  : node( node ),
+    parentFlags( parentFlags )
+  {
+  }
+
+  Node* node;
+  int parentFlags;
+};
+
+typedef std::vector< Subtree > SubtreeContainer;
+
+/**
+ * Inherits the values of a range of independent subtrees.
+ */
+class InheritValuesJob : public JobSystem::Job
+{
+public:
+
+  InheritValuesJob( const Subtree* begin, const Subtree* end, BufferIndex updateBufferIndex, Shader* defaultShader )
+  : mBegin( begin ),
+    mEnd( end ),
+    mUpdateBufferIndex( updateBufferIndex ),
+    mDefaultShader( defaultShader )
+  {
+  }
+
+  virtual void Process()
+  {
+    for( const Subtree* subtree = mBegin; subtree != mEnd; ++subtree )
+    {
+      InheritSubtreeValues( *subtree->node, subtree->parentFlags, mUpdateBufferIndex, mDefaultShader );
+    }
+  }
+
+private:
+
+  const Subtree* mBegin;
+  const Subtree* mEnd;
+  BufferIndex mUpdateBufferIndex;
+  Shader* mDefaultShader;
+};
+
+/**
+ * Inherit the values of the nodes below the root, with the worker threads of the job system.
+ * The update-thread inherits the values of the upper levels, until there are enough subtrees
+ * for the threads; a node only reads the values of its parent, so the subtrees are independent.
+ */
+void InheritValuesInParallel( Layer& rootNode, int rootFlags, BufferIndex updateBufferIndex, Shader* defaultShader, JobSystem& jobSystem )
+{
+  const unsigned int threadCount = jobSystem.GetWorkerCount() + 1u;
+
+  SubtreeContainer subtrees;
+  SubtreeContainer nextLevel;
+
+  NodeContainer& rootChildren = rootNode.GetChildren();
+  for ( NodeIter iter = rootChildren.Begin(); iter != rootChildren.End(); ++iter )
+  {
+    subtrees.push_back( Subtree( *iter, rootFlags ) );
+  }
+
+  for( unsigned int level = 0u; level < MAX_EXPANDED_LEVELS && !subtrees.empty() && subtrees.size() < threadCount * SUBTREES_PER_THREAD; ++level )
+  {
+    nextLevel.clear();
+
+    for( SubtreeContainer::iterator iter = subtrees.begin(); iter != subtrees.end(); ++iter )
+    {
+      Node& node = *iter->node;
+      if ( node.IsVisible( updateBufferIndex ) )
+      {
+        const int nodeDirtyFlags = GetNodeDirtyFlags( node, iter->parentFlags, updateBufferIndex );
+
+        InheritNodeValues( node, nodeDirtyFlags, updateBufferIndex, defaultShader );
+
+        NodeContainer& children = node.GetChildren();
+        for ( NodeIter childIter = children.Begin(); childIter != children.End(); ++childIter )
+        {
+          nextLevel.push_back( Subtree( *childIter, nodeDirtyFlags ) );
+        }
+      }
+    }
+
+    subtrees.swap( nextLevel );
+  }
+
+  const unsigned int subtreeCount = subtrees.size();
+  if( 0u == subtreeCount )
+  {
+    return;
+  }
+
+  const unsigned int jobCount = std::min( subtreeCount, threadCount * JOBS_PER_THREAD );
+
+  std::vector< InheritValuesJob > jobs;
+  jobs.reserve( jobCount );
+
+  JobSystem::JobContainer jobPointers;
+  jobPointers.Reserve( jobCount );
+
+  const Subtree* first = &subtrees[0];
+  for( unsigned int i = 0u; i < jobCount; ++i )
+  {
+    jobs.push_back( InheritValuesJob( first + ( subtreeCount * i ) / jobCount,
+                                      first + ( subtreeCount * ( i + 1u ) ) / jobCount,
+                                      updateBufferIndex,
+                                      defaultShader ) );
+    jobPointers.PushBack( &jobs.back() );
+  }
+
+  jobSystem.Process( jobPointers );
+}
+
 /**
  * This is called recursively for all children of the root Node
  */
@@ -365,7 +579,8 @@ inline int UpdateNodesAndAttachments( Node& node,
                                       RenderQueue& renderQueue,
                                       Layer& currentLayer,
                                       Shader* defaultShader,
-                                      int inheritedDrawMode )
+                                      int inheritedDrawMode,
+                                      bool valuesInherited )
 {
   Layer* layer = &currentLayer;
 
@@ -375,21 +590,10 @@ inline int UpdateNodesAndAttachments( Node& node,
     return 0;
   }
 
-  // If the node was not previously visible
-  BufferIndex previousBuffer = updateBufferIndex ? 0u : 1u;
-  if ( !node.IsVisible( previousBuffer ) )
-  {
-    // The node was skipped in the previous update; it must recalculate everything
-    node.SetAllDirtyFlags();
-  }
+  const int nodeDirtyFlags = GetNodeDirtyFlags( node, parentFlags, updateBufferIndex );
 
-  // Some dirty flags are inherited from parent
-  int nodeDirtyFlags( node.GetDirtyFlags() | ( parentFlags & InheritedDirtyFlags ) );
-
-  if ( node.GetInheritedShader() == NULL )
-  {
-    nodeDirtyFlags |= ShaderFlag;
-  }
+  // Connected nodes are not reset every frame, so the flags are cleared here
+  node.ClearDirtyFlags();
 
   int cumulativeDirtyFlags = nodeDirtyFlags;
 
@@ -406,14 +610,13 @@ inline int UpdateNodesAndAttachments( Node& node,
   }
   DALI_ASSERT_DEBUG( NULL != layer );
 
-  UpdateNodeShader( node, nodeDirtyFlags, defaultShader );
-
-  UpdateNodeOpacity( node, nodeDirtyFlags, updateBufferIndex );
+  if( !valuesInherited )
+  {
+    InheritNodeValues( node, nodeDirtyFlags, updateBufferIndex, defaultShader );
+  }
 
   UpdateNodeGeometry( node, nodeDirtyFlags, updateBufferIndex );
 
-  UpdateNodeTransformValues( node, nodeDirtyFlags, updateBufferIndex );
-
   // Setting STENCIL will override OVERLAY, if that would otherwise have been inherited.
   inheritedDrawMode |= node.GetDrawMode();
 
@@ -431,9 +634,15 @@ inline int UpdateNodesAndAttachments( Node& node,
 
     if( NULL != renderable )
     {
+      // Any change to the node, or to the scale-for-size, may change how the renderable looks on screen
+      renderable->SetDamaged( ( NothingFlag != nodeDirtyFlags ) ||
+                             ( renderable->UsesGeometryScaling() && renderable->IsScaleForSizeDirty() ) );
+
       // Update the world matrix after renderable update; the ScaleForSize property should now be calculated
       UpdateNodeWorldMatrix( node, *renderable, nodeDirtyFlags, updateBufferIndex );
 
+      UpdateNodeBoundingSphere( node, *renderable, defaultShader, updateBufferIndex );
+
       // The attachment is ready to render, so it is added to a set of renderables.
       AddRenderableToLayer( *layer, *renderable, updateBufferIndex, inheritedDrawMode );
     }
@@ -465,7 +674,8 @@ inline int UpdateNodesAndAttachments( Node& node,
                                                       renderQueue,
                                                       *layer,
                                                       defaultShader,
-                                                      inheritedDrawMode );
+                                                      inheritedDrawMode,
+                                                      valuesInherited );
   }
 
   return cumulativeDirtyFlags;
@@ -478,7 +688,8 @@ int UpdateNodesAndAttachments( Layer& rootNode,
                                BufferIndex updateBufferIndex,
                                ResourceManager& resourceManager,
                                RenderQueue& renderQueue,
-                               Shader* defaultShader )
+                               Shader* defaultShader,
+                               JobSystem& jobSystem )
 {
   DALI_ASSERT_DEBUG( rootNode.IsRoot() );
 
@@ -489,7 +700,7 @@ int UpdateNodesAndAttachments( Layer& rootNode,
   }
 
   // If the root node was not previously visible
-  BufferIndex previousBuffer = updateBufferIndex ? 0u : 1u;
+  BufferIndex previousBuffer = SceneGraphBuffers::GetPreviousBufferIndex( updateBufferIndex );
   if ( !rootNode.IsVisible( previousBuffer ) )
   {
     // The node was skipped in the previous update; it must recalculate everything
@@ -497,6 +708,7 @@ int UpdateNodesAndAttachments( Layer& rootNode,
   }
 
   int nodeDirtyFlags( rootNode.GetDirtyFlags() );
+  rootNode.ClearDirtyFlags();
 
   if ( rootNode.GetInheritedShader() == NULL )
   {
@@ -511,6 +723,13 @@ int UpdateNodesAndAttachments( Layer& rootNode,
 
   UpdateRootNodeTransformValues( rootNode, nodeDirtyFlags, updateBufferIndex );
 
+  // The attachments, layers & render queue are not thread-safe, so only the inherited values are updated in parallel
+  const bool valuesInherited( jobSystem.GetWorkerCount() > 0u );
+  if( valuesInherited )
+  {
+    InheritValuesInParallel( rootNode, nodeDirtyFlags, updateBufferIndex, defaultShader, jobSystem );
+  }
+
   DrawMode::Type drawMode( rootNode.GetDrawMode() );
 
   // recurse children
@@ -526,7 +745,8 @@ int UpdateNodesAndAttachments( Layer& rootNode,
                                                        renderQueue,
                                                        rootNode,
                                                        defaultShader,
-                                                       drawMode );
+                                                       drawMode,
+                                                       valuesInherited );
   }
 
   return cumulativeDirtyFlags;
@@ -31,6 +31,7 @@ class ResourceManager;
 namespace SceneGraph
 {
 
+class JobSystem;
 class Layer;
 class Node;
 class PropertyOwner;
@@ -57,19 +58,24 @@ unsigned int ConstrainPropertyOwner( PropertyOwner& propertyOwner, BufferIndex u
  * Update a tree of nodes, and attached objects.
  * The inherited properties of each node are recalculated if necessary.
  * When a renderable attachment is ready to render, PrepareResources() is called and
- * it is added to the list for its Layer.
+ * it is added to the list for its Layer. The world-space bounding sphere of the node is
+ * also calculated, for view-frustum culling in ProcessRenderTasks().
+ * When the job system has worker threads, the inherited values of independent subtrees are
+ * recalculated in parallel first; the attachments are then updated by the calling thread.
  * @param[in] rootNode The root of a tree of nodes.
  * @param[in] updateBufferIndex The current update buffer index.
  * @param[in] resourceManager The resource manager.
  * @param[in] renderQueue Used to query messages for the next Render.
  * @param[in] defaultShader The default shader.
+ * @param[in] jobSystem Used to recalculate the inherited values in parallel.
  * @return The cumulative (ORed) dirty flags for the updated nodes
  */
 int UpdateNodesAndAttachments( Layer& rootNode,
                                BufferIndex updateBufferIndex,
                                ResourceManager& resourceManager,
                                RenderQueue& renderQueue,
-                               Shader* defaultShader );
+                               Shader* defaultShader,
+                               JobSystem& jobSystem );
 
 } // namespace SceneGraph
 
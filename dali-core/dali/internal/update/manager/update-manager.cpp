@@ -17,9 +17,6 @@
 // CLASS HEADER
 #include <dali/internal/update/manager/update-manager.h>
 
-// EXTERNAL INCLUDES
-#include <set>
-
 // INTERNAL INCLUDES
 #include <dali/public-api/common/stage.h>
 
@@ -41,8 +38,10 @@
 
 #include <dali/internal/update/animation/scene-graph-animator.h>
 #include <dali/internal/update/animation/scene-graph-animation.h>
+#include <dali/internal/update/common/animatable-property.h>
 #include <dali/internal/update/common/discard-queue.h>
 #include <dali/internal/update/common/double-buffered.h>
+#include <dali/internal/update/common/job-system.h>
 #include <dali/internal/update/manager/prepare-render-algorithms.h>
 #include <dali/internal/update/manager/process-render-tasks.h>
 #include <dali/internal/update/resources/resource-manager.h>
@@ -61,6 +60,7 @@
 #include <dali/internal/update/node-attachments/scene-graph-camera-attachment.h>
 #include <dali/internal/update/nodes/node.h>
 #include <dali/internal/update/nodes/scene-graph-layer.h>
+#include <dali/internal/update/nodes/node-index-list.h>
 #include <dali/internal/update/dynamics/scene-graph-dynamics-world.h>
 #include <dali/internal/update/touch/touch-resampler.h>
 
@@ -113,18 +113,246 @@ namespace
 
 const int DEFAULT_CAMERA_INDEX = -1;
 
-void DestroyNodeSet( std::set<Node*>& nodeSet )
+const unsigned int MIN_ANIMATORS_FOR_JOBS = 256u; ///< With fewer animators, the update-thread applies them alone
+const unsigned int ANIMATE_JOBS_PER_THREAD = 2u;  ///< More jobs than threads, since the animators are not evenly distributed
+
+void DestroyNodeList( NodeIndexList& nodeList )
 {
-  for( std::set<Node*>::iterator iter = nodeSet.begin(); iter != nodeSet.end(); ++iter )
+  while( !nodeList.Empty() )
   {
-    Node* node( *iter );
+    Node* node = nodeList.RemoveLast();
 
     // Call Node::OnDestroy as each node is destroyed
     node->OnDestroy();
 
     delete node;
   }
-  nodeSet.clear();
+}
+
+/**
+ * Applies animators, from several animations, to a subset of the animated properties.
+ * Each property is only updated by one job, so that the animators of a property are still applied in order.
+ * The properties touched by the job are added to its own touched list, and merged after the jobs have finished.
+ */
+class AnimateJob : public JobSystem::Job
+{
+public:
+
+  /**
+   * Adjacent animators from the same batch of an animation; see Animation::Update().
+   */
+  struct Batch
+  {
+    AnimatorBase::UpdateFunction updateFunction;
+    unsigned int batchNumber;    ///< Identifies the batch in the animation, during the current update
+    unsigned int animationIndex; ///< The index of the animation, in the animations advanced during the current update
+    unsigned int begin;          ///< The index of the first animator in the job
+    unsigned int count;          ///< The number of animators
+    unsigned int applied;        ///< The number of animators applied by Process()
+    float elapsedSeconds;
+    bool bake;
+  };
+
+  typedef Dali::Vector< Batch > BatchContainer;
+
+  /**
+   * Constructor.
+   */
+  AnimateJob()
+  : mBufferIndex( 0 )
+  {
+  }
+
+  /**
+   * Select the job which applies the animators of a property.
+   * @param[in] property The animated property.
+   * @param[in] jobCount The number of jobs.
+   * @return The index of the job.
+   */
+  static unsigned int GetJobIndex( const PropertyBase* property, unsigned int jobCount )
+  {
+    // The low bits are ignored, since they are the same for aligned properties
+    return static_cast< unsigned int >( reinterpret_cast< std::size_t >( property ) >> 4u ) % jobCount;
+  }
+
+  /**
+   * Set the buffer to update, before the animators are added.
+   * @param[in] bufferIndex The buffer to update.
+   */
+  void SetBufferIndex( BufferIndex bufferIndex )
+  {
+    mBufferIndex = bufferIndex;
+  }
+
+  /**
+   * Add an animator to the job.
+   * @param[in] animator The animator.
+   * @param[in] batchNumber Identifies the batch of the animator; adjacent animators with the same number are applied together.
+   * @param[in] animationIndex The index of the animation.
+   * @param[in] elapsedSeconds The elapsed time of the animation.
+   * @param[in] bake True if the final result should be baked.
+   */
+  void AddAnimator( AnimatorBase* animator, unsigned int batchNumber, unsigned int animationIndex, float elapsedSeconds, bool bake )
+  {
+    if( 0u == mBatches.Count() || batchNumber != mBatches[ mBatches.Count() - 1u ].batchNumber )
+    {
+      const unsigned int begin = mAnimators.Count();
+      Batch batch = { animator->GetUpdateFunction(), batchNumber, animationIndex, begin, 0u, 0u, elapsedSeconds, bake };
+      mBatches.PushBack( batch );
+    }
+
+    mAnimators.PushBack( animator );
+    ++mBatches[ mBatches.Count() - 1u ].count;
+  }
+
+  /**
+   * @copydoc JobSystem::Job::Process()
+   */
+  virtual void Process()
+  {
+    TouchedPropertyContainer* previousTouchedProperties = AnimatablePropertyBase::SetTouchedProperties( &mTouchedProperties );
+
+    AnimatorBase* const* animators = mAnimators.Begin();
+    for( BatchContainer::Iterator iter = mBatches.Begin(), endIter = mBatches.End(); iter != endIter; ++iter )
+    {
+      Batch& batch = *iter;
+      batch.applied = batch.updateFunction( animators + batch.begin, batch.count, mBufferIndex, batch.elapsedSeconds, batch.bake );
+    }
+
+    AnimatablePropertyBase::SetTouchedProperties( previousTouchedProperties );
+  }
+
+  /**
+   * Called by the update-thread after the job has been processed.
+   * The touched properties are merged, the number of applied animators is added for each animation, and the job is cleared.
+   * @param[in] touchedProperties The touched list of the UpdateManager.
+   * @param[in,out] appliedCounts The number of animators applied, for each animation.
+   */
+  void Complete( TouchedPropertyContainer& touchedProperties, Dali::Vector< unsigned int >& appliedCounts )
+  {
+    AnimatablePropertyBase::MergeTouchedProperties( touchedProperties, mTouchedProperties );
+
+    for( BatchContainer::ConstIterator iter = mBatches.Begin(), endIter = mBatches.End(); iter != endIter; ++iter )
+    {
+      appliedCounts[ iter->animationIndex ] += iter->applied;
+    }
+
+    mBatches.Clear();
+    mAnimators.Clear();
+  }
+
+private:
+
+  BufferIndex mBufferIndex;
+  Dali::Vector< AnimatorBase* > mAnimators;     ///< The animators of each batch, in order; not owned
+  BatchContainer mBatches;
+  TouchedPropertyContainer mTouchedProperties;  ///< The properties first touched by this job; not owned
+};
+
+typedef OwnerContainer< AnimateJob* > AnimateJobContainer;
+
+/**
+ * Count the animators of the animations which are running.
+ * @param[in] animations The animations.
+ * @return The number of animators.
+ */
+unsigned int CountRunningAnimators( AnimationContainer& animations )
+{
+  unsigned int count = 0u;
+  for( AnimationIter iter = animations.Begin(), endIter = animations.End(); iter != endIter; ++iter )
+  {
+    Animation* animation = *iter;
+    if( Animation::Playing == animation->GetState() || Animation::Paused == animation->GetState() )
+    {
+      count += animation->GetAnimators().Count();
+    }
+  }
+
+  return count;
+}
+
+/**
+ * Update the animations, with their animators applied in parallel by a JobSystem.
+ * The animations are advanced and completed by the update-thread; only the batches of animators are processed in parallel.
+ * @param[in] animations The animations.
+ * @param[in] bufferIndex The buffer to update.
+ * @param[in] elapsedSeconds The time elapsed since the previous frame.
+ * @param[in] jobSystem The job system.
+ * @param[in] animateJobs The jobs, reused between frames.
+ * @param[in] touchedProperties The touched list of the UpdateManager.
+ * @return True if an animation has finished.
+ */
+bool UpdateAnimationsInParallel( AnimationContainer& animations,
+                                 BufferIndex bufferIndex,
+                                 float elapsedSeconds,
+                                 JobSystem& jobSystem,
+                                 AnimateJobContainer& animateJobs,
+                                 TouchedPropertyContainer& touchedProperties )
+{
+  const unsigned int jobCount = ( jobSystem.GetWorkerCount() + 1u ) * ANIMATE_JOBS_PER_THREAD;
+  while( animateJobs.Count() < jobCount )
+  {
+    animateJobs.PushBack( new AnimateJob() );
+  }
+
+  JobSystem::JobContainer jobs;
+  jobs.Reserve( jobCount );
+  for( unsigned int index = 0u; index < jobCount; ++index )
+  {
+    animateJobs[ index ]->SetBufferIndex( bufferIndex );
+    jobs.PushBack( animateJobs[ index ] );
+  }
+
+  // Distribute the animators by property, in the order they would be applied by Animation::Update()
+  Dali::Vector< Animation* > advancedAnimations;
+  unsigned int batchNumber = 0u;
+
+  for( AnimationIter iter = animations.Begin(), endIter = animations.End(); iter != endIter; ++iter )
+  {
+    Animation* animation = *iter;
+    if( animation->Advance( elapsedSeconds ) )
+    {
+      const unsigned int animationIndex = advancedAnimations.Count();
+      advancedAnimations.PushBack( animation );
+
+      const AnimatorContainer& animators = animation->GetGroupedAnimators();
+      const float animationSeconds = animation->GetElapsedSeconds();
+      const bool bake = animation->IsBaking();
+
+      const AnimatorBase* first = NULL;
+      for( AnimatorConstIter animatorIter = animators.Begin(), animatorEndIter = animators.End(); animatorIter != animatorEndIter; ++animatorIter )
+      {
+        AnimatorBase* animator = *animatorIter;
+        if( NULL == first || !animator->IsBatchedWith( *first ) )
+        {
+          first = animator;
+          ++batchNumber;
+        }
+
+        AnimateJob* job = animateJobs[ AnimateJob::GetJobIndex( animator->GetProperty(), jobCount ) ];
+        job->AddAnimator( animator, batchNumber, animationIndex, animationSeconds, bake );
+      }
+    }
+  }
+
+  jobSystem.Process( jobs );
+
+  Dali::Vector< unsigned int > appliedCounts;
+  appliedCounts.Resize( advancedAnimations.Count(), 0u );
+
+  for( unsigned int index = 0u; index < jobCount; ++index )
+  {
+    animateJobs[ index ]->Complete( touchedProperties, appliedCounts );
+  }
+
+  bool animationFinished = false;
+  for( unsigned int index = 0u; index < advancedAnimations.Count(); ++index )
+  {
+    const bool finished = advancedAnimations[ index ]->CompleteUpdate( appliedCounts[ index ] );
+    animationFinished = animationFinished || finished;
+  }
+
+  return animationFinished;
 }
 
 } //namespace
@@ -158,7 +386,8 @@ struct UpdateManager::Impl
         RenderQueue& renderQueue,
         TextureCache& textureCache,
         TouchResampler& touchResampler,
-        SceneGraphBuffers& sceneGraphBuffers )
+        SceneGraphBuffers& sceneGraphBuffers,
+        unsigned int updateWorkerCount )
   :
     renderMessageDispatcher( renderManager, renderQueue, sceneGraphBuffers ),
     notificationManager( notificationManager ),
@@ -178,6 +407,7 @@ struct UpdateManager::Impl
     systemLevelTaskList ( completeStatusManager ),
     root( NULL ),
     systemLevelRoot( NULL ),
+    jobSystem( updateWorkerCount ),
     defaultShader( NULL ),
     messageQueue( renderController, sceneGraphBuffers ),
     dynamicsWorld( NULL ),
@@ -186,10 +416,13 @@ struct UpdateManager::Impl
     animationFinishedDuringUpdate( false ),
     activeConstraints( 0 ),
     nodeDirtyFlags( TransformFlag ), // set to TransformFlag to ensure full update the first time through Update()
-    previousUpdateScene( false ),
+    previousUpdateSceneCount( 0u ),
     frameCounter( 0 ),
     renderSortingHelper(),
     renderTaskList( NULL ),
+    panGesturePredictionMode( PanGesture::DEFAULT_PREDICTION_MODE ),
+    panGesturePredictionAmount( PanGesture::DEFAULT_PREDICTION_AMOUNT ),
+    panGestureSmoothingAmount( PanGesture::DEFAULT_SMOOTHING_AMOUNT ),
     renderTaskWaiting( false )
   {
     sceneController = new SceneControllerImpl( renderMessageDispatcher, renderQueue, discardQueue, textureCache, completeStatusManager );
@@ -211,9 +444,9 @@ struct UpdateManager::Impl
     }
 
     // UpdateManager owns the Nodes
-    DestroyNodeSet( activeDisconnectedNodes );
-    DestroyNodeSet( connectedNodes );
-    DestroyNodeSet( disconnectedNodes );
+    DestroyNodeList( activeDisconnectedNodes );
+    DestroyNodeList( connectedNodes );
+    DestroyNodeList( disconnectedNodes );
 
     // If there is root, reset it, otherwise do nothing as rendering was never started
     if( root )
@@ -258,14 +491,20 @@ struct UpdateManager::Impl
 
   Layer*                              root;                          ///< The root node (root is a layer)
   Layer*                              systemLevelRoot;               ///< A separate root-node for system-level content
-  std::set< Node* >                   activeDisconnectedNodes;       ///< A container of new or modified nodes (without parent) owned by UpdateManager
-  std::set< Node* >                   connectedNodes;                ///< A container of connected (with parent) nodes owned by UpdateManager
-  std::set< Node* >                   disconnectedNodes;             ///< A container of inactive disconnected nodes (without parent) owned by UpdateManager
+  NodeIndexList                       activeDisconnectedNodes;       ///< A container of new or modified nodes (without parent) owned by UpdateManager
+  NodeIndexList                       connectedNodes;                ///< A container of connected (with parent) nodes owned by UpdateManager
+  NodeIndexList                       disconnectedNodes;             ///< A container of inactive disconnected nodes (without parent) owned by UpdateManager
+  NodeContainer                       newlyConnectedNodes;           ///< Nodes which were connected before their initial reset; not owned
+
+  JobSystem                           jobSystem;                     ///< Used to process independent parts of the update in parallel
+  AnimateJobContainer                 animateJobs;                   ///< Used to apply the animators in parallel; reused between frames
 
   SortedLayerPointers                 sortedLayers;                  ///< A container of Layer pointers sorted by depth
   SortedLayerPointers                 systemLevelSortedLayers;       ///< A separate container of system-level Layers
 
   OwnerContainer< PropertyOwner* >    customObjects;                 ///< A container of owned objects (with custom properties)
+  Dali::Vector< PropertyOwner* >      newPropertyOwners;             ///< Custom objects & animatable meshes awaiting their initial reset; not owned
+  TouchedPropertyContainer            touchedProperties;             ///< The properties which have been Set or Baked, and are not yet clean; not owned
 
   AnimationContainer                  animations;                    ///< A container of owned animations
   PropertyNotificationContainer       propertyNotifications;         ///< A container of owner property notifications.
@@ -285,13 +524,16 @@ struct UpdateManager::Impl
 
   unsigned int                        activeConstraints;             ///< number of active constraints from previous frame
   int                                 nodeDirtyFlags;                ///< cumulative node dirty flags from previous frame
-  bool                                previousUpdateScene;           ///< True if the scene was updated in the previous frame (otherwise it was optimized out)
+  unsigned int                        previousUpdateSceneCount;      ///< Non-zero while the buffers written before the last scene update must still be synchronized
 
   int                                 frameCounter;                  ///< Frame counter used in debugging to choose which frame to debug and which to ignore.
   RendererSortingHelper               renderSortingHelper;           ///< helper used to sort transparent renderers
 
   Internal::RenderTaskList*           renderTaskList;                ///< Stores a pointer to the internal implementation to the render task list.
   GestureContainer                    gestures;                      ///< A container of owned gesture detectors
+  PanGesture::PredictionMode          panGesturePredictionMode;      ///< The prediction mode of the pan gestures
+  unsigned int                        panGesturePredictionAmount;    ///< The time added to the next render time when predicting pan gestures
+  float                               panGestureSmoothingAmount;     ///< How much the velocity of the pan gestures is smoothed
   bool                                renderTaskWaiting;             ///< A REFRESH_ONCE render task is waiting to be rendered
 };
 
@@ -305,7 +547,8 @@ UpdateManager::UpdateManager( NotificationManager& notificationManager,
                               RenderManager& renderManager,
                               RenderQueue& renderQueue,
                               TextureCache& textureCache,
-                              TouchResampler& touchResampler )
+                              TouchResampler& touchResampler,
+                              unsigned int updateWorkerCount )
   : mImpl(NULL)
 {
   mImpl = new Impl( notificationManager,
@@ -319,7 +562,8 @@ UpdateManager::UpdateManager( NotificationManager& notificationManager,
                     renderQueue,
                     textureCache,
                     touchResampler,
-                    mSceneGraphBuffers );
+                    mSceneGraphBuffers,
+                    updateWorkerCount );
 
   textureCache.SetBufferIndices( &mSceneGraphBuffers );
 }
@@ -363,7 +607,7 @@ void UpdateManager::AddNode( Node* node )
   DALI_ASSERT_ALWAYS( NULL != node );
   DALI_ASSERT_ALWAYS( NULL == node->GetParent() ); // Should not have a parent yet
 
-  mImpl->activeDisconnectedNodes.insert( node ); // Takes ownership of node
+  mImpl->activeDisconnectedNodes.Add( node ); // Takes ownership of node
 }
 
 void UpdateManager::ConnectNode( Node* parent, Node* node )
@@ -373,13 +617,18 @@ void UpdateManager::ConnectNode( Node* parent, Node* node )
   DALI_ASSERT_ALWAYS( NULL == node->GetParent() ); // Should not have a parent yet
 
   // Move from active/disconnectedNodes to connectedNodes
-  std::set<Node*>::size_type removed = mImpl->activeDisconnectedNodes.erase( node );
-  if( !removed )
+  bool removed = mImpl->activeDisconnectedNodes.Remove( node );
+  if( removed )
   {
-    removed = mImpl->disconnectedNodes.erase( node );
+    // Connected nodes are not reset every frame; the properties of an active node must be reset once
+    mImpl->newlyConnectedNodes.PushBack( node );
+  }
+  else
+  {
+    removed = mImpl->disconnectedNodes.Remove( node );
     DALI_ASSERT_ALWAYS( removed );
   }
-  mImpl->connectedNodes.insert( node );
+  mImpl->connectedNodes.Add( node );
 
   node->SetActive( true );
 
@@ -402,9 +651,9 @@ void UpdateManager::SetNodeActive( Node* node )
   DALI_ASSERT_ALWAYS( NULL == node->GetParent() ); // Should not have a parent yet
 
   // Move from disconnectedNodes to activeDisconnectedNodes (reset properties next frame)
-  std::set<Node*>::size_type removed = mImpl->disconnectedNodes.erase( node );
+  bool removed = mImpl->disconnectedNodes.Remove( node );
   DALI_ASSERT_ALWAYS( removed );
-  mImpl->activeDisconnectedNodes.insert( node );
+  mImpl->activeDisconnectedNodes.Add( node );
 
   node->SetActive( true );
 }
@@ -416,10 +665,10 @@ void UpdateManager::DestroyNode( Node* node )
 
   // Transfer ownership from new/disconnectedNodes to the discard queue
   // This keeps the nodes alive, until the render-thread has finished with them
-  std::set<Node*>::size_type removed = mImpl->activeDisconnectedNodes.erase( node );
+  bool removed = mImpl->activeDisconnectedNodes.Remove( node );
   if( !removed )
   {
-    removed = mImpl->disconnectedNodes.erase( node );
+    removed = mImpl->disconnectedNodes.Remove( node );
     DALI_ASSERT_ALWAYS( removed );
   }
   mImpl->discardQueue.Add( mSceneGraphBuffers.GetUpdateBufferIndex(), node );
@@ -443,12 +692,15 @@ void UpdateManager::AddObject( PropertyOwner* object )
   DALI_ASSERT_DEBUG( NULL != object );
 
   mImpl->customObjects.PushBack( object );
+  AddNewPropertyOwner( object );
 }
 
 void UpdateManager::RemoveObject( PropertyOwner* object )
 {
   DALI_ASSERT_DEBUG( NULL != object );
 
+  RemoveNewPropertyOwner( object );
+
   OwnerContainer< PropertyOwner* >& customObjects = mImpl->customObjects;
 
   // Find the object and destroy it
@@ -551,6 +803,7 @@ void UpdateManager::AddShader( Shader* shader )
   if( NULL == mImpl->defaultShader )
   {
     mImpl->defaultShader = shader;
+    shader->SetDefault();
   }
 
   mImpl->shaders.PushBack( shader );
@@ -603,18 +856,24 @@ void UpdateManager::SetShaderProgram( Shader* shader, GeometryType geometryType,
 
     // Construct message in the render queue memory; note that delete should not be called on the return value
     new (slot) DerivedType( shader, &Shader::SetProgram, geometryType, subType, resourceId, shaderData, &(mImpl->renderManager.GetContext()) );
+
+    // Compilation and linking are issued when the message is processed; renderers wait for them to finish
+    shader->SetProgramPending();
   }
 }
 
 void UpdateManager::AddAnimatableMesh( AnimatableMesh* animatableMesh )
 {
   mImpl->animatableMeshes.PushBack(animatableMesh);
+  AddNewPropertyOwner( animatableMesh );
 }
 
 void UpdateManager::RemoveAnimatableMesh( AnimatableMesh* animatableMesh )
 {
   DALI_ASSERT_DEBUG(animatableMesh != NULL);
 
+  RemoveNewPropertyOwner( animatableMesh );
+
   AnimatableMeshContainer& animatableMeshes = mImpl->animatableMeshes;
 
   // Find the animatableMesh and destroy it
@@ -690,6 +949,10 @@ void UpdateManager::AddGesture( PanGesture* gesture )
 {
   DALI_ASSERT_DEBUG( NULL != gesture );
 
+  gesture->SetPredictionMode( mImpl->panGesturePredictionMode );
+  gesture->SetPredictionAmount( mImpl->panGesturePredictionAmount );
+  gesture->SetSmoothingAmount( mImpl->panGestureSmoothingAmount );
+
   mImpl->gestures.PushBack( gesture );
 }
 
@@ -713,6 +976,63 @@ void UpdateManager::RemoveGesture( PanGesture* gesture )
   DALI_ASSERT_DEBUG(false);
 }
 
+void UpdateManager::SetPanGesturePredictionMode( PanGesture::PredictionMode mode )
+{
+  mImpl->panGesturePredictionMode = mode;
+
+  for ( GestureIter iter = mImpl->gestures.Begin(), endIter = mImpl->gestures.End(); iter != endIter; ++iter )
+  {
+    (*iter)->SetPredictionMode( mode );
+  }
+}
+
+void UpdateManager::SetPanGesturePredictionAmount( unsigned int amount )
+{
+  mImpl->panGesturePredictionAmount = amount;
+
+  for ( GestureIter iter = mImpl->gestures.Begin(), endIter = mImpl->gestures.End(); iter != endIter; ++iter )
+  {
+    (*iter)->SetPredictionAmount( amount );
+  }
+}
+
+void UpdateManager::SetPanGestureSmoothingAmount( float amount )
+{
+  mImpl->panGestureSmoothingAmount = amount;
+
+  for ( GestureIter iter = mImpl->gestures.Begin(), endIter = mImpl->gestures.End(); iter != endIter; ++iter )
+  {
+    (*iter)->SetSmoothingAmount( amount );
+  }
+}
+
+void UpdateManager::AddNewPropertyOwner( PropertyOwner* owner )
+{
+  Dali::Vector< PropertyOwner* >& newOwners = mImpl->newPropertyOwners;
+
+  owner->SetNewOwnerIndex( newOwners.Count() );
+  newOwners.PushBack( owner );
+}
+
+void UpdateManager::RemoveNewPropertyOwner( PropertyOwner* owner )
+{
+  Dali::Vector< PropertyOwner* >& newOwners = mImpl->newPropertyOwners;
+
+  const unsigned int index = owner->GetNewOwnerIndex();
+  if( index < newOwners.Count() )
+  {
+    DALI_ASSERT_DEBUG( owner == newOwners[ index ] );
+
+    // The order of the initial resets does not matter, so the last owner is moved into the gap
+    PropertyOwner* last = newOwners[ newOwners.Count() - 1u ];
+    newOwners[ index ] = last;
+    last->SetNewOwnerIndex( index );
+    newOwners.Resize( newOwners.Count() - 1u );
+
+    owner->SetNewOwnerIndex( PropertyOwner::INVALID_NEW_OWNER_INDEX );
+  }
+}
+
 void UpdateManager::ResetNodeProperty( Node& node )
 {
   node.ResetToBaseValues( mSceneGraphBuffers.GetUpdateBufferIndex() );
@@ -725,7 +1045,9 @@ void UpdateManager::ResetProperties()
   // Clear the "animations finished" flag; This should be set if any (previously playing) animation is stopped
   mImpl->animationFinishedDuringUpdate = false;
 
-  // Animated properties have to be reset to their original value each frame
+  // Animated properties have to be reset to their original value each frame.
+  // Only the properties which were Set or Baked are visited; this must be done before any owner is reset.
+  AnimatablePropertyBase::ResetTouchedProperties( mImpl->touchedProperties, mSceneGraphBuffers.GetUpdateBufferIndex() );
 
   // Reset node properties
   if ( mImpl->root )
@@ -738,23 +1060,27 @@ void UpdateManager::ResetProperties()
     ResetNodeProperty( *mImpl->systemLevelRoot );
   }
 
-  // Reset the Connected Nodes
-  const std::set<Node*>::iterator endIter = mImpl->connectedNodes.end();
-  for( std::set<Node*>::iterator iter = mImpl->connectedNodes.begin(); endIter != iter; ++iter )
+  // Nodes which were connected before being reset, require an initial reset
+  const NodeContainer::Iterator endIter = mImpl->newlyConnectedNodes.End();
+  for( NodeContainer::Iterator iter = mImpl->newlyConnectedNodes.Begin(); endIter != iter; ++iter )
   {
-    ResetNodeProperty( **iter );
+    // The node may have been disconnected (and reset) again, during the same frame
+    if( mImpl->connectedNodes.Contains( *iter ) )
+    {
+      ResetNodeProperty( **iter );
+    }
   }
+  mImpl->newlyConnectedNodes.Clear();
 
   // If a Node is disconnected, it may still be "active" (requires a reset in next frame)
-  for( std::set<Node*>::iterator iter = mImpl->activeDisconnectedNodes.begin(); mImpl->activeDisconnectedNodes.end() != iter; iter = mImpl->activeDisconnectedNodes.begin() )
+  while( !mImpl->activeDisconnectedNodes.Empty() )
   {
-    Node* node = *iter;
+    Node* node = mImpl->activeDisconnectedNodes.RemoveLast();
     node->ResetToBaseValues( mSceneGraphBuffers.GetUpdateBufferIndex() );
     node->SetActive( false );
 
     // Move everything from activeDisconnectedNodes to disconnectedNodes (no need to reset again)
-    mImpl->activeDisconnectedNodes.erase( iter );
-    mImpl->disconnectedNodes.insert( node );
+    mImpl->disconnectedNodes.Add( node );
   }
 
   // Reset system-level render-task list properties to base values
@@ -773,11 +1099,13 @@ void UpdateManager::ResetProperties()
     (*iter)->ResetToBaseValues( mSceneGraphBuffers.GetUpdateBufferIndex() );
   }
 
-  // Reset custom object properties to base values
-  for (OwnerContainer<PropertyOwner*>::Iterator iter = mImpl->customObjects.Begin(); iter != mImpl->customObjects.End(); ++iter)
+  // Custom objects & animatable meshes require an initial reset; afterwards only their touched properties are reset
+  for( Dali::Vector< PropertyOwner* >::Iterator iter = mImpl->newPropertyOwners.Begin(); iter != mImpl->newPropertyOwners.End(); ++iter )
   {
     (*iter)->ResetToBaseValues( mSceneGraphBuffers.GetUpdateBufferIndex() );
+    (*iter)->SetNewOwnerIndex( PropertyOwner::INVALID_NEW_OWNER_INDEX );
   }
+  mImpl->newPropertyOwners.Clear();
 
   // Reset animatable shader properties to base values
   for (ShaderIter iter = mImpl->shaders.Begin(); iter != mImpl->shaders.End(); ++iter)
@@ -785,12 +1113,6 @@ void UpdateManager::ResetProperties()
     (*iter)->ResetToBaseValues( mSceneGraphBuffers.GetUpdateBufferIndex() );
   }
 
-  // Reset animatable mesh properties to base values
-  for ( AnimatableMeshIter iter = mImpl->animatableMeshes.Begin(); iter != mImpl->animatableMeshes.End(); ++iter )
-  {
-    (*iter)->ResetToBaseValues( mSceneGraphBuffers.GetUpdateBufferIndex() );
-  }
-
   // Reset gesture properties to base values
   for ( GestureIter iter = mImpl->gestures.Begin(); iter != mImpl->gestures.End(); ++iter )
   {
@@ -817,16 +1139,33 @@ void UpdateManager::Animate( float elapsedSeconds )
   PERF_MONITOR_START(PerformanceMonitor::ANIMATE_NODES);
 
   AnimationContainer &animations = mImpl->animations;
-  AnimationIter iter = animations.Begin();
-  while ( iter != animations.End() )
+
+  if( mImpl->jobSystem.GetWorkerCount() > 0u && CountRunningAnimators( animations ) >= MIN_ANIMATORS_FOR_JOBS )
   {
-    Animation* animation = *iter;
-    bool finished = animation->Update(mSceneGraphBuffers.GetUpdateBufferIndex(), elapsedSeconds);
+    const bool finished = UpdateAnimationsInParallel( animations,
+                                                      mSceneGraphBuffers.GetUpdateBufferIndex(),
+                                                      elapsedSeconds,
+                                                      mImpl->jobSystem,
+                                                      mImpl->animateJobs,
+                                                      mImpl->touchedProperties );
 
     mImpl->animationFinishedDuringUpdate = mImpl->animationFinishedDuringUpdate || finished;
+  }
+  else
+  {
+    for( AnimationIter iter = animations.Begin(), endIter = animations.End(); iter != endIter; ++iter )
+    {
+      bool finished = (*iter)->Update(mSceneGraphBuffers.GetUpdateBufferIndex(), elapsedSeconds);
+
+      mImpl->animationFinishedDuringUpdate = mImpl->animationFinishedDuringUpdate || finished;
+    }
+  }
 
+  AnimationIter iter = animations.Begin();
+  while ( iter != animations.End() )
+  {
     // Remove animations that had been destroyed but were still waiting for an update
-    if (animation->GetState() == Animation::Destroyed)
+    if ((*iter)->GetState() == Animation::Destroyed)
     {
       iter = animations.Erase(iter);
     }
@@ -953,21 +1292,25 @@ void UpdateManager::UpdateNodes()
 
   if ( NULL != defaultShader )
   {
+    const BufferIndex updateBufferIndex = mSceneGraphBuffers.GetUpdateBufferIndex();
+
     // Prepare resources, update shaders, update attachments, for each node
     // And add the renderers to the sorted layers. Start from root, which is also a layer
     mImpl->nodeDirtyFlags = UpdateNodesAndAttachments( *( mImpl->root ),
-                                                       mSceneGraphBuffers.GetUpdateBufferIndex(),
+                                                       updateBufferIndex,
                                                        mImpl->resourceManager,
                                                        mImpl->renderQueue,
-                                                       defaultShader );
+                                                       defaultShader,
+                                                       mImpl->jobSystem );
 
     if ( mImpl->systemLevelRoot )
     {
       mImpl->nodeDirtyFlags |= UpdateNodesAndAttachments( *( mImpl->systemLevelRoot ),
-                                                          mSceneGraphBuffers.GetUpdateBufferIndex(),
+                                                          updateBufferIndex,
                                                           mImpl->resourceManager,
                                                           mImpl->renderQueue,
-                                                          defaultShader );
+                                                          defaultShader,
+                                                          mImpl->jobSystem );
     }
   }
 
@@ -1010,6 +1353,9 @@ unsigned int UpdateManager::Update( float elapsedSeconds, unsigned int lastRende
   // Measure the time spent in UpdateManager::Update
   PERF_MONITOR_START(PerformanceMonitor::UPDATE);
 
+  // The properties Set or Baked during this update are added to the touched list of this UpdateManager
+  TouchedPropertyContainer* previousTouchedProperties = AnimatablePropertyBase::SetTouchedProperties( &mImpl->touchedProperties );
+
   // Update the frame time delta on the render thread.
   mImpl->renderManager.SetFrameDeltaTime(elapsedSeconds);
 
@@ -1028,8 +1374,10 @@ unsigned int UpdateManager::Update( float elapsedSeconds, unsigned int lastRende
       resourceChanged;                                                // one or more resources were updated/changed
 
   // Although the scene-graph may not require an update, we still need to synchronize double-buffered
-  // values if the scene was updated in the previous frame.
-  if( updateScene || mImpl->previousUpdateScene )
+  // values if the scene was updated in the previous frame (or two previous frames, when triple-buffered).
+  const bool synchronizeBuffers = updateScene || ( 0u != mImpl->previousUpdateSceneCount );
+
+  if( synchronizeBuffers )
   {
     // 3) Reset properties from the previous update
     ResetProperties();
@@ -1043,8 +1391,8 @@ unsigned int UpdateManager::Update( float elapsedSeconds, unsigned int lastRende
 
   // Although the scene-graph may not require an update, we still need to synchronize double-buffered
   // renderer lists if the scene was updated in the previous frame.
-  // We should not start skipping update steps or reusing lists until there has been two frames where nothing changes
-  if( updateScene || mImpl->previousUpdateScene )
+  // We should not start skipping update steps or reusing lists until there has been two (or three) frames where nothing changes
+  if( synchronizeBuffers )
   {
     // 6) Process Touches & Gestures
     mImpl->touchResampler.Update();
@@ -1160,8 +1508,15 @@ unsigned int UpdateManager::Update( float elapsedSeconds, unsigned int lastRende
   // Macro is undefined in release build.
   SNAPSHOT_NODE_LOGGING;
 
-  // A ResetProperties() may be required in the next frame
-  mImpl->previousUpdateScene = updateScene;
+  // A ResetProperties() may be required in the next frame, or next two frames when triple-buffered
+  if( updateScene )
+  {
+    mImpl->previousUpdateSceneCount = NUM_SCENE_GRAPH_BUFFERS - 1u;
+  }
+  else if( 0u != mImpl->previousUpdateSceneCount )
+  {
+    --mImpl->previousUpdateSceneCount;
+  }
 
   // Check whether further updates are required
   unsigned int keepUpdating = KeepUpdatingCheck( elapsedSeconds );
@@ -1171,9 +1526,14 @@ unsigned int UpdateManager::Update( float elapsedSeconds, unsigned int lastRende
   keepUpdating |= KeepUpdating::MONITORING_PERFORMANCE;
 #endif
 
-  // The update has finished; swap the double-buffering indices
+  // Let the render thread know whether the instructions in this buffer changed, so it can redraw just the damaged area
+  mImpl->renderInstructions.UpdateCompleted( mSceneGraphBuffers.GetUpdateBufferIndex(), synchronizeBuffers );
+
+  // The update has finished; swap the buffer indices
   mSceneGraphBuffers.Swap();
 
+  AnimatablePropertyBase::SetTouchedProperties( previousTouchedProperties );
+
   PERF_MONITOR_END(PerformanceMonitor::UPDATE);
 
   return keepUpdating;
@@ -32,6 +32,7 @@
 #include <dali/internal/update/common/double-buffered.h>
 #include <dali/internal/update/modeling/scene-graph-animatable-mesh.h>
 #include <dali/internal/update/nodes/scene-graph-layer.h>
+#include <dali/internal/update/gestures/scene-graph-pan-gesture.h>
 #include <dali/internal/event/effects/shader-declarations.h>
 #include <dali/internal/common/type-abstraction-enums.h>
 
@@ -61,6 +62,8 @@ class TouchResampler;
 // value types used by messages
 template <> struct ParameterType< PropertyNotification::NotifyMode >
 : public BasicType< PropertyNotification::NotifyMode > {};
+template <> struct ParameterType< SceneGraph::PanGesture::PredictionMode >
+: public BasicType< SceneGraph::PanGesture::PredictionMode > {};
 
 namespace SceneGraph
 {
@@ -69,7 +72,6 @@ class AnimatableMesh;
 class Animation;
 class DiscardQueue;
 class Material;
-class PanGesture;
 class RenderManager;
 class RenderTaskList;
 class RenderQueue;
@@ -100,6 +102,7 @@ public:
    * @param[in] renderQueue Used to queue messages for the next render.
    * @param[in] textureCache Used for caching textures.
    * @param[in] touchResampler Used for re-sampling touch events.
+   * @param[in] updateWorkerCount The number of worker threads used to parallelize parts of the update.
    */
   UpdateManager( NotificationManager& notificationManager,
                  Integration::GlSyncAbstraction& glSyncAbstraction,
@@ -111,7 +114,8 @@ public:
                  RenderManager& renderManager,
                  RenderQueue& renderQueue,
                  TextureCache& textureCache,
-                 TouchResampler& touchResampler );
+                 TouchResampler& touchResampler,
+                 unsigned int updateWorkerCount );
 
   /**
    * Destructor. Not virtual as this is not a base class
@@ -349,6 +353,24 @@ public:
    */
   void RemoveGesture( PanGesture* gesture );
 
+  /**
+   * Sets how the properties of the pan gestures are worked out.
+   * @param[in] mode The prediction mode
+   */
+  void SetPanGesturePredictionMode( PanGesture::PredictionMode mode );
+
+  /**
+   * Sets the time added to the next render time when the pan gestures are predicted.
+   * @param[in] amount The time added, in milliseconds
+   */
+  void SetPanGesturePredictionAmount( unsigned int amount );
+
+  /**
+   * Sets how much the velocity of the pan gestures is smoothed when they are predicted.
+   * @param[in] amount The smoothing amount, between 0 (no smoothing) and 1
+   */
+  void SetPanGestureSmoothingAmount( float amount );
+
 public:
 
   /**
@@ -413,6 +435,18 @@ private:
    */
   void PostProcessResources();
 
+  /**
+   * Helper to add a custom object or animatable mesh to the list awaiting an initial reset.
+   * @param[in] owner The property owner.
+   */
+  void AddNewPropertyOwner( PropertyOwner* owner );
+
+  /**
+   * Helper to remove a custom object or animatable mesh, which is being destroyed, from the list awaiting an initial reset.
+   * @param[in] owner The property owner.
+   */
+  void RemoveNewPropertyOwner( PropertyOwner* owner );
+
   /**
    * Helper to reset a Node properties.
    * @param[in] node The node.
@@ -851,6 +885,39 @@ inline void RemoveGestureMessage( UpdateManager& manager, PanGesture* gesture )
   new (slot) LocalType( &manager, &UpdateManager::RemoveGesture, gesture );
 }
 
+inline void SetPanGesturePredictionModeMessage( UpdateManager& manager, PanGesture::PredictionMode mode )
+{
+  typedef MessageValue1< UpdateManager, PanGesture::PredictionMode > LocalType;
+
+  // Reserve some memory inside the message queue
+  unsigned int* slot = manager.GetEventToUpdate().ReserveMessageSlot( sizeof( LocalType ) );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &manager, &UpdateManager::SetPanGesturePredictionMode, mode );
+}
+
+inline void SetPanGesturePredictionAmountMessage( UpdateManager& manager, unsigned int amount )
+{
+  typedef MessageValue1< UpdateManager, unsigned int > LocalType;
+
+  // Reserve some memory inside the message queue
+  unsigned int* slot = manager.GetEventToUpdate().ReserveMessageSlot( sizeof( LocalType ) );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &manager, &UpdateManager::SetPanGesturePredictionAmount, amount );
+}
+
+inline void SetPanGestureSmoothingAmountMessage( UpdateManager& manager, float amount )
+{
+  typedef MessageValue1< UpdateManager, float > LocalType;
+
+  // Reserve some memory inside the message queue
+  unsigned int* slot = manager.GetEventToUpdate().ReserveMessageSlot( sizeof( LocalType ) );
+
+  // Construct message in the message queue memory; note that delete should not be called on the return value
+  new (slot) LocalType( &manager, &UpdateManager::SetPanGestureSmoothingAmount, amount );
+}
+
 } // namespace SceneGraph
 
 } // namespace Internal
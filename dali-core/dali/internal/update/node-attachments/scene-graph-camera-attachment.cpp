@@ -26,12 +26,6 @@
 
 using namespace std;
 
-namespace // unnamed namespace
-{
-static unsigned int UPDATE_COUNT        = 2u; // Update projection or view matrix this many frames after a change
-static unsigned int COPY_PREVIOUS_PROJECTION = 1u; // Copy projection matrix from previous frame
-}
-
 namespace Dali
 {
 
@@ -44,6 +38,14 @@ namespace SceneGraph
 namespace
 {
 
+/**
+ * The projection or view matrix is updated this many frames after a change; once for each scene-graph buffer.
+ */
+unsigned int UpdateCount()
+{
+  return NUM_SCENE_GRAPH_BUFFERS;
+}
+
 void LookAt(Matrix& result, const Vector3& eye, const Vector3& target, const Vector3& up)
 {
   Vector3 vZ = target - eye;
@@ -150,8 +152,8 @@ const Vector3 CameraAttachment::DEFAULT_TARGET_POSITION( 0.0f, 0.0f, 0.0f );
 
 CameraAttachment::CameraAttachment()
 : NodeAttachment(),
-  mUpdateViewFlag( UPDATE_COUNT ),
-  mUpdateProjectionFlag( UPDATE_COUNT ),
+  mUpdateViewFlag( UpdateCount() ),
+  mUpdateProjectionFlag( UpdateCount() ),
   mType( DEFAULT_TYPE ),
   mProjectionMode( DEFAULT_MODE ),
   mInvertYAxis( DEFAULT_INVERT_Y_AXIS ),
@@ -202,67 +204,67 @@ void CameraAttachment::SetType( Dali::Camera::Type type )
 void CameraAttachment::SetProjectionMode( Dali::Camera::ProjectionMode mode )
 {
   mProjectionMode = mode;
-  mUpdateProjectionFlag = UPDATE_COUNT;
+  mUpdateProjectionFlag = UpdateCount();
 }
 
 void CameraAttachment::SetInvertYAxis( bool invertYAxis )
 {
   mInvertYAxis = invertYAxis;
-  mUpdateProjectionFlag = UPDATE_COUNT;
+  mUpdateProjectionFlag = UpdateCount();
 }
 
 void CameraAttachment::SetFieldOfView( float fieldOfView )
 {
   mFieldOfView = fieldOfView;
-  mUpdateProjectionFlag = UPDATE_COUNT;
+  mUpdateProjectionFlag = UpdateCount();
 }
 
 void CameraAttachment::SetAspectRatio( float aspectRatio )
 {
   mAspectRatio = aspectRatio;
-  mUpdateProjectionFlag = UPDATE_COUNT;
+  mUpdateProjectionFlag = UpdateCount();
 }
 
 void CameraAttachment::SetLeftClippingPlane( float leftClippingPlane )
 {
   mLeftClippingPlane = leftClippingPlane;
-  mUpdateProjectionFlag = UPDATE_COUNT;
+  mUpdateProjectionFlag = UpdateCount();
 }
 
 void CameraAttachment::SetRightClippingPlane( float rightClippingPlane )
 {
   mRightClippingPlane = rightClippingPlane;
-  mUpdateProjectionFlag = UPDATE_COUNT;
+  mUpdateProjectionFlag = UpdateCount();
 }
 
 void CameraAttachment::SetTopClippingPlane( float topClippingPlane )
 {
   mTopClippingPlane = topClippingPlane;
-  mUpdateProjectionFlag = UPDATE_COUNT;
+  mUpdateProjectionFlag = UpdateCount();
 }
 
 void CameraAttachment::SetBottomClippingPlane( float bottomClippingPlane )
 {
   mBottomClippingPlane = bottomClippingPlane;
-  mUpdateProjectionFlag = UPDATE_COUNT;
+  mUpdateProjectionFlag = UpdateCount();
 }
 
 void CameraAttachment::SetNearClippingPlane( float nearClippingPlane )
 {
   mNearClippingPlane = nearClippingPlane;
-  mUpdateProjectionFlag = UPDATE_COUNT;
+  mUpdateProjectionFlag = UpdateCount();
 }
 
 void CameraAttachment::SetFarClippingPlane( float farClippingPlane )
 {
   mFarClippingPlane = farClippingPlane;
-  mUpdateProjectionFlag = UPDATE_COUNT;
+  mUpdateProjectionFlag = UpdateCount();
 }
 
 void CameraAttachment::SetTargetPosition( const Vector3& targetPosition )
 {
   mTargetPosition = targetPosition;
-  mUpdateViewFlag = UPDATE_COUNT;
+  mUpdateViewFlag = UpdateCount();
 }
 
 const Matrix& CameraAttachment::GetProjectionMatrix( BufferIndex bufferIndex ) const
@@ -280,6 +282,20 @@ const Matrix& CameraAttachment::GetInverseViewProjectionMatrix( BufferIndex buff
   return mInverseViewProjection[ bufferIndex ];
 }
 
+bool CameraAttachment::IsSphereInsideFrustum( BufferIndex bufferIndex, const Vector3& center, float radius ) const
+{
+  const Vector4* planes = mFrustumPlanes[ bufferIndex ];
+  for( unsigned int i = 0; i < 6; ++i )
+  {
+    // Signed distance from the plane; the sphere is outside if it is entirely behind any one plane
+    if( planes[ i ].Dot( center ) + planes[ i ].w < -radius )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 const PropertyInputImpl* CameraAttachment::GetProjectionMatrix() const
 {
   return &mProjectionMatrix;
@@ -292,10 +308,10 @@ const PropertyInputImpl* CameraAttachment::GetViewMatrix() const
 
 void CameraAttachment::Update( BufferIndex updateBufferIndex, const Node& owningNode, int nodeDirtyFlags )
 {
-  // if owning node has changes in world position we need to update camera for next 2 frames
+  // if owning node has changes in world position we need to update camera for the next 2 (or 3) frames
   if( nodeDirtyFlags & TransformFlag )
   {
-    mUpdateViewFlag = UPDATE_COUNT;
+    mUpdateViewFlag = UpdateCount();
   }
   if( nodeDirtyFlags & VisibleFlag )
   {
@@ -303,7 +319,7 @@ void CameraAttachment::Update( BufferIndex updateBufferIndex, const Node& owning
     // It may happen the first time an actor is rendered it's rendered only once and becomes invisible,
     // in the following update the node will be skipped leaving the projection matrix (double buffered)
     // with the Identity.
-    mUpdateProjectionFlag = UPDATE_COUNT;
+    mUpdateProjectionFlag = UpdateCount();
   }
   if( 0u != mUpdateViewFlag )
   {
@@ -351,12 +367,12 @@ void CameraAttachment::UpdateProjection( BufferIndex updateBufferIndex )
   // Early-exit if no update required
   if ( 0u != mUpdateProjectionFlag )
   {
-    if ( COPY_PREVIOUS_PROJECTION == mUpdateProjectionFlag )
+    if ( mUpdateProjectionFlag < UpdateCount() )
     {
-      // The projection matrix was updated in the previous frame; copy it
+      // The projection matrix was updated in a previous frame; copy it
       mProjectionMatrix.CopyPrevious( updateBufferIndex );
     }
-    else // UPDATE_COUNT == mUpdateProjectionFlag
+    else // UpdateCount() == mUpdateProjectionFlag
     {
       switch( mProjectionMode )
       {
@@ -398,10 +414,38 @@ void CameraAttachment::UpdateProjection( BufferIndex updateBufferIndex )
 void CameraAttachment::UpdateInverseViewProjection( BufferIndex updateBufferIndex )
 {
   Matrix::Multiply( mInverseViewProjection[ updateBufferIndex ], mViewMatrix[ updateBufferIndex ], mProjectionMatrix[ updateBufferIndex ] );
+  UpdateFrustumPlanes( updateBufferIndex, mInverseViewProjection[ updateBufferIndex ] );
   // ignore the error, if the view projection is incorrect (non inversible) then you will have tough times anyways
   static_cast< void >( mInverseViewProjection[ updateBufferIndex ].Invert() );
 }
 
+void CameraAttachment::UpdateFrustumPlanes( BufferIndex updateBufferIndex, const Matrix& viewProjection )
+{
+  // The planes are combinations of the rows of the (column-major) view-projection matrix
+  const float* m = viewProjection.AsFloat();
+  const Vector4 row0( m[0], m[4], m[8],  m[12] );
+  const Vector4 row1( m[1], m[5], m[9],  m[13] );
+  const Vector4 row2( m[2], m[6], m[10], m[14] );
+  const Vector4 row3( m[3], m[7], m[11], m[15] );
+
+  Vector4* planes = mFrustumPlanes[ updateBufferIndex ];
+  planes[0] = row3 + row0; // left
+  planes[1] = row3 - row0; // right
+  planes[2] = row3 + row1; // bottom
+  planes[3] = row3 - row1; // top
+  planes[4] = row3 + row2; // near
+  planes[5] = row3 - row2; // far
+
+  for( unsigned int i = 0; i < 6; ++i )
+  {
+    const float length = Vector3( planes[ i ] ).Length();
+    if( length > Math::MACHINE_EPSILON_0 )
+    {
+      planes[ i ] /= length;
+    }
+  }
+}
+
 } // namespace SceneGraph
 
 } // namespace Internal
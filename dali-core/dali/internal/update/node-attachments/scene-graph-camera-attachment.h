@@ -19,6 +19,7 @@
 
 // INTERNAL INCLUDES
 #include <dali/public-api/math/rect.h>
+#include <dali/public-api/math/vector4.h>
 #include <dali/public-api/actors/camera-actor.h>
 #include <dali/internal/common/message.h>
 #include <dali/internal/common/event-to-update.h>
@@ -177,6 +178,16 @@ public:
    */
   const Matrix& GetInverseViewProjectionMatrix( BufferIndex bufferIndex ) const;
 
+  /**
+   * Query whether a world-space bounding sphere is at least partially inside the view-frustum.
+   * The frustum planes are extracted from the view-projection matrix, whenever it changes.
+   * @param[in] bufferIndex The buffer to read from.
+   * @param[in] center The center of the sphere, in world coordinates.
+   * @param[in] radius The radius of the sphere.
+   * @return False if the sphere is entirely outside the view-frustum, true otherwise.
+   */
+  bool IsSphereInsideFrustum( BufferIndex bufferIndex, const Vector3& center, float radius ) const;
+
   /**
    * Retrieve the projection-matrix property querying interface.
    * @pre The attachment is on-stage.
@@ -228,6 +239,13 @@ private:
    */
   void UpdateInverseViewProjection( BufferIndex updateBufferIndex );
 
+  /**
+   * Extracts the view-frustum planes from a view-projection matrix.
+   * @param[in] updateBufferIndex The current update buffer index.
+   * @param[in] viewProjection The view-projection matrix.
+   */
+  void UpdateFrustumPlanes( BufferIndex updateBufferIndex, const Matrix& viewProjection );
+
 private:
   unsigned int                  mUpdateViewFlag;       ///< This is non-zero if the view matrix requires an update
   unsigned int                  mUpdateProjectionFlag; ///< This is non-zero if the projection matrix requires an update
@@ -252,6 +270,13 @@ public:  // PROPERTIES
 
   DoubleBuffered< Matrix >      mInverseViewProjection;///< Inverted viewprojection; double buffered for input handling
 
+  /**
+   * The left, right, bottom, top, near & far planes of the view-frustum, in world coordinates.
+   * Each plane is stored as a unit normal (pointing into the frustum) in xyz, and the distance in w.
+   * Buffered as they must match the view & projection matrices of the same buffer.
+   */
+  Vector4                       mFrustumPlanes[ NUM_SCENE_GRAPH_BUFFERS ][ 6 ];
+
 };
 
 // Messages for CameraAttachment
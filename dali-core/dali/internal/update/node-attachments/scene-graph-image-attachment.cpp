@@ -246,6 +246,11 @@ bool ImageAttachment::DoPrepareResources( BufferIndex updateBufferIndex, Resourc
       {
         ready = true;
       }
+      else if( resourceManager.IsResourcePartiallyLoaded( mTextureId ) )
+      {
+        // Draw the low resolution version until the whole image has loaded
+        ready = true;
+      }
       mFinishedResourceAcquisition = false;
       FollowTracker( mTextureId );
     }
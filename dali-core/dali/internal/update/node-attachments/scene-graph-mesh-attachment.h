@@ -95,6 +95,15 @@ public:
     return mHasSizeAndColorFlag;
   }
 
+  /**
+   * @copydoc RenderableAttachment::IsCullable
+   * Mesh geometry is not bounded by the size of the node, so it is never culled.
+   */
+  virtual bool IsCullable() const
+  {
+    return false;
+  }
+
   /**
    * @copydoc RenderableAttachment::GetRenderer().
    */
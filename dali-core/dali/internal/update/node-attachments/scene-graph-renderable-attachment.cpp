@@ -106,7 +106,8 @@ void RenderableAttachment::PrepareResources( BufferIndex updateBufferIndex, Reso
   mHasUntrackedResources = false; // Only need to know this if the resources are not yet complete
   mTrackedResources.Clear(); // Resource trackers are only needed if not yet completea
 
-  if( Shader* shader = mParent->GetAppliedShader() )
+  Shader* shader = mParent->GetAppliedShader();
+  if( shader )
   {
     Integration::ResourceId id = shader->GetEffectTextureResourceId();
 
@@ -132,6 +133,13 @@ void RenderableAttachment::PrepareResources( BufferIndex updateBufferIndex, Reso
   }
 
   mResourcesReady = DoPrepareResources( updateBufferIndex, resourceManager );
+
+  // The renderer skips drawing until the programs of the shader have been compiled and linked
+  if( shader && shader->HasPendingPrograms() )
+  {
+    mFinishedResourceAcquisition = false;
+    mHasUntrackedResources = true;
+  }
 }
 
 void RenderableAttachment::FollowTracker( Integration::ResourceId id )
@@ -275,6 +283,7 @@ RenderableAttachment::RenderableAttachment( bool usesGeometryScaling )
   mResourcesReady( false ),
   mFinishedResourceAcquisition( false ),
   mHasUntrackedResources( false ),
+  mDamaged( true ),
   mCullFaceMode( CullNone ),
   mSortModifier( 0.0f )
 {
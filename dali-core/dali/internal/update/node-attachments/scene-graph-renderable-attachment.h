@@ -127,6 +127,24 @@ public: // API
     return mScaleForSizeDirty;
   }
 
+  /**
+   * Marks whether the renderable may look different than in the previous frame; set during the update algorithm.
+   * @param[in] damaged True if the node or the scale-for-size of the renderable has changed.
+   */
+  void SetDamaged( bool damaged )
+  {
+    mDamaged = damaged;
+  }
+
+  /**
+   * Query whether the renderable may look different than in the previous frame, inlined as called from update algorithm often
+   * @return True if the area covered by the renderable needs to be redrawn.
+   */
+  bool IsDamaged() const
+  {
+    return mDamaged;
+  }
+
   /**
    * Retrieve scale-for-size for given node size
    * Clears the scale for size flag
@@ -159,6 +177,16 @@ public: // For use during in the update algorithm only
     return mHasSizeAndColorFlag;
   }
 
+  /**
+   * Query whether the geometry of the renderable is bounded by the size of its node.
+   * If so, the renderable can be culled when the node lies outside the view-frustum.
+   * @return True if the renderable can be culled.
+   */
+  virtual bool IsCullable() const
+  {
+    return true;
+  }
+
   /**
    * if this renderable actor has visible size and color
    * @return true if you can potentially see this actor
@@ -330,6 +358,7 @@ protected:
   bool mResourcesReady:1;              ///< Set during the Update algorithm; true if the attachment has resources ready for the current frame.
   bool mFinishedResourceAcquisition:1; ///< Set during DoPrepareResources; true if ready & all resource acquisition has finished (successfully or otherwise)
   bool mHasUntrackedResources:1;       ///< Set during PrepareResources, true if have tried to follow untracked resources
+  bool mDamaged:1;                     ///< Set during the update algorithm; true if the renderable may look different than in the previous frame
   CullFaceMode mCullFaceMode:3;        ///< Cullface mode, 3 bits is enough for 4 values
 
   float mSortModifier;
@@ -0,0 +1,180 @@
+#ifndef __DALI_INTERNAL_SCENE_GRAPH_NODE_INDEX_LIST_H__
+#define __DALI_INTERNAL_SCENE_GRAPH_NODE_INDEX_LIST_H__
+
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/dali-common.h>
+#include <dali/internal/update/nodes/node.h>
+#include <dali/internal/update/nodes/node-declarations.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+/**
+ * A dense array of nodes, where each node stores its own index in the array.
+ * This allows nodes to be added, found & removed in constant time, and the list to be traversed linearly.
+ * A node can only be in one NodeIndexList at a time. The order of the nodes is not preserved by Remove().
+ */
+class NodeIndexList
+{
+public:
+
+  typedef NodeContainer::Iterator Iterator;
+  typedef NodeContainer::ConstIterator ConstIterator;
+
+  /**
+   * Create an empty list.
+   */
+  NodeIndexList()
+  {
+  }
+
+  /**
+   * Non-virtual destructor; NodeIndexList is not suitable as a base class.
+   * The nodes are not owned, and are not deleted.
+   */
+  ~NodeIndexList()
+  {
+  }
+
+  /**
+   * Add a node to the end of the list.
+   * @pre The node is not in any NodeIndexList.
+   * @param[in] node The node to add.
+   */
+  void Add( Node* node )
+  {
+    DALI_ASSERT_DEBUG( Node::INVALID_LIST_INDEX == node->GetListIndex() );
+
+    node->SetListIndex( mNodes.Count() );
+    mNodes.PushBack( node );
+  }
+
+  /**
+   * Query whether a node is in this list.
+   * @param[in] node The node to find.
+   * @return True if the node is in this list.
+   */
+  bool Contains( const Node* node ) const
+  {
+    const unsigned int index = node->GetListIndex();
+
+    return index < mNodes.Count() && mNodes[ index ] == node;
+  }
+
+  /**
+   * Remove a node from the list; the last node in the list takes its place.
+   * @param[in] node The node to remove.
+   * @return True if the node was removed, false if it was not in this list.
+   */
+  bool Remove( Node* node )
+  {
+    if( !Contains( node ) )
+    {
+      return false;
+    }
+
+    const unsigned int index = node->GetListIndex();
+
+    // Remove() swaps the last node into the vacated slot
+    mNodes.Remove( mNodes.Begin() + index );
+    if( index < mNodes.Count() )
+    {
+      mNodes[ index ]->SetListIndex( index );
+    }
+
+    node->SetListIndex( Node::INVALID_LIST_INDEX );
+
+    return true;
+  }
+
+  /**
+   * Remove the last node from the list.
+   * @pre The list is not empty.
+   * @return The node which was removed.
+   */
+  Node* RemoveLast()
+  {
+    DALI_ASSERT_DEBUG( 0u != mNodes.Count() );
+
+    Node* last = mNodes[ mNodes.Count() - 1u ];
+    mNodes.Remove( mNodes.End() - 1 );
+
+    last->SetListIndex( Node::INVALID_LIST_INDEX );
+
+    return last;
+  }
+
+  /**
+   * @return True if the list is empty.
+   */
+  bool Empty() const
+  {
+    return 0u == mNodes.Count();
+  }
+
+  /**
+   * @return The number of nodes in the list.
+   */
+  unsigned int Count() const
+  {
+    return mNodes.Count();
+  }
+
+  /**
+   * @return An iterator to the first node.
+   */
+  Iterator Begin()
+  {
+    return mNodes.Begin();
+  }
+
+  /**
+   * @return An iterator past the last node.
+   */
+  Iterator End()
+  {
+    return mNodes.End();
+  }
+
+private:
+
+  // Undefined
+  NodeIndexList( const NodeIndexList& );
+
+  // Undefined
+  NodeIndexList& operator=( const NodeIndexList& rhs );
+
+private:
+
+  NodeContainer mNodes; ///< The nodes; not owned
+};
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_SCENE_GRAPH_NODE_INDEX_LIST_H__
@@ -20,6 +20,7 @@
 // INTERNAL INCLUDES
 #include <dali/internal/update/node-attachments/node-attachment.h>
 #include <dali/internal/update/common/discard-queue.h>
+#include <dali/internal/update/nodes/node-index-list.h>
 #include <dali/internal/render/shaders/shader.h>
 #include <dali/public-api/common/dali-common.h>
 #include <dali/public-api/common/constants.h>
@@ -35,6 +36,7 @@ namespace SceneGraph
 
 const PositionInheritanceMode Node::DEFAULT_POSITION_INHERITANCE_MODE( INHERIT_PARENT_POSITION );
 const ColorMode Node::DEFAULT_COLOR_MODE( USE_OWN_MULTIPLY_PARENT_ALPHA );
+const unsigned int Node::INVALID_LIST_INDEX( 0xFFFFFFFFu );
 
 Node* Node::New()
 {
@@ -72,7 +74,9 @@ Node::Node()
   mDirtyFlags(AllFlags),
   mGeometryScale( Vector3::ONE ),
   mInitialVolume( Vector3::ONE ),
-  mExclusiveRenderTask( NULL )
+  mWorldBoundingSphere( 0.0f, 0.0f, 0.0f, -1.0f ),
+  mExclusiveRenderTask( NULL ),
+  mListIndex( INVALID_LIST_INDEX )
 {
 }
 
@@ -123,7 +127,7 @@ void Node::ConnectChild( Node* childNode )
   mChildren.PushBack( childNode );
 }
 
-void Node::DisconnectChild( BufferIndex updateBufferIndex, Node& childNode, std::set<Node*>& connectedNodes,  std::set<Node*>& disconnectedNodes )
+void Node::DisconnectChild( BufferIndex updateBufferIndex, Node& childNode, NodeIndexList& connectedNodes, NodeIndexList& disconnectedNodes )
 {
   DALI_ASSERT_ALWAYS( this != &childNode );
   DALI_ASSERT_ALWAYS( childNode.GetParent() == this );
@@ -204,7 +208,7 @@ void Node::InheritShader(Shader* defaultShader)
 
 int Node::GetDirtyFlags() const
 {
-  // get initial dirty flags, they are reset ResetDefaultProperties, but setters may have made the node dirty already
+  // get initial dirty flags, they are cleared by ClearDirtyFlags(), but setters may have made the node dirty already
   int flags = mDirtyFlags;
   const bool sizeFlag = mSize.IsClean();
 
@@ -285,7 +289,7 @@ void Node::SetParent(Node& parentNode)
   mParent = &parentNode;
 }
 
-void Node::RecursiveDisconnectFromSceneGraph( BufferIndex updateBufferIndex, std::set<Node*>& connectedNodes,  std::set<Node*>& disconnectedNodes )
+void Node::RecursiveDisconnectFromSceneGraph( BufferIndex updateBufferIndex, NodeIndexList& connectedNodes, NodeIndexList& disconnectedNodes )
 {
   DALI_ASSERT_ALWAYS(!mIsRoot);
   DALI_ASSERT_ALWAYS(mParent != NULL);
@@ -310,9 +314,9 @@ void Node::RecursiveDisconnectFromSceneGraph( BufferIndex updateBufferIndex, std
   mChildren.Clear();
 
   // Move into disconnectedNodes
-  std::set<Node*>::size_type removed = connectedNodes.erase( this );
+  bool removed = connectedNodes.Remove( this );
   DALI_ASSERT_ALWAYS( removed );
-  disconnectedNodes.insert( this );
+  disconnectedNodes.Add( this );
 }
 
 } // namespace SceneGraph
@@ -23,6 +23,7 @@
 #include <dali/public-api/math/quaternion.h>
 #include <dali/public-api/math/math-utils.h>
 #include <dali/public-api/math/vector3.h>
+#include <dali/public-api/math/vector4.h>
 #include <dali/internal/common/message.h>
 #include <dali/internal/common/event-to-update.h>
 #include <dali/internal/update/common/animatable-property.h>
@@ -53,6 +54,7 @@ class DiscardQueue;
 class Layer;
 class Shader;
 class NodeAttachment;
+class NodeIndexList;
 class RenderTask;
 class UpdateManager;
 
@@ -96,6 +98,7 @@ public:
   // Defaults
   static const PositionInheritanceMode DEFAULT_POSITION_INHERITANCE_MODE;
   static const ColorMode DEFAULT_COLOR_MODE;
+  static const unsigned int INVALID_LIST_INDEX; ///< The list index of a Node which is not in a NodeIndexList
 
   // Creation methods
 
@@ -128,6 +131,24 @@ public:
     return mIsActive;
   }
 
+  /**
+   * Set the index of this Node within the NodeIndexList which contains it.
+   * @param[in] index The index, or INVALID_LIST_INDEX if the Node is not in a list.
+   */
+  void SetListIndex( unsigned int index )
+  {
+    mListIndex = index;
+  }
+
+  /**
+   * Retrieve the index of this Node within the NodeIndexList which contains it.
+   * @return The index, or INVALID_LIST_INDEX if the Node is not in a list.
+   */
+  unsigned int GetListIndex() const
+  {
+    return mListIndex;
+  }
+
   /**
    * Called during UpdateManager::DestroyNode shortly before Node is destroyed.
    */
@@ -236,7 +257,7 @@ public:
    * @param[in] connectedNodes Disconnected Node attachments should be removed from here.
    * @param[in] disconnectedNodes Disconnected Node attachments should be added here.
    */
-  void DisconnectChild( BufferIndex updateBufferIndex, Node& childNode, std::set<Node*>& connectedNodes,  std::set<Node*>& disconnectedNodes );
+  void DisconnectChild( BufferIndex updateBufferIndex, Node& childNode, NodeIndexList& connectedNodes, NodeIndexList& disconnectedNodes );
 
   /**
    * Retrieve the children a Node.
@@ -339,6 +360,15 @@ public:
     mDirtyFlags = AllFlags;
   }
 
+  /**
+   * Clear the flags set with SetDirtyFlag(); this should be called once the node has been updated.
+   * Flags derived from the animatable properties are cleared when the properties are reset.
+   */
+  void ClearDirtyFlags()
+  {
+    mDirtyFlags = NothingFlag;
+  }
+
   /**
    * Query whether a node is dirty.
    * @return The dirty flags
@@ -968,6 +998,29 @@ public:
     mWorldMatrix.CopyPrevious( updateBufferIndex );
   }
 
+  /**
+   * Set the world-space bounding sphere of the node's renderable; this is used for view-frustum culling.
+   * This is recalculated during the update algorithm, after the world matrix.
+   * @param[in] center The center of the sphere, in world coordinates.
+   * @param[in] radius The radius of the sphere, or a negative value if the node should never be culled.
+   */
+  void SetWorldBoundingSphere( const Vector3& center, float radius )
+  {
+    mWorldBoundingSphere.x = center.x;
+    mWorldBoundingSphere.y = center.y;
+    mWorldBoundingSphere.z = center.z;
+    mWorldBoundingSphere.w = radius;
+  }
+
+  /**
+   * Retrieve the world-space bounding sphere of the node's renderable.
+   * @return The center of the sphere in xyz, and the radius in w; the radius is negative if the node should never be culled.
+   */
+  const Vector4& GetWorldBoundingSphere() const
+  {
+    return mWorldBoundingSphere;
+  }
+
   /**
    * Mark the node as exclusive to a single RenderTask.
    * @param[in] renderTask The render-task, or NULL if the Node is not exclusive to a single RenderTask.
@@ -1090,7 +1143,7 @@ private:
    * @param[in] connectedNodes Disconnected Node attachments should be removed from here.
    * @param[in] disconnectedNodes Disconnected Node attachments should be added here.
    */
-  void RecursiveDisconnectFromSceneGraph( BufferIndex updateBufferIndex, std::set<Node*>& connectedNodes, std::set<Node*>& disconnectedNodes );
+  void RecursiveDisconnectFromSceneGraph( BufferIndex updateBufferIndex, NodeIndexList& connectedNodes, NodeIndexList& disconnectedNodes );
 
 public: // Default properties
 
@@ -1138,9 +1191,12 @@ protected:
 
   Vector3    mGeometryScale;    ///< Applied before calculating world transform.
   Vector3    mInitialVolume;    ///< Initial volume... TODO - need a better name
+  Vector4    mWorldBoundingSphere; ///< Bounding sphere of the renderable, calculated during the update algorithm.
 
   RenderTask* mExclusiveRenderTask; ///< Nodes can be marked as exclusive to a single RenderTask
 
+  unsigned int mListIndex; ///< The index of this Node within the NodeIndexList which contains it
+
   // Changes scope, should be at end of class
   DALI_LOG_OBJECT_STRING_DECLARATION;
 };
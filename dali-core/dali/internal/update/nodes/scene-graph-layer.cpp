@@ -45,8 +45,10 @@ Layer::Layer()
   mIsDefaultSortFunction( true )
 {
   // layer starts off dirty
-  mAllChildTransformsClean[ 0 ] = false;
-  mAllChildTransformsClean[ 1 ] = false;
+  for( unsigned int i = 0; i < NUM_SCENE_GRAPH_BUFFERS; ++i )
+  {
+    mAllChildTransformsClean[ i ] = false;
+  }
 }
 
 Layer::~Layer()
@@ -68,8 +70,10 @@ void Layer::SetSortFunction( Dali::Layer::SortFunctionType function )
     }
 
     // changing the sort function makes the layer dirty
-    mAllChildTransformsClean[ 0 ] = false;
-    mAllChildTransformsClean[ 1 ] = false;
+    for( unsigned int i = 0; i < NUM_SCENE_GRAPH_BUFFERS; ++i )
+    {
+      mAllChildTransformsClean[ i ] = false;
+    }
     mSortFunction = function;
   }
 }
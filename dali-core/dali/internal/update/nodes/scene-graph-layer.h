@@ -141,11 +141,16 @@ public:
   }
 
   /**
-   * @return True if all children have been clean for two consequtive frames
+   * @return True if all children have been clean for two (or three, when triple-buffered) consequtive frames
    */
   bool CanReuseRenderers()
   {
-    return mAllChildTransformsClean[ 0 ] && mAllChildTransformsClean[ 1 ];
+    bool clean = true;
+    for( unsigned int i = 0; clean && i < NUM_SCENE_GRAPH_BUFFERS; ++i )
+    {
+      clean = mAllChildTransformsClean[ i ];
+    }
+    return clean;
   }
 
   /**
@@ -182,8 +187,8 @@ private:
   SortFunctionType mSortFunction; ///< Used to sort semi-transparent geometry
 
   ClippingBox mClippingBox;           ///< The clipping box, in window coordinates
-  bool mAllChildTransformsClean[ 2 ]; ///< True if all child nodes transforms are clean,
-                                      /// double buffered as we need two clean frames before we can reuse N-1 for N+1
+  bool mAllChildTransformsClean[ NUM_SCENE_GRAPH_BUFFERS ]; ///< True if all child nodes transforms are clean,
+                                      /// buffered as we need a clean frame for each buffer before we can reuse N-1 for N+1
                                       /// this allows us to cache render items when layer is "static"
   bool mIsClipping:1;                 ///< True when clipping is enabled
   bool mDepthTestDisabled:1;          ///< Whether depth test is disabled.
@@ -17,24 +17,11 @@
 // CLASS HEADER
 #include <dali/internal/update/queue/update-message-queue.h>
 
-// EXTERNAL INCLUDES
-#ifdef __clang__
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wall"
-#include <boost/thread/mutex.hpp>
-#pragma clang diagnostic pop
-#else
-#include <boost/thread/mutex.hpp>
-#endif // ifdef __clang
-
 // INTERNAL INCLUDES
-#include <dali/public-api/common/vector-wrapper.h>
 #include <dali/integration-api/render-controller.h>
-#include <dali/internal/common/message-buffer.h>
+#include <dali/internal/common/message-ring.h>
 #include <dali/internal/render/common/performance-monitor.h>
 
-using std::vector;
-
 using Dali::Integration::RenderController;
 using Dali::Internal::SceneGraph::SceneGraphBuffers;
 
@@ -48,16 +35,12 @@ namespace // unnamed namespace
 {
 
 // A message to set Actor::SIZE is 72 bytes on 32bit device
-// A buffer of size 32768 would store (32768 - 4) / (72 + 4) = 431 of those messages
-static const std::size_t INITIAL_BUFFER_SIZE =  32768;
-static const std::size_t MAX_BUFFER_CAPACITY = 73728; // Avoid keeping buffers which exceed this
-static const std::size_t MAX_FREE_BUFFER_COUNT = 3; // Allow this number of buffers to be recycled
+// A segment of size 32768 would store (32768 - 4) / (72 + 4) = 431 of those messages
+static const std::size_t SEGMENT_SIZE = 32768;
+static const std::size_t MAX_RING_CAPACITY = 131072; // Free recycled segments whilst the ring exceeds this
 
-// A queue of message buffers
-typedef vector< MessageBuffer* > MessageBufferQueue;
-typedef MessageBufferQueue::iterator MessageBufferIter;
-
-typedef boost::mutex MessageQueueMutex;
+// Passed with each batch of messages
+static const unsigned int SCENE_UPDATE_BATCH = 0x01; // At least one message in the batch requires a scene-graph node tree update
 
 } // unnamed namespace
 
@@ -75,68 +58,45 @@ struct MessageQueue::Impl
     processingEvents(false),
     queueWasEmpty(true),
     sceneUpdateFlag( false ),
+    messagesReserved( false ),
+    sceneUpdatesFlushed( 0u ),
+    sceneUpdatesProcessed( 0u ),
     sceneUpdate( 0 ),
-    currentMessageBuffer(NULL)
+    messageRing( SEGMENT_SIZE, MAX_RING_CAPACITY )
   {
   }
 
   ~Impl()
   {
-    // Delete the current buffer
-    delete currentMessageBuffer;
-
-    // Delete the unprocessed buffers
-    const MessageBufferIter processQueueEndIter = processQueue.end();
-    for ( MessageBufferIter iter = processQueue.begin(); iter != processQueueEndIter; ++iter )
-    {
-      MessageBuffer* unprocessedBuffer = *iter;
-      DeleteBufferContents( unprocessedBuffer );
-      delete unprocessedBuffer;
-    }
-
-    // Delete the recycled buffers
-    const MessageBufferIter recycleQueueEndIter = recycleQueue.end();
-    for ( MessageBufferIter iter = recycleQueue.begin(); iter != recycleQueueEndIter; ++iter )
-    {
-      MessageBuffer* recycledBuffer = *iter;
-      DeleteBufferContents( recycledBuffer );
-      delete recycledBuffer;
-    }
+    // Delete the unprocessed messages, including those which were not flushed
+    messageRing.Publish( 0u );
+    messageRing.AcquirePublished();
 
-    const MessageBufferIter freeQueueEndIter = freeQueue.end();
-    for ( MessageBufferIter iter = freeQueue.begin(); iter != freeQueueEndIter; ++iter )
-    {
-      MessageBuffer* freeBuffer = *iter;
-      DeleteBufferContents( freeBuffer );
-      delete freeBuffer;
-    }
-  }
-
-  void DeleteBufferContents( MessageBuffer* buffer )
-  {
-    for( MessageBuffer::Iterator iter = buffer->Begin(); iter.IsValid(); iter.Next() )
+    unsigned int batchData( 0u );
+    while( messageRing.HasAcquiredMessages() )
     {
-      MessageBase* message = reinterpret_cast< MessageBase* >( iter.Get() );
-
-      // Call virtual destructor explictly; since delete will not be called after placement new
-      message->~MessageBase();
+      MessageBase* message = reinterpret_cast< MessageBase* >( messageRing.Read( batchData ) );
+      if( message )
+      {
+        // Call virtual destructor explictly; since delete will not be called after placement new
+        message->~MessageBase();
+      }
     }
   }
 
-  RenderController&        renderController;     ///< render controller
-  const SceneGraphBuffers& sceneGraphBuffers;    ///< Used to keep track of which buffers are being written or read.
+  RenderController&        renderController;      ///< render controller
+  const SceneGraphBuffers& sceneGraphBuffers;     ///< Used to keep track of which buffers are being written or read.
 
-  bool                     processingEvents;     ///< Whether messages queued will be flushed by core
-  bool                     queueWasEmpty;        ///< Flag whether the queue was empty during the Update()
-  bool                     sceneUpdateFlag;      ///< true when there is a new message that requires a scene-graph node tree update
-  int                      sceneUpdate;          ///< Non zero when there is a message in the queue requiring a scene-graph node tree update
+  bool                     processingEvents;      ///< Whether messages queued will be flushed by core
+  bool                     queueWasEmpty;         ///< Flag whether the queue was empty during the Update()
+  bool                     sceneUpdateFlag;       ///< true when there is a new message that requires a scene-graph node tree update
+  bool                     messagesReserved;      ///< true when messages have been reserved since the last flush; used by the event-thread
 
-  MessageQueueMutex        queueMutex;           ///< queueMutex must be locked whilst accessing processQueue or recycleQueue
-  MessageBufferQueue       processQueue;         ///< to process in the next update
-  MessageBufferQueue       recycleQueue;         ///< to recycle MessageBuffers after the messages have been processed
+  volatile unsigned int    sceneUpdatesFlushed;   ///< The number of flushed batches requiring a scene-graph node tree update; written by the event-thread
+  unsigned int             sceneUpdatesProcessed; ///< The number of processed batches requiring a scene-graph node tree update; used by the update-thread
+  int                      sceneUpdate;           ///< Non zero when there is a message in the queue requiring a scene-graph node tree update
 
-  MessageBuffer*           currentMessageBuffer; ///< can be used without locking
-  MessageBufferQueue       freeQueue;            ///< buffers from the recycleQueue; can be used without locking
+  MessageRing              messageRing;           ///< Lock-free; messages are written by the event-thread, and processed by the update-thread
 };
 
 MessageQueue::MessageQueue( RenderController& controller, const SceneGraphBuffers& buffers )
@@ -164,32 +124,7 @@ unsigned int* MessageQueue::ReserveMessageSlot( std::size_t requestedSize, bool
     mImpl->sceneUpdateFlag = true;
   }
 
-  if ( !mImpl->currentMessageBuffer )
-  {
-    const MessageBufferIter endIter = mImpl->freeQueue.end();
-
-    // Find the largest recycled buffer from freeQueue
-    MessageBufferIter nextBuffer = endIter;
-    for ( MessageBufferIter iter = mImpl->freeQueue.begin(); iter != endIter; ++iter )
-    {
-      if ( endIter == nextBuffer ||
-           (*nextBuffer)->GetCapacity() < (*iter)->GetCapacity() )
-      {
-        nextBuffer = iter;
-      }
-    }
-
-    if ( endIter != nextBuffer )
-    {
-      // Reuse a recycled buffer from freeQueue
-      mImpl->currentMessageBuffer = *nextBuffer;
-      mImpl->freeQueue.erase( nextBuffer );
-    }
-    else
-    {
-      mImpl->currentMessageBuffer = new MessageBuffer( INITIAL_BUFFER_SIZE );
-    }
-  }
+  mImpl->messagesReserved = true;
 
   // If we are inside Core::ProcessEvents(), core will automatically flush the queue.
   // If we are outside, then we have to request a call to Core::ProcessEvents() on idle.
@@ -198,7 +133,7 @@ unsigned int* MessageQueue::ReserveMessageSlot( std::size_t requestedSize, bool
     mImpl->renderController.RequestProcessEventsOnIdle();
   }
 
-  return mImpl->currentMessageBuffer->ReserveMessageSlot( requestedSize );
+  return mImpl->messageRing.ReserveMessageSlot( requestedSize );
 }
 
 BufferIndex MessageQueue::GetEventBufferIndex() const
@@ -208,40 +143,25 @@ BufferIndex MessageQueue::GetEventBufferIndex() const
 
 bool MessageQueue::FlushQueue()
 {
-  const bool messagesToProcess = ( NULL != mImpl->currentMessageBuffer );
+  const bool messagesToProcess = mImpl->messagesReserved;
 
   // If there're messages to flush
   if ( messagesToProcess )
   {
-    // queueMutex must be locked whilst accessing processQueue or recycleQueue
-    MessageQueueMutex::scoped_lock lock( mImpl->queueMutex );
-
-    mImpl->processQueue.push_back( mImpl->currentMessageBuffer );
-    mImpl->currentMessageBuffer = NULL;
-
-    // Grab any recycled MessageBuffers
-    while ( !mImpl->recycleQueue.empty() )
-    {
-      MessageBuffer* recycled = mImpl->recycleQueue.back();
-      mImpl->recycleQueue.pop_back();
-
-      // Guard against excessive message buffer growth
-      if ( MAX_FREE_BUFFER_COUNT < mImpl->freeQueue.size() ||
-           MAX_BUFFER_CAPACITY   < recycled->GetCapacity() )
-      {
-        delete recycled;
-      }
-      else
-      {
-        mImpl->freeQueue.push_back( recycled );
-      }
-    }
+    unsigned int batchData( 0u );
 
     if( mImpl->sceneUpdateFlag )
     {
-      mImpl->sceneUpdate |= 2;
+      batchData |= SCENE_UPDATE_BATCH;
       mImpl->sceneUpdateFlag = false;
+
+      // Allow the update-thread to check for a scene update, before the batch is processed
+      __sync_add_and_fetch( &mImpl->sceneUpdatesFlushed, 1u );
     }
+
+    // The event-thread does not wait for the update-thread
+    mImpl->messageRing.Publish( batchData );
+    mImpl->messagesReserved = false;
   }
 
   mImpl->processingEvents = false;
@@ -253,34 +173,40 @@ void MessageQueue::ProcessMessages()
 {
   PERF_MONITOR_START(PerformanceMonitor::PROCESS_MESSAGES);
 
-  // queueMutex must be locked whilst accessing queue
-  MessageQueueMutex::scoped_lock lock( mImpl->queueMutex );
+  MessageRing& messageRing = mImpl->messageRing;
+
+  bool processedBatch( false );
 
-  const MessageBufferIter processQueueEndIter = mImpl->processQueue.end();
-  for ( MessageBufferIter iter = mImpl->processQueue.begin(); iter != processQueueEndIter ; ++iter )
+  // Process the batches flushed so far; any flushed whilst processing will wait for the next update
+  messageRing.AcquirePublished();
+
+  unsigned int batchData( 0u );
+  while( messageRing.HasAcquiredMessages() )
   {
-    MessageBuffer* buffer = *iter;
+    MessageBase* message = reinterpret_cast< MessageBase* >( messageRing.Read( batchData ) );
 
-    for( MessageBuffer::Iterator iter = buffer->Begin(); iter.IsValid(); iter.Next() )
+    if( message )
     {
-      MessageBase* message = reinterpret_cast< MessageBase* >( iter.Get() );
-
       message->Process( mImpl->sceneGraphBuffers.GetUpdateBufferIndex() );
 
       // Call virtual destructor explictly; since delete will not be called after placement new
       message->~MessageBase();
     }
-    buffer->Reset();
-
-    // Pass back for use in the event-thread
-    mImpl->recycleQueue.push_back( buffer );
+    else
+    {
+      // End of a batch
+      if( batchData & SCENE_UPDATE_BATCH )
+      {
+        ++mImpl->sceneUpdatesProcessed;
+        mImpl->sceneUpdate |= 2;
+      }
+      mImpl->sceneUpdate >>= 1;
 
-    mImpl->sceneUpdate >>= 1;
+      processedBatch = true;
+    }
   }
 
-  mImpl->queueWasEmpty = mImpl->processQueue.empty(); // Flag whether we processed anything
-
-  mImpl->processQueue.clear();
+  mImpl->queueWasEmpty = !processedBatch; // Flag whether we processed anything
 
   PERF_MONITOR_END(PerformanceMonitor::PROCESS_MESSAGES);
 }
@@ -292,7 +218,7 @@ bool MessageQueue::WasEmpty() const
 
 bool MessageQueue::IsSceneUpdateRequired() const
 {
-  return mImpl->sceneUpdate;
+  return mImpl->sceneUpdate || ( mImpl->sceneUpdatesFlushed != mImpl->sceneUpdatesProcessed );
 }
 
 } // namespace Update
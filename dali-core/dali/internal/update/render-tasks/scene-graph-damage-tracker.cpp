@@ -0,0 +1,286 @@
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// CLASS HEADER
+#include <dali/internal/update/render-tasks/scene-graph-damage-tracker.h>
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <cstring>
+
+// INTERNAL INCLUDES
+#include <dali/public-api/math/math-utils.h>
+#include <dali/internal/update/nodes/node.h>
+#include <dali/internal/update/nodes/scene-graph-layer.h>
+#include <dali/internal/update/node-attachments/scene-graph-renderable-attachment.h>
+#include <dali/internal/render/common/render-instruction.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+namespace
+{
+
+unsigned int gLastDamageTrackerId = 0u; ///< Only used by the update thread
+
+/**
+ * Orders items by renderable, so the items of consecutive frames can be merged
+ */
+struct CompareRenderables
+{
+  template< typename ItemType >
+  bool operator()( const ItemType& lhs, const ItemType& rhs ) const
+  {
+    return lhs.renderable < rhs.renderable;
+  }
+};
+
+/**
+ * Grows damaged bounds to include other bounds.
+ * @param[in,out] damage The damaged bounds; left > right when nothing is damaged yet.
+ * @param[in] bounds The bounds to include.
+ */
+inline void AddDamage( Vector4& damage, const Vector4& bounds )
+{
+  damage.x = std::min( damage.x, bounds.x );
+  damage.y = std::min( damage.y, bounds.y );
+  damage.z = std::max( damage.z, bounds.z );
+  damage.w = std::max( damage.w, bounds.w );
+}
+
+/**
+ * Calculates the bounds of a renderable in normalized device coordinates.
+ * The renderable is bounded by the size of its node, as when it is culled against the view-frustum.
+ * @param[in] updateBufferIndex The current update buffer index.
+ * @param[in] renderable The renderable.
+ * @param[in] viewProjection The view-projection matrix of the render-task.
+ * @param[out] bounds The left, bottom, right and top bounds.
+ * @return False if the bounds are unknown, or the renderable crosses the plane of the camera.
+ */
+bool CalculateBounds( BufferIndex updateBufferIndex, const RenderableAttachment& renderable, const Matrix& viewProjection, Vector4& bounds )
+{
+  const Node& node = renderable.GetParent();
+
+  // A negative radius means the renderable is not bounded by the node size
+  const Vector4& boundingSphere = node.GetWorldBoundingSphere();
+  if( boundingSphere.w < 0.0f ||
+      node.GetInhibitLocalTransform() )
+  {
+    return false;
+  }
+
+  const Vector3 halfSize( node.GetSize( updateBufferIndex ) * node.GetWorldScale( updateBufferIndex ) * 0.5f );
+  const Quaternion& rotation = node.GetWorldRotation( updateBufferIndex );
+
+  // Flat renderables only have four distinct corners
+  const unsigned int cornerCount = EqualsZero( halfSize.z ) ? 4u : 8u;
+
+  bounds = Vector4( 1.0f, 1.0f, -1.0f, -1.0f );
+  for( unsigned int corner = 0u; corner < cornerCount; ++corner )
+  {
+    const Vector3 offset( ( corner & 1u ) ? halfSize.x : -halfSize.x,
+                          ( corner & 2u ) ? halfSize.y : -halfSize.y,
+                          ( corner & 4u ) ? halfSize.z : -halfSize.z );
+    const Vector3 position( Vector3( boundingSphere ) + rotation.Rotate( offset ) );
+    const Vector4 clipPosition( viewProjection * Vector4( position.x, position.y, position.z, 1.0f ) );
+
+    if( clipPosition.w < Math::MACHINE_EPSILON_1000 )
+    {
+      return false;
+    }
+
+    const float x = clipPosition.x / clipPosition.w;
+    const float y = clipPosition.y / clipPosition.w;
+    if( 0u == corner )
+    {
+      bounds = Vector4( x, y, x, y );
+    }
+    else
+    {
+      AddDamage( bounds, Vector4( x, y, x, y ) );
+    }
+  }
+
+  return true;
+}
+
+} // unnamed namespace
+
+DamageTracker::DamageTracker()
+: mItems(),
+  mPreviousItems(),
+  mOrders(),
+  mViewProjection(),
+  mViewport(),
+  mClearColor(),
+  mId( ++gLastDamageTrackerId ),
+  mIsViewportSet( false ),
+  mIsClearColorSet( false ),
+  mPreviousValid( false )
+{
+}
+
+DamageTracker::~DamageTracker()
+{
+}
+
+void DamageTracker::CalculateDamage( BufferIndex updateBufferIndex, const SortedLayerPointers& sortedLayers, RenderInstruction& instruction )
+{
+  Matrix viewProjection( false );
+  Matrix::Multiply( viewProjection, *instruction.mViewMatrix, *instruction.mProjectionMatrix );
+
+  mItems.clear();
+
+  bool valid = true;
+  const SortedLayersConstIter endIter = sortedLayers.end();
+  for ( SortedLayersConstIter iter = sortedLayers.begin(); iter != endIter; ++iter )
+  {
+    const Layer& layer = **iter;
+
+    // The order matches PrepareRenderInstruction()
+    valid = AddItems( updateBufferIndex, layer.stencilRenderables, viewProjection ) && valid;
+    valid = AddItems( updateBufferIndex, layer.opaqueRenderables, viewProjection ) && valid;
+    valid = AddItems( updateBufferIndex, layer.transparentRenderables, viewProjection ) && valid;
+    valid = AddItems( updateBufferIndex, layer.overlayRenderables, viewProjection ) && valid;
+  }
+
+  std::sort( mItems.begin(), mItems.end(), CompareRenderables() );
+
+  // Anything which affects every pixel of the render-task damages all of it
+  bool fullyDamaged = !valid || !mPreviousValid ||
+                      ( 0 != memcmp( viewProjection.AsFloat(), mViewProjection.AsFloat(), sizeof( float ) * 16u ) ) ||
+                      ( instruction.mIsViewportSet != mIsViewportSet ) ||
+                      ( instruction.mIsViewportSet && instruction.mViewport != mViewport ) ||
+                      ( instruction.mIsClearColorSet != mIsClearColorSet ) ||
+                      ( instruction.mIsClearColorSet && instruction.mClearColor != mClearColor );
+
+  Vector4 damage( 1.0f, 1.0f, -1.0f, -1.0f );
+  if( !fullyDamaged )
+  {
+    fullyDamaged = !CompareItems( damage );
+  }
+
+  instruction.mDamageTrackerId = mId;
+  instruction.mIsFullyDamaged = fullyDamaged;
+  if( !fullyDamaged && damage.x <= damage.z && damage.y <= damage.w )
+  {
+    instruction.mDamagedArea = Rect<float>( damage.x, damage.y, damage.z - damage.x, damage.w - damage.y );
+  }
+  else
+  {
+    instruction.mDamagedArea = Rect<float>();
+  }
+
+  mItems.swap( mPreviousItems );
+  mViewProjection = viewProjection;
+  mViewport = instruction.mViewport;
+  mClearColor = instruction.mClearColor;
+  mIsViewportSet = instruction.mIsViewportSet;
+  mIsClearColorSet = instruction.mIsClearColorSet;
+  mPreviousValid = valid;
+}
+
+void DamageTracker::Reset()
+{
+  mPreviousItems.clear();
+  mPreviousValid = false;
+}
+
+bool DamageTracker::AddItems( BufferIndex updateBufferIndex, const RenderableAttachmentContainer& renderables, const Matrix& viewProjection )
+{
+  bool valid = true;
+
+  Item item;
+  const RenderableAttachmentContainer::const_iterator endIter = renderables.end();
+  for( RenderableAttachmentContainer::const_iterator iter = renderables.begin(); iter != endIter; ++iter )
+  {
+    const RenderableAttachment& renderable = **iter;
+
+    item.renderable = &renderable;
+    item.order = mItems.size();
+    item.damaged = renderable.IsDamaged();
+    if( !CalculateBounds( updateBufferIndex, renderable, viewProjection, item.bounds ) )
+    {
+      valid = false;
+    }
+    mItems.push_back( item );
+  }
+
+  return valid;
+}
+
+bool DamageTracker::CompareItems( Vector4& damage )
+{
+  mOrders.clear();
+
+  ItemContainer::const_iterator current = mItems.begin();
+  ItemContainer::const_iterator previous = mPreviousItems.begin();
+  const ItemContainer::const_iterator currentEnd = mItems.end();
+  const ItemContainer::const_iterator previousEnd = mPreviousItems.end();
+
+  while( current != currentEnd || previous != previousEnd )
+  {
+    if( previous == previousEnd ||
+        ( current != currentEnd && current->renderable < previous->renderable ) )
+    {
+      // Added since the previous frame
+      AddDamage( damage, current->bounds );
+      ++current;
+    }
+    else if( current == currentEnd ||
+             previous->renderable < current->renderable )
+    {
+      // Removed since the previous frame
+      AddDamage( damage, previous->bounds );
+      ++previous;
+    }
+    else
+    {
+      if( current->damaged || current->bounds != previous->bounds )
+      {
+        AddDamage( damage, previous->bounds );
+        AddDamage( damage, current->bounds );
+      }
+      mOrders.push_back( std::make_pair( current->order, previous->order ) );
+      ++current;
+      ++previous;
+    }
+  }
+
+  // The renderables drawn in both frames must be drawn in the same order
+  std::sort( mOrders.begin(), mOrders.end() );
+  for( OrderContainer::size_type index = 1u; index < mOrders.size(); ++index )
+  {
+    if( mOrders[ index ].second < mOrders[ index - 1u ].second )
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
@@ -0,0 +1,135 @@
+#ifndef __DALI_INTERNAL_SCENE_GRAPH_DAMAGE_TRACKER_H__
+#define __DALI_INTERNAL_SCENE_GRAPH_DAMAGE_TRACKER_H__
+
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// INTERNAL INCLUDES
+#include <dali/public-api/common/vector-wrapper.h>
+#include <dali/public-api/math/matrix.h>
+#include <dali/public-api/math/vector4.h>
+#include <dali/public-api/math/viewport.h>
+#include <dali/internal/common/buffer-index.h>
+#include <dali/internal/update/manager/sorted-layers.h>
+#include <dali/internal/update/node-attachments/scene-graph-renderable-attachment-declarations.h>
+
+namespace Dali
+{
+
+namespace Internal
+{
+
+namespace SceneGraph
+{
+
+class RenderInstruction;
+
+/**
+ * Works out which area of the screen an on-screen render-task has to redraw.
+ * The screen bounds of the renderables drawn in a frame are compared with those of the previous frame;
+ * renderables which moved, appeared, disappeared or were marked as damaged by the update algorithm
+ * damage both their previous and current bounds.
+ * Renderables which are not bounded by the size of their node (custom shader effects, meshes etc.),
+ * camera changes, reordering and changes to the viewport or clear color damage the whole render-task.
+ */
+class DamageTracker
+{
+public:
+
+  /**
+   * Constructor
+   */
+  DamageTracker();
+
+  /**
+   * Non-virtual destructor
+   */
+  ~DamageTracker();
+
+  /**
+   * Calculates the area damaged since the previous frame, and writes it to the render-instruction.
+   * @pre The render-instruction has been prepared from the renderables of the sorted layers.
+   * @param[in] updateBufferIndex The current update buffer index.
+   * @param[in] sortedLayers The layers containing the renderables of the render-task.
+   * @param[in,out] instruction The render-instruction of the render-task.
+   */
+  void CalculateDamage( BufferIndex updateBufferIndex, const SortedLayerPointers& sortedLayers, RenderInstruction& instruction );
+
+  /**
+   * Forgets the previous frame; the next frame will be fully damaged.
+   */
+  void Reset();
+
+private:
+
+  /**
+   * The screen bounds of a renderable in a frame
+   */
+  struct Item
+  {
+    const RenderableAttachment* renderable; ///< Identifies the renderable
+    Vector4                     bounds;     ///< Left, bottom, right and top bounds in normalized device coordinates
+    unsigned int                order;      ///< The position of the renderable in the drawing order
+    bool                        damaged;    ///< Whether the renderable changed since the previous frame
+  };
+
+  typedef std::vector< Item > ItemContainer;
+  typedef std::vector< std::pair< unsigned int, unsigned int > > OrderContainer;
+
+  /**
+   * Adds the bounds of renderables to mItems.
+   * @param[in] updateBufferIndex The current update buffer index.
+   * @param[in] renderables The renderables, in drawing order.
+   * @param[in] viewProjection The view-projection matrix of the render-task.
+   * @return False if the bounds of a renderable are unknown.
+   */
+  bool AddItems( BufferIndex updateBufferIndex, const RenderableAttachmentContainer& renderables, const Matrix& viewProjection );
+
+  /**
+   * Compares mItems with mPreviousItems; both must be sorted by renderable.
+   * @param[out] damage The damaged bounds, in normalized device coordinates.
+   * @return False if the drawing order of the renderables changed.
+   */
+  bool CompareItems( Vector4& damage );
+
+  // Undefined
+  DamageTracker( const DamageTracker& );
+
+  // Undefined
+  DamageTracker& operator=( const DamageTracker& rhs );
+
+private:
+
+  ItemContainer  mItems;             ///< The renderables of the current frame
+  ItemContainer  mPreviousItems;     ///< The renderables of the previous frame, sorted by renderable
+  OrderContainer mOrders;            ///< The current and previous drawing order of the renderables in both frames
+
+  Matrix         mViewProjection;    ///< The view-projection matrix of the previous frame
+  Viewport       mViewport;          ///< The viewport of the previous frame
+  Vector4        mClearColor;        ///< The clear color of the previous frame
+  unsigned int   mId;                ///< Identifies the tracker to the render thread
+  bool           mIsViewportSet:1;   ///< Whether the viewport was set in the previous frame
+  bool           mIsClearColorSet:1; ///< Whether the clear color was set in the previous frame
+  bool           mPreviousValid:1;   ///< Whether the bounds of the previous frame are all known
+};
+
+} // namespace SceneGraph
+
+} // namespace Internal
+
+} // namespace Dali
+
+#endif // __DALI_INTERNAL_SCENE_GRAPH_DAMAGE_TRACKER_H__
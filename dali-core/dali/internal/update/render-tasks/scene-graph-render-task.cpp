@@ -408,6 +408,13 @@ const Matrix& RenderTask::GetProjectionMatrix( BufferIndex bufferIndex ) const
   return mCameraAttachment->GetProjectionMatrix( bufferIndex );
 }
 
+bool RenderTask::IsSphereInsideFrustum( BufferIndex bufferIndex, const Vector3& center, float radius ) const
+{
+  DALI_ASSERT_DEBUG( NULL != mCameraAttachment );
+
+  return mCameraAttachment->IsSphereInsideFrustum( bufferIndex, center, radius );
+}
+
 void RenderTask::PrepareRenderInstruction( RenderInstruction& instruction, BufferIndex updateBufferIndex )
 {
   TASK_LOG(Debug::General);
@@ -507,7 +514,8 @@ RenderTask::RenderTask()
           : RENDER_ONCE_WAITING_FOR_RESOURCES ),
   mRefreshRate( Dali::RenderTask::DEFAULT_REFRESH_RATE ),
   mFrameCounter( 0u ),
-  mRenderedOnceCounter( 0u )
+  mRenderedOnceCounter( 0u ),
+  mDamageTracker()
 {
 }
 
@@ -26,6 +26,7 @@
 #include <dali/internal/update/common/double-buffered.h>
 #include <dali/internal/update/common/property-owner.h>
 #include <dali/internal/update/common/animatable-property.h>
+#include <dali/internal/update/render-tasks/scene-graph-damage-tracker.h>
 
 namespace Dali
 {
@@ -279,6 +280,16 @@ public:
    */
   const Matrix& GetProjectionMatrix( BufferIndex bufferIndex ) const;
 
+  /**
+   * Query whether a world-space bounding sphere is at least partially inside the view-frustum of the camera.
+   * @pre GetCameraNode() returns a node with valid CameraAttachment.
+   * @param[in] bufferIndex The buffer to read from.
+   * @param[in] center The center of the sphere, in world coordinates.
+   * @param[in] radius The radius of the sphere.
+   * @return False if the sphere is entirely outside the view-frustum, true otherwise.
+   */
+  bool IsSphereInsideFrustum( BufferIndex bufferIndex, const Vector3& center, float radius ) const;
+
   /**
    * Prepares the render-instruction buffer to be populated with instructions.
    * @param[out] instruction to prepare
@@ -291,6 +302,15 @@ public:
    */
   bool ViewMatrixUpdated();
 
+  /**
+   * Retrieve the tracker for the area of the screen which an on-screen render-task has to redraw.
+   * @return The damage tracker.
+   */
+  DamageTracker& GetDamageTracker()
+  {
+    return mDamageTracker;
+  }
+
   /**
    * Set the complete status tracker.
    * @param[in] completeStatusManager The complete status Tracker (not owned)
@@ -340,6 +360,8 @@ private:
 
   unsigned int mRenderedOnceCounter;  ///< Incremented whenever state changes to RENDERED_ONCE_AND_NOTIFIED
 
+  DamageTracker mDamageTracker;       ///< Works out which area of the screen has changed since the previous frame
+
 };
 
 // Messages for RenderTask
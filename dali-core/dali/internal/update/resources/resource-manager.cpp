@@ -143,6 +143,7 @@ struct ResourceManager::ResourceManagerImpl
    * When the resources are eventually deleted, the ID will be removed from the dead container.
    */
   LiveRequestContainer loadingRequests;
+  LiveRequestContainer partialRequests;       ///< loading bitmaps whose partial result has a texture (must also be in loadingRequests)
   LiveRequestContainer newCompleteRequests;
   LiveRequestContainer oldCompleteRequests;
   LiveRequestContainer newFailedRequests;
@@ -532,7 +533,8 @@ void ResourceManager::HandleSaveResourceRequest( ResourceId id, const ResourceTy
     {
       mImpl->saveRequests.insert(id);
 
-      ResourceRequest request(id, *typePath.type, typePath.path, resource);
+      // Nothing is waiting for the resource to be saved
+      ResourceRequest request(id, *typePath.type, typePath.path, resource, LoadPriorityLow);
       mImpl->mPlatformAbstraction.SaveResource(request);
     }
   }
@@ -566,6 +568,9 @@ void ResourceManager::HandleDiscardResourceRequest( ResourceId deadId, ResourceT
     foundLiveRequest = wasLoading = RemoveId(mImpl->loadingRequests, deadId);
   }
 
+  // A partially loaded image has a texture, even though it is still loading
+  const bool wasPartial = RemoveId(mImpl->partialRequests, deadId);
+
   // Try removing from the new completed requests
   if (!foundLiveRequest)
   {
@@ -605,6 +610,11 @@ void ResourceManager::HandleDiscardResourceRequest( ResourceId deadId, ResourceT
       mImpl->deadRequests.insert(DeadRequestPair(deadId, typeId));
     }
   }
+  else if (wasPartial)
+  {
+    mImpl->mBitmapMetadata.erase( deadId );
+    mImpl->mTextureCacheDispatcher.DispatchDiscardTexture( deadId );
+  }
 
   if (wasLoading)
   {
@@ -660,6 +670,11 @@ bool ResourceManager::IsResourceLoaded(ResourceId id)
   return loaded;
 }
 
+bool ResourceManager::IsResourcePartiallyLoaded(ResourceId id)
+{
+  return mImpl->partialRequests.find(id) != mImpl->partialRequests.end();
+}
+
 bool ResourceManager::IsResourceLoadFailed(ResourceId id)
 {
   bool loadFailed = false;
@@ -761,7 +776,6 @@ void ResourceManager::LoadResponse( ResourceId id, ResourceTypeId type, Resource
     {
       case ResourceBitmap:
       {
-        DALI_ASSERT_DEBUG( loadStatus == RESOURCE_COMPLETELY_LOADED && "Partial results not handled for image loading.\n" );
         Bitmap* const bitmap = static_cast<Bitmap*>( resource.Get() );
         if( !bitmap )
         {
@@ -778,8 +792,18 @@ void ResourceManager::LoadResponse( ResourceId id, ResourceTypeId type, Resource
         }
         Pixel::Format pixelFormat = bitmap->GetPixelFormat();
 
-        ImageAttributes attrs = ImageAttributes::New( bitmapWidth, bitmapHeight, pixelFormat ); ///!< Issue #AHC01
-        UpdateImageTicket (id, attrs);
+        if( loadStatus == RESOURCE_COMPLETELY_LOADED )
+        {
+          ImageAttributes attrs = ImageAttributes::New( bitmapWidth, bitmapHeight, pixelFormat ); ///!< Issue #AHC01
+          UpdateImageTicket (id, attrs);
+          mImpl->partialRequests.erase( id );
+        }
+        else
+        {
+          // A low resolution version of a progressively loaded image; it is drawn until the
+          // whole image arrives, but the ticket keeps the size the image will have.
+          mImpl->partialRequests.insert( id );
+        }
 
         // Check for reloaded bitmap
         BitmapMetadataIter iter = mImpl->mBitmapMetadata.find(id);
@@ -898,6 +922,13 @@ void ResourceManager::LoadFailed(ResourceId id, ResourceFailure failure)
     // Remove from the loading set
     mImpl->loadingRequests.erase(iter);
 
+    // Drop the texture of the low resolution version of a progressively loaded image
+    if( RemoveId( mImpl->partialRequests, id ) && !IsResourceLoaded( id ) )
+    {
+      mImpl->mBitmapMetadata.erase( id );
+      mImpl->mTextureCacheDispatcher.DispatchDiscardTexture( id );
+    }
+
     // Add the ID to the failed set, this will trigger a notification during UpdateTickets
     mImpl->newFailedRequests.insert(id);
 
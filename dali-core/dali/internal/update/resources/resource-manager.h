@@ -334,6 +334,13 @@ public: // Used by ResourceClient
    */
   bool IsResourceLoaded(ResourceId id);
 
+  /**
+   * Check if a low resolution version of a progressively loaded bitmap is available.
+   * @param[in] id The ID of a bitmap/texture resource.
+   * @return true if the bitmap is still loading, but a texture for its partial result exists
+   */
+  bool IsResourcePartiallyLoaded(ResourceId id);
+
   /**
    * Check if a resource has failed to load, e.g. file not found, etc.
    * @param[in] id The ID of a bitmap/texture resource.
@@ -22,6 +22,11 @@
 #include <math.h>
 #include <stdio.h>
 #include <time.h>
+#include <boost/thread/thread.hpp>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 // INTERNAL INCLUDES
 #include <dali/public-api/common/constants.h>
@@ -77,13 +82,39 @@ void ScaleField( int width, int height, float* in, int targetWidth, int targetHe
 #define SQUARE(a) ((a) * (a))
 const float MAX_DISTANCE( 1e20 );
 
+const unsigned int COLUMN_BLOCK_SIZE( 16u );                  ///< Number of columns copied together, so the image is read a row segment at a time
+const unsigned int MINIMUM_PIXELS_PER_THREAD( 128u * 128u );  ///< Smaller images are transformed by the calling thread only
+const unsigned int MAXIMUM_THREAD_COUNT( 4u );                ///< Maximum number of threads transforming an image
+
+/**
+ * Scratch memory for the distance transforms of one thread.
+ */
+struct TransformBuffers
+{
+  /**
+   * Constructor
+   * @param[in] width The width of the image
+   * @param[in] height The height of the image
+   */
+  TransformBuffers( unsigned int width, unsigned int height )
+  : columns( COLUMN_BLOCK_SIZE * height ),
+    result( std::max( width, height ) ),
+    parabolas( std::max( width, height ) ),
+    edges( std::max( width, height ) + 1u )
+  {
+  }
+
+  std::vector<float> columns;   ///< A block of columns, each one stored contiguously
+  std::vector<float> result;    ///< The transform of a single row or column
+  std::vector<int>   parabolas; ///< Locations of parabolas in lower envelope
+  std::vector<float> edges;     ///< Locations of boundaries between parabolas
+};
+
 /**
  * Distance transform of 1D function using squared distance
  */
-void DistanceTransform( float *source, float* dest, unsigned int length )
+void DistanceTransform( const float* source, float* dest, unsigned int length, int* parabolas, float* edge )
 {
-  int parabolas[length];    // Locations of parabolas in lower envelope
-  float edge[length + 1];   // Locations of boundaries between parabolas
   int rightmost(0);         // Index of rightmost parabola in lower envelope
 
   parabolas[0] = 0;
@@ -119,41 +150,199 @@ void DistanceTransform( float *source, float* dest, unsigned int length )
 }
 
 /**
- * Distance transform of 2D function using squared distance
+ * Distance transform along a range of columns.
+ * The columns are copied a block at a time, reading whole row segments, rather than one at a time.
  */
-void DistanceTransform( float* data, unsigned int width, unsigned int height, float* sourceBuffer, float* destBuffer )
+void TransformColumns( float* data, unsigned int width, unsigned int height, unsigned int firstColumn, unsigned int endColumn, TransformBuffers& buffers )
 {
-  // transform along columns
-  for( unsigned int x = 0; x < width; ++x )
+  float* columns( &buffers.columns[0] );
+  float* result( &buffers.result[0] );
+
+  for( unsigned int blockStart = firstColumn; blockStart < endColumn; blockStart += COLUMN_BLOCK_SIZE )
   {
+    const unsigned int blockWidth( std::min( COLUMN_BLOCK_SIZE, endColumn - blockStart ) );
+
     for( unsigned int y = 0; y < height; ++y )
     {
-      sourceBuffer[y] = data[ y * width + x ];
+      const float* row( data + y * width + blockStart );
+      for( unsigned int x = 0; x < blockWidth; ++x )
+      {
+        columns[ x * height + y ] = row[x];
+      }
     }
 
-    DistanceTransform( sourceBuffer, destBuffer, height );
+    for( unsigned int x = 0; x < blockWidth; ++x )
+    {
+      float* column( columns + x * height );
+      DistanceTransform( column, result, height, &buffers.parabolas[0], &buffers.edges[0] );
+      std::copy( result, result + height, column );
+    }
 
-    for( unsigned int y = 0; y < height; y++ )
+    for( unsigned int y = 0; y < height; ++y )
     {
-      data[y * width + x] = destBuffer[y];
+      float* row( data + y * width + blockStart );
+      for( unsigned int x = 0; x < blockWidth; ++x )
+      {
+        row[x] = columns[ x * height + y ];
+      }
     }
   }
+}
+
+/**
+ * Distance transform along a range of rows.
+ */
+void TransformRows( float* data, unsigned int width, unsigned int firstRow, unsigned int endRow, TransformBuffers& buffers )
+{
+  float* result( &buffers.result[0] );
+
+  for( unsigned int y = firstRow; y < endRow; ++y )
+  {
+    float* row( data + y * width );
+    DistanceTransform( row, result, width, &buffers.parabolas[0], &buffers.edges[0] );
+    std::copy( result, result + width, row );
+  }
+}
 
-  // transform along rows
-  for( unsigned int y = 0; y < height; ++y )
+/**
+ * A band of columns or rows of an image, transformed by one thread.
+ */
+struct TransformBand
+{
+  void operator()() const
   {
-    for( unsigned int x = 0; x < width; ++x )
+    TransformBuffers buffers( width, height );
+    if( columns )
     {
-      sourceBuffer[x] = data[ y * width + x ];
+      TransformColumns( data, width, height, first, end, buffers );
     }
-
-    DistanceTransform( sourceBuffer, destBuffer, width );
-
-    for( unsigned int x = 0; x < width; x++ )
+    else
     {
-      data[y * width + x] = destBuffer[x];
+      TransformRows( data, width, first, end, buffers );
     }
   }
+
+  float*       data;    ///< The image
+  unsigned int width;   ///< The width of the image
+  unsigned int height;  ///< The height of the image
+  unsigned int first;   ///< The first column or row of the band
+  unsigned int end;     ///< One past the last column or row of the band
+  bool         columns; ///< Whether the band is made of columns or rows
+};
+
+/**
+ * Distance transform along all the columns, or all the rows, split in to bands transformed in parallel.
+ * Each column (or row) is independent of the others, so the result doesn't depend on the number of threads.
+ */
+void TransformInParallel( float* data, unsigned int width, unsigned int height, bool columns, unsigned int threadCount )
+{
+  const unsigned int length( columns ? width : height );
+
+  boost::thread_group threads;
+  TransformBand callerBand = { data, width, height, 0u, length / threadCount, columns };
+
+  for( unsigned int i = 1u; i < threadCount; ++i )
+  {
+    TransformBand band = { data, width, height, ( length * i ) / threadCount, ( length * ( i + 1u ) ) / threadCount, columns };
+    threads.create_thread( band );
+  }
+
+  // The calling thread transforms the first band, rather than waiting idle
+  callerBand();
+
+  threads.join_all();
+}
+
+/**
+ * Choose the number of threads to transform an image with.
+ */
+unsigned int GetTransformThreadCount( unsigned int width, unsigned int height )
+{
+  const unsigned int threadsForSize( ( width * height ) / MINIMUM_PIXELS_PER_THREAD );
+  const unsigned int threadsAvailable( std::min( boost::thread::hardware_concurrency(), MAXIMUM_THREAD_COUNT ) );
+
+  return std::max( 1u, std::min( threadsForSize, threadsAvailable ) );
+}
+
+/**
+ * Distance transform of 2D function using squared distance
+ */
+void DistanceTransform( float* data, unsigned int width, unsigned int height, unsigned int threadCount )
+{
+  if( threadCount > 1u )
+  {
+    TransformInParallel( data, width, height, true, threadCount );
+    TransformInParallel( data, width, height, false, threadCount );
+  }
+  else
+  {
+    TransformBuffers buffers( width, height );
+
+    // transform along columns
+    TransformColumns( data, width, height, 0u, width, buffers );
+
+    // transform along rows
+    TransformRows( data, width, 0u, height, buffers );
+  }
+}
+
+/**
+ * Combine the outside and inside distances in to the bipolar distance field, stored in outside.
+ * distmap = outside - inside
+ */
+void CombineDistances( float* outside, const float* inside, unsigned int count )
+{
+  unsigned int i( 0u );
+
+#if defined(__SSE2__)
+  // Four pixels at a time; the SSE operations, including the square root, round exactly as the scalar ones do
+  const __m128 zero( _mm_setzero_ps() );
+  const __m128 centre( _mm_set1_ps( 128.0f ) );
+  const __m128 scale( _mm_set1_ps( 16.0f ) );
+  const __m128 maximum( _mm_set1_ps( 255.0f ) );
+
+  for( ; i + 4u <= count; i += 4u )
+  {
+    __m128 pixel( _mm_sub_ps( _mm_sqrt_ps( _mm_loadu_ps( outside + i ) ), _mm_sqrt_ps( _mm_loadu_ps( inside + i ) ) ) );
+    pixel = _mm_add_ps( centre, _mm_mul_ps( pixel, scale ) );
+    pixel = _mm_max_ps( _mm_min_ps( pixel, maximum ), zero );
+    _mm_storeu_ps( outside + i, _mm_div_ps( _mm_sub_ps( maximum, pixel ), maximum ) );
+  }
+#endif
+
+  for( ; i < count; ++i )
+  {
+    float pixel( sqrtf(outside[i]) - sqrtf(inside[i]) );
+    pixel = 128.0f + pixel * 16.0f;
+    pixel = Clamp( pixel, 0.0f, 255.0f );
+    outside[i] = (255.0f - pixel) / 255.0f;
+  }
+}
+
+/**
+ * Convert the distance field from floats in the range [0,1] to bytes.
+ */
+void ConvertToBytes( const float* field, unsigned char* distanceMap, unsigned int count )
+{
+  unsigned int i( 0u );
+
+#if defined(__SSE2__)
+  const __m128 scale( _mm_set1_ps( 255.0f ) );
+
+  for( ; i + 4u <= count; i += 4u )
+  {
+    // truncate to integers as static_cast does, then pack to bytes; the values are already in [0,255]
+    const __m128i integers( _mm_cvttps_epi32( _mm_mul_ps( _mm_loadu_ps( field + i ), scale ) ) );
+    const __m128i bytes( _mm_packus_epi16( _mm_packs_epi32( integers, integers ), integers ) );
+    const int packed( _mm_cvtsi128_si32( bytes ) );
+    std::copy( reinterpret_cast<const unsigned char*>( &packed ), reinterpret_cast<const unsigned char*>( &packed ) + 4u, distanceMap + i );
+  }
+#endif
+
+  for( ; i < count; ++i )
+  {
+    distanceMap[i] = static_cast< unsigned char >(field[i] * 255.0f);
+  }
 }
 
 } // namespace
@@ -190,65 +379,46 @@ void GenerateDistanceFieldMap(const unsigned char* const imagePixels, const Size
   float* outside( outsidePixels.data() );
   float* inside( insidePixels.data() );
 
-  for( int y = 0; y < paddedHeight; ++y )
+  // the border is outside the figure
+  std::fill( outside, outside + paddedWidth * paddedHeight, MAX_DISTANCE );
+  std::fill( inside, inside + paddedWidth * paddedHeight, 0.0f );
+
+  for( int y = 0; y < originalHeight; ++y )
   {
-    for ( int x = 0; x < paddedWidth; ++x)
+    const unsigned char* const sourceRow( imagePixels + y * originalWidth );
+    const int offset( ( y + fieldBorder ) * paddedWidth + fieldBorder );
+    float* const outsideRow( outside + offset );
+    float* const insideRow( inside + offset );
+
+    for ( int x = 0; x < originalWidth; ++x)
     {
-      if( y < (int)fieldBorder || y >= (paddedHeight - (int)fieldBorder) ||
-          x < (int)fieldBorder || x >= (paddedWidth - (int)fieldBorder) )
-      {
-        outside[ y * paddedWidth + x ] = MAX_DISTANCE;
-        inside[ y * paddedWidth + x ] = 0.0f;
-      }
-      else
-      {
-        unsigned int pixel( imagePixels[ (y - fieldBorder) * originalWidth + (x - fieldBorder) ] );
-        outside[ y * paddedWidth + x ] = (pixel == 0) ? MAX_DISTANCE : SQUARE((255 - pixel) / 255.0f);
-        inside[ y * paddedWidth + x ] = (pixel == 255) ? MAX_DISTANCE : SQUARE(pixel / 255.0f);
-      }
+      unsigned int pixel( sourceRow[x] );
+      outsideRow[x] = (pixel == 0) ? MAX_DISTANCE : SQUARE((255 - pixel) / 255.0f);
+      insideRow[x] = (pixel == 255) ? MAX_DISTANCE : SQUARE(pixel / 255.0f);
     }
   }
 
   // perform distance transform if high quality requested, else use original figure
   if( highQuality )
   {
-    // create temporary buffers for DistanceTransform()
-    const int tempBufferLength( std::max(paddedWidth, paddedHeight) );
-    std::vector<float> tempSourceBuffer( tempBufferLength, 0.0f );
-    std::vector<float> tempDestBuffer( tempBufferLength, 0.0f );
+    // large images are transformed by several threads
+    const unsigned int threadCount( GetTransformThreadCount( paddedWidth, paddedHeight ) );
 
     // Perform distance transform for pixels 'outside' the figure
-    DistanceTransform( outside, paddedWidth, paddedHeight, tempSourceBuffer.data(), tempDestBuffer.data() );
+    DistanceTransform( outside, paddedWidth, paddedHeight, threadCount );
 
     // Perform distance transform for pixels 'inside' the figure
-    DistanceTransform( inside, paddedWidth, paddedHeight, tempSourceBuffer.data(), tempDestBuffer.data() );
+    DistanceTransform( inside, paddedWidth, paddedHeight, threadCount );
   }
 
   // distmap = outside - inside; % Bipolar distance field
-  for( int y = 0; y < paddedHeight; ++y)
-  {
-    for( int x = 0; x < paddedWidth; ++x )
-    {
-      const int offset( y * paddedWidth + x );
-      float pixel( sqrtf(outside[offset]) - sqrtf(inside[offset]) );
-      pixel = 128.0f + pixel * 16.0f;
-      pixel = Clamp( pixel, 0.0f, 255.0f );
-      outside[offset] = (255.0f - pixel) / 255.0f;
-    }
-  }
+  CombineDistances( outside, inside, paddedWidth * paddedHeight );
 
   // scale the figure to the distance field tile size
   ScaleField( paddedWidth, paddedHeight, outside, scaledWidth, scaledHeight, inside );
 
   // convert from floats to integers
-  for( int y = 0; y < scaledHeight; ++y )
-  {
-    for( int x = 0; x < scaledWidth; ++x )
-    {
-      float pixel( inside[ y * scaledWidth + x ] );
-      distanceMap[y * scaledWidth + x ] = static_cast< unsigned char >(pixel * 255.0f);
-    }
-  }
+  ConvertToBytes( inside, distanceMap, scaledWidth * scaledHeight );
 }
 
 } // namespace Dali
@@ -36,6 +36,7 @@ struct ImageAttributes::ImageAttributesImpl
      pixelformat(Pixel::RGBA8888),
      crop(0.0f,0.0f,1.0f,1.0f),
      mOrientationCorrection(false),
+     mProgressiveLoading(false),
      isDistanceField(false),
      fieldRadius(4.0f),
      fieldBorder(4)
@@ -53,6 +54,7 @@ struct ImageAttributes::ImageAttributesImpl
     pixelformat( rhs.pixelformat ),
     crop( rhs.crop ),
     mOrientationCorrection( rhs.mOrientationCorrection ),
+    mProgressiveLoading( rhs.mProgressiveLoading ),
     isDistanceField( rhs.isDistanceField ),
     fieldRadius( rhs.fieldRadius ),
     fieldBorder( rhs.fieldBorder )
@@ -69,6 +71,7 @@ struct ImageAttributes::ImageAttributesImpl
       pixelformat = rhs.pixelformat;
       crop = rhs.crop;
       mOrientationCorrection = rhs.mOrientationCorrection;
+      mProgressiveLoading = rhs.mProgressiveLoading;
       isDistanceField = rhs.isDistanceField;
       fieldRadius = rhs.fieldRadius;
       fieldBorder = rhs.fieldBorder;
@@ -91,6 +94,7 @@ struct ImageAttributes::ImageAttributesImpl
   Rect<float>   crop;
 
   bool          mOrientationCorrection; ///< If true, image pixels are reordered according to orientation metadata on load.
+  bool          mProgressiveLoading;    ///< If true, a low resolution version of the image is delivered before the whole image.
 
   // For distance fields :
   bool          isDistanceField;  ///< true, if the image is a distancefield. Default is false.
@@ -153,6 +157,11 @@ void ImageAttributes::SetOrientationCorrection(const bool enabled)
   impl->mOrientationCorrection = enabled;
 }
 
+void ImageAttributes::SetProgressiveLoading(const bool enabled)
+{
+  impl->mProgressiveLoading = enabled;
+}
+
 unsigned int ImageAttributes::GetWidth() const
 {
   return impl->width;
@@ -203,6 +212,11 @@ bool ImageAttributes::GetOrientationCorrection() const
   return impl->mOrientationCorrection;
 }
 
+bool ImageAttributes::GetProgressiveLoading() const
+{
+  return impl->mProgressiveLoading;
+}
+
 ImageAttributes ImageAttributes::New()
 {
   return ImageAttributes();
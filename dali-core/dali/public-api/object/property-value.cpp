@@ -17,8 +17,10 @@
 // CLASS HEADER
 #include <dali/public-api/object/property-value.h>
 
+// EXTERNAL INCLUDES
+#include <cstring>
+
 // INTERNAL INCLUDES
-#include <dali/public-api/object/any.h>
 #include <dali/public-api/math/angle-axis.h>
 #include <dali/public-api/math/radian.h>
 #include <dali/public-api/math/vector2.h>
@@ -34,401 +36,400 @@
 namespace Dali
 {
 
+namespace
+{
+
+const unsigned int MATRIX3_SIZE = 9u;
+const unsigned int MATRIX_SIZE = 16u;
+
+} // unnamed namespace
+
+/**
+ * Holds the type and contents of a value.
+ * Fixed-size values are held inline, so creating or copying one makes a single allocation;
+ * only matrices, strings, arrays and maps allocate their contents separately.
+ */
 struct Property::Value::Impl
 {
-  Impl()
-  : mType( Property::NONE )
+  Impl( Type type )
+  : mType( type ),
+    mAngleAxis( false )
   {
   }
 
-  Impl(bool boolValue)
-  : mType( PropertyTypes::Get<bool>() ),
-    mValue( boolValue )
+  Impl( const Impl& impl )
+  : mType( Property::NONE ),
+    mAngleAxis( false )
   {
+    Copy( impl );
   }
 
-  Impl(float floatValue)
-  : mType( PropertyTypes::Get<float>() ),
-    mValue( floatValue )
+  ~Impl()
   {
+    Release();
   }
 
-  Impl(int integerValue)
-  : mType( PropertyTypes::Get<int>() ),
-    mValue( integerValue )
+  /**
+   * Query whether the contents of a value are allocated separately.
+   * @param[in] type The type of the value.
+   * @return True for matrices, strings, arrays and maps.
+   */
+  static bool IsAllocated( Type type )
   {
+    return ( Property::MATRIX3 == type ) || ( Property::MATRIX == type ) ||
+           ( Property::STRING == type ) || ( Property::ARRAY == type ) || ( Property::MAP == type );
   }
 
-  Impl(unsigned int unsignedIntegerValue)
-  : mType( PropertyTypes::Get<unsigned int>() ),
-    mValue( unsignedIntegerValue )
+  /**
+   * Copy the type and contents of another value.
+   * @pre The previous contents have been released.
+   * @param[in] impl The value to copy.
+   */
+  void Copy( const Impl& impl )
   {
-  }
+    mType = impl.mType;
+    mAngleAxis = impl.mAngleAxis;
 
-  Impl(const Vector2& vectorValue)
-  : mType( PropertyTypes::Get<Vector2>() ),
-    mValue( vectorValue )
-  {
-  }
+    switch( mType )
+    {
+      case Property::MATRIX3:
+      {
+        mMatrix = new float[ MATRIX3_SIZE ];
+        memcpy( mMatrix, impl.mMatrix, MATRIX3_SIZE * sizeof(float) );
+        break;
+      }
 
-  Impl(const Vector3& vectorValue)
-  : mType( PropertyTypes::Get<Vector3>() ),
-    mValue( vectorValue )
-  {
-  }
+      case Property::MATRIX:
+      {
+        mMatrix = new float[ MATRIX_SIZE ];
+        memcpy( mMatrix, impl.mMatrix, MATRIX_SIZE * sizeof(float) );
+        break;
+      }
 
-  Impl(const Vector4& vectorValue)
-  : mType( PropertyTypes::Get<Vector4>() ),
-    mValue( vectorValue )
-  {
-  }
+      case Property::STRING:
+      {
+        mString = new std::string( *impl.mString );
+        break;
+      }
 
-  Impl(const Matrix3& matrixValue)
-  : mType(PropertyTypes::Get<Matrix3>()),
-    mValue(matrixValue)
-  {
-  }
+      case Property::ARRAY:
+      {
+        mArray = new Property::Array( *impl.mArray );
+        break;
+      }
 
-  Impl(const Matrix& matrixValue)
-  : mType(PropertyTypes::Get<Matrix>()),
-    mValue(matrixValue)
-  {
-  }
+      case Property::MAP:
+      {
+        mMap = new Property::Map( *impl.mMap );
+        break;
+      }
 
-  Impl(const AngleAxis& angleAxisValue)
-  : mType( PropertyTypes::Get<AngleAxis>() ),
-    mValue( angleAxisValue )
-  {
+      case Property::NONE:
+      case Property::BOOLEAN:
+      case Property::FLOAT:
+      case Property::INTEGER:
+      case Property::UNSIGNED_INTEGER:
+      case Property::VECTOR2:
+      case Property::VECTOR3:
+      case Property::VECTOR4:
+      case Property::RECTANGLE:
+      case Property::ROTATION:
+      case Property::TYPE_COUNT:
+      {
+        // Fixed-size values are copied inline
+        memcpy( mFloats, impl.mFloats, sizeof(mFloats) );
+        break;
+      }
+    }
   }
 
-  Impl(const Quaternion& quaternionValue)
-  : mType( PropertyTypes::Get<Quaternion>() ),
-    mValue( quaternionValue )
+  /**
+   * Delete the contents which were allocated separately.
+   */
+  void Release()
   {
-  }
+    switch( mType )
+    {
+      case Property::MATRIX3:
+      case Property::MATRIX:
+      {
+        delete [] mMatrix;
+        break;
+      }
 
-  Impl(const std::string& stringValue)
-    : mType( PropertyTypes::Get<std::string>() ),
-      mValue( stringValue )
-  {
-  }
+      case Property::STRING:
+      {
+        delete mString;
+        break;
+      }
 
-  Impl(const Rect<int>& rect)
-    : mType( PropertyTypes::Get<Rect<int> >() ),
-      mValue( rect )
-  {
-  }
+      case Property::ARRAY:
+      {
+        delete mArray;
+        break;
+      }
 
-  Impl(Property::Map container)
-    : mType( PropertyTypes::Get<Property::Map >() ),
-      mValue( container )
-  {
+      case Property::MAP:
+      {
+        delete mMap;
+        break;
+      }
+
+      case Property::NONE:
+      case Property::BOOLEAN:
+      case Property::FLOAT:
+      case Property::INTEGER:
+      case Property::UNSIGNED_INTEGER:
+      case Property::VECTOR2:
+      case Property::VECTOR3:
+      case Property::VECTOR4:
+      case Property::RECTANGLE:
+      case Property::ROTATION:
+      case Property::TYPE_COUNT:
+      {
+        // Nothing was allocated
+        break;
+      }
+    }
+
+    mType = Property::NONE;
   }
 
-  Impl(Property::Array container)
-    : mType( PropertyTypes::Get<Property::Array >() ),
-      mValue( container )
+  Type mType;        ///< The type of the value
+  bool mAngleAxis;   ///< Whether a Property::ROTATION value is held as an angle-axis, rather than a quaternion
+
+  union
   {
-  }
+    bool             mBool;
+    int              mInteger;
+    unsigned int     mUnsignedInteger;
+    float            mFloats[4];    ///< The components of floating-point, vector and rotation values
+    int              mIntegers[4];  ///< The components of an integer rectangle
+    float*           mMatrix;       ///< The elements of a matrix
+    std::string*     mString;
+    Property::Array* mArray;
+    Property::Map*   mMap;
+  };
 
-  Type mType;
+private:
 
-  typedef Any AnyValue;
-  AnyValue mValue;
+  // Undefined
+  Impl& operator=( const Impl& );
 };
 
 Property::Value::Value()
-: mImpl( NULL )
+: mImpl( new Impl( Property::NONE ) )
 {
-  mImpl = new Impl();
 }
 
 Property::Value::Value(bool boolValue)
-: mImpl( NULL )
+: mImpl( new Impl( Property::BOOLEAN ) )
 {
-  mImpl = new Impl( boolValue );
+  mImpl->mBool = boolValue;
 }
 
 Property::Value::Value(float floatValue)
-: mImpl( NULL )
+: mImpl( new Impl( Property::FLOAT ) )
 {
-  mImpl = new Impl( floatValue );
+  mImpl->mFloats[0] = floatValue;
 }
 
 Property::Value::Value(int integerValue)
-: mImpl( NULL )
+: mImpl( new Impl( Property::INTEGER ) )
 {
-  mImpl = new Impl( integerValue );
+  mImpl->mInteger = integerValue;
 }
 
 Property::Value::Value(unsigned int unsignedIntegerValue)
-: mImpl( NULL )
+: mImpl( new Impl( Property::UNSIGNED_INTEGER ) )
 {
-  mImpl = new Impl( unsignedIntegerValue );
+  mImpl->mUnsignedInteger = unsignedIntegerValue;
 }
 
 Property::Value::Value(const Vector2& vectorValue)
-: mImpl( NULL )
+: mImpl( new Impl( Property::VECTOR2 ) )
 {
-  mImpl = new Impl( vectorValue );
+  mImpl->mFloats[0] = vectorValue.x;
+  mImpl->mFloats[1] = vectorValue.y;
 }
 
 Property::Value::Value(const Vector3& vectorValue)
-: mImpl( NULL )
+: mImpl( new Impl( Property::VECTOR3 ) )
 {
-  mImpl = new Impl( vectorValue );
+  mImpl->mFloats[0] = vectorValue.x;
+  mImpl->mFloats[1] = vectorValue.y;
+  mImpl->mFloats[2] = vectorValue.z;
 }
 
 Property::Value::Value(const Vector4& vectorValue)
-: mImpl( NULL )
+: mImpl( new Impl( Property::VECTOR4 ) )
 {
-  mImpl = new Impl( vectorValue );
+  mImpl->mFloats[0] = vectorValue.x;
+  mImpl->mFloats[1] = vectorValue.y;
+  mImpl->mFloats[2] = vectorValue.z;
+  mImpl->mFloats[3] = vectorValue.w;
 }
 
 Property::Value::Value(const Matrix3& matrixValue)
-: mImpl( NULL )
+: mImpl( new Impl( Property::MATRIX3 ) )
 {
-  mImpl = new Impl( matrixValue );
+  mImpl->mMatrix = new float[ MATRIX3_SIZE ];
+  memcpy( mImpl->mMatrix, matrixValue.AsFloat(), MATRIX3_SIZE * sizeof(float) );
 }
 
 Property::Value::Value(const Matrix& matrixValue)
-: mImpl( NULL )
+: mImpl( new Impl( Property::MATRIX ) )
 {
-  mImpl = new Impl( matrixValue );
+  mImpl->mMatrix = new float[ MATRIX_SIZE ];
+  memcpy( mImpl->mMatrix, matrixValue.AsFloat(), MATRIX_SIZE * sizeof(float) );
 }
 
 Property::Value::Value(const Rect<int>& rect)
-: mImpl( NULL )
+: mImpl( new Impl( Property::RECTANGLE ) )
 {
-  mImpl = new Impl( rect );
+  mImpl->mIntegers[0] = rect.x;
+  mImpl->mIntegers[1] = rect.y;
+  mImpl->mIntegers[2] = rect.width;
+  mImpl->mIntegers[3] = rect.height;
 }
 
 Property::Value::Value(const AngleAxis& angleAxisValue)
-: mImpl( NULL )
+: mImpl( new Impl( Property::ROTATION ) )
 {
-  mImpl = new Impl( angleAxisValue );
+  mImpl->mAngleAxis = true;
+  mImpl->mFloats[0] = angleAxisValue.angle;
+  mImpl->mFloats[1] = angleAxisValue.axis.x;
+  mImpl->mFloats[2] = angleAxisValue.axis.y;
+  mImpl->mFloats[3] = angleAxisValue.axis.z;
 }
 
 Property::Value::Value(const Quaternion& quaternionValue)
+: mImpl( new Impl( Property::ROTATION ) )
 {
-  mImpl = new Impl( quaternionValue );
+  mImpl->mFloats[0] = quaternionValue.mVector.x;
+  mImpl->mFloats[1] = quaternionValue.mVector.y;
+  mImpl->mFloats[2] = quaternionValue.mVector.z;
+  mImpl->mFloats[3] = quaternionValue.mVector.w;
 }
 
 Property::Value::Value(const std::string& stringValue)
+: mImpl( new Impl( Property::STRING ) )
 {
-  mImpl = new Impl( stringValue );
+  mImpl->mString = new std::string( stringValue );
 }
 
 Property::Value::Value(const char *stringValue)
+: mImpl( new Impl( Property::STRING ) )
 {
-  mImpl = new Impl( std::string(stringValue) );
+  mImpl->mString = new std::string( stringValue );
 }
 
 Property::Value::Value(Property::Array &arrayValue)
+: mImpl( new Impl( Property::ARRAY ) )
 {
-  mImpl = new Impl( arrayValue );
+  mImpl->mArray = new Property::Array( arrayValue );
 }
 
 Property::Value::Value(Property::Map &mapValue)
+: mImpl( new Impl( Property::MAP ) )
 {
-  mImpl = new Impl( mapValue );
+  mImpl->mMap = new Property::Map( mapValue );
 }
 
-
 Property::Value::~Value()
 {
   delete mImpl;
 }
 
 Property::Value::Value(const Value& value)
+: mImpl( new Impl( *value.mImpl ) )
 {
-  switch (value.GetType())
-  {
-    case Property::BOOLEAN:
-    {
-      mImpl = new Impl( value.Get<bool>() );
-      break;
-    }
-
-    case Property::FLOAT:
-    {
-      mImpl = new Impl( value.Get<float>() );
-      break;
-    }
-
-    case Property::INTEGER:
-    {
-      mImpl = new Impl( value.Get<int>() );
-      break;
-    }
-
-    case Property::UNSIGNED_INTEGER:
-    {
-      mImpl = new Impl( value.Get<unsigned int>() );
-      break;
-    }
-
-    case Property::VECTOR2:
-    {
-      mImpl = new Impl( value.Get<Vector2>() );
-      break;
-    }
-
-    case Property::VECTOR3:
-    {
-      mImpl = new Impl( value.Get<Vector3>() );
-      break;
-    }
-
-    case Property::VECTOR4:
-    {
-      mImpl = new Impl( value.Get<Vector4>() );
-      break;
-    }
-
-    case Property::RECTANGLE:
-    {
-      mImpl = new Impl( value.Get<Rect<int> >() );
-      break;
-    }
-
-    case Property::ROTATION:
-    {
-      mImpl = new Impl( value.Get<Quaternion>() );
-      break;
-    }
-
-    case Property::MATRIX3:
-    {
-      mImpl = new Impl( value.Get<Matrix3>());
-      break;
-    }
-
-    case Property::MATRIX:
-    {
-      mImpl = new Impl( value.Get<Matrix>());
-      break;
-    }
-
-    case Property::STRING:
-    {
-      mImpl = new Impl( value.Get<std::string>() );
-      break;
-    }
-
-    case Property::MAP:
-    {
-      mImpl = new Impl( value.Get<Property::Map>() );
-      break;
-    }
-
-    case Property::ARRAY:
-    {
-      mImpl = new Impl( value.Get<Property::Array>() );
-      break;
-    }
-
-    case Property::NONE: // fall
-    default:
-    {
-      mImpl = new Impl();
-      break;
-    }
-  }
 }
 
 Property::Value::Value(Type type)
+: mImpl( new Impl( type ) )
 {
   switch (type)
   {
     case Property::BOOLEAN:
     {
-      mImpl = new Impl( false );
-      break;
-    }
-
-    case Property::FLOAT:
-    {
-      mImpl = new Impl( 0.f );
+      mImpl->mBool = false;
       break;
     }
 
     case Property::INTEGER:
     {
-      mImpl = new Impl( 0 );
+      mImpl->mInteger = 0;
       break;
     }
 
     case Property::UNSIGNED_INTEGER:
     {
-      mImpl = new Impl( 0U );
+      mImpl->mUnsignedInteger = 0U;
       break;
     }
 
+    case Property::FLOAT:
     case Property::VECTOR2:
-    {
-      mImpl = new Impl( Vector2::ZERO );
-      break;
-    }
-
     case Property::VECTOR3:
-    {
-      mImpl = new Impl( Vector3::ZERO );
-      break;
-    }
-
     case Property::VECTOR4:
     {
-      mImpl = new Impl( Vector4::ZERO );
+      memset( mImpl->mFloats, 0, sizeof(mImpl->mFloats) );
       break;
     }
 
     case Property::RECTANGLE:
     {
-      mImpl = new Impl( Rect<int>(0,0,0,0) );
+      memset( mImpl->mIntegers, 0, sizeof(mImpl->mIntegers) );
       break;
     }
 
     case Property::ROTATION:
     {
-      mImpl = new Impl( Quaternion(0.f, Vector4::YAXIS) );
+      const Quaternion identity( 0.f, Vector4::YAXIS );
+      mImpl->mFloats[0] = identity.mVector.x;
+      mImpl->mFloats[1] = identity.mVector.y;
+      mImpl->mFloats[2] = identity.mVector.z;
+      mImpl->mFloats[3] = identity.mVector.w;
       break;
     }
 
     case Property::STRING:
     {
-      mImpl = new Impl( std::string() );
+      mImpl->mString = new std::string();
       break;
     }
 
     case Property::MAP:
     {
-      mImpl = new Impl( Property::Map() );
+      mImpl->mMap = new Property::Map();
       break;
     }
 
     case Property::MATRIX:
     {
-      mImpl = new Impl( Matrix() );
+      mImpl->mMatrix = new float[ MATRIX_SIZE ];
+      memcpy( mImpl->mMatrix, Matrix().AsFloat(), MATRIX_SIZE * sizeof(float) );
       break;
     }
 
     case Property::MATRIX3:
     {
-      mImpl = new Impl( Matrix3() );
+      mImpl->mMatrix = new float[ MATRIX3_SIZE ];
+      memcpy( mImpl->mMatrix, Matrix3().AsFloat(), MATRIX3_SIZE * sizeof(float) );
       break;
     }
 
     case Property::ARRAY:
     {
-      mImpl = new Impl( Property::Array() );
+      mImpl->mArray = new Property::Array();
       break;
     }
 
     case Property::NONE: // fall
     default:
     {
-      mImpl = new Impl();
+      mImpl->mType = Property::NONE;
       break;
     }
   }
@@ -442,100 +443,17 @@ Property::Value& Property::Value::operator=(const Property::Value& value)
     return *this;
   }
 
-  mImpl->mType = value.GetType();
-
-  switch (mImpl->mType)
+  if( !Impl::IsAllocated( mImpl->mType ) && !Impl::IsAllocated( value.mImpl->mType ) )
   {
-    case Property::BOOLEAN:
-    {
-      mImpl->mValue = value.Get<bool>();
-      break;
-    }
-
-    case Property::FLOAT:
-    {
-      mImpl->mValue = value.Get<float>();
-      break;
-    }
-
-    case Property::INTEGER:
-    {
-      mImpl->mValue = value.Get<int>();
-      break;
-    }
-
-    case Property::UNSIGNED_INTEGER:
-    {
-      mImpl->mValue = value.Get<unsigned int>();
-      break;
-    }
-
-    case Property::VECTOR2:
-    {
-      mImpl->mValue = value.Get<Vector2>();
-      break;
-    }
-
-    case Property::VECTOR3:
-    {
-      mImpl->mValue = value.Get<Vector3>();
-      break;
-    }
-
-    case Property::VECTOR4:
-    {
-      mImpl->mValue = value.Get<Vector4>();
-      break;
-    }
-
-    case Property::RECTANGLE:
-    {
-      mImpl->mValue = value.Get<Rect<int> >();
-      break;
-    }
-
-    case Property::ROTATION:
-    {
-      mImpl->mValue = value.Get<Quaternion>();
-      break;
-    }
-
-    case Property::STRING:
-    {
-      mImpl->mValue = value.Get<std::string>();
-      break;
-    }
-
-    case Property::MATRIX:
-    {
-      mImpl->mValue = value.Get<Matrix>();
-      break;
-    }
-
-    case Property::MATRIX3:
-    {
-      mImpl->mValue = value.Get<Matrix3>();
-      break;
-    }
-
-    case Property::MAP:
-    {
-      mImpl->mValue = value.Get<Property::Map>();
-      break;
-    }
-
-    case Property::ARRAY:
-    {
-      mImpl->mValue = value.Get<Property::Array>();
-      break;
-    }
-
-    case Property::NONE: // fall
-    default:
-    {
-      mImpl->mValue = Impl::AnyValue(0);
-      break;
-    }
+    // Fixed-size values are copied into the existing implementation
+    mImpl->Copy( *value.mImpl );
+  }
+  else
+  {
+    // The value may be held within this map or array; copy it before releasing the container
+    Impl* impl = new Impl( *value.mImpl );
+    delete mImpl;
+    mImpl = impl;
   }
 
   return *this;
@@ -548,83 +466,91 @@ Property::Type Property::Value::GetType() const
 
 void Property::Value::Get(bool& boolValue) const
 {
-  DALI_ASSERT_DEBUG( Property::BOOLEAN == GetType() && "Property type invalid" );  // AnyCast does asserted type checking
+  DALI_ASSERT_ALWAYS( Property::BOOLEAN == GetType() && "Property type invalid" );
 
-  boolValue = AnyCast<bool>(mImpl->mValue);
+  boolValue = mImpl->mBool;
 }
 
 void Property::Value::Get(float& floatValue) const
 {
-  DALI_ASSERT_DEBUG( Property::FLOAT == GetType() && "Property type invalid" );
+  DALI_ASSERT_ALWAYS( Property::FLOAT == GetType() && "Property type invalid" );
 
-  floatValue = AnyCast<float>(mImpl->mValue);
+  floatValue = mImpl->mFloats[0];
 }
 
 void Property::Value::Get(int& integerValue) const
 {
-  DALI_ASSERT_DEBUG( Property::INTEGER == GetType() && "Property type invalid" );
+  DALI_ASSERT_ALWAYS( Property::INTEGER == GetType() && "Property type invalid" );
 
-  integerValue = AnyCast<int>(mImpl->mValue);
+  integerValue = mImpl->mInteger;
 }
 
 void Property::Value::Get(unsigned int& unsignedIntegerValue) const
 {
-  DALI_ASSERT_DEBUG( Property::UNSIGNED_INTEGER == GetType() && "Property type invalid" );
+  DALI_ASSERT_ALWAYS( Property::UNSIGNED_INTEGER == GetType() && "Property type invalid" );
 
-  unsignedIntegerValue = AnyCast<unsigned int>(mImpl->mValue);
+  unsignedIntegerValue = mImpl->mUnsignedInteger;
 }
 
 void Property::Value::Get(Vector2& vectorValue) const
 {
-  DALI_ASSERT_DEBUG( Property::VECTOR2 == GetType() && "Property type invalid" );
+  DALI_ASSERT_ALWAYS( Property::VECTOR2 == GetType() && "Property type invalid" );
 
-  vectorValue = AnyCast<Vector2>(mImpl->mValue);
+  vectorValue.x = mImpl->mFloats[0];
+  vectorValue.y = mImpl->mFloats[1];
 }
 
 void Property::Value::Get(Vector3& vectorValue) const
 {
-  DALI_ASSERT_DEBUG( Property::VECTOR3 == GetType() && "Property type invalid" );
+  DALI_ASSERT_ALWAYS( Property::VECTOR3 == GetType() && "Property type invalid" );
 
-  vectorValue = AnyCast<Vector3>(mImpl->mValue);
+  vectorValue.x = mImpl->mFloats[0];
+  vectorValue.y = mImpl->mFloats[1];
+  vectorValue.z = mImpl->mFloats[2];
 }
 
 void Property::Value::Get(Vector4& vectorValue) const
 {
-  DALI_ASSERT_DEBUG( Property::VECTOR4 == GetType() && "Property type invalid" );
+  DALI_ASSERT_ALWAYS( Property::VECTOR4 == GetType() && "Property type invalid" );
 
-  vectorValue = AnyCast<Vector4>(mImpl->mValue);
+  vectorValue.x = mImpl->mFloats[0];
+  vectorValue.y = mImpl->mFloats[1];
+  vectorValue.z = mImpl->mFloats[2];
+  vectorValue.w = mImpl->mFloats[3];
 }
 
 void Property::Value::Get(Matrix3& matrixValue) const
 {
-  DALI_ASSERT_DEBUG( Property::MATRIX3 == GetType() && "Property type invalid" );
-  matrixValue = AnyCast<Matrix3>(mImpl->mValue);
+  DALI_ASSERT_ALWAYS( Property::MATRIX3 == GetType() && "Property type invalid" );
+  memcpy( matrixValue.AsFloat(), mImpl->mMatrix, MATRIX3_SIZE * sizeof(float) );
 }
 
 void Property::Value::Get(Matrix& matrixValue) const
 {
-  DALI_ASSERT_DEBUG( Property::MATRIX == GetType() && "Property type invalid" );
-  matrixValue = AnyCast<Matrix>(mImpl->mValue);
+  DALI_ASSERT_ALWAYS( Property::MATRIX == GetType() && "Property type invalid" );
+  memcpy( matrixValue.AsFloat(), mImpl->mMatrix, MATRIX_SIZE * sizeof(float) );
 }
 
 void Property::Value::Get(Rect<int>& rect) const
 {
-  DALI_ASSERT_DEBUG( Property::RECTANGLE == GetType() && "Property type invalid" );
+  DALI_ASSERT_ALWAYS( Property::RECTANGLE == GetType() && "Property type invalid" );
 
-  rect = AnyCast<Rect<int> >(mImpl->mValue);
+  rect.x      = mImpl->mIntegers[0];
+  rect.y      = mImpl->mIntegers[1];
+  rect.width  = mImpl->mIntegers[2];
+  rect.height = mImpl->mIntegers[3];
 }
 
 void Property::Value::Get(AngleAxis& angleAxisValue) const
 {
   DALI_ASSERT_ALWAYS( Property::ROTATION == GetType() && "Property type invalid" );
 
-  // Rotations have two representations
-  DALI_ASSERT_DEBUG( typeid(Quaternion) == mImpl->mValue.GetType() ||
-                     typeid(AngleAxis)  == mImpl->mValue.GetType() );
+  const float* floats = mImpl->mFloats;
 
-  if ( typeid(Quaternion) == mImpl->mValue.GetType() )
+  // Rotations have two representations
+  if ( !mImpl->mAngleAxis )
   {
-    Quaternion quaternion = AnyCast<Quaternion>(mImpl->mValue);
+    Quaternion quaternion( Vector4( floats[0], floats[1], floats[2], floats[3] ) );
 
     Radian angleRadians(0.0f);
     quaternion.ToAxisAngle( angleAxisValue.axis, angleRadians );
@@ -632,56 +558,54 @@ void Property::Value::Get(AngleAxis& angleAxisValue) const
   }
   else
   {
-    angleAxisValue = AnyCast<AngleAxis>(mImpl->mValue);
+    angleAxisValue.angle = Degree( floats[0] );
+    angleAxisValue.axis = Vector3( floats[1], floats[2], floats[3] );
   }
 }
 
 void Property::Value::Get(Quaternion& quaternionValue) const
 {
-  DALI_ASSERT_DEBUG( Property::ROTATION == GetType() && "Property type invalid" );
+  DALI_ASSERT_ALWAYS( Property::ROTATION == GetType() && "Property type invalid" );
 
-  // Rotations have two representations
-  DALI_ASSERT_DEBUG( typeid(Quaternion) == mImpl->mValue.GetType() ||
-               typeid(AngleAxis)  == mImpl->mValue.GetType() );
+  const float* floats = mImpl->mFloats;
 
-  if ( typeid(Quaternion) == mImpl->mValue.GetType() )
+  // Rotations have two representations
+  if ( !mImpl->mAngleAxis )
   {
-    quaternionValue = AnyCast<Quaternion>(mImpl->mValue);
+    quaternionValue.mVector = Vector4( floats[0], floats[1], floats[2], floats[3] );
   }
   else
   {
-    AngleAxis angleAxis = AnyCast<AngleAxis>(mImpl->mValue);
-
-    quaternionValue = Quaternion( Radian(angleAxis.angle), angleAxis.axis );
+    quaternionValue = Quaternion( Radian( Degree( floats[0] ) ), Vector3( floats[1], floats[2], floats[3] ) );
   }
 }
 
 void Property::Value::Get(std::string &out) const
 {
-  DALI_ASSERT_DEBUG(Property::STRING == GetType() && "Property type invalid");
+  DALI_ASSERT_ALWAYS(Property::STRING == GetType() && "Property type invalid");
 
-  out = AnyCast<std::string>(mImpl->mValue);
+  out = *mImpl->mString;
 }
 
 void Property::Value::Get(Property::Array &out) const
 {
-  DALI_ASSERT_DEBUG(Property::ARRAY == GetType() && "Property type invalid");
+  DALI_ASSERT_ALWAYS(Property::ARRAY == GetType() && "Property type invalid");
 
-  out = AnyCast<Property::Array>(mImpl->mValue);
+  out = *mImpl->mArray;
 }
 
 void Property::Value::Get(Property::Map &out) const
 {
-  DALI_ASSERT_DEBUG(Property::MAP == GetType() && "Property type invalid");
+  DALI_ASSERT_ALWAYS(Property::MAP == GetType() && "Property type invalid");
 
-  out = AnyCast<Property::Map>(mImpl->mValue);
+  out = *mImpl->mMap;
 }
 
 Property::Value& Property::Value::GetValue(const std::string& key) const
 {
   DALI_ASSERT_DEBUG(Property::MAP == GetType() && "Property type invalid");
 
-  Property::Map *container = AnyCast<Property::Map>(&(mImpl->mValue));
+  Property::Map *container = ( Property::MAP == mImpl->mType ? mImpl->mMap : NULL );
 
   DALI_ASSERT_DEBUG(container);
 
@@ -710,7 +634,7 @@ bool Property::Value::HasKey(const std::string& key) const
 
   if( Property::MAP == GetType() )
   {
-    Property::Map *container = AnyCast<Property::Map>(&(mImpl->mValue));
+    Property::Map *container = ( Property::MAP == mImpl->mType ? mImpl->mMap : NULL );
 
     DALI_ASSERT_DEBUG(container && "Property::Map has no container?");
 
@@ -737,7 +661,7 @@ const std::string& Property::Value::GetKey(const int index) const
     case Property::MAP:
     {
       int i = 0;
-      Property::Map *container = AnyCast<Property::Map>(&(mImpl->mValue));
+      Property::Map *container = ( Property::MAP == mImpl->mType ? mImpl->mMap : NULL );
       DALI_ASSERT_DEBUG(container && "Property::Map has no container?");
       if(container)
       {
@@ -785,7 +709,7 @@ void Property::Value::SetValue(const std::string& key, const Property::Value &va
 {
   DALI_ASSERT_DEBUG(Property::MAP == GetType() && "Property type invalid");
 
-  Property::Map *container = AnyCast<Property::Map>(&(mImpl->mValue));
+  Property::Map *container = ( Property::MAP == mImpl->mType ? mImpl->mMap : NULL );
 
   if(container)
   {
@@ -811,7 +735,7 @@ Property::Value& Property::Value::GetItem(const int index) const
     case Property::MAP:
     {
       int i = 0;
-      Property::Map *container = AnyCast<Property::Map>(&(mImpl->mValue));
+      Property::Map *container = ( Property::MAP == mImpl->mType ? mImpl->mMap : NULL );
 
       DALI_ASSERT_DEBUG(container && "Property::Map has no container?");
       if(container)
@@ -833,7 +757,7 @@ Property::Value& Property::Value::GetItem(const int index) const
     case Property::ARRAY:
     {
       int i = 0;
-      Property::Array *container = AnyCast<Property::Array>(&(mImpl->mValue));
+      Property::Array *container = ( Property::ARRAY == mImpl->mType ? mImpl->mArray : NULL );
 
       DALI_ASSERT_DEBUG(container && "Property::Map has no container?");
       if(container)
@@ -887,7 +811,7 @@ void Property::Value::SetItem(const int index, const Property::Value &value)
   {
     case Property::MAP:
     {
-      Property::Map *container = AnyCast<Property::Map>(&(mImpl->mValue));
+      Property::Map *container = ( Property::MAP == mImpl->mType ? mImpl->mMap : NULL );
       if( container && index < static_cast<int>(container->size()) )
       {
         int i = 0;
@@ -905,7 +829,7 @@ void Property::Value::SetItem(const int index, const Property::Value &value)
 
     case Property::ARRAY:
     {
-      Property::Array *container = AnyCast<Property::Array>(&(mImpl->mValue));
+      Property::Array *container = ( Property::ARRAY == mImpl->mType ? mImpl->mArray : NULL );
       if( container && index < static_cast<int>(container->size()) )
       {
         (*container)[index] = value;
@@ -938,7 +862,7 @@ int Property::Value::AppendItem(const Property::Value &value)
 {
   DALI_ASSERT_DEBUG(Property::ARRAY == GetType() && "Property type invalid");
 
-  Property::Array *container = AnyCast<Property::Array>(&(mImpl->mValue));
+  Property::Array *container = ( Property::ARRAY == mImpl->mType ? mImpl->mArray : NULL );
 
   if(container)
   {
@@ -960,7 +884,7 @@ int Property::Value::GetSize() const
   {
     case Property::MAP:
     {
-      Property::Map *container = AnyCast<Property::Map>(&(mImpl->mValue));
+      Property::Map *container = ( Property::MAP == mImpl->mType ? mImpl->mMap : NULL );
       if(container)
       {
         ret = container->size();
@@ -970,7 +894,7 @@ int Property::Value::GetSize() const
 
     case Property::ARRAY:
     {
-      Property::Array *container = AnyCast<Property::Array>(&(mImpl->mValue));
+      Property::Array *container = ( Property::ARRAY == mImpl->mType ? mImpl->mArray : NULL );
       if(container)
       {
         ret = container->size();
@@ -1001,5 +925,4 @@ int Property::Value::GetSize() const
   return ret;
 }
 
-
 } // namespace Dali
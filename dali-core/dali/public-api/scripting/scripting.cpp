@@ -375,6 +375,13 @@ Image NewImage( const Property::Value& map )
       attributes.SetCrop( Rect<float>(v.x, v.y, v.z, v.w) );
     }
 
+    field = "progressive";
+    if( map.HasKey(field) )
+    {
+      DALI_ASSERT_ALWAYS(map.GetValue(field).GetType() == Property::BOOLEAN && "Image progressive property is not a boolean" );
+      attributes.SetProgressiveLoading( map.GetValue(field).Get<bool>() );
+    }
+
     if( map.HasKey("type") )
     {
       DALI_ASSERT_ALWAYS( map.GetValue("type").GetType() == Property::STRING );
@@ -68,6 +68,11 @@ bool Character::IsNewLine() const
   return mImpl->IsNewLine();
 }
 
+uint32_t Character::GetCodePoint() const
+{
+  return mImpl->GetCharacter();
+}
+
 Character::Character( Internal::Character* impl )
 : mImpl( impl )
 {
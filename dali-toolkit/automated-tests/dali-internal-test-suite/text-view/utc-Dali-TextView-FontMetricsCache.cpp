@@ -0,0 +1,253 @@
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <iostream>
+
+#include <stdlib.h>
+#include <sys/time.h>
+#include <tet_api.h>
+
+#include <dali/public-api/dali-core.h>
+#include <dali-toolkit/dali-toolkit.h>
+
+#include <dali-toolkit-test-suite-utils.h>
+
+// Internal headers are allowed here
+#include <dali-toolkit/internal/controls/text-view/font-metrics-cache.h>
+#include <dali-toolkit/internal/controls/text-view/text-view-impl.h>
+#include <dali-toolkit/internal/controls/text-view/text-view-processor.h>
+
+using namespace Dali;
+using namespace Dali::Toolkit;
+using namespace Dali::Toolkit::Internal;
+
+namespace
+{
+
+const Toolkit::Internal::TextView::LayoutParameters DEFAULT_LAYOUT_PARAMETERS;
+
+const std::string PARAGRAPH( "Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et dolore magna aliqua.\n" );
+
+/**
+ * Creates the layout info of the given text.
+ *
+ * @param[in] text The text.
+ * @param[out] relayoutData The layout info.
+ */
+void CreateTextInfo( const std::string& text, Toolkit::Internal::TextView::RelayoutData& relayoutData )
+{
+  MarkupProcessor::StyledTextArray styledText;
+  MarkupProcessor::GetStyledTextArray( text, styledText );
+
+  TextViewProcessor::CreateTextInfo( styledText,
+                                     DEFAULT_LAYOUT_PARAMETERS,
+                                     relayoutData );
+}
+
+/**
+ * Lays out the given text a number of times.
+ *
+ * @param[in] text The text.
+ * @param[in] iterations Number of times the text is laid out.
+ *
+ * @return The number of characters laid out per second.
+ */
+float LayOutCharactersPerSecond( const std::string& text, unsigned int iterations )
+{
+  MarkupProcessor::StyledTextArray styledText;
+  MarkupProcessor::GetStyledTextArray( text, styledText );
+
+  std::string plainString;
+  MarkupProcessor::GetPlainString( styledText, plainString );
+  const std::size_t numberOfCharacters = plainString.size();
+
+  timeval start, end;
+  gettimeofday( &start, NULL );
+
+  for( unsigned int i = 0; i < iterations; ++i )
+  {
+    Toolkit::Internal::TextView::RelayoutData relayoutData;
+    TextViewProcessor::CreateTextInfo( styledText,
+                                       DEFAULT_LAYOUT_PARAMETERS,
+                                       relayoutData );
+  }
+
+  gettimeofday( &end, NULL );
+
+  const float seconds = static_cast<float>( end.tv_sec - start.tv_sec ) + static_cast<float>( end.tv_usec - start.tv_usec ) * 0.000001f;
+
+  return ( seconds > 0.f ) ? static_cast<float>( numberOfCharacters * iterations ) / seconds : 0.f;
+}
+
+} // namespace
+
+static void Startup();
+static void Cleanup();
+
+extern "C" {
+  void (*tet_startup)() = Startup;
+  void (*tet_cleanup)() = Cleanup;
+}
+
+enum {
+  POSITIVE_TC_IDX = 0x01,
+  NEGATIVE_TC_IDX,
+};
+
+#define MAX_NUMBER_OF_TESTS 10000
+extern "C" {
+  struct tet_testlist tet_testlist[MAX_NUMBER_OF_TESTS];
+}
+
+// Add test functionality for all APIs in the class (Positive and Negative)
+TEST_FUNCTION( UtcDaliTextViewFontMetricsCacheFonts, POSITIVE_TC_IDX );     // Tests fonts are stored once per style and reused between relayouts.
+TEST_FUNCTION( UtcDaliTextViewFontMetricsCacheMetrics, POSITIVE_TC_IDX );   // Tests the cached metrics are the same as the ones retrieved from the font.
+TEST_FUNCTION( UtcDaliTextViewFontMetricsCacheClear, POSITIVE_TC_IDX );     // Tests the cache is cleared.
+TEST_FUNCTION( UtcDaliTextViewFontMetricsCacheBenchmark, POSITIVE_TC_IDX ); // Lays out long paragraphs and prints the characters laid out per second.
+
+// Called only once before first test is run.
+static void Startup()
+{
+}
+
+// Called only once after last test is run
+static void Cleanup()
+{
+}
+
+static void UtcDaliTextViewFontMetricsCacheFonts()
+{
+  ToolkitTestApplication application;
+
+  tet_infoline("UtcDaliTextViewFontMetricsCacheFonts : ");
+
+  TextViewProcessor::FontMetricsCache& cache = TextViewProcessor::FontMetricsCache::Get();
+  cache.Clear();
+
+  DALI_TEST_EQUALS( cache.GetNumberOfFonts(), 0u, TEST_LOCATION );
+
+  Toolkit::Internal::TextView::RelayoutData relayoutData;
+  CreateTextInfo( PARAGRAPH, relayoutData );
+
+  const std::size_t numberOfFonts = cache.GetNumberOfFonts();
+  DALI_TEST_CHECK( 0u != numberOfFonts );
+
+  // A second text-view with the same style doesn't add fonts.
+  Toolkit::Internal::TextView::RelayoutData otherRelayoutData;
+  CreateTextInfo( PARAGRAPH + PARAGRAPH, otherRelayoutData );
+
+  DALI_TEST_EQUALS( cache.GetNumberOfFonts(), numberOfFonts, TEST_LOCATION );
+
+  // A new point size adds a font.
+  TextStyle style;
+  style.SetFontPointSize( PointSize( 123.f ) );
+
+  const TextViewProcessor::FontMetricsCache::FontId fontId = cache.GetFontId( style );
+  DALI_TEST_EQUALS( cache.GetNumberOfFonts(), numberOfFonts + 1u, TEST_LOCATION );
+  DALI_TEST_EQUALS( cache.GetFontId( style ), fontId, TEST_LOCATION );
+
+  tet_result( TET_PASS );
+}
+
+static void UtcDaliTextViewFontMetricsCacheMetrics()
+{
+  ToolkitTestApplication application;
+
+  tet_infoline("UtcDaliTextViewFontMetricsCacheMetrics : ");
+
+  TextViewProcessor::FontMetricsCache& cache = TextViewProcessor::FontMetricsCache::Get();
+  cache.Clear();
+
+  TextStyle style;
+  style.SetFontPointSize( PointSize( 10.f ) );
+
+  const Font font = Font::New( FontParameters( style.GetFontName(), style.GetFontStyle(), style.GetFontPointSize() ) );
+  const TextViewProcessor::FontMetricsCache::FontId fontId = cache.GetFontId( style );
+
+  const TextViewProcessor::FontMetricsCache::FontMetrics& fontMetrics = cache.GetFontMetrics( fontId );
+  DALI_TEST_EQUALS( fontMetrics.mLineHeight, font.GetLineHeight(), TEST_LOCATION );
+  DALI_TEST_EQUALS( fontMetrics.mAscender, font.GetAscender(), TEST_LOCATION );
+  DALI_TEST_EQUALS( fontMetrics.mUnderlineThickness, font.GetUnderlineThickness(), TEST_LOCATION );
+  DALI_TEST_EQUALS( fontMetrics.mUnderlinePosition, font.GetUnderlinePosition(), TEST_LOCATION );
+
+  const Text text( std::string( "aZ \n" ) );
+  for( std::size_t index = 0; index < text.GetLength(); ++index )
+  {
+    const Character character = text[index];
+    const Font::Metrics metrics = font.GetMetrics( character );
+
+    // Retrieved twice; from the font and from the cache.
+    for( unsigned int i = 0; i < 2u; ++i )
+    {
+      const TextViewProcessor::FontMetricsCache::GlyphMetrics& glyphMetrics = cache.GetGlyphMetrics( fontId, character );
+      DALI_TEST_EQUALS( glyphMetrics.mAdvance, metrics.GetAdvance(), TEST_LOCATION );
+      DALI_TEST_EQUALS( glyphMetrics.mBearing, metrics.GetBearing(), TEST_LOCATION );
+      DALI_TEST_EQUALS( cache.IsGlyphSupported( fontId, character ), font.AllGlyphsSupported( character ), TEST_LOCATION );
+    }
+  }
+
+  tet_result( TET_PASS );
+}
+
+static void UtcDaliTextViewFontMetricsCacheClear()
+{
+  ToolkitTestApplication application;
+
+  tet_infoline("UtcDaliTextViewFontMetricsCacheClear : ");
+
+  TextViewProcessor::FontMetricsCache& cache = TextViewProcessor::FontMetricsCache::Get();
+
+  Toolkit::Internal::TextView::RelayoutData relayoutData;
+  CreateTextInfo( PARAGRAPH, relayoutData );
+  DALI_TEST_CHECK( 0u != cache.GetNumberOfFonts() );
+
+  cache.Clear();
+  DALI_TEST_EQUALS( cache.GetNumberOfFonts(), 0u, TEST_LOCATION );
+
+  // The text is laid out the same way after clearing the cache.
+  Toolkit::Internal::TextView::RelayoutData otherRelayoutData;
+  CreateTextInfo( PARAGRAPH, otherRelayoutData );
+
+  DALI_TEST_EQUALS( otherRelayoutData.mTextLayoutInfo.mWholeTextSize, relayoutData.mTextLayoutInfo.mWholeTextSize, TEST_LOCATION );
+  DALI_TEST_EQUALS( otherRelayoutData.mTextLayoutInfo.mNumberOfCharacters, relayoutData.mTextLayoutInfo.mNumberOfCharacters, TEST_LOCATION );
+
+  tet_result( TET_PASS );
+}
+
+static void UtcDaliTextViewFontMetricsCacheBenchmark()
+{
+  ToolkitTestApplication application;
+
+  tet_infoline("UtcDaliTextViewFontMetricsCacheBenchmark : ");
+
+  const unsigned int ITERATIONS = 10u;
+
+  std::string text;
+  while( text.size() < 10000u )
+  {
+    text += PARAGRAPH;
+  }
+
+  TextViewProcessor::FontMetricsCache::Get().Clear();
+
+  // The first layout fills the cache.
+  const float coldCharactersPerSecond = LayOutCharactersPerSecond( text, 1u );
+  const float warmCharactersPerSecond = LayOutCharactersPerSecond( text, ITERATIONS );
+
+  tet_printf( "Layout of %d characters: first %.0f characters/s, cached %.0f characters/s\n", text.size(), coldCharactersPerSecond, warmCharactersPerSecond );
+
+  tet_result( TET_PASS );
+}
@@ -0,0 +1,161 @@
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+#include <iostream>
+#include <sstream>
+
+#include <stdlib.h>
+#include <sys/time.h>
+#include <tet_api.h>
+
+#include <dali/public-api/dali-core.h>
+#include <dali-toolkit/public-api/builder/builder.h>
+#include <dali-toolkit-test-suite-utils.h>
+
+using namespace Dali;
+using namespace Toolkit;
+
+namespace
+{
+
+const unsigned int ACTOR_COUNT = 2000u;  ///< The number of actors in the generated scene
+const unsigned int ITERATIONS = 5u;      ///< The number of times the scene is loaded
+
+float GetMilliseconds( const timeval& start, const timeval& end )
+{
+  return static_cast<float>( end.tv_sec - start.tv_sec ) * 1000.0f +
+         static_cast<float>( end.tv_usec - start.tv_usec ) / 1000.0f;
+}
+
+/**
+ * Generate a scene of actors, where each actor sets the vector, rotation & colour properties a script typically would.
+ * @param[in] actorCount The number of actors in the scene.
+ * @return The JSON scene.
+ */
+std::string GenerateScene( unsigned int actorCount )
+{
+  std::ostringstream json;
+
+  json << "{\n"
+       << "  \"styles\":\n"
+       << "  {\n"
+       << "    \"basic-actor\": { \"type\":\"Actor\", \"parent-origin\":[0.5,0.5,0.5], \"anchor-point\":[0.5,0.5,0.5] }\n"
+       << "  },\n"
+       << "  \"stage\":\n"
+       << "  [\n";
+
+  for( unsigned int i = 0u; i < actorCount; ++i )
+  {
+    json << "    { \"name\":\"actor" << i << "\", \"type\":\"basic-actor\""
+         << ", \"position\":[" << i % 100u << "," << i / 100u << ",0]"
+         << ", \"size\":[10,10,1]"
+         << ", \"scale\":[1,1,1]"
+         << ", \"color\":[1.0,0.5,0.25,1.0]"
+         << ", \"rotation\":[" << i % 360u << ",0,0]"
+         << " }" << ( i + 1u < actorCount ? ",\n" : "\n" );
+  }
+
+  json << "  ]\n"
+       << "}\n";
+
+  return json.str();
+}
+
+} // namespace
+
+static void Startup();
+static void Cleanup();
+
+extern "C" {
+  void (*tet_startup)() = Startup;
+  void (*tet_cleanup)() = Cleanup;
+}
+
+static void UtcDaliBuilderBenchmarkLoadScene();
+
+enum {
+  POSITIVE_TC_IDX = 0x01,
+  NEGATIVE_TC_IDX,
+};
+
+// Add test functionality for all APIs in the class (Positive and Negative)
+extern "C" {
+  struct tet_testlist tet_testlist[] = {
+    { UtcDaliBuilderBenchmarkLoadScene, POSITIVE_TC_IDX },
+    { NULL, 0 }
+  };
+}
+
+// Called only once before first test is run.
+static void Startup()
+{
+}
+
+// Called only once after last test is run
+static void Cleanup()
+{
+}
+
+static void UtcDaliBuilderBenchmarkLoadScene()
+{
+  ToolkitTestApplication application;
+
+  tet_infoline(" UtcDaliBuilderBenchmarkLoadScene - Measure parsing a JSON scene and creating its actors");
+
+  const std::string scene = GenerateScene( ACTOR_COUNT );
+
+  float parseTime = 0.0f;
+  float createTime = 0.0f;
+
+  for( unsigned int iteration = 0u; iteration < ITERATIONS; ++iteration )
+  {
+    Actor root = Actor::New();
+    Stage::GetCurrent().Add( root );
+
+    Builder builder = Builder::New();
+
+    timeval start, parsed, created;
+    gettimeofday( &start, NULL );
+
+    builder.LoadFromString( scene );
+
+    gettimeofday( &parsed, NULL );
+
+    builder.AddActors( root );
+
+    gettimeofday( &created, NULL );
+
+    parseTime += GetMilliseconds( start, parsed );
+    createTime += GetMilliseconds( parsed, created );
+
+    DALI_TEST_EQUALS( root.GetChildCount(), ACTOR_COUNT, TEST_LOCATION );
+
+    Actor actor = root.FindChildByName( "actor101" );
+    DALI_TEST_CHECK( actor );
+    DALI_TEST_EQUALS( actor.GetCurrentColor(), Color::WHITE, TEST_LOCATION ); // Not rendered yet
+
+    application.SendNotification();
+    application.Render();
+
+    DALI_TEST_EQUALS( actor.GetCurrentPosition(), Vector3( 1.0f, 1.0f, 0.0f ), TEST_LOCATION );
+    DALI_TEST_EQUALS( actor.GetCurrentColor(), Vector4( 1.0f, 0.5f, 0.25f, 1.0f ), TEST_LOCATION );
+
+    Stage::GetCurrent().Remove( root );
+  }
+
+  tet_printf( "Loaded a scene of %u actors %u times: %.2f ms parsing, %.2f ms creating actors per load\n",
+              ACTOR_COUNT, ITERATIONS, parseTime / ITERATIONS, createTime / ITERATIONS );
+}
@@ -59,6 +59,89 @@ static void TestCallback(BaseHandle handle)
   ++gNumberObjectCreated;
 }
 
+/**
+ * Creates a text-view split by word, with the given text and size, and adds it to the stage.
+ */
+TextView CreateSplitByWordTextView( const std::string& text, const Vector2& size, Alignment::Type alignment )
+{
+  TextView textView = TextView::New( text );
+  textView.SetSnapshotModeEnabled( false ); // Disables offscreen rendering.
+  textView.SetMultilinePolicy( TextView::SplitByWord );
+  textView.SetWidthExceedPolicy( TextView::Split );
+  textView.SetHeightExceedPolicy( TextView::Original );
+  textView.SetTextAlignment( alignment );
+  textView.SetSize( size );
+
+  Stage::GetCurrent().Add( textView );
+
+  return textView;
+}
+
+/**
+ * Checks a text-view which has been modified is laid-out as a new one with the same text.
+ */
+void CheckLayoutAfterModification( ToolkitTestApplication& application, TextView textView, const Vector2& size, Alignment::Type alignment )
+{
+  application.SendNotification();
+  application.Render();
+
+  TextView expectedTextView = CreateSplitByWordTextView( textView.GetText(), size, alignment );
+
+  application.SendNotification();
+  application.Render();
+
+  TextView::TextLayoutInfo layoutInfo;
+  TextView::TextLayoutInfo expectedLayoutInfo;
+  textView.GetTextLayoutInfo( layoutInfo );
+  expectedTextView.GetTextLayoutInfo( expectedLayoutInfo );
+
+  DALI_TEST_EQUALS( layoutInfo.mTextSize, expectedLayoutInfo.mTextSize, Math::MACHINE_EPSILON_1000, TEST_LOCATION );
+
+  DALI_TEST_EQUALS( layoutInfo.mCharacterLayoutInfoTable.size(), expectedLayoutInfo.mCharacterLayoutInfoTable.size(), TEST_LOCATION );
+  for( std::size_t index = 0, num = std::min( layoutInfo.mCharacterLayoutInfoTable.size(), expectedLayoutInfo.mCharacterLayoutInfoTable.size() ); index < num; ++index )
+  {
+    const TextView::CharacterLayoutInfo& character( layoutInfo.mCharacterLayoutInfoTable[index] );
+    const TextView::CharacterLayoutInfo& expectedCharacter( expectedLayoutInfo.mCharacterLayoutInfoTable[index] );
+
+    DALI_TEST_EQUALS( character.mPosition, expectedCharacter.mPosition, Math::MACHINE_EPSILON_1000, TEST_LOCATION );
+    DALI_TEST_EQUALS( character.mSize, expectedCharacter.mSize, Math::MACHINE_EPSILON_1000, TEST_LOCATION );
+    DALI_TEST_EQUALS( character.mIsVisible, expectedCharacter.mIsVisible, TEST_LOCATION );
+  }
+
+  DALI_TEST_EQUALS( layoutInfo.mLines.size(), expectedLayoutInfo.mLines.size(), TEST_LOCATION );
+  for( std::size_t index = 0, num = std::min( layoutInfo.mLines.size(), expectedLayoutInfo.mLines.size() ); index < num; ++index )
+  {
+    DALI_TEST_EQUALS( layoutInfo.mLines[index].mCharacterGlobalIndex, expectedLayoutInfo.mLines[index].mCharacterGlobalIndex, TEST_LOCATION );
+    DALI_TEST_EQUALS( layoutInfo.mLines[index].mSize, expectedLayoutInfo.mLines[index].mSize, Math::MACHINE_EPSILON_1000, TEST_LOCATION );
+  }
+
+  // Both text-views have the same text-actors, not necessarily in the same order.
+  DALI_TEST_EQUALS( textView.GetChildCount(), expectedTextView.GetChildCount(), TEST_LOCATION );
+  for( unsigned int expectedIndex = 0, expectedNum = expectedTextView.GetChildCount(); expectedIndex < expectedNum; ++expectedIndex )
+  {
+    TextActor expectedTextActor = TextActor::DownCast( expectedTextView.GetChildAt( expectedIndex ) );
+
+    bool found = false;
+    for( unsigned int index = 0, num = textView.GetChildCount(); !found && ( index < num ); ++index )
+    {
+      TextActor textActor = TextActor::DownCast( textView.GetChildAt( index ) );
+
+      found = ( textActor.GetText() == expectedTextActor.GetText() ) &&
+              TestEqual( textActor.GetCurrentPosition().x, expectedTextActor.GetCurrentPosition().x ) &&
+              TestEqual( textActor.GetCurrentPosition().y, expectedTextActor.GetCurrentPosition().y ) &&
+              TestEqual( textActor.GetCurrentSize().width, expectedTextActor.GetCurrentSize().width );
+    }
+
+    if( !found )
+    {
+      tet_printf( "text-actor \"%s\" not found\n", expectedTextActor.GetText().c_str() );
+    }
+    DALI_TEST_CHECK( found );
+  }
+
+  Stage::GetCurrent().Remove( expectedTextView );
+}
+
 static bool gTextScrolled;
 static Vector2 gScrollDelta;
 static void TestTextScrolled( TextView textView, Vector2 scrollDelta )
@@ -101,6 +184,7 @@ TEST_FUNCTION( UtcDaliTextViewSetAndGetHeightExceedPolicy, POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliTextViewTestLayoutOptions01, POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliTextViewTestLayoutOptions02, POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliTextViewInsertRemoveText, POSITIVE_TC_IDX );
+TEST_FUNCTION( UtcDaliTextViewInsertRemoveTextRelayout, POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliTextViewSnapshotEnable, POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliTextViewScroll, POSITIVE_TC_IDX );
 TEST_FUNCTION( UtcDaliTextViewSetProperty, POSITIVE_TC_IDX );
@@ -642,6 +726,88 @@ static void UtcDaliTextViewInsertRemoveText()
   DALI_TEST_EQUALS( view.GetText(), std::string("Hello "), TEST_LOCATION );
 }
 
+static void UtcDaliTextViewInsertRemoveTextRelayout()
+{
+  tet_infoline("UtcDaliTextViewInsertRemoveTextRelayout: ");
+  ToolkitTestApplication application;
+
+  // Only the lines modified since the last relayout are relaid-out. The result should be the same as relaying-out the whole text.
+
+  const Vector2 size( 200.f, 400.f );
+  const Alignment::Type ALIGNMENT[] = { static_cast<Alignment::Type>( Alignment::HorizontalLeft | Alignment::VerticalTop ),
+                                        static_cast<Alignment::Type>( Alignment::HorizontalCenter | Alignment::VerticalCenter ) };
+  const unsigned int NUM_ALIGNMENT = sizeof( ALIGNMENT ) / sizeof( Alignment::Type );
+
+  for( unsigned int alignmentIndex = 0; alignmentIndex < NUM_ALIGNMENT; ++alignmentIndex )
+  {
+    const Alignment::Type alignment = ALIGNMENT[alignmentIndex];
+
+    TextView textView = CreateSplitByWordTextView( "First line\nSecond line is longer\n  Third\n\nFifth line\nLast", size, alignment );
+
+    application.SendNotification();
+    application.Render();
+
+    // The text-actor of the first line is kept if it's not modified.
+    TextActor firstTextActor;
+    for( unsigned int index = 0, num = textView.GetChildCount(); index < num; ++index )
+    {
+      TextActor textActor = TextActor::DownCast( textView.GetChildAt( index ) );
+      if( textActor && ( 0 == textActor.GetText().find( "First" ) ) )
+      {
+        firstTextActor = textActor;
+      }
+    }
+    DALI_TEST_CHECK( firstTextActor );
+
+    // Modifies a line in the middle.
+    textView.InsertTextAt( 18, "very " );
+    CheckLayoutAfterModification( application, textView, size, alignment );
+    DALI_TEST_CHECK( firstTextActor.GetParent() == textView );
+
+    // Splits a line.
+    textView.InsertTextAt( 25, "\n" );
+    CheckLayoutAfterModification( application, textView, size, alignment );
+
+    // Merges two lines.
+    textView.RemoveTextFrom( 25, 1 );
+    CheckLayoutAfterModification( application, textView, size, alignment );
+
+    // The line is laid-out in more lines so the following ones are moved down.
+    textView.InsertTextAt( 30, " and longer and longer and longer and longer" );
+    CheckLayoutAfterModification( application, textView, size, alignment );
+
+    // Moves the following lines up.
+    textView.RemoveTextFrom( 30, 22 );
+    CheckLayoutAfterModification( application, textView, size, alignment );
+
+    // Replaces text in two lines.
+    textView.ReplaceTextFromTo( 40, 10, "new text" );
+    CheckLayoutAfterModification( application, textView, size, alignment );
+
+    // Modifies the empty line.
+    const std::size_t emptyLinePosition = textView.GetText().find( "\n\n" ) + 1u;
+    textView.InsertTextAt( emptyLinePosition, "Fourth" );
+    CheckLayoutAfterModification( application, textView, size, alignment );
+
+    // Modifies the last line and adds a new line at the end.
+    textView.InsertTextAt( textView.GetText().size(), " line\n" );
+    CheckLayoutAfterModification( application, textView, size, alignment );
+    DALI_TEST_CHECK( firstTextActor.GetParent() == textView );
+
+    // Modifies the first line.
+    textView.RemoveTextFrom( 0, 6 );
+    CheckLayoutAfterModification( application, textView, size, alignment );
+
+    // Several modifications before the relayout.
+    textView.InsertTextAt( 0, "A " );
+    textView.InsertTextAt( textView.GetText().size(), "End" );
+    textView.RemoveTextFrom( 10, 3 );
+    CheckLayoutAfterModification( application, textView, size, alignment );
+
+    Stage::GetCurrent().Remove( textView );
+  }
+}
+
 static void UtcDaliTextViewSnapshotEnable()
 {
   tet_infoline("UtcDaliTextViewSnapshotEnable: ");
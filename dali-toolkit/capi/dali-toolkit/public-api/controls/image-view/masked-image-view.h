@@ -156,6 +156,9 @@ public:
   /**
    * @brief Set the image used as a source in the masking operation.
    *
+   * When only a tile of a large image is shown, loading it with ImageAttributes::SetCrop()
+   * decodes only that tile; ImageAttributes::SetProgressiveLoading() shows a low resolution
+   * version while the image loads.
    * @param[in] sourceImage The source image
    */
   void SetSourceImage( Image sourceImage );
@@ -22,6 +22,7 @@
 
 // INTERNAL INCLUDES
 #include <dali/public-api/events/mouse-wheel-event.h>
+#include <dali/integration-api/trace.h>
 #include <dali-toolkit/public-api/controls/scrollable/item-view/item-factory.h>
 #include <dali-toolkit/internal/controls/scrollable/scroll-connector-impl.h>
 
@@ -642,6 +643,8 @@ bool ItemView::OnRefreshTick()
     return false;
   }
 
+  DALI_TRACE_SCOPE( "ItemView::Refresh" );
+
   ItemRange range = GetItemRange(*mActiveLayout, mActiveLayoutTargetSize, true/*reserve extra*/);
 
   RemoveActorsOutsideRange( range );
@@ -0,0 +1,291 @@
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// CLASS HEADER
+#include <dali-toolkit/internal/controls/text-view/font-metrics-cache.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+namespace TextViewProcessor
+{
+
+namespace
+{
+
+const std::size_t INVALID_FONT_ID = static_cast<std::size_t>( -1 );
+
+const unsigned int GLYPH_PAGE_SHIFT = 8u;                                  // Characters are stored in pages of 256 consecutive code points.
+const unsigned int GLYPHS_PER_PAGE = 1u << GLYPH_PAGE_SHIFT;
+const unsigned int GLYPH_PAGE_MASK = GLYPHS_PER_PAGE - 1u;
+
+const unsigned char METRICS_CACHED = 0x01; // The glyph metrics have been queried.
+const unsigned char SUPPORT_CACHED = 0x02; // Whether the font supports the character has been queried.
+const unsigned char SUPPORTED      = 0x04; // The font supports the character.
+
+} // namespace
+
+struct FontMetricsCache::GlyphEntry
+{
+  GlyphMetrics  mMetrics; ///< The glyph metrics.
+  unsigned char mFlags;   ///< Which values have been queried.
+};
+
+struct FontMetricsCache::GlyphPage
+{
+  GlyphEntry mGlyphs[GLYPHS_PER_PAGE];
+};
+
+struct FontMetricsCache::FontEntry
+{
+  /**
+   * Constructor.
+   *
+   * @param[in] fontParameters The parameters used to create the font when a character's metrics are not stored.
+   */
+  FontEntry( const FontParameters& fontParameters )
+  : mParameters( fontParameters ),
+    mMetrics(),
+    mPages()
+  {
+  }
+
+  /**
+   * Destructor.
+   */
+  ~FontEntry()
+  {
+    for( std::vector<GlyphPage*>::iterator it = mPages.begin(), endIt = mPages.end(); it != endIt; ++it )
+    {
+      delete *it;
+    }
+  }
+
+  FontParameters          mParameters; ///< The font parameters.
+  FontMetrics             mMetrics;    ///< The font metrics.
+  std::vector<GlyphPage*> mPages;      ///< The glyph table, indexed by the code point's page. Pages are created on demand.
+};
+
+bool FontMetricsCache::FontKey::operator<( const FontKey& key ) const
+{
+  if( mPointSize != key.mPointSize )
+  {
+    return mPointSize < key.mPointSize;
+  }
+
+  const int compareFamily = mFamilyName.compare( key.mFamilyName );
+  if( 0 != compareFamily )
+  {
+    return compareFamily < 0;
+  }
+
+  return mStyle < key.mStyle;
+}
+
+FontMetricsCache& FontMetricsCache::Get()
+{
+  static FontMetricsCache cache;
+
+  return cache;
+}
+
+FontMetricsCache::FontMetricsCache()
+: mFonts(),
+  mFontLookup(),
+  mFamilyLookup(),
+  mDefaultFontId( INVALID_FONT_ID ),
+  mLastFontId( INVALID_FONT_ID )
+{
+}
+
+FontMetricsCache::~FontMetricsCache()
+{
+  Clear();
+}
+
+FontMetricsCache::FontId FontMetricsCache::GetFontId( const TextStyle& style )
+{
+  const std::string& familyName = style.GetFontName();
+  const std::string& fontStyle = style.GetFontStyle();
+  const float pointSize = style.GetFontPointSize();
+
+  if( INVALID_FONT_ID != mLastFontId )
+  {
+    const FontParameters& lastParameters = mFonts[mLastFontId]->mParameters;
+
+    if( ( static_cast<float>( lastParameters.GetSize() ) == pointSize ) &&
+        ( lastParameters.GetFamilyName() == familyName ) &&
+        ( lastParameters.GetStyle() == fontStyle ) )
+    {
+      return mLastFontId;
+    }
+  }
+
+  FontKey key;
+  key.mFamilyName = familyName;
+  key.mStyle = fontStyle;
+  key.mPointSize = pointSize;
+
+  FontLookup::const_iterator it = mFontLookup.find( key );
+  if( mFontLookup.end() != it )
+  {
+    mLastFontId = it->second;
+  }
+  else
+  {
+    mLastFontId = AddFont( FontParameters( familyName, fontStyle, PointSize( pointSize ) ) );
+    mFontLookup.insert( std::make_pair( key, mLastFontId ) );
+  }
+
+  return mLastFontId;
+}
+
+FontMetricsCache::FontId FontMetricsCache::GetDefaultFontId()
+{
+  if( INVALID_FONT_ID == mDefaultFontId )
+  {
+    mDefaultFontId = AddFont( DEFAULT_FONT_PARAMETERS );
+  }
+
+  return mDefaultFontId;
+}
+
+const FontMetricsCache::FontMetrics& FontMetricsCache::GetFontMetrics( FontId fontId ) const
+{
+  DALI_ASSERT_DEBUG( fontId < mFonts.size() );
+
+  return mFonts[fontId]->mMetrics;
+}
+
+const FontMetricsCache::GlyphMetrics& FontMetricsCache::GetGlyphMetrics( FontId fontId, const Character& character )
+{
+  GlyphEntry& entry = GetGlyphEntry( fontId, character );
+
+  if( !( entry.mFlags & METRICS_CACHED ) )
+  {
+    const Font font = Font::New( mFonts[fontId]->mParameters );
+    const Font::Metrics metrics = font.GetMetrics( character );
+
+    entry.mMetrics.mAdvance = metrics.GetAdvance();
+    entry.mMetrics.mBearing = metrics.GetBearing();
+    entry.mFlags |= METRICS_CACHED;
+  }
+
+  return entry.mMetrics;
+}
+
+bool FontMetricsCache::IsGlyphSupported( FontId fontId, const Character& character )
+{
+  GlyphEntry& entry = GetGlyphEntry( fontId, character );
+
+  if( !( entry.mFlags & SUPPORT_CACHED ) )
+  {
+    const Font font = Font::New( mFonts[fontId]->mParameters );
+
+    entry.mFlags |= SUPPORT_CACHED;
+    if( font.AllGlyphsSupported( character ) )
+    {
+      entry.mFlags |= SUPPORTED;
+    }
+  }
+
+  return entry.mFlags & SUPPORTED;
+}
+
+const std::string& FontMetricsCache::GetFamilyForCharacter( const Character& character )
+{
+  const uint32_t codePoint = character.GetCodePoint();
+
+  FamilyLookup::iterator it = mFamilyLookup.find( codePoint );
+  if( mFamilyLookup.end() == it )
+  {
+    it = mFamilyLookup.insert( std::make_pair( codePoint, Font::GetFamilyForText( character ) ) ).first;
+  }
+
+  return it->second;
+}
+
+void FontMetricsCache::Clear()
+{
+  for( std::vector<FontEntry*>::iterator it = mFonts.begin(), endIt = mFonts.end(); it != endIt; ++it )
+  {
+    delete *it;
+  }
+  mFonts.clear();
+  mFontLookup.clear();
+  mFamilyLookup.clear();
+
+  mDefaultFontId = INVALID_FONT_ID;
+  mLastFontId = INVALID_FONT_ID;
+}
+
+std::size_t FontMetricsCache::GetNumberOfFonts() const
+{
+  return mFonts.size();
+}
+
+FontMetricsCache::FontId FontMetricsCache::AddFont( const FontParameters& fontParameters )
+{
+  const Font font = Font::New( fontParameters );
+
+  FontEntry* entry = new FontEntry( fontParameters );
+  entry->mMetrics.mLineHeight = font.GetLineHeight();
+  entry->mMetrics.mAscender = font.GetAscender();
+  entry->mMetrics.mUnderlineThickness = font.GetUnderlineThickness();
+  entry->mMetrics.mUnderlinePosition = font.GetUnderlinePosition();
+  entry->mMetrics.mIsDefaultSystemFont = font.IsDefaultSystemFont();
+
+  mFonts.push_back( entry );
+
+  return mFonts.size() - 1u;
+}
+
+FontMetricsCache::GlyphEntry& FontMetricsCache::GetGlyphEntry( FontId fontId, const Character& character )
+{
+  DALI_ASSERT_DEBUG( fontId < mFonts.size() );
+
+  const uint32_t codePoint = character.GetCodePoint();
+  const std::size_t pageIndex = codePoint >> GLYPH_PAGE_SHIFT;
+
+  std::vector<GlyphPage*>& pages = mFonts[fontId]->mPages;
+  if( pageIndex >= pages.size() )
+  {
+    pages.resize( pageIndex + 1u, NULL );
+  }
+
+  GlyphPage*& page = pages[pageIndex];
+  if( NULL == page )
+  {
+    // Value-initialization clears the flags of all the entries.
+    page = new GlyphPage();
+  }
+
+  return page->mGlyphs[codePoint & GLYPH_PAGE_MASK];
+}
+
+} // namespace TextViewProcessor
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
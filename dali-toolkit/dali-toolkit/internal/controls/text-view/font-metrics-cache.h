@@ -0,0 +1,231 @@
+#ifndef __DALI_TOOLKIT_INTERNAL_FONT_METRICS_CACHE_H__
+#define __DALI_TOOLKIT_INTERNAL_FONT_METRICS_CACHE_H__
+
+//
+// Copyright (c) 2014 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Flora License, Version 1.0 (the License);
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://floralicense.org/license/
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an AS IS BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+
+// INTERNAL INCLUDES
+#include <dali/dali.h>
+
+// EXTERNAL INCLUDES
+#include <map>
+#include <stdint.h>
+
+namespace Dali
+{
+
+namespace Toolkit
+{
+
+namespace Internal
+{
+
+namespace TextViewProcessor
+{
+
+/**
+ * Stores the font and glyph metrics used to lay out characters.
+ *
+ * Fonts are keyed by family name, style and point size. For each font the metrics of every character
+ * laid out are stored in a table indexed by the character's code point, so a relayout only goes
+ * through the font factory for characters which haven't been seen before.
+ *
+ * The cache is shared by all text-views and must only be used from the event thread. It only stores
+ * plain values, no font handles, so it may outlive the core.
+ */
+class FontMetricsCache
+{
+public:
+
+  typedef std::size_t FontId;
+
+  /**
+   * Metrics of a font, the same for all its characters.
+   */
+  struct FontMetrics
+  {
+    float mLineHeight;          ///< The font's line height.
+    float mAscender;            ///< The font's ascender.
+    float mUnderlineThickness;  ///< The underline thickness.
+    float mUnderlinePosition;   ///< The underline position.
+    bool  mIsDefaultSystemFont; ///< Whether the font parameters resolved to the default system font.
+  };
+
+  /**
+   * Metrics of a character for a given font.
+   */
+  struct GlyphMetrics
+  {
+    float mAdvance; ///< The character's advance.
+    float mBearing; ///< The character's bearing.
+  };
+
+  /**
+   * Retrieves the cache shared by all text-views.
+   *
+   * @return A reference to the cache.
+   */
+  static FontMetricsCache& Get();
+
+  /**
+   * Default constructor.
+   */
+  FontMetricsCache();
+
+  /**
+   * Destructor.
+   */
+  ~FontMetricsCache();
+
+  /**
+   * Retrieves the id of the font for the given style's family name, font style and point size.
+   *
+   * The font is queried and its metrics stored the first time it's used.
+   *
+   * @param[in] style The text style.
+   *
+   * @return The font id.
+   */
+  FontId GetFontId( const TextStyle& style );
+
+  /**
+   * Retrieves the id of the default system font.
+   *
+   * @return The font id.
+   */
+  FontId GetDefaultFontId();
+
+  /**
+   * Retrieves the metrics of the given font.
+   *
+   * @param[in] fontId The font id.
+   *
+   * @return The font metrics.
+   */
+  const FontMetrics& GetFontMetrics( FontId fontId ) const;
+
+  /**
+   * Retrieves the metrics of the given character for the given font.
+   *
+   * @param[in] fontId The font id.
+   * @param[in] character The character.
+   *
+   * @return The glyph metrics.
+   */
+  const GlyphMetrics& GetGlyphMetrics( FontId fontId, const Character& character );
+
+  /**
+   * Whether the given font has a glyph for the given character.
+   *
+   * @param[in] fontId The font id.
+   * @param[in] character The character.
+   *
+   * @return \e true if the character is supported.
+   */
+  bool IsGlyphSupported( FontId fontId, const Character& character );
+
+  /**
+   * Retrieves a suitable font family for the given character.
+   *
+   * @see Font::GetFamilyForText()
+   *
+   * @param[in] character The character.
+   *
+   * @return The family name.
+   */
+  const std::string& GetFamilyForCharacter( const Character& character );
+
+  /**
+   * Removes all cached fonts and metrics.
+   *
+   * Needs to be called when the system fonts change.
+   */
+  void Clear();
+
+  /**
+   * @return The number of fonts stored.
+   */
+  std::size_t GetNumberOfFonts() const;
+
+private:
+
+  // Undefined
+  FontMetricsCache( const FontMetricsCache& );
+
+  // Undefined
+  FontMetricsCache& operator=( const FontMetricsCache& );
+
+private:
+
+  /**
+   * Identifies a font by the parameters taken from the text style.
+   */
+  struct FontKey
+  {
+    /**
+     * Less than operator, used to sort the font lookup.
+     */
+    bool operator<( const FontKey& key ) const;
+
+    std::string mFamilyName; ///< The font family name.
+    std::string mStyle;      ///< The font style.
+    float       mPointSize;  ///< The font size in points.
+  };
+
+  struct FontEntry;
+  struct GlyphEntry;
+  struct GlyphPage;
+
+  typedef std::map<FontKey, FontId> FontLookup;
+  typedef std::map<uint32_t, std::string> FamilyLookup;
+
+  /**
+   * Adds a new font with the given parameters.
+   *
+   * @param[in] fontParameters The font parameters.
+   *
+   * @return The font id.
+   */
+  FontId AddFont( const FontParameters& fontParameters );
+
+  /**
+   * Retrieves the entry for the given character, creating its page if needed.
+   *
+   * @param[in] fontId The font id.
+   * @param[in] character The character.
+   *
+   * @return The glyph entry.
+   */
+  GlyphEntry& GetGlyphEntry( FontId fontId, const Character& character );
+
+private:
+
+  std::vector<FontEntry*> mFonts;          ///< Stores the fonts, indexed by font id.
+  FontLookup              mFontLookup;     ///< Maps family name, style and point size to a font id.
+  FamilyLookup            mFamilyLookup;   ///< Stores the family chosen for characters not supported by the default font.
+  FontId                  mDefaultFontId;  ///< The id of the default system font.
+  FontId                  mLastFontId;     ///< The id of the font retrieved last; consecutive characters usually share the style.
+};
+
+} // namespace TextViewProcessor
+
+} // namespace Internal
+
+} // namespace Toolkit
+
+} // namespace Dali
+
+#endif // __DALI_TOOLKIT_INTERNAL_FONT_METRICS_CACHE_H__
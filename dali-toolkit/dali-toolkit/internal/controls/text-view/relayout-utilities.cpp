@@ -19,6 +19,7 @@
 #include "relayout-utilities.h"
 
 // EXTERNAL INCLUDES
+#include <algorithm>
 #include <cmath>
 
 // INTERNAL INCLUDES
@@ -529,10 +530,22 @@ void UpdateAlignment( const TextView::LayoutParameters& layoutParameters,
   std::size_t lineJustificationIndex = 0; // Index to the first position of the vector which stores all line justification info.
   std::size_t infoTableCharacterIndex = 0;
 
-  relayoutParameters.mIndices.mLineIndex = 0;
+  // Only the lines moved since the last relayout are aligned.
+  std::size_t firstLine = 0u;
+  std::size_t endLine = 0u;
+  relayoutData.mDamagedLines.GetMovedLines( relayoutData.mTextLayoutInfo.mLinesLayoutInfo.size(), firstLine, endLine );
 
-  for( TextViewProcessor::LineLayoutInfoContainer::iterator lineLayoutIt = relayoutData.mTextLayoutInfo.mLinesLayoutInfo.begin(),
-         endLineLayoutIt = relayoutData.mTextLayoutInfo.mLinesLayoutInfo.end();
+  if( 0u != firstLine )
+  {
+    const TextView::LineRelayoutInfo& lineRelayoutInfo( *( relayoutData.mLinesRelayoutInfo.begin() + firstLine ) );
+    lineJustificationIndex = lineRelayoutInfo.mLineJustificationIndex;
+    infoTableCharacterIndex = lineRelayoutInfo.mCharacterGlobalIndex;
+  }
+
+  relayoutParameters.mIndices.mLineIndex = firstLine;
+
+  for( TextViewProcessor::LineLayoutInfoContainer::iterator lineLayoutIt = relayoutData.mTextLayoutInfo.mLinesLayoutInfo.begin() + firstLine,
+         endLineLayoutIt = relayoutData.mTextLayoutInfo.mLinesLayoutInfo.begin() + endLine;
        lineLayoutIt != endLineLayoutIt;
        ++lineLayoutIt, ++relayoutParameters.mIndices.mLineIndex )
   {
@@ -1219,8 +1232,13 @@ void EllipsizeLine( const TextView::LayoutParameters& layoutParameters,
 
 void SetTextVisible( TextView::RelayoutData& relayoutData )
 {
-  for( TextViewProcessor::LineLayoutInfoContainer::iterator lineLayoutIt = relayoutData.mTextLayoutInfo.mLinesLayoutInfo.begin(),
-         endLineLayoutIt = relayoutData.mTextLayoutInfo.mLinesLayoutInfo.end();
+  // Only the lines modified since the last relayout are set visible.
+  std::size_t firstLine = 0u;
+  std::size_t endLine = 0u;
+  relayoutData.mDamagedLines.GetModifiedLines( relayoutData.mTextLayoutInfo.mLinesLayoutInfo.size(), firstLine, endLine );
+
+  for( TextViewProcessor::LineLayoutInfoContainer::iterator lineLayoutIt = relayoutData.mTextLayoutInfo.mLinesLayoutInfo.begin() + firstLine,
+         endLineLayoutIt = relayoutData.mTextLayoutInfo.mLinesLayoutInfo.begin() + endLine;
        lineLayoutIt != endLineLayoutIt;
        ++lineLayoutIt )
   {
@@ -1256,9 +1274,17 @@ void SetTextVisible( TextView::RelayoutData& relayoutData )
     } // end group of words
   } // end lines
 
+  std::size_t firstCharacter = 0u;
+  std::size_t endCharacter = relayoutData.mCharacterLayoutInfoTable.size();
+  if( !relayoutData.mDamagedLines.mWholeText )
+  {
+    firstCharacter = ( *( relayoutData.mLinesRelayoutInfo.begin() + firstLine ) ).mCharacterGlobalIndex;
+    endCharacter = ( *( relayoutData.mLinesRelayoutInfo.begin() + endLine ) ).mCharacterGlobalIndex;
+  }
+
   // Updates the visibility for text-input..
-  for( std::vector<Toolkit::TextView::CharacterLayoutInfo>::iterator it = relayoutData.mCharacterLayoutInfoTable.begin(),
-         endIt = relayoutData.mCharacterLayoutInfoTable.end();
+  for( std::vector<Toolkit::TextView::CharacterLayoutInfo>::iterator it = relayoutData.mCharacterLayoutInfoTable.begin() + firstCharacter,
+         endIt = relayoutData.mCharacterLayoutInfoTable.begin() + endCharacter;
        it != endIt;
        ++it )
   {
@@ -1512,36 +1538,87 @@ void UpdateVisibility( const TextView::LayoutParameters& layoutParameters,
   }
 }
 
+bool HasTextActor( const TextViewProcessor::LineLayoutInfo& lineLayoutInfo )
+{
+  for( TextViewProcessor::WordGroupLayoutInfoContainer::const_iterator groupLayoutIt = lineLayoutInfo.mWordGroupsLayoutInfo.begin(),
+         endGroupLayoutIt = lineLayoutInfo.mWordGroupsLayoutInfo.end();
+       groupLayoutIt != endGroupLayoutIt;
+       ++groupLayoutIt )
+  {
+    const TextViewProcessor::WordGroupLayoutInfo& wordGroupLayoutInfo( *groupLayoutIt );
+
+    for( TextViewProcessor::WordLayoutInfoContainer::const_iterator wordLayoutIt = wordGroupLayoutInfo.mWordsLayoutInfo.begin(),
+           endWordLayoutIt = wordGroupLayoutInfo.mWordsLayoutInfo.end();
+         wordLayoutIt != endWordLayoutIt;
+         ++wordLayoutIt )
+    {
+      const TextViewProcessor::WordLayoutInfo& wordLayoutInfo( *wordLayoutIt );
+
+      for( TextViewProcessor::CharacterLayoutInfoContainer::const_iterator characterLayoutIt = wordLayoutInfo.mCharactersLayoutInfo.begin(),
+             endCharacterLayoutIt = wordLayoutInfo.mCharactersLayoutInfo.end();
+           characterLayoutIt != endCharacterLayoutIt;
+           ++characterLayoutIt )
+      {
+        if( ( *characterLayoutIt ).mTextActor )
+        {
+          return true;
+        }
+      }
+    }
+  }
+
+  return false;
+}
+
 void UpdateTextActorInfo( const TextView::VisualParameters& visualParameters,
                           TextView::RelayoutData& relayoutData )
 {
   CurrentTextActorInfo currentTextActorInfo;
 
+  // Only the text-actors of the lines moved since the last relayout are updated.
+  std::size_t firstLine = 0u;
+  std::size_t endLine = 0u;
+  relayoutData.mDamagedLines.GetMovedLines( relayoutData.mTextLayoutInfo.mLinesLayoutInfo.size(), firstLine, endLine );
+
+  // White spaces without text-actor are added to the text-actor of the previous characters, which could be in a previous line.
+  // The traverse starts in the last line with text-actors before the moved ones and stops in the first text-actor after them.
+  if( 0u != firstLine )
+  {
+    do
+    {
+      --firstLine;
+    }
+    while( ( 0u != firstLine ) && !HasTextActor( *( relayoutData.mTextLayoutInfo.mLinesLayoutInfo.begin() + firstLine ) ) );
+  }
+
+  std::size_t lineIndex = firstLine;
+  bool textActorAfterMovedLinesFound = false;
+
   // Traverses the text-actor and layout info data structures.
-  for( TextViewProcessor::LineLayoutInfoContainer::iterator lineLayoutIt = relayoutData.mTextLayoutInfo.mLinesLayoutInfo.begin(),
+  for( TextViewProcessor::LineLayoutInfoContainer::iterator lineLayoutIt = relayoutData.mTextLayoutInfo.mLinesLayoutInfo.begin() + firstLine,
          endLineLayoutIt = relayoutData.mTextLayoutInfo.mLinesLayoutInfo.end();
-       lineLayoutIt != endLineLayoutIt;
-       ++lineLayoutIt )
+       ( lineLayoutIt != endLineLayoutIt ) && !textActorAfterMovedLinesFound;
+       ++lineLayoutIt, ++lineIndex )
   {
     TextViewProcessor::LineLayoutInfo& lineLayoutInfo( *lineLayoutIt );
 
     for( TextViewProcessor::WordGroupLayoutInfoContainer::iterator groupLayoutIt = lineLayoutInfo.mWordGroupsLayoutInfo.begin(),
            endGroupLayoutIt = lineLayoutInfo.mWordGroupsLayoutInfo.end();
-         groupLayoutIt != endGroupLayoutIt;
+         ( groupLayoutIt != endGroupLayoutIt ) && !textActorAfterMovedLinesFound;
          ++groupLayoutIt )
     {
       TextViewProcessor::WordGroupLayoutInfo& wordGroupLayoutInfo( *groupLayoutIt );
 
       for( TextViewProcessor::WordLayoutInfoContainer::iterator wordLayoutIt = wordGroupLayoutInfo.mWordsLayoutInfo.begin(),
              endWordLayoutIt = wordGroupLayoutInfo.mWordsLayoutInfo.end();
-           wordLayoutIt != endWordLayoutIt;
+           ( wordLayoutIt != endWordLayoutIt ) && !textActorAfterMovedLinesFound;
            ++wordLayoutIt )
       {
         TextViewProcessor::WordLayoutInfo& wordLayoutInfo( *wordLayoutIt );
 
         for( TextViewProcessor::CharacterLayoutInfoContainer::iterator characterLayoutIt = wordLayoutInfo.mCharactersLayoutInfo.begin(),
                endCharacterLayoutIt = wordLayoutInfo.mCharactersLayoutInfo.end();
-             characterLayoutIt != endCharacterLayoutIt;
+             ( characterLayoutIt != endCharacterLayoutIt ) && !textActorAfterMovedLinesFound;
              ++characterLayoutIt )
         {
           TextViewProcessor::CharacterLayoutInfo& characterLayoutInfo( *characterLayoutIt );
@@ -1561,6 +1638,13 @@ void UpdateTextActorInfo( const TextView::VisualParameters& visualParameters,
                                    lineLayoutInfo.mSize.height );
             }
 
+            if( lineIndex >= endLine )
+            {
+              // The text-actors after the moved lines are not updated.
+              textActorAfterMovedLinesFound = true;
+              continue;
+            }
+
             currentTextActorInfo.text = characterLayoutInfo.mStyledText.mText;
             currentTextActorInfo.position = Vector3( characterLayoutInfo.mPosition.x + characterLayoutInfo.mOffset.x,
                                                      characterLayoutInfo.mPosition.y + characterLayoutInfo.mOffset.y,
@@ -1634,8 +1718,15 @@ void CalculateUnderlineInfo( TextView::RelayoutData& relayoutData, TextViewRelay
   //
   // Note that relayoutData.mTextLayoutInfo contains layout info per line but these lines are the result of split the whole text every time a '\n' is found.
   // According with the layout option, one of this lines could be laid-out in more than one.
+  //
+  // Every line starts a new laid-out line so only the lines modified since the last relayout are traversed.
+  // The given status points the first character and laid-out line of the first modified line.
+
+  std::size_t firstLine = 0u;
+  std::size_t endLine = 0u;
+  relayoutData.mDamagedLines.GetModifiedLines( relayoutData.mTextLayoutInfo.mLinesLayoutInfo.size(), firstLine, endLine );
 
-  for( TextViewProcessor::LineLayoutInfoContainer::iterator lineIt = relayoutData.mTextLayoutInfo.mLinesLayoutInfo.begin(), lineEndIt = relayoutData.mTextLayoutInfo.mLinesLayoutInfo.end();
+  for( TextViewProcessor::LineLayoutInfoContainer::iterator lineIt = relayoutData.mTextLayoutInfo.mLinesLayoutInfo.begin() + firstLine, lineEndIt = relayoutData.mTextLayoutInfo.mLinesLayoutInfo.begin() + endLine;
        lineIt != lineEndIt;
        ++lineIt )
   {
@@ -1713,7 +1804,24 @@ void SetUnderlineInfo( TextView::RelayoutData& relayoutData )
   // Stores for each group of consecutive underlined text in each laid-out line its maximum thicknes, its position of that thickness and the maximum character's height.
   TextViewRelayout::TextUnderlineStatus textUnderlineStatus;
 
-  // Traverse the whole text to find all groups of consecutive underlined characters in the same laid-out line.
+  // Only the lines modified since the last relayout are traversed.
+  std::size_t firstLine = 0u;
+  std::size_t endLine = 0u;
+  relayoutData.mDamagedLines.GetModifiedLines( relayoutData.mTextLayoutInfo.mLinesLayoutInfo.size(), firstLine, endLine );
+
+  std::size_t firstCharacterGlobalIndex = 0u;
+  std::size_t firstLineGlobalIndex = 0u;
+  if( 0u != firstLine )
+  {
+    const TextView::LineRelayoutInfo& lineRelayoutInfo( *( relayoutData.mLinesRelayoutInfo.begin() + firstLine ) );
+    firstCharacterGlobalIndex = lineRelayoutInfo.mCharacterGlobalIndex;
+    firstLineGlobalIndex = lineRelayoutInfo.mLaidOutLineIndex;
+  }
+
+  textUnderlineStatus.mCharacterGlobalIndex = firstCharacterGlobalIndex;
+  textUnderlineStatus.mLineGlobalIndex = firstLineGlobalIndex;
+
+  // Traverse the text to find all groups of consecutive underlined characters in the same laid-out line.
   CalculateUnderlineInfo( relayoutData, textUnderlineStatus );
 
   if( textUnderlineStatus.mUnderlineInfo.empty() )
@@ -1737,13 +1845,13 @@ void SetUnderlineInfo( TextView::RelayoutData& relayoutData )
 
   // Whether current text is underlined.
   textUnderlineStatus.mCurrentUnderlineStatus = false;
-  textUnderlineStatus.mCharacterGlobalIndex = 0;
-  textUnderlineStatus.mLineGlobalIndex = 0;
+  textUnderlineStatus.mCharacterGlobalIndex = firstCharacterGlobalIndex;
+  textUnderlineStatus.mLineGlobalIndex = firstLineGlobalIndex;
 
   float currentLineHeight = 0.f;
   float currentLineAscender = 0.f;
 
-  for( TextViewProcessor::LineLayoutInfoContainer::iterator lineIt = relayoutData.mTextLayoutInfo.mLinesLayoutInfo.begin(), lineEndIt = relayoutData.mTextLayoutInfo.mLinesLayoutInfo.end();
+  for( TextViewProcessor::LineLayoutInfoContainer::iterator lineIt = relayoutData.mTextLayoutInfo.mLinesLayoutInfo.begin() + firstLine, lineEndIt = relayoutData.mTextLayoutInfo.mLinesLayoutInfo.begin() + endLine;
        lineIt != lineEndIt;
        ++lineIt )
   {
@@ -1864,15 +1972,49 @@ void InsertToTextView( const TextView::RelayoutOperationMask relayoutOperationMa
   const bool insertToTextView = relayoutOperationMask & TextView::RELAYOUT_INSERT_TO_TEXT_VIEW;
   const bool insertToTextActorList = relayoutOperationMask & TextView::RELAYOUT_INSERT_TO_TEXT_ACTOR_LIST;
 
+  // Only the text-actors of the lines modified since the last relayout are inserted.
+  // The text-actors of the other lines are already in the text-view and in the text-actor list.
+  const std::size_t numberOfLines = relayoutData.mTextLayoutInfo.mLinesLayoutInfo.size();
+  std::size_t firstLine = 0u;
+  std::size_t endLine = 0u;
+  relayoutData.mDamagedLines.GetModifiedLines( numberOfLines, firstLine, endLine );
+
+  const bool wholeText = relayoutData.mDamagedLines.mWholeText;
+
+  // The text-actors of the modified lines replace the ones stored in the text-actor list before the relayout.
+  // If the whole text is relaid-out, the text-actors are replaced only if they are inserted into the list. Usually the list is empty.
+  const bool replaceTextActors = !wholeText || insertToTextActorList;
+
+  // The index to the first text-actor of each line is stored if there is relayout info for each line. See SplitByWord::CalculateSizeAndPosition().
+  const bool storeTextActorIndices = insertToTextActorList && ( relayoutData.mLinesRelayoutInfo.size() == numberOfLines + 1u );
+
+  // Range of the text-actor list with the text-actors of the modified lines before the relayout.
+  std::size_t firstTextActorIndex = 0u;
+  std::size_t endTextActorIndex = relayoutData.mTextActors.size();
+  if( !wholeText )
+  {
+    firstTextActorIndex = ( *( relayoutData.mLinesRelayoutInfo.begin() + firstLine ) ).mTextActorIndex;
+    endTextActorIndex = ( *( relayoutData.mLinesRelayoutInfo.begin() + endLine ) ).mTextActorIndex;
+  }
+
+  // Text-actors of the modified lines.
+  std::vector<TextActor> textActors;
+
   // Add text-actors to the text-view.
 
-  for( TextViewProcessor::LineLayoutInfoContainer::iterator lineLayoutIt = relayoutData.mTextLayoutInfo.mLinesLayoutInfo.begin(),
-         endLineLayoutIt = relayoutData.mTextLayoutInfo.mLinesLayoutInfo.end();
+  std::size_t lineIndex = firstLine;
+  for( TextViewProcessor::LineLayoutInfoContainer::iterator lineLayoutIt = relayoutData.mTextLayoutInfo.mLinesLayoutInfo.begin() + firstLine,
+         endLineLayoutIt = relayoutData.mTextLayoutInfo.mLinesLayoutInfo.begin() + endLine;
        lineLayoutIt != endLineLayoutIt;
-       ++lineLayoutIt )
+       ++lineLayoutIt, ++lineIndex )
   {
     TextViewProcessor::LineLayoutInfo& lineLayoutInfo( *lineLayoutIt );
 
+    if( storeTextActorIndices )
+    {
+      ( *( relayoutData.mLinesRelayoutInfo.begin() + lineIndex ) ).mTextActorIndex = firstTextActorIndex + textActors.size();
+    }
+
     for( TextViewProcessor::WordGroupLayoutInfoContainer::iterator groupLayoutIt = lineLayoutInfo.mWordGroupsLayoutInfo.begin(),
            endGroupLayoutIt = lineLayoutInfo.mWordGroupsLayoutInfo.end();
          groupLayoutIt != endGroupLayoutIt;
@@ -1901,9 +2043,9 @@ void InsertToTextView( const TextView::RelayoutOperationMask relayoutOperationMa
             {
               textView.Add( characterLayoutInfo.mTextActor );
             }
-            if( insertToTextActorList )
+            if( replaceTextActors )
             {
-              relayoutData.mTextActors.push_back( characterLayoutInfo.mTextActor );
+              textActors.push_back( characterLayoutInfo.mTextActor );
             }
           }
         } // end group of character
@@ -1911,6 +2053,51 @@ void InsertToTextView( const TextView::RelayoutOperationMask relayoutOperationMa
     } // end group of words
   } // end lines
 
+  if( replaceTextActors && ( firstTextActorIndex <= endTextActorIndex ) && ( endTextActorIndex <= relayoutData.mTextActors.size() ) )
+  {
+    // Removes from the text-view the previous text-actors which are not used any more.
+    std::vector<TextActor> sortedTextActors( textActors );
+    std::sort( sortedTextActors.begin(), sortedTextActors.end() );
+
+    for( std::vector<TextActor>::iterator it = relayoutData.mTextActors.begin() + firstTextActorIndex,
+           endIt = relayoutData.mTextActors.begin() + endTextActorIndex;
+         it != endIt;
+         ++it )
+    {
+      if( !std::binary_search( sortedTextActors.begin(), sortedTextActors.end(), *it ) )
+      {
+        textView.Remove( *it );
+      }
+    }
+
+    if( insertToTextActorList )
+    {
+      // Replaces the previous text-actors in the text-actor list.
+      relayoutData.mTextActors.erase( relayoutData.mTextActors.begin() + firstTextActorIndex, relayoutData.mTextActors.begin() + endTextActorIndex );
+      relayoutData.mTextActors.insert( relayoutData.mTextActors.begin() + firstTextActorIndex, textActors.begin(), textActors.end() );
+
+      // Updates the text-actor index of the lines after the modified ones.
+      if( wholeText )
+      {
+        if( storeTextActorIndices )
+        {
+          ( *( relayoutData.mLinesRelayoutInfo.begin() + numberOfLines ) ).mTextActorIndex = textActors.size();
+        }
+      }
+      else
+      {
+        for( std::vector<TextView::LineRelayoutInfo>::iterator it = relayoutData.mLinesRelayoutInfo.begin() + endLine,
+               endIt = relayoutData.mLinesRelayoutInfo.end();
+             it != endIt;
+             ++it )
+        {
+          TextView::LineRelayoutInfo& lineRelayoutInfo( *it );
+          lineRelayoutInfo.mTextActorIndex = lineRelayoutInfo.mTextActorIndex - endTextActorIndex + firstTextActorIndex + textActors.size();
+        }
+      }
+    }
+  }
+
   for( std::vector<TextActor>::iterator it = relayoutData.mEllipsizedTextActors.begin(),
          endIt = relayoutData.mEllipsizedTextActors.end();
        it != endIt;
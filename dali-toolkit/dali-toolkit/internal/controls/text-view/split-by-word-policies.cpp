@@ -463,21 +463,136 @@ float RelayoutForShrinkToFit( TextView::RelayoutData& relayoutData,
   return shrinkFactor;
 }
 
+/**
+ * Moves vertically the characters of the given lines.
+ *
+ * @param[in] verticalOffset The vertical offset.
+ * @param[in] lineBeginIt Iterator to the first line.
+ * @param[in] lineEndIt Iterator to one past the last line.
+ */
+void MoveLines( const float verticalOffset,
+                TextViewProcessor::LineLayoutInfoContainer::iterator lineBeginIt,
+                TextViewProcessor::LineLayoutInfoContainer::iterator lineEndIt )
+{
+  for( TextViewProcessor::LineLayoutInfoContainer::iterator lineLayoutIt = lineBeginIt; lineLayoutIt != lineEndIt; ++lineLayoutIt )
+  {
+    TextViewProcessor::LineLayoutInfo& lineLayoutInfo( *lineLayoutIt );
+
+    for( TextViewProcessor::WordGroupLayoutInfoContainer::iterator groupLayoutIt = lineLayoutInfo.mWordGroupsLayoutInfo.begin(),
+           endGroupLayoutIt = lineLayoutInfo.mWordGroupsLayoutInfo.end();
+         groupLayoutIt != endGroupLayoutIt;
+         ++groupLayoutIt )
+    {
+      TextViewProcessor::WordGroupLayoutInfo& wordGroupLayoutInfo( *groupLayoutIt );
+
+      for( TextViewProcessor::WordLayoutInfoContainer::iterator wordLayoutIt = wordGroupLayoutInfo.mWordsLayoutInfo.begin(),
+             endWordLayoutIt = wordGroupLayoutInfo.mWordsLayoutInfo.end();
+           wordLayoutIt != endWordLayoutIt;
+           ++wordLayoutIt )
+      {
+        TextViewProcessor::WordLayoutInfo& wordLayoutInfo( *wordLayoutIt );
+
+        for( TextViewProcessor::CharacterLayoutInfoContainer::iterator characterLayoutIt = wordLayoutInfo.mCharactersLayoutInfo.begin(),
+               endCharacterLayoutIt = wordLayoutInfo.mCharactersLayoutInfo.end();
+             characterLayoutIt != endCharacterLayoutIt;
+             ++characterLayoutIt )
+        {
+          ( *characterLayoutIt ).mPosition.y += verticalOffset;
+        } // end characters
+      } // end words
+    } // end group of words
+  } // end lines
+}
+
 void CalculateSizeAndPosition( const TextView::LayoutParameters& layoutParameters,
                                TextView::RelayoutData& relayoutData )
 {
   TextViewRelayout::RelayoutParameters relayoutParameters;
 
-  // clear
-  relayoutData.mCharacterLayoutInfoTable.clear();
-  relayoutData.mLines.clear();
+  // The previous text size is used to check whether the alignment of the lines which are not relaid-out changes.
+  const Size previousTextSize = relayoutData.mTextSizeForRelayoutOption;
   relayoutData.mTextSizeForRelayoutOption = Size();
 
-  // Calculates the text size for split by char.
-  Vector4 minMaxXY( std::numeric_limits<float>::max(),
-                    std::numeric_limits<float>::max(),
-                    std::numeric_limits<float>::min(),
-                    std::numeric_limits<float>::min() );
+  // Only the lines modified since the last relayout are relaid-out if there is a previous layout and it can be reused.
+  // With the original and split exceed policies the layout of a line only depends on the position where the previous one ends.
+
+  TextView::DamagedLines& damagedLines( relayoutData.mDamagedLines );
+  std::vector<TextView::LineRelayoutInfo>& linesRelayoutInfo( relayoutData.mLinesRelayoutInfo );
+  const std::size_t numberOfLines = relayoutData.mTextLayoutInfo.mLinesLayoutInfo.size();
+
+  bool relayoutWholeText = damagedLines.mWholeText ||
+                           ( ( TextView::Original != layoutParameters.mExceedPolicy ) && ( TextView::SplitOriginal != layoutParameters.mExceedPolicy ) ) ||
+                           linesRelayoutInfo.empty() ||
+                           ( linesRelayoutInfo.back().mCharacterGlobalIndex != relayoutData.mCharacterLayoutInfoTable.size() ) ||
+                           ( linesRelayoutInfo.back().mLaidOutLineIndex != relayoutData.mLines.size() ) ||
+                           ( linesRelayoutInfo.back().mLineJustificationIndex != relayoutData.mLineJustificationInfo.size() );
+
+  std::size_t firstLine = 0u;            // Index to the first line to be relaid-out.
+  std::size_t endLine = numberOfLines;   // Index to one past the last line to be relaid-out.
+  std::size_t previousEndLine = 0u;      // Index to the first line after the relaid-out ones within the previous layout.
+
+  if( !relayoutWholeText )
+  {
+    const std::size_t previousNumberOfLines = linesRelayoutInfo.size() - 1u;
+
+    // If no line is modified, the range is empty.
+    firstLine = std::min( damagedLines.mFirstModifiedLine, previousNumberOfLines );
+    const std::size_t linesAfter = std::min( damagedLines.mLinesAfterModified, previousNumberOfLines - firstLine );
+
+    if( firstLine + linesAfter > numberOfLines )
+    {
+      // The damaged lines don't match the text.
+      relayoutWholeText = true;
+    }
+    else
+    {
+      previousEndLine = previousNumberOfLines - linesAfter;
+      endLine = numberOfLines - linesAfter;
+    }
+  }
+
+  // Layout info of the lines after the relaid-out ones. It's appended once the modified lines are relaid-out.
+  Toolkit::TextView::CharacterLayoutInfoContainer charactersAfter;
+  Toolkit::TextView::LineLayoutInfoContainer laidOutLinesAfter;
+  std::vector<TextView::LineJustificationInfo> lineJustificationInfoAfter;
+  std::vector<TextView::LineRelayoutInfo> linesRelayoutInfoAfter;
+
+  std::size_t textActorIndex = 0u;
+
+  if( relayoutWholeText )
+  {
+    damagedLines.SetWholeText();
+
+    // clear
+    relayoutData.mCharacterLayoutInfoTable.clear();
+    relayoutData.mLines.clear();
+    relayoutData.mLineJustificationInfo.clear();
+    linesRelayoutInfo.clear();
+
+    relayoutParameters.mPositionOffset = Vector3::ZERO;
+    relayoutParameters.mCharacterGlobalIndex = 0u;
+  }
+  else
+  {
+    const TextView::LineRelayoutInfo firstLineRelayoutInfo( linesRelayoutInfo[firstLine] );
+    const TextView::LineRelayoutInfo& previousEndLineRelayoutInfo( linesRelayoutInfo[previousEndLine] );
+
+    charactersAfter.assign( relayoutData.mCharacterLayoutInfoTable.begin() + previousEndLineRelayoutInfo.mCharacterGlobalIndex, relayoutData.mCharacterLayoutInfoTable.end() );
+    laidOutLinesAfter.assign( relayoutData.mLines.begin() + previousEndLineRelayoutInfo.mLaidOutLineIndex, relayoutData.mLines.end() );
+    lineJustificationInfoAfter.assign( relayoutData.mLineJustificationInfo.begin() + previousEndLineRelayoutInfo.mLineJustificationIndex, relayoutData.mLineJustificationInfo.end() );
+    linesRelayoutInfoAfter.assign( linesRelayoutInfo.begin() + previousEndLine, linesRelayoutInfo.end() );
+
+    // Removes the layout info of the modified lines and the ones after them.
+    relayoutData.mCharacterLayoutInfoTable.erase( relayoutData.mCharacterLayoutInfoTable.begin() + firstLineRelayoutInfo.mCharacterGlobalIndex, relayoutData.mCharacterLayoutInfoTable.end() );
+    relayoutData.mLines.erase( relayoutData.mLines.begin() + firstLineRelayoutInfo.mLaidOutLineIndex, relayoutData.mLines.end() );
+    relayoutData.mLineJustificationInfo.erase( relayoutData.mLineJustificationInfo.begin() + firstLineRelayoutInfo.mLineJustificationIndex, relayoutData.mLineJustificationInfo.end() );
+    linesRelayoutInfo.erase( linesRelayoutInfo.begin() + firstLine, linesRelayoutInfo.end() );
+
+    // Continues from the state at the beginning of the first modified line.
+    relayoutParameters.mPositionOffset = firstLineRelayoutInfo.mPositionOffset;
+    relayoutParameters.mCharacterGlobalIndex = firstLineRelayoutInfo.mCharacterGlobalIndex;
+    textActorIndex = firstLineRelayoutInfo.mTextActorIndex;
+  }
 
   relayoutData.mShrinkFactor = 1.f; // Shrink factor used when the exceed policy contains ShrinkToFit
 
@@ -491,18 +606,30 @@ void CalculateSizeAndPosition( const TextView::LayoutParameters& layoutParameter
     relayoutData.mShrinkFactor = ( relayoutData.mTextLayoutInfo.mMaxWordWidth > relayoutData.mTextViewSize.width ? relayoutData.mTextViewSize.width / relayoutData.mTextLayoutInfo.mMaxWordWidth : 1.f );
   }
 
-  relayoutParameters.mPositionOffset = Vector3::ZERO;
-  relayoutParameters.mIsFirstCharacter = true;
-  relayoutParameters.mIndices.mLineIndex = 0;
-  relayoutParameters.mCharacterGlobalIndex = 0;
+  relayoutParameters.mIsFirstCharacter = ( 0u == relayoutParameters.mCharacterGlobalIndex );
+  relayoutParameters.mIndices.mLineIndex = firstLine;
 
-  for( TextViewProcessor::LineLayoutInfoContainer::iterator lineLayoutIt = relayoutData.mTextLayoutInfo.mLinesLayoutInfo.begin(),
-       endLineLayoutIt = relayoutData.mTextLayoutInfo.mLinesLayoutInfo.end();
+  for( TextViewProcessor::LineLayoutInfoContainer::iterator lineLayoutIt = relayoutData.mTextLayoutInfo.mLinesLayoutInfo.begin() + firstLine,
+       endLineLayoutIt = relayoutData.mTextLayoutInfo.mLinesLayoutInfo.begin() + endLine;
        lineLayoutIt != endLineLayoutIt;
        ++lineLayoutIt, ++relayoutParameters.mIndices.mLineIndex )
   {
     TextViewProcessor::LineLayoutInfo& lineLayoutInfo( *lineLayoutIt );
 
+    // Stores the state at the beginning of the line. The text-actor index is set when text-actors are inserted into the text-view.
+    TextView::LineRelayoutInfo lineRelayoutInfo;
+    lineRelayoutInfo.mPositionOffset = relayoutParameters.mPositionOffset;
+    lineRelayoutInfo.mCharacterGlobalIndex = relayoutParameters.mCharacterGlobalIndex;
+    lineRelayoutInfo.mLaidOutLineIndex = relayoutData.mLines.size();
+    lineRelayoutInfo.mLineJustificationIndex = relayoutData.mLineJustificationInfo.size();
+    lineRelayoutInfo.mTextActorIndex = textActorIndex;
+
+    // Calculates the line size for split by word.
+    lineRelayoutInfo.mMinMaxXY = Vector4( std::numeric_limits<float>::max(),
+                                          std::numeric_limits<float>::max(),
+                                          std::numeric_limits<float>::min(),
+                                          std::numeric_limits<float>::min() );
+
     relayoutParameters.mIsNewLine = true;
     relayoutParameters.mLineSize = lineLayoutInfo.mSize;
     relayoutParameters.mIndices.mGroupIndex = 0;
@@ -606,7 +733,7 @@ void CalculateSizeAndPosition( const TextView::LayoutParameters& layoutParameter
           }
 
           // updates min and max position to calculate the text size for split by word.
-          TextViewRelayout::UpdateLayoutInfoTable( minMaxXY,
+          TextViewRelayout::UpdateLayoutInfoTable( lineRelayoutInfo.mMinMaxXY,
                                                    wordGroupLayoutInfo,
                                                    wordLayoutInfo,
                                                    characterLayoutInfo,
@@ -620,8 +747,105 @@ void CalculateSizeAndPosition( const TextView::LayoutParameters& layoutParameter
         } // end characters
       } // end words
     } // end group of words
+
+    linesRelayoutInfo.push_back( lineRelayoutInfo );
   } // end lines
 
+  // The state one past the last relaid-out line.
+  TextView::LineRelayoutInfo endLineRelayoutInfo;
+  endLineRelayoutInfo.mPositionOffset = relayoutParameters.mPositionOffset;
+  endLineRelayoutInfo.mMinMaxXY = Vector4( std::numeric_limits<float>::max(),
+                                           std::numeric_limits<float>::max(),
+                                           std::numeric_limits<float>::min(),
+                                           std::numeric_limits<float>::min() );
+  endLineRelayoutInfo.mCharacterGlobalIndex = relayoutParameters.mCharacterGlobalIndex;
+  endLineRelayoutInfo.mLaidOutLineIndex = relayoutData.mLines.size();
+  endLineRelayoutInfo.mLineJustificationIndex = relayoutData.mLineJustificationInfo.size();
+  endLineRelayoutInfo.mTextActorIndex = textActorIndex;
+
+  // Vertical offset of the lines after the relaid-out ones.
+  float verticalOffset = 0.f;
+
+  if( relayoutWholeText )
+  {
+    linesRelayoutInfo.push_back( endLineRelayoutInfo );
+  }
+  else
+  {
+    // The position of a line only depends on where the previous one ends. If it ends in a different place, the following lines are moved.
+    const TextView::LineRelayoutInfo previousEndLineRelayoutInfo( *linesRelayoutInfoAfter.begin() );
+    const float previousPositionY = ( 0u == previousEndLineRelayoutInfo.mCharacterGlobalIndex ) ? 0.f : previousEndLineRelayoutInfo.mPositionOffset.y;
+    const float positionY = ( 0u == endLineRelayoutInfo.mCharacterGlobalIndex ) ? 0.f : endLineRelayoutInfo.mPositionOffset.y;
+    verticalOffset = positionY - previousPositionY;
+
+    for( Toolkit::TextView::CharacterLayoutInfoContainer::iterator it = charactersAfter.begin(), endIt = charactersAfter.end(); it != endIt; ++it )
+    {
+      ( *it ).mPosition.y += verticalOffset;
+    }
+    relayoutData.mCharacterLayoutInfoTable.insert( relayoutData.mCharacterLayoutInfoTable.end(), charactersAfter.begin(), charactersAfter.end() );
+
+    for( Toolkit::TextView::LineLayoutInfoContainer::iterator it = laidOutLinesAfter.begin(), endIt = laidOutLinesAfter.end(); it != endIt; ++it )
+    {
+      Toolkit::TextView::LineLayoutInfo& lineInfo( *it );
+      lineInfo.mCharacterGlobalIndex = lineInfo.mCharacterGlobalIndex - previousEndLineRelayoutInfo.mCharacterGlobalIndex + endLineRelayoutInfo.mCharacterGlobalIndex;
+    }
+    relayoutData.mLines.insert( relayoutData.mLines.end(), laidOutLinesAfter.begin(), laidOutLinesAfter.end() );
+
+    for( std::vector<TextView::LineJustificationInfo>::iterator it = lineJustificationInfoAfter.begin(), endIt = lineJustificationInfoAfter.end(); it != endIt; ++it )
+    {
+      TextView::LineJustificationInfo& justificationInfo( *it );
+      justificationInfo.mIndices.mLineIndex = justificationInfo.mIndices.mLineIndex - previousEndLine + endLine;
+    }
+    relayoutData.mLineJustificationInfo.insert( relayoutData.mLineJustificationInfo.end(), lineJustificationInfoAfter.begin(), lineJustificationInfoAfter.end() );
+
+    for( std::vector<TextView::LineRelayoutInfo>::iterator it = linesRelayoutInfoAfter.begin(), endIt = linesRelayoutInfoAfter.end(); it != endIt; ++it )
+    {
+      TextView::LineRelayoutInfo& lineRelayoutInfo( *it );
+
+      // Empty lines don't have a size.
+      const bool hasCharacters = ( it + 1 != endIt ) && ( ( *( it + 1 ) ).mCharacterGlobalIndex > lineRelayoutInfo.mCharacterGlobalIndex );
+      if( hasCharacters )
+      {
+        lineRelayoutInfo.mMinMaxXY.y += verticalOffset;
+        lineRelayoutInfo.mMinMaxXY.w += verticalOffset;
+      }
+      lineRelayoutInfo.mPositionOffset.y += verticalOffset;
+
+      // The text-actor index is updated when text-actors are inserted into the text-view.
+      lineRelayoutInfo.mCharacterGlobalIndex = lineRelayoutInfo.mCharacterGlobalIndex - previousEndLineRelayoutInfo.mCharacterGlobalIndex + endLineRelayoutInfo.mCharacterGlobalIndex;
+      lineRelayoutInfo.mLaidOutLineIndex = lineRelayoutInfo.mLaidOutLineIndex - previousEndLineRelayoutInfo.mLaidOutLineIndex + endLineRelayoutInfo.mLaidOutLineIndex;
+      lineRelayoutInfo.mLineJustificationIndex = lineRelayoutInfo.mLineJustificationIndex - previousEndLineRelayoutInfo.mLineJustificationIndex + endLineRelayoutInfo.mLineJustificationIndex;
+    }
+
+    // The first line after the relaid-out ones starts where the last relaid-out one ends.
+    ( *linesRelayoutInfoAfter.begin() ).mPositionOffset = endLineRelayoutInfo.mPositionOffset;
+
+    linesRelayoutInfo.insert( linesRelayoutInfo.end(), linesRelayoutInfoAfter.begin(), linesRelayoutInfoAfter.end() );
+
+    if( fabsf( verticalOffset ) > 0.f )
+    {
+      MoveLines( verticalOffset,
+                 relayoutData.mTextLayoutInfo.mLinesLayoutInfo.begin() + endLine,
+                 relayoutData.mTextLayoutInfo.mLinesLayoutInfo.end() );
+    }
+  }
+
+  // Calculates the text size for split by word.
+  Vector4 minMaxXY( std::numeric_limits<float>::max(),
+                    std::numeric_limits<float>::max(),
+                    std::numeric_limits<float>::min(),
+                    std::numeric_limits<float>::min() );
+
+  for( std::vector<TextView::LineRelayoutInfo>::const_iterator it = linesRelayoutInfo.begin(), endIt = linesRelayoutInfo.end(); it != endIt; ++it )
+  {
+    const Vector4& lineMinMaxXY( ( *it ).mMinMaxXY );
+
+    minMaxXY.x = std::min( minMaxXY.x, lineMinMaxXY.x );
+    minMaxXY.y = std::min( minMaxXY.y, lineMinMaxXY.y );
+    minMaxXY.z = std::max( minMaxXY.z, lineMinMaxXY.z );
+    minMaxXY.w = std::max( minMaxXY.w, lineMinMaxXY.w );
+  }
+
   if( relayoutData.mCharacterLayoutInfoTable.empty() )
   {
     relayoutData.mTextSizeForRelayoutOption = Size();
@@ -642,6 +866,26 @@ void CalculateSizeAndPosition( const TextView::LayoutParameters& layoutParameter
       relayoutData.mTextSizeForRelayoutOption.height += lineLayoutInfo.mSize.height * relayoutData.mShrinkFactor;
     }
   }
+
+  if( !relayoutWholeText )
+  {
+    // The alignment and justification offsets of all lines change if they depend on a text size which has changed.
+    const bool widthChanged = ( previousTextSize.width != relayoutData.mTextSizeForRelayoutOption.width ) &&
+                              ( ( Toolkit::Alignment::HorizontalLeft != layoutParameters.mHorizontalAlignment ) ||
+                                ( Toolkit::TextView::Center == layoutParameters.mLineJustification ) ||
+                                ( Toolkit::TextView::Right == layoutParameters.mLineJustification ) );
+    const bool heightChanged = ( previousTextSize.height != relayoutData.mTextSizeForRelayoutOption.height ) &&
+                               ( Toolkit::Alignment::VerticalTop != layoutParameters.mVerticalAlignment );
+
+    if( widthChanged || heightChanged )
+    {
+      damagedLines.AddMovedLines( 0u, 0u );
+    }
+    else if( fabsf( verticalOffset ) > 0.f )
+    {
+      damagedLines.AddMovedLines( firstLine, 0u );
+    }
+  }
 }
 
 } // namespace
@@ -654,7 +898,6 @@ void Relayout( Actor textView,
 {
   if( relayoutOperationMask & TextView::RELAYOUT_SIZE_POSITION )
   {
-    relayoutData.mLineJustificationInfo.clear();
     CalculateSizeAndPosition( layoutParameters,
                               relayoutData );
 
@@ -25,6 +25,11 @@
 #include "text-view-word-processor.h"
 #include "relayout-utilities.h"
 #include "text-view-processor-dbg.h"
+#include "font-metrics-cache.h"
+
+// EXTERNAL INCLUDES
+#include <algorithm>
+#include <limits>
 
 namespace Dali
 {
@@ -104,6 +109,72 @@ bool IsTextViewProcessorNewStyleOperation( const TextView::TextViewProcessorMeta
   return ( metadata.mType == TextView::NewStyle );
 }
 
+/**
+ * Whether a character is before the beginning of a line.
+ *
+ * @param[in] characterIndex Index to the character within the whole text.
+ * @param[in] lineRelayoutInfo The relayout state at the beginning of the line.
+ *
+ * @return \e true if the character is before the line.
+ */
+bool IsCharacterBeforeLine( const std::size_t characterIndex, const TextView::LineRelayoutInfo& lineRelayoutInfo )
+{
+  return characterIndex < lineRelayoutInfo.mCharacterGlobalIndex;
+}
+
+/**
+ * Retrieves the index of the line (piece of text between two new line characters) which contains the given character.
+ *
+ * While the text hasn't been modified since the last split by word relayout, the index to the first character of each line
+ * is stored in RelayoutData::mLinesRelayoutInfo and the line is found with a binary search. Otherwise the lines are traversed.
+ *
+ * @param[in] characterIndex Index to the character within the whole text. If it's out of bounds the last line is returned.
+ * @param[in] relayoutData The text layout info and the relayout state of each line.
+ *
+ * @return The index to the line.
+ */
+std::size_t GetLineIndex( const std::size_t characterIndex, const TextView::RelayoutData& relayoutData )
+{
+  const TextViewProcessor::TextLayoutInfo& textLayoutInfo( relayoutData.mTextLayoutInfo );
+  const std::vector<TextView::LineRelayoutInfo>& linesRelayoutInfo( relayoutData.mLinesRelayoutInfo );
+  const std::size_t numberOfLines = textLayoutInfo.mLinesLayoutInfo.size();
+
+  if( 0u == numberOfLines )
+  {
+    return 0u;
+  }
+
+  if( relayoutData.mDamagedLines.IsClear() &&
+      ( linesRelayoutInfo.size() == numberOfLines + 1u ) &&
+      ( linesRelayoutInfo.back().mCharacterGlobalIndex == textLayoutInfo.mNumberOfCharacters ) )
+  {
+    // The line which contains the character is the last one which doesn't start after it.
+    const std::vector<TextView::LineRelayoutInfo>::const_iterator lineIt = std::upper_bound( linesRelayoutInfo.begin(),
+                                                                                             linesRelayoutInfo.begin() + numberOfLines,
+                                                                                             characterIndex,
+                                                                                             IsCharacterBeforeLine );
+
+    return ( lineIt == linesRelayoutInfo.begin() ) ? 0u : ( lineIt - linesRelayoutInfo.begin() ) - 1u;
+  }
+
+  std::size_t lineIndex = 0u;
+  std::size_t lineCharacterIndex = 0u; // Index to the first character of the current line.
+
+  for( TextViewProcessor::LineLayoutInfoContainer::const_iterator lineIt = textLayoutInfo.mLinesLayoutInfo.begin(), lineEndIt = textLayoutInfo.mLinesLayoutInfo.end();
+       lineIt != lineEndIt;
+       ++lineIt, ++lineIndex )
+  {
+    lineCharacterIndex += ( *lineIt ).mNumberOfCharacters;
+
+    if( characterIndex < lineCharacterIndex )
+    {
+      return lineIndex;
+    }
+  }
+
+  return numberOfLines - 1u;
+}
+
 } // namespace
 
 TextView::TextViewProcessorMetadata::TextViewProcessorMetadata()
@@ -161,6 +232,9 @@ void TextView::SetText( const MarkupProcessor::StyledTextArray& text )
   // Updates current styled text.
   mCurrentStyledText = text;
 
+  // The whole text needs to be relaid-out.
+  mRelayoutData.mDamagedLines.SetWholeText();
+
   // Request to be relaid out
   RelayoutRequest();
 
@@ -287,6 +361,9 @@ void TextView::SetLineHeightOffset( const PointSize offset )
     // Updates line height offset.
     mLayoutParameters.mLineHeightOffset = offset;
 
+    // The whole text needs to be relaid-out.
+    mRelayoutData.mDamagedLines.SetWholeText();
+
     RelayoutRequest();
 
     // If a GetTextLayoutInfo() or GetHeightForWidth() arrives, relayout the text synchronously is needed on order to retrieve the right values.
@@ -354,6 +431,9 @@ void TextView::SetStyleToCurrentText( const TextStyle& style, const TextStyle::M
 
       MarkupProcessor::SetTextStyle( mCurrentStyledText, style, mask );
 
+      // The whole text needs to be relaid-out.
+      mRelayoutData.mDamagedLines.SetWholeText();
+
       RelayoutRequest();
 
       if( RELAYOUT_ALL != mRelayoutOperations )
@@ -390,6 +470,9 @@ void TextView::SetTextAlignment( Toolkit::Alignment::Type align )
     mLayoutParameters.mHorizontalAlignment = horizontalAlignment;
     mLayoutParameters.mVerticalAlignment = verticalAlignment;
 
+    // The whole text needs to be relaid-out.
+    mRelayoutData.mDamagedLines.SetWholeText();
+
     RelayoutRequest();
 
     // If a GetTextLayoutInfo() or GetHeightForWidth() arrives, relayout the text synchronously is needed in order to retrieve the right values.
@@ -417,6 +500,9 @@ void TextView::SetMultilinePolicy( Toolkit::TextView::MultilinePolicy policy )
     // If a GetTextLayoutInfo() or GetHeightForWidth() arrives, relayout the text synchronously is needed on order to retrieve the right values.
     mRelayoutOperations = RELAYOUT_ALL;
 
+    // The whole text needs to be relaid-out.
+    mRelayoutData.mDamagedLines.SetWholeText();
+
     RelayoutRequest();
   }
 }
@@ -438,6 +524,9 @@ void TextView::SetWidthExceedPolicy( Toolkit::TextView::ExceedPolicy policy )
     // If a GetTextLayoutInfo() or GetHeightForWidth() arrives, relayout the text synchronously is needed in order to retrieve the right values.
     mRelayoutOperations = RELAYOUT_ALL;
 
+    // The whole text needs to be relaid-out.
+    mRelayoutData.mDamagedLines.SetWholeText();
+
     RelayoutRequest();
   }
 }
@@ -453,6 +542,9 @@ void TextView::SetHeightExceedPolicy( Toolkit::TextView::ExceedPolicy policy )
   {
     mLayoutParameters.mHeightExceedPolicy = policy;
 
+    // The whole text needs to be relaid-out.
+    mRelayoutData.mDamagedLines.SetWholeText();
+
     RelayoutRequest();
 
     // If a GetTextLayoutInfo() or GetHeightForWidth() arrives, relayout the text synchronously is needed in order to retrieve the right values.
@@ -481,6 +573,9 @@ void TextView::SetLineJustification( Toolkit::TextView::LineJustification justif
   {
     mLayoutParameters.mLineJustification = justification;
 
+    // The whole text needs to be relaid-out.
+    mRelayoutData.mDamagedLines.SetWholeText();
+
     RelayoutRequest();
 
     // If a GetTextLayoutInfo() or GetHeightForWidth() arrives, relayout the text synchronously is needed in order to retrieve the right values.
@@ -512,6 +607,9 @@ void TextView::SetFadeBoundary( const Toolkit::TextView::FadeBoundary& fadeBound
   {
     mVisualParameters.mFadeBoundary = fadeBoundary;
 
+    // The whole text needs to be relaid-out.
+    mRelayoutData.mDamagedLines.SetWholeText();
+
     RelayoutRequest();
 
     // If a GetTextLayoutInfo() or GetHeightForWidth() arrives, relayout the text synchronously is needed in order to retrieve the right values.
@@ -550,6 +648,9 @@ void TextView::SetEllipsizeText( const MarkupProcessor::StyledTextArray& ellipsi
   TextViewProcessor::CreateWordTextInfo( mLayoutParameters.mEllipsizeText,
                                          mRelayoutData.mTextLayoutInfo.mEllipsizeLayoutInfo );
 
+  // The whole text needs to be relaid-out.
+  mRelayoutData.mDamagedLines.SetWholeText();
+
   // Request to be relaid out
   RelayoutRequest();
 
@@ -591,8 +692,8 @@ void TextView::GetTextLayoutInfo()
     if( ( textViewSize.width > Math::MACHINE_EPSILON_1000 ) &&
         ( textViewSize.height > Math::MACHINE_EPSILON_1000 ) )
     {
-      // Check if the text-view has text-actors.
-      const bool hasTextActors = !mRelayoutData.mTextActors.empty();
+      // Check if the text-view has text-actors which need to be removed.
+      const bool hasTextActors = !mRelayoutData.mTextActors.empty() && !IsIncrementalRelayoutPossible( textViewSize.GetVectorXY() );
 
       RelayoutOperationMask mask = NO_RELAYOUT;
       if( relayoutSizeAndPositionNeeded )
@@ -729,6 +830,10 @@ void TextView::SetSnapshotModeEnabled( bool enable )
                                                                 RELAYOUT_INSERT_TO_TEXT_VIEW |
                                                                 RELAYOUT_INSERT_TO_TEXT_ACTOR_LIST );
     }
+
+    // The whole text needs to be relaid-out.
+    mRelayoutData.mDamagedLines.SetWholeText();
+
     RelayoutRequest();
   }
 }
@@ -939,6 +1044,89 @@ TextView::VisualParameters& TextView::VisualParameters::operator=( const TextVie
   return *this;
 }
 
+TextView::LineRelayoutInfo::LineRelayoutInfo()
+: mPositionOffset(),
+  mMinMaxXY(),
+  mCharacterGlobalIndex( 0u ),
+  mLaidOutLineIndex( 0u ),
+  mLineJustificationIndex( 0u ),
+  mTextActorIndex( 0u )
+{
+}
+
+TextView::DamagedLines::DamagedLines()
+: mFirstModifiedLine( std::numeric_limits<std::size_t>::max() ),
+  mLinesAfterModified( std::numeric_limits<std::size_t>::max() ),
+  mFirstMovedLine( std::numeric_limits<std::size_t>::max() ),
+  mLinesAfterMoved( std::numeric_limits<std::size_t>::max() ),
+  mWholeText( true )
+{
+}
+
+void TextView::DamagedLines::AddModifiedLines( const std::size_t firstLine, const std::size_t linesAfter )
+{
+  mFirstModifiedLine = std::min( mFirstModifiedLine, firstLine );
+  mLinesAfterModified = std::min( mLinesAfterModified, linesAfter );
+}
+
+void TextView::DamagedLines::AddMovedLines( const std::size_t firstLine, const std::size_t linesAfter )
+{
+  mFirstMovedLine = std::min( mFirstMovedLine, firstLine );
+  mLinesAfterMoved = std::min( mLinesAfterMoved, linesAfter );
+}
+
+void TextView::DamagedLines::SetWholeText()
+{
+  mWholeText = true;
+}
+
+void TextView::DamagedLines::Clear()
+{
+  mFirstModifiedLine = std::numeric_limits<std::size_t>::max();
+  mLinesAfterModified = std::numeric_limits<std::size_t>::max();
+  mFirstMovedLine = std::numeric_limits<std::size_t>::max();
+  mLinesAfterMoved = std::numeric_limits<std::size_t>::max();
+  mWholeText = false;
+}
+
+bool TextView::DamagedLines::IsClear() const
+{
+  return ( !mWholeText &&
+           ( std::numeric_limits<std::size_t>::max() == mFirstModifiedLine ) &&
+           ( std::numeric_limits<std::size_t>::max() == mFirstMovedLine ) );
+}
+
+void TextView::DamagedLines::GetModifiedLines( const std::size_t numberOfLines, std::size_t& begin, std::size_t& end ) const
+{
+  if( mWholeText )
+  {
+    begin = 0u;
+    end = numberOfLines;
+    return;
+  }
+
+  // The lines after the range are counted from the end of the text.
+  begin = std::min( mFirstModifiedLine, numberOfLines );
+  end = ( mLinesAfterModified < numberOfLines - begin ) ? numberOfLines - mLinesAfterModified : begin;
+}
+
+void TextView::DamagedLines::GetMovedLines( const std::size_t numberOfLines, std::size_t& begin, std::size_t& end ) const
+{
+  if( mWholeText )
+  {
+    begin = 0u;
+    end = numberOfLines;
+    return;
+  }
+
+  // Modified lines need to be positioned as well.
+  const std::size_t firstLine = std::min( mFirstMovedLine, mFirstModifiedLine );
+  const std::size_t linesAfter = std::min( mLinesAfterMoved, mLinesAfterModified );
+
+  begin = std::min( firstLine, numberOfLines );
+  end = ( linesAfter < numberOfLines - begin ) ? numberOfLines - linesAfter : begin;
+}
+
 TextView::RelayoutData::RelayoutData()
 : mTextViewSize(),
   mShrinkFactor( 1.f ),
@@ -948,7 +1136,9 @@ TextView::RelayoutData::RelayoutData()
   mTextActors(),
   mCharacterLayoutInfoTable(),
   mLines(),
-  mTextSizeForRelayoutOption()
+  mTextSizeForRelayoutOption(),
+  mLinesRelayoutInfo(),
+  mDamagedLines()
 {
 }
 
@@ -961,7 +1151,9 @@ TextView::RelayoutData::RelayoutData( const TextView::RelayoutData& relayoutData
   mTextActors( relayoutData.mTextActors ),
   mCharacterLayoutInfoTable( relayoutData.mCharacterLayoutInfoTable ),
   mLines( relayoutData.mLines ),
-  mTextSizeForRelayoutOption( relayoutData.mTextSizeForRelayoutOption )
+  mTextSizeForRelayoutOption( relayoutData.mTextSizeForRelayoutOption ),
+  mLinesRelayoutInfo( relayoutData.mLinesRelayoutInfo ),
+  mDamagedLines( relayoutData.mDamagedLines )
 {
 }
 
@@ -976,6 +1168,8 @@ TextView::RelayoutData& TextView::RelayoutData::operator=( const TextView::Relay
   mCharacterLayoutInfoTable = relayoutData.mCharacterLayoutInfoTable;
   mLines = relayoutData.mLines;
   mTextSizeForRelayoutOption = relayoutData.mTextSizeForRelayoutOption;
+  mLinesRelayoutInfo = relayoutData.mLinesRelayoutInfo;
+  mDamagedLines = relayoutData.mDamagedLines;
 
   return *this;
 }
@@ -1026,7 +1220,7 @@ Vector3 TextView::GetNaturalSize()
   {
     // There are SetText, Inserts or Removes to do. It means the current layout info is not updated.
 
-    if( !mRelayoutData.mTextActors.empty() )
+    if( !mRelayoutData.mTextActors.empty() && !IsIncrementalRelayoutPossible( mRelayoutData.mTextViewSize ) )
     {
       // Remove text-actors from the text-view as some text-operation like CreateTextInfo()
       // add them to the text-actor cache.
@@ -1060,8 +1254,11 @@ float TextView::GetHeightForWidth( float width )
     // Check if the given width is different than the current one.
     const bool differentWidth = ( fabsf( width - mRelayoutData.mTextViewSize.width ) > Math::MACHINE_EPSILON_1000 );
 
-    // Check if the text-view has text-actors.
-    const bool hasTextActors = !mRelayoutData.mTextActors.empty();
+    // Use the given width.
+    const Vector2 textViewSize( width, GetControlSize().height );
+
+    // Check if the text-view has text-actors which need to be removed.
+    const bool hasTextActors = !mRelayoutData.mTextActors.empty() && !IsIncrementalRelayoutPossible( textViewSize );
 
     // Check which layout operations need to be done.
     const bool relayoutSizeAndPositionNeeded = ( mRelayoutOperations & RELAYOUT_SIZE_POSITION ) || differentWidth;
@@ -1076,9 +1273,6 @@ float TextView::GetHeightForWidth( float width )
         mRelayoutData.mTextActors.clear();
       }
 
-      // Use the given width.
-      const Vector2 textViewSize( width, GetControlSize().height );
-
       // Relays-out but doesn't add text-actors to the text-view.
       DoRelayOut( textViewSize, RELAYOUT_SIZE_POSITION );
     }
@@ -1187,6 +1381,12 @@ void TextView::OnInitialize()
 
 void TextView::OnStyleChange( StyleChange change )
 {
+  if( change.defaultFontChange || change.defaultFontSizeChange )
+  {
+    // The cached fonts and metrics may not be valid any more.
+    TextViewProcessor::FontMetricsCache::Get().Clear();
+  }
+
   mRelayoutData.mTextLayoutInfo.mEllipsizeLayoutInfo = TextViewProcessor::WordLayoutInfo();
   TextViewProcessor::CreateWordTextInfo( mLayoutParameters.mEllipsizeText,
                                          mRelayoutData.mTextLayoutInfo.mEllipsizeLayoutInfo );
@@ -1201,6 +1401,9 @@ void TextView::OnControlSizeSet( const Vector3& size )
     // If a GetTextLayoutInfo() or GetHeightForWidth() arrives, relayout the text synchronously is needed in order to retrieve the right values.
     mRelayoutOperations = RELAYOUT_ALL;
 
+    // The whole text needs to be relaid-out.
+    mRelayoutData.mDamagedLines.SetWholeText();
+
     // Request to be relaid out
     RelayoutRequest();
   }
@@ -1230,8 +1433,8 @@ void TextView::OnRelaidOut( Vector2 size, ActorSizeContainer& container )
     }
   }
 
-  // Remove text-actors from text-view
-  if( !mRelayoutData.mTextActors.empty() && ( mRelayoutOperations & RELAYOUT_REMOVE_TEXT_ACTORS ) )
+  // Remove text-actors from text-view. They are kept if only the damaged lines are relaid-out.
+  if( !mRelayoutData.mTextActors.empty() && ( mRelayoutOperations & RELAYOUT_REMOVE_TEXT_ACTORS ) && !IsIncrementalRelayoutPossible( size ) )
   {
     TextViewRelayout::RemoveTextActors( GetRootActor(), mRelayoutData.mTextActors );
     mRelayoutData.mTextActors.clear();
@@ -1263,6 +1466,8 @@ void TextView::PerformTextViewProcessorOperations()
     {
       case TextView::TextSet:
       {
+        mRelayoutData.mDamagedLines.SetWholeText();
+
         TextViewProcessor::CreateTextInfo( relayoutMetadata.mText,
                                            mLayoutParameters,
                                            mRelayoutData );
@@ -1270,6 +1475,8 @@ void TextView::PerformTextViewProcessorOperations()
       }
       case TextView::TextInserted:
       {
+        AddDamagedLines( relayoutMetadata.mPosition, 0u );
+
         TextViewProcessor::UpdateTextInfo( relayoutMetadata.mPosition,
                                            relayoutMetadata.mText,
                                            mLayoutParameters,
@@ -1278,6 +1485,8 @@ void TextView::PerformTextViewProcessorOperations()
       }
       case TextView::TextReplaced:
       {
+        AddDamagedLines( relayoutMetadata.mPosition, relayoutMetadata.mNumberOfCharacters );
+
         TextViewProcessor::UpdateTextInfo( relayoutMetadata.mPosition,
                                            relayoutMetadata.mNumberOfCharacters,
                                            relayoutMetadata.mText,
@@ -1287,6 +1496,8 @@ void TextView::PerformTextViewProcessorOperations()
       }
       case TextView::TextRemoved:
       {
+        AddDamagedLines( relayoutMetadata.mPosition, relayoutMetadata.mNumberOfCharacters );
+
         TextViewProcessor::UpdateTextInfo( relayoutMetadata.mPosition,
                                            relayoutMetadata.mNumberOfCharacters,
                                            mLayoutParameters,
@@ -1296,12 +1507,16 @@ void TextView::PerformTextViewProcessorOperations()
       }
       case TextView::NewLineHeight:
       {
+        mRelayoutData.mDamagedLines.SetWholeText();
+
         TextViewProcessor::UpdateTextInfo( mLayoutParameters.mLineHeightOffset,
                                            mRelayoutData.mTextLayoutInfo );
         break;
       }
       case TextView::NewStyle:
       {
+        mRelayoutData.mDamagedLines.SetWholeText();
+
         TextViewProcessor::UpdateTextInfo( ( *relayoutMetadata.mText.begin() ).mStyle,
                                            relayoutMetadata.mStyleMask,
                                            mRelayoutData );
@@ -1371,8 +1586,40 @@ void TextView::OptimizeTextViewProcessorOperations()
   mTextViewProcessorOperations = textViewProcessorOperations;
 }
 
+void TextView::AddDamagedLines( const std::size_t position, const std::size_t numberOfCharacters )
+{
+  const TextViewProcessor::TextLayoutInfo& textLayoutInfo( mRelayoutData.mTextLayoutInfo );
+
+  if( 0u == textLayoutInfo.mNumberOfCharacters )
+  {
+    // The text is created from scratch.
+    mRelayoutData.mDamagedLines.SetWholeText();
+    return;
+  }
+
+  // The line which contains the character after the removed ones is included as it may be merged if a new line character is removed.
+  const std::size_t firstLine = GetLineIndex( position, mRelayoutData );
+  const std::size_t lastLine = GetLineIndex( position + numberOfCharacters, mRelayoutData );
+
+  mRelayoutData.mDamagedLines.AddModifiedLines( firstLine, textLayoutInfo.mLinesLayoutInfo.size() - 1u - lastLine );
+}
+
+bool TextView::IsIncrementalRelayoutPossible( const Size& textViewSize ) const
+{
+  return ( !mRelayoutData.mDamagedLines.mWholeText &&
+           ( Toolkit::TextView::SplitByWord == mLayoutParameters.mMultilinePolicy ) &&
+           ( ( Toolkit::TextView::Original == mLayoutParameters.mWidthExceedPolicy ) || ( Toolkit::TextView::Split == mLayoutParameters.mWidthExceedPolicy ) ) &&
+           ( Toolkit::TextView::Original == mLayoutParameters.mHeightExceedPolicy ) &&
+           ( textViewSize == mRelayoutData.mTextViewSize ) );
+}
+
 void TextView::DoRelayOut( const Size& textViewSize, const RelayoutOperationMask relayoutOperationMask )
 {
+  if( !IsIncrementalRelayoutPossible( textViewSize ) )
+  {
+    mRelayoutData.mDamagedLines.SetWholeText();
+  }
+
   // Traverse the relayout operation vector. It fills the natural size, layout and text-actor data structures.
   if( !mTextViewProcessorOperations.empty() )
   {
@@ -1392,6 +1639,12 @@ void TextView::DoRelayOut( const Size& textViewSize, const RelayoutOperationMask
   }
 
   mRelayoutData.mTextViewSize = textViewSize;
+  if( Toolkit::TextView::SplitByWord != mLayoutParameters.mMultilinePolicy )
+  {
+    // Only the split by word policy stores the relayout state of each line.
+    mRelayoutData.mLinesRelayoutInfo.clear();
+  }
+
   switch( mLayoutParameters.mMultilinePolicy )
   {
     case Toolkit::TextView::SplitByNewLineChar:              // multiline policy == SplitByNewLineChar.
@@ -1415,6 +1668,12 @@ void TextView::DoRelayOut( const Size& textViewSize, const RelayoutOperationMask
 
   // Remove done operations from the mask.
   mRelayoutOperations = static_cast<RelayoutOperationMask>( mRelayoutOperations & ~relayoutOperationMask );
+
+  if( NO_RELAYOUT == mRelayoutOperations )
+  {
+    // All text-actors are updated. Next text operations only damage the lines they modify.
+    mRelayoutData.mDamagedLines.Clear();
+  }
 }
 
 void TextView::ProcessSnapshot( const Size& textViewSize )
@@ -414,6 +414,29 @@ private:
    */
   void DoRelayOut( const Size& textViewSize, RelayoutOperationMask relayoutOperationMask );
 
+  /**
+   * Adds the lines modified by a text-view processor operation to the damaged lines.
+   *
+   * It needs to be called before the operation is performed.
+   *
+   * @param[in] position Character position within the text where text is inserted or removed.
+   * @param[in] numberOfCharacters Number of characters to be removed.
+   */
+  void AddDamagedLines( std::size_t position, std::size_t numberOfCharacters );
+
+  /**
+   * Whether only the damaged lines can be relaid-out.
+   *
+   * The text-actors of the lines which are not damaged are kept in the text-view. This is only possible with the split by word
+   * multiline policy and the original or split width exceed policies and the original height exceed policy, and if the size of the
+   * text-view doesn't change.
+   *
+   * @param[in] textViewSize The new text-view's size.
+   *
+   * @return \e true if the text can be relaid-out incrementally.
+   */
+  bool IsIncrementalRelayoutPossible( const Size& textViewSize ) const;
+
   /**
    * Process Snapshot. It refresh the render-task in order to generate a new snapshot image.
    *
@@ -615,6 +638,100 @@ public:
     float                              mLineLength; ///< Length of the line (or portion of line).
   };
 
+  /**
+   * Relayout state at the beginning of a line (piece of text between two new line characters).
+   *
+   * It allows to relay-out a range of lines without traversing the previous ones.
+   */
+  struct LineRelayoutInfo
+  {
+    /**
+     * Default constructor.
+     */
+    LineRelayoutInfo();
+
+    Vector3     mPositionOffset;         ///< The position offset before laying out the first character of the line.
+    Vector4     mMinMaxXY;               ///< Minimum and maximum positions of the line's characters. Used to calculate the text size.
+    std::size_t mCharacterGlobalIndex;   ///< Index to the first character of the line within the whole text.
+    std::size_t mLaidOutLineIndex;       ///< Index to the first laid-out line within RelayoutData::mLines.
+    std::size_t mLineJustificationIndex; ///< Index to the first line justification info within RelayoutData::mLineJustificationInfo.
+    std::size_t mTextActorIndex;         ///< Index to the first text-actor of the line within RelayoutData::mTextActors.
+  };
+
+  /**
+   * Stores which lines (pieces of text between two new line characters) need to be relaid-out.
+   *
+   * A range of lines is stored as the index to its first line and the number of lines after it which are not affected.
+   * It keeps the range valid when lines are inserted or removed within it. Ranges are accumulated until all relayout
+   * operations are done.
+   */
+  struct DamagedLines
+  {
+    /**
+     * Default constructor.
+     *
+     * The whole text is damaged as there is no previous layout.
+     */
+    DamagedLines();
+
+    /**
+     * Adds a range of lines whose text has been modified.
+     *
+     * @param[in] firstLine Index to the first modified line.
+     * @param[in] linesAfter Number of lines after the last modified one.
+     */
+    void AddModifiedLines( std::size_t firstLine, std::size_t linesAfter );
+
+    /**
+     * Adds a range of lines whose text is not modified but its position or alignment has changed.
+     *
+     * @param[in] firstLine Index to the first moved line.
+     * @param[in] linesAfter Number of lines after the last moved one.
+     */
+    void AddMovedLines( std::size_t firstLine, std::size_t linesAfter );
+
+    /**
+     * Sets the whole text to be relaid-out.
+     */
+    void SetWholeText();
+
+    /**
+     * Clears all damaged lines once the relayout operations are done.
+     */
+    void Clear();
+
+    /**
+     * Whether no line has been damaged since the last relayout.
+     *
+     * @return \e true if no line needs to be relaid-out.
+     */
+    bool IsClear() const;
+
+    /**
+     * Retrieves the range of lines whose text has been modified.
+     *
+     * @param[in] numberOfLines The current number of lines.
+     * @param[out] begin Index to the first modified line.
+     * @param[out] end Index to one past the last modified line.
+     */
+    void GetModifiedLines( std::size_t numberOfLines, std::size_t& begin, std::size_t& end ) const;
+
+    /**
+     * Retrieves the range of lines whose position or alignment need to be updated. It includes the modified ones.
+     *
+     * @param[in] numberOfLines The current number of lines.
+     * @param[out] begin Index to the first moved line.
+     * @param[out] end Index to one past the last moved line.
+     */
+    void GetMovedLines( std::size_t numberOfLines, std::size_t& begin, std::size_t& end ) const;
+
+    std::size_t mFirstModifiedLine;  ///< Index to the first modified line.
+    std::size_t mLinesAfterModified; ///< Number of lines after the last modified one.
+    std::size_t mFirstMovedLine;     ///< Index to the first moved line.
+    std::size_t mLinesAfterMoved;    ///< Number of lines after the last moved one.
+    bool        mWholeText;          ///< Whether the whole text needs to be relaid-out.
+  };
+
   /**
    * The results of the relayout process.
    */
@@ -646,6 +763,8 @@ public:
     Toolkit::TextView::LineLayoutInfoContainer      mLines;                       ///< Stores an index to the first character of each line.
     Size                                            mTextSizeForRelayoutOption;   ///< Stores the text size after relayout.
     std::vector<LineJustificationInfo>              mLineJustificationInfo;       ///< Stores justification info per line.
+    std::vector<LineRelayoutInfo>                   mLinesRelayoutInfo;           ///< Stores the relayout state at the beginning of each line plus one past the last line. Only filled by the split by word policy.
+    DamagedLines                                    mDamagedLines;                ///< Stores which lines need to be relaid-out.
     TextActorCache                                  mTextActorCache;              ///< Stores previously created text-actors to be reused.
   };
 
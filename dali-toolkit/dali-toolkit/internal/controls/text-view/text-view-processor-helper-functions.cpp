@@ -16,6 +16,7 @@
 
 // INTERNAL INCLUDES
 #include "text-view-processor-helper-functions.h"
+#include "font-metrics-cache.h"
 
 namespace Dali
 {
@@ -56,6 +57,13 @@ TextSeparatorType GetTextSeparatorType( const Character& character )
 
 void ChooseFontFamilyName( MarkupProcessor::StyledText& text )
 {
+  if( 1u == text.mText.GetLength() )
+  {
+    // Layout is done character by character; use the cached fonts.
+    ChooseFontFamilyName( text.mText[0], text.mStyle );
+    return;
+  }
+
   bool userDefinedFontFamilyName = false;
 
   // First check if there is a font defined in the style and it supports the given text.
@@ -90,6 +98,35 @@ void ChooseFontFamilyName( MarkupProcessor::StyledText& text )
   }
 }
 
+void ChooseFontFamilyName( const Character& character, TextStyle& style )
+{
+  FontMetricsCache& cache = FontMetricsCache::Get();
+
+  // First check if there is a font defined in the style and it supports the given character.
+  if( !style.GetFontName().empty() )
+  {
+    const FontMetricsCache::FontId fontId = cache.GetFontId( style );
+
+    if( !cache.GetFontMetrics( fontId ).mIsDefaultSystemFont && cache.IsGlyphSupported( fontId, character ) )
+    {
+      return;
+    }
+  }
+
+  // At this point no font is set or doesn't support the given character.
+  if( !cache.IsGlyphSupported( cache.GetDefaultFontId(), character ) )
+  {
+    // If the default system font doesn't support the given character,
+    // an appropiate font is selected.
+    style.SetFontName( cache.GetFamilyForCharacter( character ) );
+  }
+  else
+  {
+    // The character is supported with default font, so use it
+    style.SetFontName( "" );
+  }
+}
+
 void GetIndicesFromGlobalCharacterIndex( const std::size_t index,
                                          const TextLayoutInfo& textLayoutInfo,
                                          TextInfoIndices& indices )
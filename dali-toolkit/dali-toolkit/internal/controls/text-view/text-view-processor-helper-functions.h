@@ -77,6 +77,17 @@ TextSeparatorType GetTextSeparatorType( const Character& character );
  */
 void ChooseFontFamilyName( MarkupProcessor::StyledText& text );
 
+/**
+ * Choose a suitable font family name for the given character and style.
+ *
+ * It may modify the given text-style by setting a suitable font-family.
+ * The fonts and the supported characters are retrieved from the shared FontMetricsCache.
+ *
+ * @param[in] character The character.
+ * @param[in,out] style The character's style.
+ */
+void ChooseFontFamilyName( const Character& character, TextStyle& style );
+
 /**
  * Retrieves the line, word group, word and character indices for the given global character's index.
  *
@@ -1067,10 +1067,21 @@ void InitializeTextActorInfo( TextView::RelayoutData& relayoutData )
     return;
   }
 
+  // Only the text-actors of the lines modified since the last relayout are initialized.
+  std::size_t firstLine = 0u;
+  std::size_t endLine = 0u;
+  relayoutData.mDamagedLines.GetModifiedLines( textLayoutInfo.mLinesLayoutInfo.size(), firstLine, endLine );
+
   std::size_t characterGlobalIndex = 0; // Index to the global character (within the whole text).
   std::size_t lineLayoutInfoIndex = 0;  // Index to the laid out line info.
+  if( 0u != firstLine )
+  {
+    const TextView::LineRelayoutInfo& lineRelayoutInfo( *( relayoutData.mLinesRelayoutInfo.begin() + firstLine ) );
+    characterGlobalIndex = lineRelayoutInfo.mCharacterGlobalIndex;
+    lineLayoutInfoIndex = lineRelayoutInfo.mLaidOutLineIndex;
+  }
   const std::size_t lineLayoutInfoSize = relayoutData.mLines.size(); // Number or laid out lines.
-  bool lineLayoutEnd = false;           // Whether lineLayoutInfoIndex points at the last laid out line.
+  bool lineLayoutEnd = lineLayoutInfoIndex >= lineLayoutInfoSize; // Whether lineLayoutInfoIndex points at the last laid out line.
   bool textActorCreatedForLine = false;
 
   TextActor currentTextActor;           // text-actor used when the edit mode is disabled.
@@ -1081,7 +1092,7 @@ void InitializeTextActorInfo( TextView::RelayoutData& relayoutData )
 
   std::vector<TextActor> textActorsToRemove; // Keep a vector of text-actors to be included into the cache.
 
-  for( LineLayoutInfoContainer::iterator lineIt = textLayoutInfo.mLinesLayoutInfo.begin(), lineEndIt = textLayoutInfo.mLinesLayoutInfo.end();
+  for( LineLayoutInfoContainer::iterator lineIt = textLayoutInfo.mLinesLayoutInfo.begin() + firstLine, lineEndIt = textLayoutInfo.mLinesLayoutInfo.begin() + endLine;
        lineIt != lineEndIt;
        ++lineIt )
   {
@@ -17,6 +17,7 @@
 // INTERNAL INCLUDES
 #include "text-view-word-processor.h"
 #include "text-view-processor-helper-functions.h"
+#include "font-metrics-cache.h"
 
 namespace Dali
 {
@@ -95,6 +96,9 @@ WordLayoutInfo& WordLayoutInfo::operator=( const WordLayoutInfo& word )
 void CreateWordTextInfo( const MarkupProcessor::StyledTextArray& word,
                          TextViewProcessor::WordLayoutInfo& wordLayoutInfo )
 {
+  // Fonts and metrics are retrieved from the cache shared by all text-views.
+  FontMetricsCache& fontMetricsCache = FontMetricsCache::Get();
+
   // Split in characters.
   for( MarkupProcessor::StyledTextArray::const_iterator charIt = word.begin(), charEndIt = word.end(); charIt != charEndIt; ++charIt )
   {
@@ -111,19 +115,20 @@ void CreateWordTextInfo( const MarkupProcessor::StyledTextArray& word,
       styledCharacter.mText.Append( character );
 
       //Choose the right font for the given character and style.
-      ChooseFontFamilyName( styledCharacter );
+      ChooseFontFamilyName( character, styledCharacter.mStyle );
 
-      const Font font = Font::New( FontParameters( styledCharacter.mStyle.GetFontName(), styledCharacter.mStyle.GetFontStyle(), styledCharacter.mStyle.GetFontPointSize() ) );
-      const Font::Metrics metrics = font.GetMetrics( character );
-      const float ascender = font.GetAscender();
+      const FontMetricsCache::FontId fontId = fontMetricsCache.GetFontId( styledCharacter.mStyle );
+      const FontMetricsCache::FontMetrics& fontMetrics = fontMetricsCache.GetFontMetrics( fontId );
+      const FontMetricsCache::GlyphMetrics& metrics = fontMetricsCache.GetGlyphMetrics( fontId, character );
+      const float ascender = fontMetrics.mAscender;
 
       // Create layout character info.
       CharacterLayoutInfo characterLayoutInfo;
 
       // Fill Natural size info for current character.
-      characterLayoutInfo.mHeight = font.GetLineHeight();
-      characterLayoutInfo.mAdvance = metrics.GetAdvance();
-      characterLayoutInfo.mBearing = metrics.GetBearing();
+      characterLayoutInfo.mHeight = fontMetrics.mLineHeight;
+      characterLayoutInfo.mAdvance = metrics.mAdvance;
+      characterLayoutInfo.mBearing = metrics.mBearing;
 
       if( character.IsNewLine() )
       {
@@ -140,8 +145,8 @@ void CreateWordTextInfo( const MarkupProcessor::StyledTextArray& word,
 
       if( styledCharacter.mStyle.GetUnderline() )
       {
-        characterLayoutInfo.mUnderlineThickness = font.GetUnderlineThickness(); // Both thickness and position includes the
-        characterLayoutInfo.mUnderlinePosition = font.GetUnderlinePosition();   // vertical pad adjust used in effects like glow or shadow.
+        characterLayoutInfo.mUnderlineThickness = fontMetrics.mUnderlineThickness; // Both thickness and position includes the
+        characterLayoutInfo.mUnderlinePosition = fontMetrics.mUnderlinePosition;   // vertical pad adjust used in effects like glow or shadow.
       }
 
       // stores the styled text.
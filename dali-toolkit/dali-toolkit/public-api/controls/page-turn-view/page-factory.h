@@ -70,6 +70,9 @@ public:
 
   /**
    * Create an actor to represent the page content.
+   * Page images can be loaded with ImageAttributes::SetProgressiveLoading(), so a low resolution
+   * version is shown while a page is turned in, and with ImageAttributes::SetCrop() to decode
+   * only the part of a large image which is shown on the page.
    * @param[in] pageId The ID of the page to create.
    * @return An actor, or an uninitialized pointer if the ID is out of range.
    */